@@ -320,6 +320,15 @@ AS_IF([test "x$with_avx" != xyes],
                                   int main(int argc, char** argv) { return _mm_popcnt_u32(0x101) - 2;
                                   }])
       ])
+AS_IF([test "x$with_avx" = xyes],
+      [COMPILER_CPU_OPTIMIZATION([f16c], [F16C], [-mf16c],
+                                 [#include <immintrin.h>
+                                  int main(int argc, char** argv) {
+                                      float f = _cvtsh_ss(_cvtss_sh(1.0f, 0));
+                                      return (int)f - 1;
+                                  }
+                                 ])
+      ])
 
 
 DETECT_UARCH()
@@ -17,6 +17,11 @@ ucc_base_coll_alg_info_t
             {.id   = UCC_CL_HIER_ALLGATHERV_ALG_GAB,
              .name = "gab",
              .desc = "gatherv + allgatherv + bcast"},
+        [UCC_CL_HIER_ALLGATHERV_ALG_SPLIT_RAIL] =
+            {.id   = UCC_CL_HIER_ALLGATHERV_ALG_SPLIT_RAIL,
+             .name = "split_rail",
+             .desc = "intra-node allgatherv, inter-node allgatherv striped "
+                     "across rails, intra-node allgatherv"},
         [UCC_CL_HIER_ALLGATHERV_ALG_LAST] = {
             .id = 0, .name = NULL, .desc = NULL}};
 
@@ -67,7 +72,9 @@ static inline ucc_status_t find_leader_rank(ucc_base_team_t *team,
 /* Check if the ranks are block ordered. If they aren't, we'll need to
    unpack the data after the allgatherv into the right position, even if the
    dst buffer is contiguous */
-static inline ucc_status_t is_block_ordered(ucc_cl_hier_team_t *cl_team, int *ordered)
+ucc_status_t
+ucc_cl_hier_allgatherv_is_block_ordered(ucc_cl_hier_team_t *cl_team,
+                                        int                *ordered)
 {
     ucc_topo_t  *topo             = cl_team->super.super.params.team->topo;
     ucc_sbgp_t  *all_nodes        = NULL;
@@ -178,7 +185,9 @@ UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_allgatherv_init,
     cl_schedule = ucc_derived_of(schedule, ucc_cl_hier_schedule_t);
 
     n_tasks   = 0;
-    UCC_CHECK_GOTO(is_block_ordered(cl_team, &block_ordered), free_sched, status);
+    UCC_CHECK_GOTO(ucc_cl_hier_allgatherv_is_block_ordered(cl_team,
+                                                          &block_ordered),
+                   free_sched, status);
     is_contig = block_ordered && ucc_coll_args_is_disp_contig(&args.args, team_size);
 
     /* handle the case where this rank may be the only one on this node */
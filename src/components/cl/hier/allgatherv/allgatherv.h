@@ -11,6 +11,7 @@
 enum
 {
     UCC_CL_HIER_ALLGATHERV_ALG_GAB,
+    UCC_CL_HIER_ALLGATHERV_ALG_SPLIT_RAIL,
     UCC_CL_HIER_ALLGATHERV_ALG_LAST,
 };
 
@@ -19,10 +20,21 @@ extern ucc_base_coll_alg_info_t
 
 #define UCC_CL_HIER_ALLGATHERV_DEFAULT_ALG_SELECT_STR "allgatherv:0-8m:host:@gab"
 
+#define UCC_CL_HIER_ALLGATHERV_MULTI_RAIL_ALG_SELECT_STR                       \
+    "allgatherv:256k-inf:host:@split_rail"
+
 ucc_status_t ucc_cl_hier_allgatherv_init(ucc_base_coll_args_t *coll_args,
                                         ucc_base_team_t       *team,
                                         ucc_coll_task_t      **task);
 
+ucc_status_t
+ucc_cl_hier_allgatherv_split_rail_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *team,
+                                       ucc_coll_task_t     **task);
+
+ucc_status_t ucc_cl_hier_allgatherv_is_block_ordered(ucc_cl_hier_team_t *team,
+                                                     int *ordered);
+
 static inline int ucc_cl_hier_allgatherv_alg_from_str(const char *str)
 {
     int i;
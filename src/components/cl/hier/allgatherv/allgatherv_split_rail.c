@@ -0,0 +1,313 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "allgatherv.h"
+#include "unpack.h"
+#include "../cl_hier_coll.h"
+#include "core/ucc_team.h"
+
+/* Data is gathered in a buffer packed by nodes, like in gab algorithm.
+   1. intra-node allgatherv: every node rank gets the data of its node
+   2. the packed buffer is split into one stripe per rail, the node rank
+      driving rail r runs in-place allgatherv of stripe r over its NET sbgp,
+      each node contributing the part of its data falling into the stripe
+   3. intra-node in-place allgatherv of the stripes from the rail drivers
+   4. unpack to the user layout if the packed buffer is a scratch */
+
+#define MAX_ALLGATHERV_SPLIT_RAIL_TASKS 4
+
+static ucc_status_t
+ucc_cl_hier_allgatherv_split_rail_start(ucc_coll_task_t *task)
+{
+    UCC_CL_HIER_PROFILE_REQUEST_EVENT(task,
+                                      "cl_hier_allgatherv_split_rail_start",
+                                      0);
+    return ucc_schedule_start(task);
+}
+
+static ucc_status_t
+ucc_cl_hier_allgatherv_split_rail_finalize(ucc_coll_task_t *task)
+{
+    ucc_cl_hier_schedule_t *cl_schedule = ucc_derived_of(task,
+                                                         ucc_cl_hier_schedule_t);
+    ucc_status_t            status;
+
+    UCC_CL_HIER_PROFILE_REQUEST_EVENT(task,
+                                      "cl_hier_allgatherv_split_rail_finalize",
+                                      0);
+    ucc_mc_free(cl_schedule->scratch);
+    status = ucc_schedule_finalize(task);
+    ucc_cl_hier_put_schedule(&cl_schedule->super.super);
+    return status;
+}
+
+/* Sets count and displacement of the intersection of [start, start + len)
+   with stripe [s_start, s_end) */
+static inline void stripe_part(size_t start, size_t len, size_t s_start,
+                               size_t s_end, uint64_t *count, uint64_t *displ)
+{
+    size_t b = ucc_max(start, s_start);
+    size_t e = ucc_min(start + len, s_end);
+
+    *displ = b;
+    *count = (e > b) ? e - b : 0;
+}
+
+UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_allgatherv_split_rail_init,
+                         (coll_args, team, task),
+                         ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
+                         ucc_coll_task_t **task)
+{
+    ucc_cl_hier_team_t     *cl_team   = ucc_derived_of(team,
+                                                       ucc_cl_hier_team_t);
+    ucc_team_t             *core_team = team->params.team;
+    ucc_coll_args_t        *uargs     = &coll_args->args;
+    ucc_rank_t              rank      = UCC_CL_TEAM_RANK(cl_team);
+    ucc_rank_t              team_size = UCC_CL_TEAM_SIZE(cl_team);
+    ucc_rank_t              n_rails   = cl_team->n_rails;
+    size_t                  dt_size   = ucc_dt_size(uargs->dst.info_v.datatype);
+    int                     in_place  = UCC_IS_INPLACE(*uargs);
+    ucc_coll_task_t        *tasks[MAX_ALLGATHERV_SPLIT_RAIL_TASKS] = {NULL};
+    int                     n_tasks   = 0;
+    ucc_rank_t             *node_of_host = NULL;
+    ucc_sbgp_t             *nodes;
+    ucc_sbgp_t             *net;
+    ucc_schedule_t         *schedule;
+    ucc_cl_hier_schedule_t *cl_schedule;
+    ucc_base_coll_args_t    args;
+    ucc_status_t            status;
+    ucc_count_t            *leader_counts;
+    ucc_aint_t             *leader_disps;
+    uint64_t               *node_counts, *node_disps, *rail_counts,
+                           *rail_disps, *net_counts, *net_disps;
+    ucc_rank_t              node_size, my_node, i, k, r;
+    size_t                  total_count, scratch_size, offset, count;
+    size_t                  s_start, s_end;
+    void                   *buffer;
+    int                     n_nodes, block_ordered, is_contig;
+
+    if (!UCC_CL_HIER_MULTI_RAIL(cl_team) ||
+        !SBGP_EXISTS(cl_team, NODE_LEADERS) ||
+        uargs->dst.info_v.mem_type != UCC_MEMORY_TYPE_HOST ||
+        (!in_place && uargs->src.info.mem_type != UCC_MEMORY_TYPE_HOST) ||
+        UCC_IS_PERSISTENT(*uargs)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    status = ucc_topo_get_all_nodes(core_team->topo, &nodes, &n_nodes);
+    if (UCC_OK != status) {
+        return status;
+    }
+    status = ucc_cl_hier_allgatherv_is_block_ordered(cl_team, &block_ordered);
+    if (UCC_OK != status) {
+        return status;
+    }
+    is_contig   = block_ordered &&
+                  ucc_coll_args_is_disp_contig(uargs, team_size);
+    node_size   = SBGP_SIZE(cl_team, NODE);
+    net         = cl_team->sbgps[UCC_HIER_SBGP_NET].sbgp;
+    total_count = ucc_coll_args_get_total_count(uargs, uargs->dst.info_v.counts,
+                                                team_size);
+
+    schedule = &ucc_cl_hier_get_schedule(cl_team)->super.super;
+    if (ucc_unlikely(!schedule)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    cl_schedule = ucc_derived_of(schedule, ucc_cl_hier_schedule_t);
+    UCC_CHECK_GOTO(ucc_schedule_init(schedule, coll_args, team), free_sched,
+                   status);
+
+    scratch_size = n_nodes * (sizeof(ucc_count_t) + sizeof(ucc_aint_t) +
+                              2 * sizeof(uint64_t)) +
+                   node_size * 4 * sizeof(uint64_t) +
+                   (is_contig ? 0 : total_count * dt_size);
+    UCC_CHECK_GOTO(ucc_mc_alloc(&cl_schedule->scratch, scratch_size,
+                                UCC_MEMORY_TYPE_HOST),
+                   free_sched, status);
+    memset(cl_schedule->scratch->addr, 0, scratch_size - (is_contig ? 0 :
+           total_count * dt_size));
+    leader_counts = cl_schedule->scratch->addr;
+    leader_disps  = PTR_OFFSET(leader_counts, n_nodes * sizeof(ucc_count_t));
+    net_counts    = PTR_OFFSET(leader_disps, n_nodes * sizeof(ucc_aint_t));
+    net_disps     = net_counts + n_nodes;
+    node_counts   = net_disps + n_nodes;
+    node_disps    = node_counts + node_size;
+    rail_counts   = node_disps + node_size;
+    rail_disps    = rail_counts + node_size;
+    buffer        = is_contig ? uargs->dst.info_v.buffer
+                              : (void *)(rail_disps + node_size);
+
+    node_of_host = ucc_malloc(core_team->topo->topo->nnodes *
+                              sizeof(ucc_rank_t), "node_of_host");
+    if (ucc_unlikely(!node_of_host)) {
+        cl_error(team->context->lib,
+                 "failed to allocate %zd bytes for node_of_host",
+                 core_team->topo->topo->nnodes * sizeof(ucc_rank_t));
+        status = UCC_ERR_NO_MEMORY;
+        goto free_scratch;
+    }
+
+    /* packed layout: data of node i (all_nodes order) at leader_disps[i],
+       ranks of the node in the order of their NODE sbgp */
+    offset  = 0;
+    my_node = 0;
+    for (i = 0; i < n_nodes; i++) {
+        ucc_assert(nodes[i].group_size == node_size);
+        node_of_host[ucc_team_rank_host_id(ucc_ep_map_eval(nodes[i].map, 0),
+                                           core_team)] = i;
+        count = 0;
+        for (k = 0; k < node_size; k++) {
+            count += ucc_coll_args_get_count(uargs, uargs->dst.info_v.counts,
+                                             ucc_ep_map_eval(nodes[i].map, k));
+        }
+        ucc_coll_args_set_count(uargs, leader_counts, i, count);
+        ucc_coll_args_set_displacement(uargs, leader_disps, i, offset);
+        if (ucc_team_ranks_on_same_node(ucc_ep_map_eval(nodes[i].map, 0),
+                                        rank, core_team)) {
+            my_node = i;
+        }
+        offset += count;
+    }
+
+    /* 1. intra-node allgatherv into the packed segment of the node */
+    offset = 0;
+    for (k = 0; k < node_size; k++) {
+        node_counts[k] = ucc_coll_args_get_count(uargs,
+                                                 uargs->dst.info_v.counts,
+                                                 ucc_ep_map_eval(
+                                                     SBGP_MAP(cl_team, NODE),
+                                                     k));
+        node_disps[k]  = offset;
+        offset        += node_counts[k];
+    }
+    args                                = *coll_args;
+    args.args.coll_type                 = UCC_COLL_TYPE_ALLGATHERV;
+    args.args.mask                     |= UCC_COLL_ARGS_FIELD_FLAGS;
+    args.args.flags                    &= ~UCC_COLL_ARGS_FLAG_IN_PLACE;
+    args.args.flags                    |= UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+                                          UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT;
+    args.args.dst.info_v.buffer         =
+        PTR_OFFSET(buffer, dt_size * ucc_coll_args_get_displacement(
+                                         uargs, leader_disps, my_node));
+    args.args.dst.info_v.counts         = node_counts;
+    args.args.dst.info_v.displacements  = node_disps;
+    if (in_place && is_contig) {
+        /* own data is already in its packed position */
+        args.args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+    } else if (in_place) {
+        args.args.src.info.buffer   =
+            PTR_OFFSET(uargs->dst.info_v.buffer,
+                       dt_size * ucc_coll_args_get_displacement(
+                                     uargs, uargs->dst.info_v.displacements,
+                                     rank));
+        args.args.src.info.count    =
+            ucc_coll_args_get_count(uargs, uargs->dst.info_v.counts, rank);
+        args.args.src.info.datatype = uargs->dst.info_v.datatype;
+        args.args.src.info.mem_type = uargs->dst.info_v.mem_type;
+    }
+    UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NODE), &args,
+                                 &tasks[n_tasks]),
+                   free_scratch, status);
+    n_tasks++;
+
+    /* 2. inter-node allgatherv of the stripe of the rail */
+    if (cl_team->my_rail >= 0) {
+        s_start = ucc_buffer_block_offset(total_count, n_rails,
+                                          cl_team->my_rail);
+        s_end   = s_start + ucc_buffer_block_count(total_count, n_rails,
+                                                   cl_team->my_rail);
+        for (i = 0; i < net->group_size; i++) {
+            k = node_of_host[ucc_team_rank_host_id(
+                ucc_ep_map_eval(net->map, i), core_team)];
+            stripe_part(ucc_coll_args_get_displacement(uargs, leader_disps, k),
+                        ucc_coll_args_get_count(uargs, leader_counts, k),
+                        s_start, s_end, &net_counts[i], &net_disps[i]);
+        }
+        args                                = *coll_args;
+        args.args.coll_type                 = UCC_COLL_TYPE_ALLGATHERV;
+        args.args.mask                     |= UCC_COLL_ARGS_FIELD_FLAGS;
+        args.args.flags                    |=
+            UCC_COLL_ARGS_FLAG_IN_PLACE | UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+            UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT;
+        args.args.dst.info_v.buffer         = buffer;
+        args.args.dst.info_v.counts         = net_counts;
+        args.args.dst.info_v.displacements  = net_disps;
+        UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NET), &args,
+                                     &tasks[n_tasks]),
+                       free_scratch, status);
+        n_tasks++;
+    }
+
+    /* 3. intra-node allgatherv of the stripes */
+    for (r = 0; r < n_rails; r++) {
+        rail_counts[cl_team->rail_drivers[r]] =
+            ucc_buffer_block_count(total_count, n_rails, r);
+        rail_disps[cl_team->rail_drivers[r]]  =
+            ucc_buffer_block_offset(total_count, n_rails, r);
+    }
+    args                                = *coll_args;
+    args.args.coll_type                 = UCC_COLL_TYPE_ALLGATHERV;
+    args.args.mask                     |= UCC_COLL_ARGS_FIELD_FLAGS;
+    args.args.flags                    |=
+        UCC_COLL_ARGS_FLAG_IN_PLACE | UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+        UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT;
+    args.args.dst.info_v.buffer         = buffer;
+    args.args.dst.info_v.counts         = rail_counts;
+    args.args.dst.info_v.displacements  = rail_disps;
+    UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NODE), &args,
+                                 &tasks[n_tasks]),
+                   free_scratch, status);
+    n_tasks++;
+
+    /* 4. unpack */
+    if (!is_contig) {
+        args                               = *coll_args;
+        args.args.src.info_v.datatype      = uargs->dst.info_v.datatype;
+        args.args.src.info_v.mem_type      = uargs->dst.info_v.mem_type;
+        args.args.src.info_v.buffer        = buffer;
+        args.args.src.info_v.displacements = leader_disps;
+        args.args.src.info_v.counts        = leader_counts;
+        UCC_CHECK_GOTO(ucc_cl_hier_allgatherv_unpack_init(&args, team,
+                                                          &tasks[n_tasks]),
+                       free_scratch, status);
+        n_tasks++;
+    }
+    ucc_free(node_of_host);
+    node_of_host = NULL;
+
+    UCC_CHECK_GOTO(ucc_task_subscribe_dep(&schedule->super, tasks[0],
+                                          UCC_EVENT_SCHEDULE_STARTED),
+                   free_scratch, status);
+    UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[0]), free_scratch,
+                   status);
+    for (i = 1; i < n_tasks; i++) {
+        UCC_CHECK_GOTO(ucc_task_subscribe_dep(tasks[i - 1], tasks[i],
+                                              UCC_EVENT_COMPLETED),
+                       free_scratch, status);
+        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[i]),
+                       free_scratch, status);
+    }
+
+    if (!is_contig) {
+        schedule->super.flags |= UCC_COLL_TASK_FLAG_EXECUTOR;
+    }
+    schedule->super.post     = ucc_cl_hier_allgatherv_split_rail_start;
+    schedule->super.finalize = ucc_cl_hier_allgatherv_split_rail_finalize;
+    *task                    = &schedule->super;
+    return UCC_OK;
+
+free_scratch:
+    ucc_free(node_of_host);
+    ucc_mc_free(cl_schedule->scratch);
+free_sched:
+    for (i = 0; i < n_tasks; i++) {
+        tasks[i]->finalize(tasks[i]);
+    }
+    ucc_cl_hier_put_schedule(schedule);
+    cl_error(team->context->lib, "failed to init cl hier split_rail "
+             "allgatherv");
+    return status;
+}
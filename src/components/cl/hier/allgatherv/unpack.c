@@ -6,6 +6,13 @@
 
 #include "unpack.h"
 
+/* Scratch holds n_tasks, the executor tasks and the copy list */
+#define UNPACK_TASKS(_scratch)                                                 \
+    ((ucc_ee_executor_task_t **)PTR_OFFSET((_scratch)->addr,                   \
+                                           sizeof(ucc_ee_executor_task_t *)))
+#define UNPACK_ENTRIES(_scratch, _team_size)                                   \
+    ((ucc_eee_sg_copy_entry_t *)(UNPACK_TASKS(_scratch) + (_team_size)))
+
 ucc_status_t ucc_cl_hier_allgatherv_unpack_finalize(ucc_coll_task_t *task)
 {
     ucc_cl_hier_schedule_t *cl_schedule = ucc_derived_of(task,
@@ -23,9 +30,7 @@ void ucc_cl_hier_allgatherv_unpack_progress(ucc_coll_task_t *task)
     ucc_cl_hier_schedule_t  *cl_schedule = ucc_derived_of(schedule,
                                                           ucc_cl_hier_schedule_t);
     ucc_rank_t              *n_tasks     = cl_schedule->scratch->addr;
-    ucc_ee_executor_task_t **tasks       = PTR_OFFSET(
-                                                cl_schedule->scratch->addr,
-                                                sizeof(ucc_rank_t));
+    ucc_ee_executor_task_t **tasks       = UNPACK_TASKS(cl_schedule->scratch);
     ucc_status_t             st          = UCC_OK;
     ucc_rank_t               i;
     ucc_ee_executor_task_t  *etask;
@@ -50,6 +55,52 @@ out:
     schedule->super.status       = st;
 }
 
+/* The host executor takes all the copies as one scatter-gather task, other
+   executors in batches of UCC_EE_EXECUTOR_MULTI_OP_NUM_BUFS */
+static ucc_status_t
+ucc_cl_hier_allgatherv_unpack_post(ucc_ee_executor_t        *exec,
+                                   ucc_eee_sg_copy_entry_t  *entries,
+                                   ucc_rank_t                n_entries,
+                                   ucc_ee_executor_task_t  **tasks,
+                                   ucc_rank_t               *n_tasks)
+{
+    ucc_ee_executor_task_args_t eargs = {0};
+    ucc_status_t                status;
+    ucc_rank_t                  i, j, n;
+
+    *n_tasks = 0;
+    if (n_entries == 0) {
+        return UCC_OK;
+    }
+    if (exec->ee_type == UCC_EE_CPU_THREAD) {
+        eargs.task_type         = UCC_EE_EXECUTOR_TASK_COPY_SG;
+        eargs.copy_sg.entries   = entries;
+        eargs.copy_sg.n_entries = n_entries;
+        status = ucc_ee_executor_task_post(exec, &eargs, &tasks[0]);
+        if (ucc_likely(status == UCC_OK)) {
+            *n_tasks = 1;
+        }
+        return status;
+    }
+
+    eargs.task_type = UCC_EE_EXECUTOR_TASK_COPY_MULTI;
+    for (i = 0; i < n_entries; i += n) {
+        n = ucc_min(n_entries - i, UCC_EE_EXECUTOR_MULTI_OP_NUM_BUFS);
+        for (j = 0; j < n; j++) {
+            eargs.copy_multi.src[j]    = entries[i + j].src;
+            eargs.copy_multi.dst[j]    = entries[i + j].dst;
+            eargs.copy_multi.counts[j] = entries[i + j].len;
+        }
+        eargs.copy_multi.num_vectors = n;
+        status = ucc_ee_executor_task_post(exec, &eargs, &tasks[*n_tasks]);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+        (*n_tasks)++;
+    }
+    return UCC_OK;
+}
+
 ucc_status_t ucc_cl_hier_allgatherv_unpack_start(ucc_coll_task_t *task)
 {
     ucc_schedule_t             *schedule          = ucc_derived_of(task,
@@ -58,13 +109,14 @@ ucc_status_t ucc_cl_hier_allgatherv_unpack_start(ucc_coll_task_t *task)
                                                         ucc_cl_hier_team_t);
     ucc_rank_t                  team_size         = UCC_CL_TEAM_SIZE(cl_team);
     ucc_coll_args_t            *args              = &task->bargs.args;
-    ucc_ee_executor_task_args_t eargs             = {0};
     ucc_cl_hier_schedule_t     *cl_schedule       = ucc_derived_of(schedule,
                                                         ucc_cl_hier_schedule_t);
     ucc_rank_t                 *n_tasks           = cl_schedule->scratch->addr;
-    ucc_ee_executor_task_t    **tasks             = PTR_OFFSET(
-                                                    cl_schedule->scratch->addr,
-                                                sizeof(ucc_rank_t));
+    ucc_ee_executor_task_t    **tasks             = UNPACK_TASKS(
+                                                    cl_schedule->scratch);
+    ucc_eee_sg_copy_entry_t    *entries           = UNPACK_ENTRIES(
+                                                    cl_schedule->scratch,
+                                                    team_size);
     size_t                      src_dt_size       = ucc_dt_size(
                                                     args->src.info_v.datatype);
     size_t                      dst_dt_size       = ucc_dt_size(
@@ -75,7 +127,7 @@ ucc_status_t ucc_cl_hier_allgatherv_unpack_start(ucc_coll_task_t *task)
     ucc_topo_t                 *topo              = task->team->params.team->topo;
     ucc_ee_executor_t          *exec;
     ucc_status_t                status;
-    ucc_rank_t                  i;
+    ucc_rank_t                  i, n_entries;
     size_t                      dst_rank_count;
     size_t                      dst_rank_disp;
     ucc_rank_t                  curr_team_rank;
@@ -86,9 +138,9 @@ ucc_status_t ucc_cl_hier_allgatherv_unpack_start(ucc_coll_task_t *task)
     UCC_CHECK_GOTO(
         ucc_coll_task_get_executor(&schedule->super, &exec),
         out, status);
-    eargs.task_type = UCC_EE_EXECUTOR_TASK_COPY;
 
-    *n_tasks = 0;
+    *n_tasks  = 0;
+    n_entries = 0;
 
     // Get the node leaders
     UCC_CHECK_GOTO(
@@ -140,20 +192,23 @@ ucc_status_t ucc_cl_hier_allgatherv_unpack_start(ucc_coll_task_t *task)
                                 curr_team_rank);
         }
         
-        eargs.copy.src = PTR_OFFSET(args->src.info_v.buffer,
-                                    src_rank_disp * src_dt_size);
-        eargs.copy.dst = PTR_OFFSET(args->dst.info_v.buffer,
-                                    dst_rank_disp * dst_dt_size);
-        eargs.copy.len = dst_rank_count * dst_dt_size;
-        
-        if (eargs.copy.src != eargs.copy.dst) {
-            UCC_CHECK_GOTO(
-                ucc_ee_executor_task_post(exec, &eargs, &tasks[*n_tasks]),
-                out, status);
-            (*n_tasks)++;
+        entries[n_entries].src = PTR_OFFSET(args->src.info_v.buffer,
+                                            src_rank_disp * src_dt_size);
+        entries[n_entries].dst = PTR_OFFSET(args->dst.info_v.buffer,
+                                            dst_rank_disp * dst_dt_size);
+        entries[n_entries].len = dst_rank_count * dst_dt_size;
+
+        if (entries[n_entries].src != entries[n_entries].dst &&
+            entries[n_entries].len != 0) {
+            n_entries++;
         }
     }
 
+    UCC_CHECK_GOTO(
+        ucc_cl_hier_allgatherv_unpack_post(exec, entries, n_entries, tasks,
+                                           n_tasks),
+        out, status);
+
     schedule->super.status = UCC_INPROGRESS;
 
     ucc_progress_queue_enqueue(cl_team->super.super.context->ucc_context->pq,
@@ -184,8 +239,10 @@ ucc_status_t ucc_cl_hier_allgatherv_unpack_init(ucc_base_coll_args_t *coll_args,
     UCC_CHECK_GOTO(
         ucc_schedule_init(schedule, coll_args, team), free_schedule, status);
 
-    /* Holds n_tasks and n_tasks # of ucc_ee_executor_task_t pointers */
-    scratch_size = sizeof(ucc_rank_t) + team_size * sizeof(ucc_ee_executor_task_t*);
+    /* Holds n_tasks, up to team_size executor tasks and the copy list */
+    scratch_size = sizeof(ucc_ee_executor_task_t *) +
+                   team_size * (sizeof(ucc_ee_executor_task_t *) +
+                                sizeof(ucc_eee_sg_copy_entry_t));
     UCC_CHECK_GOTO(
         ucc_mc_alloc(&cl_schedule->scratch, scratch_size, UCC_MEMORY_TYPE_HOST),
         free_schedule, status);
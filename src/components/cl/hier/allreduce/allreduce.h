@@ -20,6 +20,9 @@ extern ucc_base_coll_alg_info_t
 
 #define UCC_CL_HIER_ALLREDUCE_DEFAULT_ALG_SELECT_STR "allreduce:0-4k:@rab"
 
+#define UCC_CL_HIER_ALLREDUCE_MULTI_RAIL_ALG_SELECT_STR                        \
+    "allreduce:256k-inf:@split_rail"
+
 ucc_status_t ucc_cl_hier_allreduce_rab_init(ucc_base_coll_args_t *coll_args,
                                             ucc_base_team_t      *team,
                                             ucc_coll_task_t     **task);
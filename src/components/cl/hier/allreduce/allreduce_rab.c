@@ -7,7 +7,7 @@
 #include "allreduce.h"
 #include "../cl_hier_coll.h"
 
-#define MAX_AR_RAB_TASKS 3
+#define MAX_AR_RAB_TASKS 5
 
 static ucc_status_t ucc_cl_hier_allreduce_rab_start(ucc_coll_task_t *task)
 {
@@ -42,12 +42,9 @@ static ucc_status_t
 ucc_cl_hier_allreduce_rab_frag_setup(ucc_schedule_pipelined_t *schedule_p,
                                      ucc_schedule_t *frag, int frag_num)
 {
-    ucc_cl_hier_team_t *cl_team =
-        ucc_derived_of(schedule_p->super.super.team, ucc_cl_hier_team_t);
     ucc_coll_args_t *args    = &schedule_p->super.super.bargs.args;
     size_t           dt_size = ucc_dt_size(args->dst.info.datatype);
     int              n_frags = schedule_p->super.n_tasks;
-    int              inplace = UCC_IS_INPLACE(*args);
     size_t           frag_count, frag_offset;
     ucc_coll_task_t *task;
     int              i;
@@ -63,9 +60,11 @@ ucc_cl_hier_allreduce_rab_frag_setup(ucc_schedule_pipelined_t *schedule_p,
         task->bargs.args.dst.info.count  = frag_count;
         task->bargs.args.dst.info.buffer =
             PTR_OFFSET(args->dst.info.buffer, frag_offset * dt_size);
+        /* in-place tasks work on the dst of the allreduce, with several
+           intra-node levels that also holds for intermediate reduce tasks */
         if ((task->bargs.args.coll_type == UCC_COLL_TYPE_BCAST) ||
-            (task->bargs.args.coll_type == UCC_COLL_TYPE_REDUCE && inplace &&
-             (SBGP_RANK(cl_team, NODE) != args->root))) {
+            (task->bargs.args.coll_type == UCC_COLL_TYPE_REDUCE &&
+             UCC_IS_INPLACE(task->bargs.args))) {
             task->bargs.args.src.info.buffer =
                 PTR_OFFSET(args->dst.info.buffer, frag_offset * dt_size);
         } else {
@@ -83,10 +82,13 @@ ucc_cl_hier_allreduce_rab_init_schedule(ucc_base_coll_args_t *coll_args,
 {
     ucc_cl_hier_team_t  *cl_team = ucc_derived_of(team, ucc_cl_hier_team_t);
     ucc_coll_task_t     *tasks[MAX_AR_RAB_TASKS] = {NULL};
+    ucc_hier_sbgp_type_t levels[2];
+    int                  n_levels = 0;
+    ucc_hier_sbgp_t     *hs;
     ucc_schedule_t      *schedule;
     ucc_status_t         status;
     ucc_base_coll_args_t args;
-    int                  n_tasks, i;
+    int                  n_tasks, i, l;
 
     schedule = &ucc_cl_hier_get_schedule(cl_team)->super.super;
     if (ucc_unlikely(!schedule)) {
@@ -106,20 +108,29 @@ ucc_cl_hier_allreduce_rab_init_schedule(ucc_base_coll_args_t *coll_args,
     ucc_assert(SBGP_ENABLED(cl_team, NODE) ||
                SBGP_ENABLED(cl_team, NODE_LEADERS));
 
-    if (SBGP_ENABLED(cl_team, NODE)) {
-        ucc_assert(n_tasks == 0);
-        if (cl_team->top_sbgp == UCC_HIER_SBGP_NODE) {
+    /* intra-node levels bottom-up */
+    if (cl_team->node_split) {
+        levels[n_levels++] = UCC_HIER_SBGP_SOCKET;
+        levels[n_levels++] = UCC_HIER_SBGP_SOCKET_LEADERS;
+    } else {
+        levels[n_levels++] = UCC_HIER_SBGP_NODE;
+    }
+
+    for (l = 0; l < n_levels; l++) {
+        hs = &cl_team->sbgps[levels[l]];
+        if (hs->state != UCC_HIER_SBGP_ENABLED) {
+            continue;
+        }
+        if (cl_team->top_sbgp == levels[l]) {
             args.args.coll_type = UCC_COLL_TYPE_ALLREDUCE;
         } else {
             args.args.coll_type = UCC_COLL_TYPE_REDUCE;
-            if (UCC_IS_INPLACE(args.args) &&
-                (SBGP_RANK(cl_team, NODE) != args.args.root)) {
+            if (UCC_IS_INPLACE(args.args)) {
                 args.args.src.info = args.args.dst.info;
             }
         }
-        UCC_CHECK_GOTO(
-            ucc_coll_init(SCORE_MAP(cl_team, NODE), &args, &tasks[n_tasks]),
-            out, status);
+        UCC_CHECK_GOTO(ucc_coll_init(hs->score_map, &args, &tasks[n_tasks]),
+                       out, status);
         n_tasks++;
         args.args.mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
         args.args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
@@ -134,15 +145,17 @@ ucc_cl_hier_allreduce_rab_init_schedule(ucc_base_coll_args_t *coll_args,
         n_tasks++;
     }
 
-
-    if (SBGP_ENABLED(cl_team, NODE) &&
-        cl_team->top_sbgp != UCC_HIER_SBGP_NODE) {
+    for (l = n_levels - 1; l >= 0; l--) {
+        hs = &cl_team->sbgps[levels[l]];
+        if (hs->state != UCC_HIER_SBGP_ENABLED ||
+            cl_team->top_sbgp == levels[l]) {
+            continue;
+        }
         /* For bcast src should point to origin dst of allreduce */
         args.args.src.info  = args.args.dst.info;
         args.args.coll_type = UCC_COLL_TYPE_BCAST;
-        UCC_CHECK_GOTO(
-            ucc_coll_init(SCORE_MAP(cl_team, NODE), &args, &tasks[n_tasks]),
-            out, status);
+        UCC_CHECK_GOTO(ucc_coll_init(hs->score_map, &args, &tasks[n_tasks]),
+                       out, status);
         n_tasks++;
     }
 
@@ -13,5 +13,10 @@ ucc_base_coll_alg_info_t
             {.id   = UCC_CL_HIER_BCAST_ALG_2STEP,
              .name = "2step",
              .desc = "intra-node and inter-node bcasts executed in parallel"},
+        [UCC_CL_HIER_BCAST_ALG_SPLIT_RAIL] =
+            {.id   = UCC_CL_HIER_BCAST_ALG_SPLIT_RAIL,
+             .name = "split_rail",
+             .desc = "inter-node bcast striped across rails, followed by "
+                     "intra-node allgather"},
         [UCC_CL_HIER_BCAST_ALG_LAST] = {
             .id = 0, .name = NULL, .desc = NULL}};
@@ -11,6 +11,7 @@
 enum
 {
     UCC_CL_HIER_BCAST_ALG_2STEP,
+    UCC_CL_HIER_BCAST_ALG_SPLIT_RAIL,
     UCC_CL_HIER_BCAST_ALG_LAST,
 };
 
@@ -19,10 +20,16 @@ extern ucc_base_coll_alg_info_t
 
 #define UCC_CL_HIER_BCAST_DEFAULT_ALG_SELECT_STR "bcast:0-4k:@2step"
 
+#define UCC_CL_HIER_BCAST_MULTI_RAIL_ALG_SELECT_STR "bcast:256k-inf:@split_rail"
+
 ucc_status_t ucc_cl_hier_bcast_2step_init(ucc_base_coll_args_t *coll_args,
                                           ucc_base_team_t      *team,
                                           ucc_coll_task_t     **task);
 
+ucc_status_t ucc_cl_hier_bcast_split_rail_init(ucc_base_coll_args_t *coll_args,
+                                               ucc_base_team_t      *team,
+                                               ucc_coll_task_t     **task);
+
 static inline int ucc_cl_hier_bcast_alg_from_str(const char *str)
 {
     int i;
@@ -8,6 +8,8 @@
 #include "core/ucc_team.h"
 #include "../cl_hier_coll.h"
 
+#define MAX_BCAST_2STEP_TASKS 3
+
 static ucc_status_t ucc_cl_hier_bcast_2step_start(ucc_coll_task_t *task)
 {
     UCC_CL_HIER_PROFILE_REQUEST_EVENT(task, "cl_hier_bcast_2step_start", 0);
@@ -79,20 +81,6 @@ find_root_net_rank(ucc_host_id_t root_host_id, ucc_cl_hier_team_t *cl_team)
     return UCC_RANK_INVALID;
 }
 
-static inline ucc_rank_t
-find_root_node_rank(ucc_rank_t root, ucc_cl_hier_team_t *cl_team)
-{
-    ucc_sbgp_t *sbgp       = cl_team->sbgps[UCC_HIER_SBGP_NODE].sbgp;
-    ucc_rank_t  i;
-
-    for (i = 0; i < sbgp->group_size; i++) {
-        if (ucc_ep_map_eval(sbgp->map, i) == root) {
-            return i;
-        }
-    }
-    return UCC_RANK_INVALID;
-}
-
 static ucc_status_t
 ucc_cl_hier_bcast_2step_init_schedule(ucc_base_coll_args_t *coll_args,
                                       ucc_base_team_t      *team,
@@ -100,14 +88,18 @@ ucc_cl_hier_bcast_2step_init_schedule(ucc_base_coll_args_t *coll_args,
 {
     ucc_cl_hier_team_t *cl_team   = ucc_derived_of(team, ucc_cl_hier_team_t);
     ucc_team_t         *core_team = team->params.team;
-    ucc_coll_task_t    *tasks[2]  = {NULL, NULL};
+    ucc_coll_task_t    *tasks[MAX_BCAST_2STEP_TASKS] = {NULL};
     ucc_rank_t root               = coll_args->args.root;
     ucc_rank_t rank               = UCC_TL_TEAM_RANK(cl_team);
     int root_on_local_node        = ucc_team_ranks_on_same_node(root, rank,
                                                                 core_team);
     ucc_base_coll_args_t args       = *coll_args;
     int                  n_tasks    = 0;
-    int                  first_task = 0;
+    int                  recv_task  = -1;
+    ucc_hier_sbgp_type_t levels[MAX_BCAST_2STEP_TASKS];
+    ucc_rank_t           roots[MAX_BCAST_2STEP_TASKS];
+    int                  n_levels   = 0;
+    ucc_hier_sbgp_t     *hs;
     ucc_schedule_t      *schedule;
     ucc_status_t         status;
     int                  i;
@@ -129,52 +121,69 @@ ucc_cl_hier_bcast_2step_init_schedule(ucc_base_coll_args_t *coll_args,
 
     ucc_assert(SBGP_ENABLED(cl_team, NODE_LEADERS) ||
                SBGP_ENABLED(cl_team, NODE));
+    /* enabled levels top-down, root of every level is its member closest
+       to the original root */
     if (SBGP_ENABLED(cl_team, NODE_LEADERS)) {
-        args.args.root = find_root_net_rank(
+        levels[n_levels]  = UCC_HIER_SBGP_NODE_LEADERS;
+        roots[n_levels++] = find_root_net_rank(
             ucc_team_rank_host_id(root, core_team), cl_team);
-        status = ucc_coll_init(SCORE_MAP(cl_team, NODE_LEADERS), &args,
-                               &tasks[n_tasks]);
-        if (ucc_unlikely(UCC_OK != status)) {
-            goto out;
+    }
+    if (cl_team->node_split) {
+        if (SBGP_ENABLED(cl_team, SOCKET_LEADERS)) {
+            levels[n_levels]  = UCC_HIER_SBGP_SOCKET_LEADERS;
+            roots[n_levels++] = ucc_cl_hier_socket_leaders_root(cl_team,
+                                                                root);
         }
-        n_tasks++;
-        if (root_on_local_node && (root != rank)) {
-            first_task = 1;
+        if (SBGP_ENABLED(cl_team, SOCKET)) {
+            levels[n_levels]  = UCC_HIER_SBGP_SOCKET;
+            roots[n_levels++] = ucc_cl_hier_socket_root(cl_team, root);
         }
+    } else if (SBGP_ENABLED(cl_team, NODE)) {
+        levels[n_levels]  = UCC_HIER_SBGP_NODE;
+        roots[n_levels++] = root_on_local_node
+            ? ucc_cl_hier_sbgp_rank(cl_team, UCC_HIER_SBGP_NODE, root)
+            : core_team->topo->node_leader_rank_id;
     }
 
-    if (SBGP_ENABLED(cl_team, NODE)) {
-        args.args.root = root_on_local_node
-            ? find_root_node_rank(root, cl_team)
-            : core_team->topo->node_leader_rank_id;
-        status =
-            ucc_coll_init(SCORE_MAP(cl_team, NODE), &args, &tasks[n_tasks]);
+    for (i = 0; i < n_levels; i++) {
+        hs             = &cl_team->sbgps[levels[i]];
+        args.args.root = roots[i];
+        status = ucc_coll_init(hs->score_map, &args, &tasks[n_tasks]);
         if (ucc_unlikely(UCC_OK != status)) {
             goto out;
         }
+        if (hs->sbgp->group_rank != roots[i]) {
+            /* every rank except the root receives data on exactly one level
+               and forwards it on the others */
+            ucc_assert(recv_task == -1);
+            recv_task = n_tasks;
+        }
         n_tasks++;
     }
 
-    UCC_CHECK_GOTO(ucc_task_subscribe_dep(&schedule->super, tasks[first_task],
+    if (recv_task == -1) {
+        ucc_assert(root == rank);
+        recv_task = 0;
+    }
+    UCC_CHECK_GOTO(ucc_task_subscribe_dep(&schedule->super, tasks[recv_task],
                                           UCC_EVENT_SCHEDULE_STARTED),
                    out, status);
-    UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[first_task]),
+    UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[recv_task]),
                    out, status);
-    if (n_tasks > 1) {
+    for (i = 0; i < n_tasks; i++) {
+        if (i == recv_task) {
+            continue;
+        }
         if (root == rank) {
-            UCC_CHECK_GOTO(ucc_task_subscribe_dep(&schedule->super,
-                                                  tasks[(first_task + 1) % 2],
+            UCC_CHECK_GOTO(ucc_task_subscribe_dep(&schedule->super, tasks[i],
                                                   UCC_EVENT_SCHEDULE_STARTED),
                            out, status);
         } else {
-            UCC_CHECK_GOTO(ucc_task_subscribe_dep(tasks[first_task],
-                                                  tasks[(first_task + 1) % 2],
+            UCC_CHECK_GOTO(ucc_task_subscribe_dep(tasks[recv_task], tasks[i],
                                                   UCC_EVENT_COMPLETED),
-                            out, status);
+                           out, status);
         }
-        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule,
-                                             tasks[(first_task + 1) % 2]),
-                       out, status);
+        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[i]), out, status);
     }
 
     schedule->super.post           = ucc_cl_hier_bcast_2step_start;
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "bcast.h"
+#include "core/ucc_team.h"
+#include "../cl_hier_coll.h"
+
+/* The buffer is split into one stripe per rail. The node rank driving rail r
+   broadcasts stripe r over its NET sbgp, so all the rails carry inter-node
+   traffic concurrently. On the root node the buffer is first broadcast
+   within the node, on the other nodes the stripes received by the rail
+   drivers are exchanged with in-place allgatherv. */
+
+#define MAX_BCAST_SPLIT_RAIL_TASKS 2
+
+static ucc_status_t ucc_cl_hier_bcast_split_rail_start(ucc_coll_task_t *task)
+{
+    UCC_CL_HIER_PROFILE_REQUEST_EVENT(task, "cl_hier_bcast_split_rail_start",
+                                      0);
+    return ucc_schedule_start(task);
+}
+
+static ucc_status_t
+ucc_cl_hier_bcast_split_rail_finalize(ucc_coll_task_t *task)
+{
+    ucc_cl_hier_schedule_t *schedule =
+        ucc_derived_of(task, ucc_cl_hier_schedule_t);
+    ucc_status_t status;
+
+    UCC_CL_HIER_PROFILE_REQUEST_EVENT(task,
+                                      "cl_hier_bcast_split_rail_finalize", 0);
+    status = ucc_schedule_finalize(task);
+    ucc_free(schedule->bcast_split_rail.counts);
+    ucc_cl_hier_put_schedule(&schedule->super.super);
+    return status;
+}
+
+/* Position in NET sbgp of the member located on the node of @root */
+static inline ucc_rank_t find_root_rail_rank(ucc_cl_hier_team_t *cl_team,
+                                             ucc_rank_t          root)
+{
+    ucc_sbgp_t   *sbgp      = cl_team->sbgps[UCC_HIER_SBGP_NET].sbgp;
+    ucc_team_t   *core_team = cl_team->super.super.params.team;
+    ucc_host_id_t host_id   = ucc_team_rank_host_id(root, core_team);
+    ucc_rank_t    i;
+
+    for (i = 0; i < sbgp->group_size; i++) {
+        if (ucc_team_rank_host_id(ucc_ep_map_eval(sbgp->map, i),
+                                  core_team) == host_id) {
+            return i;
+        }
+    }
+    return UCC_RANK_INVALID;
+}
+
+UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_bcast_split_rail_init,
+                         (coll_args, team, task),
+                         ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
+                         ucc_coll_task_t **task)
+{
+    ucc_cl_hier_team_t     *cl_team   = ucc_derived_of(team,
+                                                       ucc_cl_hier_team_t);
+    ucc_team_t             *core_team = team->params.team;
+    ucc_rank_t              root      = coll_args->args.root;
+    ucc_rank_t              rank      = UCC_CL_TEAM_RANK(cl_team);
+    size_t                  count     = coll_args->args.src.info.count;
+    size_t                  dt_size   =
+        ucc_dt_size(coll_args->args.src.info.datatype);
+    ucc_coll_task_t        *tasks[MAX_BCAST_SPLIT_RAIL_TASKS] = {NULL};
+    int                     n_tasks   = 0;
+    ucc_base_coll_args_t    args;
+    ucc_cl_hier_schedule_t *cl_schedule;
+    ucc_schedule_t         *schedule;
+    ucc_rank_t              node_size, node_rank, r;
+    uint64_t               *counts, *displs;
+    int                     root_on_local_node, i;
+    ucc_status_t            status;
+
+    if (!UCC_CL_HIER_MULTI_RAIL(cl_team) ||
+        UCC_IS_PERSISTENT(coll_args->args) || count < cl_team->n_rails) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    cl_schedule = ucc_cl_hier_get_schedule(cl_team);
+    if (ucc_unlikely(!cl_schedule)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    schedule  = &cl_schedule->super.super;
+    node_size = SBGP_SIZE(cl_team, NODE);
+    node_rank = SBGP_RANK(cl_team, NODE);
+    counts    = ucc_calloc(node_size * 2, sizeof(uint64_t), "counts");
+    if (ucc_unlikely(!counts)) {
+        cl_error(team->context->lib,
+                 "failed to allocate %zd bytes for counts array",
+                 node_size * 2 * sizeof(uint64_t));
+        status = UCC_ERR_NO_MEMORY;
+        goto err_counts;
+    }
+    cl_schedule->bcast_split_rail.counts = counts;
+    displs = counts + node_size;
+    for (r = 0; r < cl_team->n_rails; r++) {
+        counts[cl_team->rail_drivers[r]] =
+            ucc_buffer_block_count(count, cl_team->n_rails, r);
+        displs[cl_team->rail_drivers[r]] =
+            ucc_buffer_block_offset(count, cl_team->n_rails, r);
+    }
+
+    status = ucc_schedule_init(schedule, coll_args, team);
+    if (ucc_unlikely(UCC_OK != status)) {
+        goto err_init;
+    }
+
+    root_on_local_node = ucc_team_ranks_on_same_node(root, rank, core_team);
+    if (root_on_local_node) {
+        args           = *coll_args;
+        args.args.root = ucc_cl_hier_sbgp_rank(cl_team, UCC_HIER_SBGP_NODE,
+                                               root);
+        UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NODE), &args,
+                                     &tasks[n_tasks]),
+                       err_init, status);
+        n_tasks++;
+    }
+
+    if (cl_team->my_rail >= 0) {
+        args                      = *coll_args;
+        args.args.root            = find_root_rail_rank(cl_team, root);
+        args.args.src.info.buffer = PTR_OFFSET(coll_args->args.src.info.buffer,
+                                               displs[node_rank] * dt_size);
+        args.args.src.info.count  = counts[node_rank];
+        ucc_assert(args.args.root != UCC_RANK_INVALID);
+        UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NET), &args,
+                                     &tasks[n_tasks]),
+                       err_init, status);
+        n_tasks++;
+    }
+
+    if (!root_on_local_node) {
+        args                                = *coll_args;
+        args.args.coll_type                 = UCC_COLL_TYPE_ALLGATHERV;
+        args.args.mask                     |= UCC_COLL_ARGS_FIELD_FLAGS;
+        args.args.flags                    |=
+            UCC_COLL_ARGS_FLAG_IN_PLACE | UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+            UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT;
+        args.args.dst.info_v.buffer         = coll_args->args.src.info.buffer;
+        args.args.dst.info_v.counts         = counts;
+        args.args.dst.info_v.displacements  = displs;
+        args.args.dst.info_v.datatype       =
+            coll_args->args.src.info.datatype;
+        args.args.dst.info_v.mem_type       =
+            coll_args->args.src.info.mem_type;
+        UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NODE), &args,
+                                     &tasks[n_tasks]),
+                       err_init, status);
+        n_tasks++;
+    }
+
+    ucc_assert(n_tasks > 0);
+    UCC_CHECK_GOTO(ucc_task_subscribe_dep(&schedule->super, tasks[0],
+                                          UCC_EVENT_SCHEDULE_STARTED),
+                   err_init, status);
+    UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[0]), err_init,
+                   status);
+    for (i = 1; i < n_tasks; i++) {
+        UCC_CHECK_GOTO(ucc_task_subscribe_dep(tasks[i - 1], tasks[i],
+                                              UCC_EVENT_COMPLETED),
+                       err_init, status);
+        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[i]), err_init,
+                       status);
+    }
+
+    schedule->super.post     = ucc_cl_hier_bcast_split_rail_start;
+    schedule->super.progress = NULL;
+    schedule->super.finalize = ucc_cl_hier_bcast_split_rail_finalize;
+    *task                    = &schedule->super;
+    return UCC_OK;
+
+err_init:
+    for (i = 0; i < n_tasks; i++) {
+        tasks[i]->finalize(tasks[i]);
+    }
+    ucc_free(counts);
+err_counts:
+    ucc_cl_hier_put_schedule(schedule);
+    return status;
+}
@@ -27,11 +27,18 @@ ucc_status_t ucc_cl_hier_mem_unmap(const ucc_base_context_t *context, ucc_mem_ma
 ucc_status_t ucc_cl_hier_memh_pack(const ucc_base_context_t *context,
                                    ucc_mem_map_mode_t mode, ucc_mem_map_tl_t *tl_h, void **packed_buffer);
 
+static const char *ucc_cl_hier_node_split_names[] = {
+    [UCC_CL_HIER_NODE_SPLIT_NONE]   = "none",
+    [UCC_CL_HIER_NODE_SPLIT_SOCKET] = "socket",
+    [UCC_CL_HIER_NODE_SPLIT_NUMA]   = "numa",
+    [UCC_CL_HIER_NODE_SPLIT_AUTO]   = "auto",
+    [UCC_CL_HIER_NODE_SPLIT_LAST]   = NULL};
+
 static ucc_config_field_t ucc_cl_hier_lib_config_table[] = {
     {"", "", NULL, ucc_offsetof(ucc_cl_hier_lib_config_t, super),
      UCC_CONFIG_TYPE_TABLE(ucc_cl_lib_config_table)},
 
-    {"NODE_SBGP_TLS", "ucp",
+    {"NODE_SBGP_TLS", "shm,ucp",
      "TLS to be used for NODE subgroup.\n"
      "NODE subgroup contains processes of a team located on the same node",
      ucc_offsetof(ucc_cl_hier_lib_config_t, sbgp_tls[UCC_HIER_SBGP_NODE]),
@@ -54,6 +61,21 @@ static ucc_config_field_t ucc_cl_hier_lib_config_table[] = {
      ucc_offsetof(ucc_cl_hier_lib_config_t, sbgp_tls[UCC_HIER_SBGP_NET]),
      UCC_CONFIG_TYPE_ALLOW_LIST},
 
+    {"SOCKET_SBGP_TLS", "shm,ucp",
+     "TLS to be used for SOCKET subgroup.\n"
+     "SOCKET subgroup contains processes of a team located on the same socket "
+     "(or NUMA domain, see NODE_SPLIT) of a node",
+     ucc_offsetof(ucc_cl_hier_lib_config_t, sbgp_tls[UCC_HIER_SBGP_SOCKET]),
+     UCC_CONFIG_TYPE_ALLOW_LIST},
+
+    {"SOCKET_LEADERS_SBGP_TLS", "shm,ucp",
+     "TLS to be used for SOCKET_LEADERS subgroup.\n"
+     "SOCKET_LEADERS subgroup contains one process per socket (or NUMA "
+     "domain) of a node, the node leader is one of them",
+     ucc_offsetof(ucc_cl_hier_lib_config_t,
+                  sbgp_tls[UCC_HIER_SBGP_SOCKET_LEADERS]),
+     UCC_CONFIG_TYPE_ALLOW_LIST},
+
     {"FULL_SBGP_TLS", "ucp",
      "TLS to be used for FULL subgroup.\n"
      "FULL subgroup contains all processes of the team",
@@ -65,6 +87,27 @@ static ucc_config_field_t ucc_cl_hier_lib_config_table[] = {
      ucc_offsetof(ucc_cl_hier_lib_config_t, a2av_node_thresh),
      UCC_CONFIG_TYPE_MEMUNITS},
 
+    {"NODE_SPLIT", "auto",
+     "Split the intra-node phase of RAB allreduce, 2step bcast and 2step "
+     "reduce into socket and socket leaders levels, so that data crosses "
+     "the inter-socket link once per node.\n"
+     "none   - use the flat NODE subgroup, disables the split\n"
+     "socket - split by sockets\n"
+     "numa   - split by NUMA domains\n"
+     "auto   - split by sockets if processes are bound and a node has more "
+     "than one socket",
+     ucc_offsetof(ucc_cl_hier_lib_config_t, node_split),
+     UCC_CONFIG_TYPE_ENUM(ucc_cl_hier_node_split_names)},
+
+    {"NRAILS", "auto",
+     "Number of rails the inter-node traffic of split_rail algorithms is "
+     "striped across. Node-local processes closest to the network devices "
+     "drive the rails.\n"
+     "auto - number of network devices (see UCC_NET_DEVICES) of the nodes,\n"
+     "1    - disable striping",
+     ucc_offsetof(ucc_cl_hier_lib_config_t, n_rails),
+     UCC_CONFIG_TYPE_ULUNITS},
+
     {"ALLREDUCE_SPLIT_RAIL_PIPELINE", "n",
      "Pipelining settings for SplitRail allreduce algorithm",
      ucc_offsetof(ucc_cl_hier_lib_config_t, allreduce_split_rail_pipeline),
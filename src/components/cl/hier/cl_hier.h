@@ -39,21 +39,33 @@ typedef enum {
     UCC_HIER_SBGP_NODE,
     UCC_HIER_SBGP_NODE_LEADERS,
     UCC_HIER_SBGP_NET,
+    UCC_HIER_SBGP_SOCKET,
+    UCC_HIER_SBGP_SOCKET_LEADERS,
     UCC_HIER_SBGP_FULL,
     UCC_HIER_SBGP_LAST,
 } ucc_hier_sbgp_type_t;
 //DO we need it? Potential use case: different hier sbgps over same sbgp
 
+typedef enum ucc_cl_hier_node_split {
+    UCC_CL_HIER_NODE_SPLIT_NONE,
+    UCC_CL_HIER_NODE_SPLIT_SOCKET,
+    UCC_CL_HIER_NODE_SPLIT_NUMA,
+    UCC_CL_HIER_NODE_SPLIT_AUTO,
+    UCC_CL_HIER_NODE_SPLIT_LAST
+} ucc_cl_hier_node_split_t;
+
 typedef struct ucc_cl_hier_lib_config {
-    ucc_cl_lib_config_t super;
+    ucc_cl_lib_config_t      super;
     /* List of TLs corresponding to the sbgp team,
        which are selected based on the TL scores */
-    ucc_config_names_list_t sbgp_tls[UCC_HIER_SBGP_LAST];
-    size_t                  a2av_node_thresh;
-    ucc_pipeline_params_t   allreduce_split_rail_pipeline;
-    ucc_pipeline_params_t   allreduce_rab_pipeline;
-    ucc_pipeline_params_t   bcast_2step_pipeline;
-    ucc_pipeline_params_t   reduce_2step_pipeline;
+    ucc_config_names_list_t  sbgp_tls[UCC_HIER_SBGP_LAST];
+    size_t                   a2av_node_thresh;
+    ucc_cl_hier_node_split_t node_split;
+    unsigned long            n_rails;
+    ucc_pipeline_params_t    allreduce_split_rail_pipeline;
+    ucc_pipeline_params_t    allreduce_rab_pipeline;
+    ucc_pipeline_params_t    bcast_2step_pipeline;
+    ucc_pipeline_params_t    reduce_2step_pipeline;
 } ucc_cl_hier_lib_config_t;
 
 typedef struct ucc_cl_hier_context_config {
@@ -107,6 +119,16 @@ typedef struct ucc_cl_hier_team {
     ucc_hier_sbgp_t          sbgps[UCC_HIER_SBGP_LAST];
     ucc_hier_sbgp_type_t     top_sbgp;
     int                      is_block_ordered;
+    int                      node_split; /*< intra-node phase of hierarchical
+                                             algorithms is split into SOCKET
+                                             and SOCKET_LEADERS levels */
+    ucc_rank_t               n_rails;    /*< number of rails the inter-node
+                                             traffic is striped across */
+    ucc_rank_t               rail_drivers[UCC_MAX_RAILS]; /*< NODE sbgp rank
+                                             driving each rail, identical on
+                                             all the nodes */
+    int                      my_rail;    /*< rail driven by the process or
+                                             -1 */
 } ucc_cl_hier_team_t;
 UCC_CLASS_DECLARE(ucc_cl_hier_team_t, ucc_base_context_t *,
                   const ucc_base_team_params_t *);
@@ -149,4 +171,6 @@ ucc_status_t ucc_cl_hier_coll_init(ucc_base_coll_args_t *coll_args,
 
 #define SCORE_MAP(_team, _sbgp) (_team)->sbgps[UCC_HIER_SBGP_##_sbgp].score_map
 
+#define UCC_CL_HIER_MULTI_RAIL(_team) ((_team)->n_rails > 1)
+
 #endif
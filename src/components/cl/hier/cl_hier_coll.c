@@ -17,6 +17,12 @@ const char *
     UCC_CL_HIER_REDUCE_DEFAULT_ALG_SELECT_STR,
     UCC_CL_HIER_ALLGATHERV_DEFAULT_ALG_SELECT_STR};
 
+const char *ucc_cl_hier_multi_rail_alg_select_str
+    [UCC_CL_HIER_N_MULTI_RAIL_ALG_SELECT_STR] = {
+    UCC_CL_HIER_ALLREDUCE_MULTI_RAIL_ALG_SELECT_STR,
+    UCC_CL_HIER_BCAST_MULTI_RAIL_ALG_SELECT_STR,
+    UCC_CL_HIER_ALLGATHERV_MULTI_RAIL_ALG_SELECT_STR};
+
 ucc_status_t ucc_cl_hier_coll_init(ucc_base_coll_args_t *coll_args,
                                    ucc_base_team_t      *team,
                                    ucc_coll_task_t     **task)
@@ -112,6 +118,9 @@ ucc_status_t ucc_cl_hier_alg_id_to_init(int alg_id, const char *alg_id_str,
         case UCC_CL_HIER_BCAST_ALG_2STEP:
             *init = ucc_cl_hier_bcast_2step_init;
             break;
+        case UCC_CL_HIER_BCAST_ALG_SPLIT_RAIL:
+            *init = ucc_cl_hier_bcast_split_rail_init;
+            break;
         default:
             status = UCC_ERR_INVALID_PARAM;
             break;
@@ -132,6 +141,9 @@ ucc_status_t ucc_cl_hier_alg_id_to_init(int alg_id, const char *alg_id_str,
         case UCC_CL_HIER_ALLGATHERV_ALG_GAB:
             *init = ucc_cl_hier_allgatherv_init;
             break;
+        case UCC_CL_HIER_ALLGATHERV_ALG_SPLIT_RAIL:
+            *init = ucc_cl_hier_allgatherv_split_rail_init;
+            break;
         default:
             status = UCC_ERR_INVALID_PARAM;
             break;
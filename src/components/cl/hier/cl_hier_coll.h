@@ -7,6 +7,7 @@
 #define UCC_CL_HIER_COLL_H_
 
 #include "cl_hier.h"
+#include "core/ucc_team.h"
 #include "schedule/ucc_schedule_pipelined.h"
 #include "components/mc/ucc_mc.h"
 #include "allreduce/allreduce.h"
@@ -22,6 +23,12 @@
 extern const char
     *ucc_cl_hier_default_alg_select_str[UCC_CL_HIER_N_DEFAULT_ALG_SELECT_STR];
 
+/* Applied on top of the defaults if the team has more than one rail */
+#define UCC_CL_HIER_N_MULTI_RAIL_ALG_SELECT_STR 3
+
+extern const char *ucc_cl_hier_multi_rail_alg_select_str
+    [UCC_CL_HIER_N_MULTI_RAIL_ALG_SELECT_STR];
+
 typedef struct ucc_cl_hier_schedule_t {
     ucc_schedule_pipelined_t super;
     ucc_mc_buffer_header_t  *scratch;
@@ -29,6 +36,9 @@ typedef struct ucc_cl_hier_schedule_t {
         struct {
             uint64_t *counts;
         } allreduce_split_rail;
+        struct {
+            uint64_t *counts;
+        } bcast_split_rail;
     };
 } ucc_cl_hier_schedule_t;
 
@@ -49,6 +59,70 @@ static inline void ucc_cl_hier_put_schedule(ucc_schedule_t *schedule)
     ucc_mpool_put(schedule);
 }
 
+/* Returns position of team rank @rank in hier sbgp or UCC_RANK_INVALID */
+static inline ucc_rank_t ucc_cl_hier_sbgp_rank(ucc_cl_hier_team_t  *team,
+                                               ucc_hier_sbgp_type_t hs,
+                                               ucc_rank_t           rank)
+{
+    ucc_sbgp_t *sbgp = team->sbgps[hs].sbgp;
+    ucc_rank_t  i;
+
+    for (i = 0; i < sbgp->group_size; i++) {
+        if (ucc_ep_map_eval(sbgp->map, i) == rank) {
+            return i;
+        }
+    }
+    return UCC_RANK_INVALID;
+}
+
+/* Returns 1 if both ranks belong to the same SOCKET hier sbgp, i.e. share
+   the node and the socket (or NUMA domain, depending on node split mode) */
+static inline int ucc_cl_hier_ranks_on_same_sn(ucc_cl_hier_team_t *team,
+                                               ucc_rank_t rank1,
+                                               ucc_rank_t rank2)
+{
+    ucc_team_t      *core_team = team->super.super.params.team;
+    ucc_proc_info_t *p1 = &core_team->topo->topo->procs[
+        ucc_get_ctx_rank(core_team, rank1)];
+    ucc_proc_info_t *p2 = &core_team->topo->topo->procs[
+        ucc_get_ctx_rank(core_team, rank2)];
+
+    if (p1->host_hash != p2->host_hash) {
+        return 0;
+    }
+    return (team->sbgps[UCC_HIER_SBGP_SOCKET].sbgp_type == UCC_SBGP_SOCKET)
+               ? p1->socket_id == p2->socket_id
+               : p1->numa_id == p2->numa_id;
+}
+
+/* Root of the SOCKET level: @root itself if it shares the socket with the
+   calling rank, socket leader otherwise */
+static inline ucc_rank_t ucc_cl_hier_socket_root(ucc_cl_hier_team_t *team,
+                                                 ucc_rank_t          root)
+{
+    if (ucc_cl_hier_ranks_on_same_sn(team, root, UCC_CL_TEAM_RANK(team))) {
+        return ucc_cl_hier_sbgp_rank(team, UCC_HIER_SBGP_SOCKET, root);
+    }
+    return 0;
+}
+
+/* Root of the SOCKET_LEADERS level: leader of the @root socket if @root is
+   on the local node, node leader otherwise */
+static inline ucc_rank_t
+ucc_cl_hier_socket_leaders_root(ucc_cl_hier_team_t *team, ucc_rank_t root)
+{
+    ucc_sbgp_t *sbgp = team->sbgps[UCC_HIER_SBGP_SOCKET_LEADERS].sbgp;
+    ucc_rank_t  i;
+
+    for (i = 0; i < sbgp->group_size; i++) {
+        if (ucc_cl_hier_ranks_on_same_sn(team, root,
+                                         ucc_ep_map_eval(sbgp->map, i))) {
+            return i;
+        }
+    }
+    return 0;
+}
+
 ucc_status_t ucc_cl_hier_alg_id_to_init(int alg_id, const char *alg_id_str,
                                         ucc_coll_type_t   coll_type,
                                         ucc_memory_type_t mem_type, //NOLINT
@@ -22,12 +22,32 @@
  * Next step is to enable sbgps based on the requested hierarchical algs.
  */
 
-static void ucc_cl_hier_enable_sbgps(ucc_cl_hier_team_t *team)
+static void ucc_cl_hier_enable_sbgps(ucc_cl_hier_team_t *team,
+                                     ucc_cl_hier_lib_t  *lib,
+                                     ucc_topo_t         *topo)
 {
+    ucc_cl_hier_node_split_t split = lib->cfg.node_split;
+
     SBGP_SET(team, NET, ENABLED);
     SBGP_SET(team, NODE, ENABLED);
     SBGP_SET(team, NODE_LEADERS, ENABLED);
     SBGP_SET(team, FULL, ENABLED); /* TODO: parse score if a2av is enabled */
+
+    if (split == UCC_CL_HIER_NODE_SPLIT_AUTO) {
+        split = (ucc_topo_n_sockets(topo) > 1) ? UCC_CL_HIER_NODE_SPLIT_SOCKET
+                                               : UCC_CL_HIER_NODE_SPLIT_NONE;
+    }
+    if (split == UCC_CL_HIER_NODE_SPLIT_SOCKET) {
+        SBGP_SET(team, SOCKET, ENABLED);
+        SBGP_SET(team, SOCKET_LEADERS, ENABLED);
+    } else if (split == UCC_CL_HIER_NODE_SPLIT_NUMA) {
+        /* same hier levels, built over NUMA domains instead of sockets */
+        SBGP_SET(team, SOCKET, ENABLED);
+        SBGP_SET(team, SOCKET_LEADERS, ENABLED);
+        team->sbgps[UCC_HIER_SBGP_SOCKET].sbgp_type = UCC_SBGP_NUMA;
+        team->sbgps[UCC_HIER_SBGP_SOCKET_LEADERS].sbgp_type =
+            UCC_SBGP_NUMA_LEADERS;
+    }
 }
 
 UCC_CLASS_INIT_FUNC(ucc_cl_hier_team_t, ucc_base_context_t *cl_context,
@@ -60,7 +80,9 @@ UCC_CLASS_INIT_FUNC(ucc_cl_hier_team_t, ucc_base_context_t *cl_context,
 
     UCC_CLASS_CALL_SUPER_INIT(ucc_cl_team_t, &ctx->super, params);
     memset(self->sbgps, 0, sizeof(self->sbgps));
-    ucc_cl_hier_enable_sbgps(self);
+    self->n_rails = 1;
+    self->my_rail = -1;
+    ucc_cl_hier_enable_sbgps(self, lib, params->team->topo);
     n_sbgp_teams = 0;
     for (i = 0; i < UCC_HIER_SBGP_LAST; i++) {
         hs = &self->sbgps[i];
@@ -247,6 +269,113 @@ ucc_status_t ucc_cl_hier_team_destroy(ucc_base_team_t *cl_team)
     return status;
 }
 
+static inline int ucc_cl_hier_is_rail_driver(const ucc_rank_t *drivers,
+                                             ucc_rank_t n_rails, ucc_rank_t k)
+{
+    ucc_rank_t r;
+
+    for (r = 0; r < n_rails; r++) {
+        if (drivers[r] == k) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Rail r is driven by a node-local process bound to the numa node of
+   network device r. If there is none (e.g. processes are unbound), the
+   search starts at r * ppn / n_rails so that drivers are spread evenly
+   over the node */
+static void ucc_cl_hier_node_rail_drivers(ucc_team_t *core_team,
+                                          ucc_sbgp_t *node, ucc_rank_t n_rails,
+                                          ucc_rank_t *drivers)
+{
+    ucc_proc_info_t *procs = core_team->topo->topo->procs;
+    ucc_rank_t       r, i, k, start;
+    ucc_rail_mask_t  mask;
+    int              pass;
+
+    for (r = 0; r < n_rails; r++) {
+        drivers[r] = UCC_RANK_INVALID;
+    }
+    for (pass = 0; pass < 2; pass++) {
+        for (r = 0; r < n_rails; r++) {
+            if (drivers[r] != UCC_RANK_INVALID) {
+                continue;
+            }
+            start = (pass == 0) ? 0 : r * node->group_size / n_rails;
+            for (i = 0; i < node->group_size; i++) {
+                k    = (start + i) % node->group_size;
+                mask = procs[ucc_get_ctx_rank(core_team,
+                         ucc_ep_map_eval(node->map, k))].rail_mask;
+                if (pass == 0 && !(mask & UCC_BIT(r))) {
+                    continue;
+                }
+                if (!ucc_cl_hier_is_rail_driver(drivers, n_rails, k)) {
+                    drivers[r] = k;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void ucc_cl_hier_team_init_rails(ucc_cl_hier_team_t *team)
+{
+    ucc_cl_hier_lib_t *lib       = UCC_CL_HIER_TEAM_LIB(team);
+    ucc_team_t        *core_team = team->super.super.params.team;
+    ucc_proc_info_t   *procs     = core_team->topo->topo->procs;
+    ucc_rank_t         drivers[UCC_MAX_RAILS];
+    ucc_sbgp_t        *nodes;
+    ucc_rank_t         ppn, n_rails, r, k;
+    int                n_nodes, i, uniform;
+
+    team->n_rails = 1;
+    team->my_rail = -1;
+    if (!SBGP_ENABLED(team, NODE) || !SBGP_ENABLED(team, NET) ||
+        !ucc_topo_isoppn(core_team->topo) ||
+        UCC_OK != ucc_topo_get_all_nodes(core_team->topo, &nodes, &n_nodes)) {
+        return;
+    }
+    ppn     = SBGP_SIZE(team, NODE);
+    n_rails = UCC_MAX_RAILS;
+    for (i = 0; i < n_nodes; i++) {
+        for (k = 0; k < ppn; k++) {
+            n_rails = ucc_min(n_rails, procs[ucc_get_ctx_rank(core_team,
+                                ucc_ep_map_eval(nodes[i].map, k))].n_rails);
+        }
+    }
+    if (lib->cfg.n_rails != UCC_ULUNITS_AUTO) {
+        n_rails = ucc_min(lib->cfg.n_rails, UCC_MAX_RAILS);
+    }
+    n_rails = ucc_min(n_rails, ppn);
+    if (n_rails < 2) {
+        return;
+    }
+
+    /* NET sbgp connects equal node ranks, so every node must choose the
+       same drivers, otherwise drivers are spread evenly */
+    uniform = 1;
+    ucc_cl_hier_node_rail_drivers(core_team, &nodes[0], n_rails,
+                                  team->rail_drivers);
+    for (i = 1; i < n_nodes && uniform; i++) {
+        ucc_cl_hier_node_rail_drivers(core_team, &nodes[i], n_rails, drivers);
+        uniform = !memcmp(drivers, team->rail_drivers,
+                          n_rails * sizeof(ucc_rank_t));
+    }
+    for (r = 0; r < n_rails; r++) {
+        if (!uniform) {
+            team->rail_drivers[r] = r * ppn / n_rails;
+        }
+        if (team->rail_drivers[r] == SBGP_RANK(team, NODE)) {
+            team->my_rail = r;
+        }
+    }
+    team->n_rails = n_rails;
+    cl_debug(lib, "team %p: %u rails, uniform drivers %d, my rail %d", team,
+             n_rails, uniform, team->my_rail);
+}
+
 ucc_status_t ucc_cl_hier_team_create_test(ucc_base_team_t *cl_team)
 {
     ucc_cl_hier_team_t    *team = ucc_derived_of(cl_team, ucc_cl_hier_team_t);
@@ -341,6 +470,13 @@ ucc_status_t ucc_cl_hier_team_create_test(ucc_base_team_t *cl_team)
         ucc_assert(SBGP_EXISTS(team, NODE));
         team->top_sbgp = UCC_HIER_SBGP_NODE;
     }
+    /* the split only applies below NODE_LEADERS, single node teams keep
+       flat NODE level */
+    team->node_split = SBGP_EXISTS(team, SOCKET_LEADERS) &&
+                       team->top_sbgp == UCC_HIER_SBGP_NODE_LEADERS;
+    if (UCC_OK == status) {
+        ucc_cl_hier_team_init_rails(team);
+    }
 
     return status;
 }
@@ -413,6 +549,20 @@ ucc_status_t ucc_cl_hier_team_get_scores(ucc_base_team_t   *cl_team,
         }
     }
 
+    if (UCC_CL_HIER_MULTI_RAIL(team)) {
+        for (i = 0; i < UCC_CL_HIER_N_MULTI_RAIL_ALG_SELECT_STR; i++) {
+            status = ucc_coll_score_update_from_str(
+                ucc_cl_hier_multi_rail_alg_select_str[i], &team_info,
+                &team->super.super, score);
+            if (UCC_OK != status) {
+                cl_error(lib, "failed to apply multi-rail coll select "
+                         "setting: %s",
+                         ucc_cl_hier_multi_rail_alg_select_str[i]);
+                goto err;
+            }
+        }
+    }
+
     if (strlen(ctx->score_str) > 0) {
         status = ucc_coll_score_update_from_str(ctx->score_str, &team_info,
                                                 &team->super.super, score);
@@ -48,22 +48,6 @@ find_root_net_rank(ucc_host_id_t root_host_id, ucc_cl_hier_team_t *cl_team)
     return net_rank;
 }
 
-static inline ucc_rank_t
-find_root_node_rank(ucc_rank_t root, ucc_cl_hier_team_t *cl_team)
-{
-    ucc_rank_t  node_rank  = UCC_RANK_INVALID;
-    ucc_sbgp_t *sbgp       = cl_team->sbgps[UCC_HIER_SBGP_NODE].sbgp;
-    ucc_rank_t  i;
-
-    for (i = 0; i < sbgp->group_size; i++) {
-        if (ucc_ep_map_eval(sbgp->map, i) == root) {
-            node_rank = i;
-            break;
-        }
-    }
-    return node_rank;
-}
-
 static ucc_status_t
 ucc_cl_hier_reduce_2step_init_schedule(ucc_base_coll_args_t *coll_args,
                                        ucc_base_team_t *team,
@@ -71,21 +55,25 @@ ucc_cl_hier_reduce_2step_init_schedule(ucc_base_coll_args_t *coll_args,
 {
     ucc_cl_hier_team_t   *cl_team   = ucc_derived_of(team, ucc_cl_hier_team_t);
     ucc_team_t           *core_team = team->params.team;
-    ucc_coll_task_t      *tasks[2]  = {NULL, NULL};
+    ucc_coll_task_t      *tasks[MAX_AR_2STEP_TASKS] = {NULL};
     ucc_rank_t            root      = coll_args->args.root;
     ucc_rank_t            rank      = UCC_TL_TEAM_RANK(cl_team);
     ucc_base_coll_args_t  args      = *coll_args;
     size_t                count     = (rank == root) ?
                                       args.args.dst.info.count :
                                       args.args.src.info.count;
+    ucc_hier_sbgp_type_t    levels[MAX_AR_2STEP_TASKS];
+    ucc_rank_t              roots[MAX_AR_2STEP_TASKS];
     ucc_cl_hier_schedule_t *cl_schedule;
     ucc_schedule_t         *schedule;
+    ucc_hier_sbgp_t        *hs;
     ucc_status_t            status;
-    int                     n_tasks, i, first_task, root_on_local_node;
+    void                   *acc;
+    int                     n_tasks, n_levels, send_level, i;
 
-    root_on_local_node = ucc_team_ranks_on_same_node(root, rank, core_team);
-    n_tasks            = 0;
-    first_task         = 0;
+    n_tasks    = 0;
+    n_levels   = 0;
+    send_level = -1;
 
     if (root != rank) {
         args.args.dst.info.count    = args.args.src.info.count;
@@ -112,59 +100,88 @@ ucc_cl_hier_reduce_2step_init_schedule(ucc_base_coll_args_t *coll_args,
 
     ucc_assert(SBGP_ENABLED(cl_team, NODE_LEADERS) ||
                SBGP_ENABLED(cl_team, NODE));
-    if (SBGP_ENABLED(cl_team, NODE)) {
-        args.args.root = root_on_local_node
-            ? find_root_node_rank(root, cl_team) : 0;
-
-        if ((root != rank) && SBGP_ENABLED(cl_team, NODE_LEADERS)) {
-            status = ucc_mc_alloc(&cl_schedule->scratch,
-                                  args.max_frag_count *
-                                  ucc_dt_size(args.args.src.info.datatype),
-                                  args.args.src.info.mem_type);
-            if (ucc_unlikely(UCC_OK != status)) {
-                goto out;
-            }
-            args.args.dst.info.buffer = cl_schedule->scratch->addr;
-            if (root_on_local_node) {
-                first_task = 1;
-                args.args.src.info.buffer = cl_schedule->scratch->addr;
-            }
+    /* enabled levels bottom-up, root of every level is its member closest
+       to the original root */
+    if (cl_team->node_split) {
+        if (SBGP_ENABLED(cl_team, SOCKET)) {
+            levels[n_levels]  = UCC_HIER_SBGP_SOCKET;
+            roots[n_levels++] = ucc_cl_hier_socket_root(cl_team, root);
+        }
+        if (SBGP_ENABLED(cl_team, SOCKET_LEADERS)) {
+            levels[n_levels]  = UCC_HIER_SBGP_SOCKET_LEADERS;
+            roots[n_levels++] = ucc_cl_hier_socket_leaders_root(cl_team,
+                                                                root);
         }
-        status = ucc_coll_init(SCORE_MAP(cl_team, NODE), &args, &tasks[n_tasks]);
+    } else if (SBGP_ENABLED(cl_team, NODE)) {
+        levels[n_levels]  = UCC_HIER_SBGP_NODE;
+        roots[n_levels++] = ucc_team_ranks_on_same_node(root, rank, core_team)
+            ? ucc_cl_hier_sbgp_rank(cl_team, UCC_HIER_SBGP_NODE, root) : 0;
+    }
+    if (SBGP_ENABLED(cl_team, NODE_LEADERS)) {
+        levels[n_levels]  = UCC_HIER_SBGP_NODE_LEADERS;
+        roots[n_levels++] = find_root_net_rank(
+            ucc_team_rank_host_id(root, core_team), cl_team);
+    }
+
+    /* every rank except the root sends its partial result on exactly one
+       level, after all levels where it is the root have been reduced into
+       the accumulation buffer */
+    for (i = 0; i < n_levels; i++) {
+        if (cl_team->sbgps[levels[i]].sbgp->group_rank != roots[i]) {
+            ucc_assert(send_level == -1);
+            send_level = i;
+        }
+    }
+    ucc_assert((send_level == -1) == (root == rank));
+
+    /* non-root ranks accumulate into scratch only if they are the root of
+       some level, ranks that only send reduce from the source buffer */
+    acc = args.args.dst.info.buffer;
+    if ((root != rank) && (n_levels - (send_level != -1) > 0)) {
+        status = ucc_mc_alloc(&cl_schedule->scratch,
+                              args.max_frag_count *
+                              ucc_dt_size(args.args.src.info.datatype),
+                              args.args.src.info.mem_type);
         if (ucc_unlikely(UCC_OK != status)) {
             goto out;
         }
-        n_tasks++;
+        acc = cl_schedule->scratch->addr;
     }
 
-    if (SBGP_ENABLED(cl_team, NODE_LEADERS)) {
-        if (n_tasks == 1) {
-            if (root != rank) {
-                args.args.src.info.buffer = root_on_local_node ?
-                    coll_args->args.src.info.buffer : cl_schedule->scratch->addr;
-            } else {
-                args.args.mask |= UCC_COLL_ARGS_FIELD_FLAGS;
-                args.args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
-            }
+    for (i = 0; i < n_levels; i++) {
+        if (i == send_level) {
+            continue;
         }
-        args.args.root = find_root_net_rank(ucc_team_rank_host_id(root, core_team),
-                                            cl_team);
-        status = ucc_coll_init(SCORE_MAP(cl_team, NODE_LEADERS),
-                               &args, &tasks[n_tasks]);
+        hs                        = &cl_team->sbgps[levels[i]];
+        args.args.root            = roots[i];
+        args.args.dst.info.buffer = acc;
+        status = ucc_coll_init(hs->score_map, &args, &tasks[n_tasks]);
         if (ucc_unlikely(UCC_OK != status)) {
             goto out;
         }
         n_tasks++;
+        args.args.src.info.buffer = acc;
+        args.args.mask           |= UCC_COLL_ARGS_FIELD_FLAGS;
+        args.args.flags          |= UCC_COLL_ARGS_FLAG_IN_PLACE;
     }
 
-    ucc_task_subscribe_dep(&schedule->super, tasks[first_task],
-                           UCC_EVENT_SCHEDULE_STARTED);
-    ucc_schedule_add_task(schedule, tasks[first_task]);
+    if (send_level != -1) {
+        hs             = &cl_team->sbgps[levels[send_level]];
+        args.args.root = roots[send_level];
+        args.args.flags &= ~UCC_COLL_ARGS_FLAG_IN_PLACE;
+        status = ucc_coll_init(hs->score_map, &args, &tasks[n_tasks]);
+        if (ucc_unlikely(UCC_OK != status)) {
+            goto out;
+        }
+        n_tasks++;
+    }
 
-    if (n_tasks > 1) {
-        ucc_task_subscribe_dep(tasks[first_task],
-                               tasks[(first_task + 1) % 2], UCC_EVENT_COMPLETED);
-        ucc_schedule_add_task(schedule, tasks[(first_task + 1) % 2]);
+    ucc_task_subscribe_dep(&schedule->super, tasks[0],
+                           UCC_EVENT_SCHEDULE_STARTED);
+    ucc_schedule_add_task(schedule, tasks[0]);
+    for (i = 1; i < n_tasks; i++) {
+        ucc_task_subscribe_dep(tasks[i - 1], tasks[i], UCC_EVENT_COMPLETED);
+        ucc_schedule_add_task(schedule, tasks[i]);
     }
 
     schedule->super.post           = ucc_cl_hier_reduce_2step_start;
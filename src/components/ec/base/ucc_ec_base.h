@@ -66,6 +66,9 @@ typedef enum ucc_ee_executor_task_type {
     UCC_EE_EXECUTOR_TASK_REDUCE_MULTI_DST = UCC_BIT(2),
     UCC_EE_EXECUTOR_TASK_COPY             = UCC_BIT(3),
     UCC_EE_EXECUTOR_TASK_COPY_MULTI       = UCC_BIT(4),
+    UCC_EE_EXECUTOR_TASK_REDUCE_COPY      = UCC_BIT(5),
+    UCC_EE_EXECUTOR_TASK_COPY_SG          = UCC_BIT(6),
+    UCC_EE_EXECUTOR_TASK_REDUCE_SG        = UCC_BIT(7),
     UCC_EE_EXECUTOR_TASK_LAST
 } ucc_ee_executor_task_type_t;
 
@@ -81,6 +84,9 @@ typedef struct ucc_ee_executor_params {
    UCC_EE_EXECUTOR_TASK_COPY_MULTI operations */
 #define UCC_EE_EXECUTOR_MULTI_OP_NUM_BUFS 7
 
+/* Maximum number of extra destinations of UCC_EE_EXECUTOR_TASK_REDUCE_COPY */
+#define UCC_EE_EXECUTOR_REDUCE_COPY_NUM_DST 4
+
 /* Reduces "n_srcs" buffers (each contains "count" elements of type "dt")
    into "dst" buffer.
 
@@ -94,7 +100,12 @@ typedef struct ucc_ee_executor_params {
    is complete.
 
    If UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA flag is set on task_args
-   each element of the result of reduction is multiplied by "alpha" */
+   each element of the result of reduction is multiplied by "alpha"
+
+   If UCC_EEE_TASK_FLAG_NT_STORE flag is set on task_args the result is
+   written with non-temporal stores that bypass the cache. It is meant for
+   results larger than the last level cache that are not read back soon,
+   executors that can not stream the stores ignore the flag. */
 typedef struct ucc_eee_task_reduce {
     void *             dst;
     union {
@@ -140,6 +151,48 @@ typedef struct ucc_eee_task_reduce_strided {
     uint16_t           n_src2;
 } ucc_eee_task_reduce_strided_t;
 
+/* Same as UCC_EE_EXECUTOR_TASK_REDUCE, in addition the result is copied to
+   "n_dst2" buffers "dst2". The result is produced once and written to all
+   the destinations while it is in cache, none of them is read back to make
+   the copies. UCC_EEE_TASK_FLAG_NT_STORE applies to all destinations. */
+typedef struct ucc_eee_task_reduce_copy {
+    ucc_eee_task_reduce_t reduce;
+    void                 *dst2[UCC_EE_EXECUTOR_REDUCE_COPY_NUM_DST];
+    uint16_t              n_dst2;
+} ucc_eee_task_reduce_copy_t;
+
+/* Scatter-gather list tasks: "n_entries" independent copies or reductions
+   submitted as one task. Unlike the MULTI tasks the number of entries is not
+   limited, the "entries" array is owned by the caller and must stay valid
+   until the task completes. */
+typedef struct ucc_eee_sg_copy_entry {
+    void  *src;
+    void  *dst;
+    size_t len;
+} ucc_eee_sg_copy_entry_t;
+
+typedef struct ucc_eee_task_copy_sg {
+    ucc_eee_sg_copy_entry_t *entries;
+    size_t                   n_entries;
+} ucc_eee_task_copy_sg_t;
+
+/* Reduces "n_srcs" buffers "srcs" of "count" elements into "dst", the flags
+   of the task apply to every entry */
+typedef struct ucc_eee_sg_reduce_entry {
+    void    *dst;
+    void   **srcs;
+    size_t   count;
+    uint16_t n_srcs;
+} ucc_eee_sg_reduce_entry_t;
+
+typedef struct ucc_eee_task_reduce_sg {
+    ucc_eee_sg_reduce_entry_t *entries;
+    size_t                     n_entries;
+    double                     alpha;
+    ucc_datatype_t             dt;
+    ucc_reduction_op_t         op;
+} ucc_eee_task_reduce_sg_t;
+
 /* Copies len bytes from "src" into "dst" */
 typedef struct ucc_eee_task_copy {
     void * src;
@@ -149,7 +202,8 @@ typedef struct ucc_eee_task_copy {
 
 enum ucc_eee_task_flags {
     UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA = UCC_BIT(0),
-    UCC_EEE_TASK_FLAG_REDUCE_SRCS_EXT   = UCC_BIT(1)
+    UCC_EEE_TASK_FLAG_REDUCE_SRCS_EXT   = UCC_BIT(1),
+    UCC_EEE_TASK_FLAG_NT_STORE          = UCC_BIT(2)
 };
 
 /* Performs "num_vectors" copies from SRC[i] to DST[i] */
@@ -169,6 +223,9 @@ typedef struct ucc_ee_executor_task_args {
         ucc_eee_task_reduce_multi_dst_t reduce_multi_dst;
         ucc_eee_task_copy_t             copy;
         ucc_eee_task_copy_multi_t       copy_multi;
+        ucc_eee_task_reduce_copy_t      reduce_copy;
+        ucc_eee_task_copy_sg_t          copy_sg;
+        ucc_eee_task_reduce_sg_t        reduce_sg;
     };
 } ucc_ee_executor_task_args_t;
 
@@ -7,6 +7,7 @@
 #include "ec_cpu.h"
 #include "utils/arch/cpu.h"
 #include "components/mc/ucc_mc.h"
+#include "core/ucc_dt.h"
 #include <limits.h>
 
 static ucc_config_field_t ucc_ec_cpu_config_table[] = {
@@ -113,16 +114,30 @@ ucc_status_t ucc_cpu_executor_task_post(ucc_ee_executor_t *executor,
     eee_task->eee = executor;
     switch (task_args->task_type) {
     case UCC_EE_EXECUTOR_TASK_REDUCE:
-        status = ucc_ec_cpu_reduce((ucc_eee_task_reduce_t *)&task_args->reduce, task_args->reduce.dst,
-                                   (task_args->flags &
-                                        UCC_EEE_TASK_FLAG_REDUCE_SRCS_EXT) ?
-                                        task_args->reduce.srcs_ext :
-                                        task_args->reduce.srcs,
-                                    task_args->flags);
+        status = ucc_ec_cpu_reduce_copy(
+            (ucc_eee_task_reduce_t *)&task_args->reduce, task_args->reduce.dst,
+            (task_args->flags & UCC_EEE_TASK_FLAG_REDUCE_SRCS_EXT) ?
+                task_args->reduce.srcs_ext : task_args->reduce.srcs,
+            NULL, 0, task_args->flags);
         if (ucc_unlikely(UCC_OK != status)) {
             goto free_task;
         }
         break;
+    case UCC_EE_EXECUTOR_TASK_REDUCE_COPY:
+    {
+        ucc_eee_task_reduce_copy_t *trc =
+            (ucc_eee_task_reduce_copy_t *)&task_args->reduce_copy;
+
+        ucc_assert(trc->n_dst2 <= UCC_EE_EXECUTOR_REDUCE_COPY_NUM_DST);
+        status = ucc_ec_cpu_reduce_copy(
+            &trc->reduce, trc->reduce.dst,
+            (task_args->flags & UCC_EEE_TASK_FLAG_REDUCE_SRCS_EXT) ?
+                trc->reduce.srcs_ext : trc->reduce.srcs,
+            trc->dst2, trc->n_dst2, task_args->flags);
+        if (ucc_unlikely(UCC_OK != status)) {
+            goto free_task;
+        }
+    } break;
     case UCC_EE_EXECUTOR_TASK_REDUCE_STRIDED:
     {
         ucc_eee_task_reduce_strided_t *trs =
@@ -133,6 +148,14 @@ ucc_status_t ucc_cpu_executor_task_post(ucc_ee_executor_t *executor,
         ucc_eee_task_reduce_t tr;
         int                   i;
 
+        if (ucc_unlikely(UCC_DT_IS_GENERIC(trs->dt))) {
+            /* user callback takes the strided layout as is */
+            status = ucc_ec_cpu_reduce_strided_userdefined(trs);
+            if (ucc_unlikely(UCC_OK != status)) {
+                goto free_task;
+            }
+            break;
+        }
         if (n_srcs <= UCC_EE_EXECUTOR_NUM_BUFS) {
             srcs = &tr.srcs[0];
         } else {
@@ -151,7 +174,7 @@ ucc_status_t ucc_cpu_executor_task_post(ucc_ee_executor_t *executor,
         tr.dst    = trs->dst;
         tr.alpha  = trs->alpha;
 
-        status = ucc_ec_cpu_reduce(&tr, tr.dst, srcs, flags);
+        status = ucc_ec_cpu_reduce_copy(&tr, tr.dst, srcs, NULL, 0, flags);
         if (ucc_unlikely(UCC_OK != status)) {
             goto free_task;
         }
@@ -159,6 +182,38 @@ ucc_status_t ucc_cpu_executor_task_post(ucc_ee_executor_t *executor,
     case UCC_EE_EXECUTOR_TASK_COPY:
         memcpy(task_args->copy.dst, task_args->copy.src, task_args->copy.len);
         break;
+    case UCC_EE_EXECUTOR_TASK_COPY_SG:
+    {
+        const ucc_eee_sg_copy_entry_t *e = task_args->copy_sg.entries;
+        size_t                         i;
+
+        for (i = 0; i < task_args->copy_sg.n_entries; i++) {
+            if (e[i].src != e[i].dst) {
+                memcpy(e[i].dst, e[i].src, e[i].len);
+            }
+        }
+    } break;
+    case UCC_EE_EXECUTOR_TASK_REDUCE_SG:
+    {
+        const ucc_eee_task_reduce_sg_t *trs = &task_args->reduce_sg;
+        ucc_eee_task_reduce_t           tr;
+        size_t                          i;
+
+        tr.dt    = trs->dt;
+        tr.op    = trs->op;
+        tr.alpha = trs->alpha;
+        for (i = 0; i < trs->n_entries; i++) {
+            tr.count  = trs->entries[i].count;
+            tr.n_srcs = trs->entries[i].n_srcs;
+            tr.dst    = trs->entries[i].dst;
+            status    = ucc_ec_cpu_reduce_copy(&tr, tr.dst,
+                                               trs->entries[i].srcs, NULL, 0,
+                                               task_args->flags);
+            if (ucc_unlikely(UCC_OK != status)) {
+                goto free_task;
+            }
+        }
+    } break;
     case UCC_EE_EXECUTOR_TASK_COPY_MULTI:
     default:
         status = UCC_ERR_NOT_SUPPORTED;
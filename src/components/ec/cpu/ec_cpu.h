@@ -26,4 +26,13 @@ typedef struct ucc_ec_cpu {
 extern ucc_ec_cpu_t ucc_ec_cpu;
 
 ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst, void * const * restrict srcs, uint16_t flags);
+
+ucc_status_t
+ucc_ec_cpu_reduce_strided_userdefined(ucc_eee_task_reduce_strided_t *task);
+
+/* Reduction that also copies the result to n_dst2 extra buffers and honors
+   UCC_EEE_TASK_FLAG_NT_STORE, without either it is ucc_ec_cpu_reduce */
+ucc_status_t ucc_ec_cpu_reduce_copy(ucc_eee_task_reduce_t *task, void *dst,
+                                    void * const *srcs, void * const *dst2,
+                                    int n_dst2, uint16_t flags);
 #endif
@@ -5,52 +5,73 @@
  */
 
 #include "utils/ucc_math_op.h"
+#include "utils/ucc_dt_reduce.h"
+#include "utils/arch/cpu.h"
 #include "ec_cpu.h"
 #include <complex.h>
 
-#define DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, OP)                  \
+/* value-index pairs of UCC_OP_MAXLOC/MINLOC, same layout as MPI_FLOAT_INT,
+   MPI_DOUBLE_INT, MPI_2INT and MPI_LONG_INT */
+#define UCC_EC_CPU_LOC_PAIR(_name, _vtype)                                     \
+    typedef struct {                                                           \
+        _vtype  value;                                                         \
+        int32_t index;                                                         \
+    } _name
+
+UCC_EC_CPU_LOC_PAIR(ucc_ec_cpu_float32_int32_t, float);
+UCC_EC_CPU_LOC_PAIR(ucc_ec_cpu_float64_int32_t, double);
+UCC_EC_CPU_LOC_PAIR(ucc_ec_cpu_int32_int32_t, int32_t);
+UCC_EC_CPU_LOC_PAIR(ucc_ec_cpu_int64_int32_t, int64_t);
+
+#if SIZEOF___INT128 == 16
+__extension__ typedef __int128          ucc_ec_cpu_int128_t;
+__extension__ typedef unsigned __int128 ucc_ec_cpu_uint128_t;
+#endif
+
+#define DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, OP, _S)              \
     do {                                                                       \
         size_t _i, _j;                                                         \
-        type  _tmp;                                                            \
+        /* promoted type, sources narrower than int are summed in int */       \
+        typeof((type)0 + (type)0) _tmp;                                        \
         size_t __count = _count;                                               \
         switch (_n_srcs) {                                                     \
         case 2:                                                                \
             for (_i = 0; _i < __count; _i++) {                                 \
-                d[_i] = OP##_2(s[0][_i], s[1][_i]);                            \
+                d[_i] = _S(OP##_2(s[0][_i], s[1][_i]));                        \
             }                                                                  \
             break;                                                             \
         case 3:                                                                \
             for (_i = 0; _i < __count; _i++) {                                 \
-                d[_i] = OP##_3(s[0][_i], s[1][_i], s[2][_i]);                  \
+                d[_i] = _S(OP##_3(s[0][_i], s[1][_i], s[2][_i]));              \
             }                                                                  \
             break;                                                             \
         case 4:                                                                \
             for (_i = 0; _i < __count; _i++) {                                 \
-                d[_i] = OP##_4(s[0][_i], s[1][_i], s[2][_i], s[3][_i]);        \
+                d[_i] = _S(OP##_4(s[0][_i], s[1][_i], s[2][_i], s[3][_i]));    \
             }                                                                  \
             break;                                                             \
         case 5:                                                                \
             for (_i = 0; _i < __count; _i++) {                                 \
-                d[_i] =                                                        \
-                    OP##_5(s[0][_i], s[1][_i], s[2][_i], s[3][_i], s[4][_i]);  \
+                d[_i] = _S(OP##_5(s[0][_i], s[1][_i], s[2][_i], s[3][_i],      \
+                                  s[4][_i]));                                  \
             }                                                                  \
             break;                                                             \
         case 6:                                                                \
             for (_i = 0; _i < __count; _i++) {                                 \
-                d[_i] = OP##_6(s[0][_i], s[1][_i], s[2][_i], s[3][_i],         \
-                               s[4][_i], s[5][_i]);                            \
+                d[_i] = _S(OP##_6(s[0][_i], s[1][_i], s[2][_i], s[3][_i],      \
+                                  s[4][_i], s[5][_i]));                        \
             }                                                                  \
             break;                                                             \
         case 7:                                                                \
             for (_i = 0; _i < __count; _i++) {                                 \
-                d[_i] = OP##_7(s[0][_i], s[1][_i], s[2][_i], s[3][_i],         \
-                               s[4][_i], s[5][_i], s[6][_i]);                  \
+                d[_i] = _S(OP##_7(s[0][_i], s[1][_i], s[2][_i], s[3][_i],      \
+                                  s[4][_i], s[5][_i], s[6][_i]));              \
             }                                                                  \
             break;                                                             \
         case 8:                                                                \
             for (_i = 0; _i < __count; _i++) {                                 \
-                d[_i] = OP##_8(s[0][_i], s[1][_i], s[2][_i], s[3][_i],         \
-                               s[4][_i], s[5][_i], s[6][_i], s[7][_i]);        \
+                d[_i] = _S(OP##_8(s[0][_i], s[1][_i], s[2][_i], s[3][_i],      \
+                                  s[4][_i], s[5][_i], s[6][_i], s[7][_i]));    \
             }                                                                  \
             break;                                                             \
         default:                                                               \
@@ -60,17 +81,48 @@
                 for (_j = 8; _j < _n_srcs; _j++) {                             \
                     _tmp = OP##_2(_tmp, s[_j][_i]);                            \
                 }                                                              \
-                d[_i] = _tmp;                                                  \
+                d[_i] = _S(_tmp);                                              \
             }                                                                  \
             break;                                                             \
         }                                                                      \
     } while (0)
 
-#define VEC_OP(_d, _count, _alpha)                                             \
+/* Scaling by alpha is applied to the result before it is stored, so AVG does
+   not make a second pass over dst */
+#define DO_SCALE_NONE(_v)  (_v)
+#define DO_SCALE_ALPHA(_v) ((_v) * task->alpha)
+
+#define DO_DT_REDUCE_SCALED(type, s, d, _count, _n_srcs, OP)                   \
     do {                                                                       \
-        size_t _i;                                                             \
-        for (_i = 0; _i < _count; _i++) {                                      \
-            _d[_i] = _d[_i] * _alpha;                                          \
+        if (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) {                     \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, OP,              \
+                                 DO_SCALE_ALPHA);                              \
+        } else {                                                               \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, OP,              \
+                                 DO_SCALE_NONE);                               \
+        }                                                                      \
+    } while (0)
+
+#define DO_DT_REDUCE_SUM_SCALED(type, s, d, _count, _n_srcs)                   \
+    DO_DT_REDUCE_SCALED(type, s, d, _count, _n_srcs, DO_OP_SUM)
+
+/* Integer AVG divides the sum by the number of contributions 1 / alpha
+   instead of multiplying by alpha, so the result is exact and rounded
+   toward zero. Sources narrower than int are summed in int by promotion,
+   so the sum of a single reduction call does not wrap. */
+#define DO_SCALE_DIV(_v) ((_v) / _div)
+
+#define DO_DT_REDUCE_SUM_DIV(type, s, d, _count, _n_srcs)                      \
+    do {                                                                       \
+        if (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) {                     \
+            const typeof((type)0 + (type)0) _div =                             \
+                1.0 / task->alpha + 0.5;                                       \
+            ucc_assert(_div > 0);                                              \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_SUM,       \
+                                 DO_SCALE_DIV);                                \
+        } else {                                                               \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_SUM,       \
+                                 DO_SCALE_NONE);                               \
         }                                                                      \
     } while (0)
 
@@ -81,37 +133,43 @@
         switch (_op) {                                                         \
         case UCC_OP_AVG:                                                       \
         case UCC_OP_SUM:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_SUM);      \
-            if (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) {                 \
-                VEC_OP(d, _count, task->alpha);                                \
-            }                                                                  \
+            DO_DT_REDUCE_SUM_DIV(type, s, d, _count, _n_srcs);                 \
             break;                                                             \
         case UCC_OP_MIN:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_MIN);      \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_MIN,       \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         case UCC_OP_MAX:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_MAX);      \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_MAX,       \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         case UCC_OP_PROD:                                                      \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_PROD);     \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_PROD,      \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         case UCC_OP_LAND:                                                      \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_LAND);     \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_LAND,      \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         case UCC_OP_BAND:                                                      \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_BAND);     \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_BAND,      \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         case UCC_OP_LOR:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_LOR);      \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_LOR,       \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         case UCC_OP_BOR:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_BOR);      \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_BOR,       \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         case UCC_OP_LXOR:                                                      \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_LXOR);     \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_LXOR,      \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         case UCC_OP_BXOR:                                                      \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_BXOR);     \
+            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_BXOR,      \
+                                 DO_SCALE_NONE);                               \
             break;                                                             \
         default:                                                               \
             ec_error(&ucc_ec_cpu.super,                                        \
@@ -122,54 +180,243 @@
         }                                                                      \
     } while (0)
 
-#define DO_DT_REDUCE_WITH_OP_BFLOAT16(_srcs, _dst, _count, _n_srcs, _OP,       \
-                                      _alpha)                                  \
+/* Reduction of narrow floats (bfloat16, float16, fp8): all sources are
+   accumulated in fp32 and the result is rounded to the storage type once */
+#define DO_DT_REDUCE_WITH_OP_LOWP(_type, _to_f32, _from_f32, _srcs, _dst,     \
+                                  _start, _count, _n_srcs, _OP, _alpha)        \
     do {                                                                       \
-        float     _tmp;                                                        \
-        size_t    _i, _j;                                                      \
-        int16_t **_s = (int16_t **)_srcs;                                      \
-        int16_t * _d = (int16_t *)_dst;                                        \
-        for (_i = 0; _i < _count; _i++) {                                      \
-            _tmp = _OP(bfloat16tofloat32(&_s[0][_i]),                          \
-                       bfloat16tofloat32(&_s[1][_i]));                         \
+        float   _tmp;                                                          \
+        size_t  _i, _j;                                                        \
+        _type **_s = (_type **)_srcs;                                          \
+        _type * _d = (_type *)_dst;                                            \
+        for (_i = _start; _i < _count; _i++) {                                 \
+            _tmp = _OP(_to_f32(&_s[0][_i]), _to_f32(&_s[1][_i]));              \
             for (_j = 2; _j < _n_srcs; _j++) {                                 \
-                _tmp = _OP(_tmp, bfloat16tofloat32(&_s[_j][_i]));              \
+                _tmp = _OP(_tmp, _to_f32(&_s[_j][_i]));                        \
             }                                                                  \
-            float32tobfloat16(_tmp *_alpha, &_d[_i]);                          \
+            _from_f32(_tmp *_alpha, &_d[_i]);                                  \
         }                                                                      \
     } while (0)
 
-#define DO_DT_REDUCE_BFLOAT16(_srcs, _dst, _op, _count, _n_srcs)               \
+#define DO_DT_REDUCE_LOWP(_type, _to_f32, _from_f32, _name, _srcs, _dst, _op, \
+                          _start, _count, _n_srcs)                             \
     do {                                                                       \
         float _a = (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) ? task->alpha \
                                                                  : 1.0f;       \
         switch (_op) {                                                         \
         case UCC_OP_AVG:                                                       \
         case UCC_OP_SUM:                                                       \
-            DO_DT_REDUCE_WITH_OP_BFLOAT16(_srcs, _dst, _count, _n_srcs,        \
-                                          DO_OP_SUM, _a);                      \
+            DO_DT_REDUCE_WITH_OP_LOWP(_type, _to_f32, _from_f32, _srcs, _dst,  \
+                                      _start, _count, _n_srcs, DO_OP_SUM, _a); \
             break;                                                             \
         case UCC_OP_PROD:                                                      \
-            DO_DT_REDUCE_WITH_OP_BFLOAT16(_srcs, _dst, _count, _n_srcs,        \
-                                          DO_OP_PROD, _a);                     \
+            DO_DT_REDUCE_WITH_OP_LOWP(_type, _to_f32, _from_f32, _srcs, _dst,  \
+                                      _start, _count, _n_srcs, DO_OP_PROD,     \
+                                      _a);                                     \
             break;                                                             \
         case UCC_OP_MIN:                                                       \
-            DO_DT_REDUCE_WITH_OP_BFLOAT16(_srcs, _dst, _count, _n_srcs,        \
-                                          DO_OP_MIN, _a);                      \
+            DO_DT_REDUCE_WITH_OP_LOWP(_type, _to_f32, _from_f32, _srcs, _dst,  \
+                                      _start, _count, _n_srcs, DO_OP_MIN, _a); \
             break;                                                             \
         case UCC_OP_MAX:                                                       \
-            DO_DT_REDUCE_WITH_OP_BFLOAT16(_srcs, _dst, _count, _n_srcs,        \
-                                          DO_OP_MAX, _a);                      \
+            DO_DT_REDUCE_WITH_OP_LOWP(_type, _to_f32, _from_f32, _srcs, _dst,  \
+                                      _start, _count, _n_srcs, DO_OP_MAX, _a); \
             break;                                                             \
         default:                                                               \
             ec_error(&ucc_ec_cpu.super,                                        \
-                     "bfloat16 dtype does not support "                        \
+                     _name " dtype does not support "                          \
                      "requested reduce op: %s",                                \
                      ucc_reduction_op_str(_op));                               \
             return UCC_ERR_NOT_SUPPORTED;                                      \
         }                                                                      \
     } while (0)
 
+#if defined(__AVX512F__) || (defined(__F16C__) && defined(__AVX__))
+#include <immintrin.h>
+#define HAVE_EC_CPU_FLOAT16_VEC 1
+
+#if defined(__AVX512F__)
+#define F16_VLEN 16
+typedef __m512 f16_vec_t;
+#define F16_LOAD(_p) _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)(_p)))
+#define F16_STORE(_p, _v)                                                      \
+    _mm256_storeu_si256((__m256i *)(_p),                                       \
+                        _mm512_cvtps_ph(_v, _MM_FROUND_TO_NEAREST_INT |        \
+                                                _MM_FROUND_NO_EXC))
+#define F16_SET1 _mm512_set1_ps
+#define F16_ADD  _mm512_add_ps
+#define F16_MUL  _mm512_mul_ps
+#define F16_MIN  _mm512_min_ps
+#define F16_MAX  _mm512_max_ps
+#else
+#define F16_VLEN 8
+typedef __m256 f16_vec_t;
+#define F16_LOAD(_p) _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(_p)))
+#define F16_STORE(_p, _v)                                                      \
+    _mm_storeu_si128((__m128i *)(_p),                                          \
+                     _mm256_cvtps_ph(_v, _MM_FROUND_TO_NEAREST_INT |           \
+                                             _MM_FROUND_NO_EXC))
+#define F16_SET1 _mm256_set1_ps
+#define F16_ADD  _mm256_add_ps
+#define F16_MUL  _mm256_mul_ps
+#define F16_MIN  _mm256_min_ps
+#define F16_MAX  _mm256_max_ps
+#endif
+
+#define DO_F16_VEC_REDUCE(_OP)                                                 \
+    do {                                                                       \
+        for (i = 0; i < n; i += F16_VLEN) {                                    \
+            acc = _OP(F16_LOAD(&s[0][i]), F16_LOAD(&s[1][i]));                 \
+            for (j = 2; j < n_srcs; j++) {                                     \
+                acc = _OP(acc, F16_LOAD(&s[j][i]));                            \
+            }                                                                  \
+            F16_STORE(&d[i], F16_MUL(acc, a));                                 \
+        }                                                                      \
+    } while (0)
+
+/* Converts float16 to fp32 in registers and accumulates in fp32, same as the
+   scalar path. Returns the number of elements reduced, the tail is left to
+   the scalar loop. */
+static size_t ucc_ec_cpu_reduce_float16_vec(uint16_t *d, void * const *srcs,
+                                            size_t count, size_t n_srcs,
+                                            ucc_reduction_op_t op, float alpha)
+{
+    const uint16_t **s = (const uint16_t **)srcs;
+    size_t           n = ucc_align_down(count, F16_VLEN);
+    f16_vec_t        a = F16_SET1(alpha);
+    f16_vec_t        acc;
+    size_t           i, j;
+
+    switch (op) {
+    case UCC_OP_AVG:
+    case UCC_OP_SUM:
+        DO_F16_VEC_REDUCE(F16_ADD);
+        break;
+    case UCC_OP_PROD:
+        DO_F16_VEC_REDUCE(F16_MUL);
+        break;
+    case UCC_OP_MIN:
+        DO_F16_VEC_REDUCE(F16_MIN);
+        break;
+    case UCC_OP_MAX:
+        DO_F16_VEC_REDUCE(F16_MAX);
+        break;
+    default:
+        return 0;
+    }
+    return n;
+}
+#endif
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define HAVE_EC_CPU_COMPLEX_VEC 1
+
+/* Complex vectors hold interleaved (re, im) pairs, the product is
+   (a + bi)(c + di) = (ac - bd) + (ad + bc)i */
+static inline __m256 ucc_ec_cpu_cmul_ps(__m256 x, __m256 y)
+{
+    return _mm256_addsub_ps(
+        _mm256_mul_ps(x, _mm256_moveldup_ps(y)),
+        _mm256_mul_ps(_mm256_permute_ps(x, 0xb1), _mm256_movehdup_ps(y)));
+}
+
+static inline __m256d ucc_ec_cpu_cmul_pd(__m256d x, __m256d y)
+{
+    return _mm256_addsub_pd(
+        _mm256_mul_pd(x, _mm256_movedup_pd(y)),
+        _mm256_mul_pd(_mm256_permute_pd(x, 0x5), _mm256_permute_pd(y, 0xf)));
+}
+
+#define CPXF_VLEN          4
+#define CPXF_LOAD(_p)      _mm256_loadu_ps((const float *)(_p))
+#define CPXF_STORE(_p, _v) _mm256_storeu_ps((float *)(_p), _v)
+#define CPXF_SET1          _mm256_set1_ps
+#define CPXF_ADD           _mm256_add_ps
+#define CPXF_MUL           _mm256_mul_ps
+#define CPXF_CMUL          ucc_ec_cpu_cmul_ps
+
+#define CPXD_VLEN          2
+#define CPXD_LOAD(_p)      _mm256_loadu_pd((const double *)(_p))
+#define CPXD_STORE(_p, _v) _mm256_storeu_pd((double *)(_p), _v)
+#define CPXD_SET1          _mm256_set1_pd
+#define CPXD_ADD           _mm256_add_pd
+#define CPXD_MUL           _mm256_mul_pd
+#define CPXD_CMUL          ucc_ec_cpu_cmul_pd
+
+/* Tail elements are reduced by the scalar op with the same alpha, so the
+   result does not depend on the alignment of count */
+#define DO_CPX_VEC_REDUCE(_P, _VOP, _SOP)                                      \
+    do {                                                                       \
+        for (i = 0; i + _P##_VLEN <= count; i += _P##_VLEN) {                  \
+            acc = _VOP(_P##_LOAD(&s[0][i]), _P##_LOAD(&s[1][i]));              \
+            for (j = 2; j < n_srcs; j++) {                                     \
+                acc = _VOP(acc, _P##_LOAD(&s[j][i]));                          \
+            }                                                                  \
+            _P##_STORE(&d[i], _P##_MUL(acc, a));                               \
+        }                                                                      \
+        for (; i < count; i++) {                                               \
+            t = _SOP(s[0][i], s[1][i]);                                        \
+            for (j = 2; j < n_srcs; j++) {                                     \
+                t = _SOP(t, s[j][i]);                                          \
+            }                                                                  \
+            d[i] = t * alpha;                                                  \
+        }                                                                      \
+    } while (0)
+
+/* SUM, AVG and PROD of complex float and double. Return 0 if the op is not
+   vectorized and is left to the scalar path. */
+static int ucc_ec_cpu_reduce_complex_float_vec(float complex *d,
+                                               void * const *srcs,
+                                               size_t count, size_t n_srcs,
+                                               ucc_reduction_op_t op,
+                                               float alpha)
+{
+    const float complex **s = (const float complex **)srcs;
+    __m256                a = CPXF_SET1(alpha);
+    __m256                acc;
+    float complex         t;
+    size_t                i, j;
+
+    switch (op) {
+    case UCC_OP_AVG:
+    case UCC_OP_SUM:
+        DO_CPX_VEC_REDUCE(CPXF, CPXF_ADD, DO_OP_SUM_2);
+        return 1;
+    case UCC_OP_PROD:
+        DO_CPX_VEC_REDUCE(CPXF, CPXF_CMUL, DO_OP_PROD_2);
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int ucc_ec_cpu_reduce_complex_double_vec(double complex *d,
+                                                void * const *srcs,
+                                                size_t count, size_t n_srcs,
+                                                ucc_reduction_op_t op,
+                                                double alpha)
+{
+    const double complex **s = (const double complex **)srcs;
+    __m256d                a = CPXD_SET1(alpha);
+    __m256d                acc;
+    double complex         t;
+    size_t                 i, j;
+
+    switch (op) {
+    case UCC_OP_AVG:
+    case UCC_OP_SUM:
+        DO_CPX_VEC_REDUCE(CPXD, CPXD_ADD, DO_OP_SUM_2);
+        return 1;
+    case UCC_OP_PROD:
+        DO_CPX_VEC_REDUCE(CPXD, CPXD_CMUL, DO_OP_PROD_2);
+        return 1;
+    default:
+        return 0;
+    }
+}
+#endif
+
 #define DO_DT_REDUCE_FLOAT(type, _srcs, _dst, _op, _count, _n_srcs)            \
     do {                                                                       \
         const type **restrict s = (const type **)_srcs;                        \
@@ -177,16 +424,16 @@
         switch (_op) {                                                         \
         case UCC_OP_AVG:                                                       \
         case UCC_OP_SUM:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_SUM);      \
+            DO_DT_REDUCE_SUM_SCALED(type, s, d, _count, _n_srcs);              \
             break;                                                             \
         case UCC_OP_PROD:                                                      \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_PROD);     \
+            DO_DT_REDUCE_SCALED(type, s, d, _count, _n_srcs, DO_OP_PROD);      \
             break;                                                             \
         case UCC_OP_MIN:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_MIN);      \
+            DO_DT_REDUCE_SCALED(type, s, d, _count, _n_srcs, DO_OP_MIN);       \
             break;                                                             \
         case UCC_OP_MAX:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_MAX);      \
+            DO_DT_REDUCE_SCALED(type, s, d, _count, _n_srcs, DO_OP_MAX);       \
             break;                                                             \
         default:                                                               \
             ec_error(&ucc_ec_cpu.super,                                        \
@@ -195,9 +442,6 @@
                      ucc_reduction_op_str(_op));                               \
             return UCC_ERR_NOT_SUPPORTED;                                      \
         }                                                                      \
-        if (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) {                     \
-            VEC_OP(d, _count, task->alpha);                                    \
-        }                                                                      \
     } while (0)
 
 #define DO_DT_REDUCE_FLOAT_COMPLEX(type, _srcs, _dst, _op, _count, _n_srcs)    \
@@ -207,10 +451,10 @@
         switch (_op) {                                                         \
         case UCC_OP_AVG:                                                       \
         case UCC_OP_SUM:                                                       \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_SUM);      \
+            DO_DT_REDUCE_SUM_SCALED(type, s, d, _count, _n_srcs);              \
             break;                                                             \
         case UCC_OP_PROD:                                                      \
-            DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, DO_OP_PROD);     \
+            DO_DT_REDUCE_SCALED(type, s, d, _count, _n_srcs, DO_OP_PROD);      \
             break;                                                             \
         default:                                                               \
             ec_error(&ucc_ec_cpu.super,                                        \
@@ -219,14 +463,124 @@
                      ucc_reduction_op_str(_op));                               \
             return UCC_ERR_NOT_SUPPORTED;                                      \
         }                                                                      \
-        if (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) {                     \
-            VEC_OP(d, _count, task->alpha);          \
+    } while (0)
+
+/* _CMP(a, b) is true if pair a is preferred over b, ties on value are
+   resolved to the smaller index. dst may alias the first source. */
+#define DO_DT_REDUCE_WITH_OP_LOC(_ptype, _srcs, _dst, _count, _n_srcs, _CMP)  \
+    do {                                                                       \
+        _ptype *const *_s = (_ptype *const *)_srcs;                            \
+        _ptype        *_d = (_ptype *)_dst;                                    \
+        _ptype         _r;                                                     \
+        size_t         _i, _j;                                                 \
+        for (_i = 0; _i < _count; _i++) {                                      \
+            _r = _s[0][_i];                                                    \
+            for (_j = 1; _j < _n_srcs; _j++) {                                 \
+                if (_CMP(_s[_j][_i].value, _r.value) ||                        \
+                    (_s[_j][_i].value == _r.value &&                           \
+                     _s[_j][_i].index < _r.index)) {                           \
+                    _r = _s[_j][_i];                                           \
+                }                                                              \
+            }                                                                  \
+            _d[_i] = _r;                                                       \
         }                                                                      \
     } while (0)
 
+#define DO_LOC_GT(_a, _b) ((_a) > (_b))
+#define DO_LOC_LT(_a, _b) ((_a) < (_b))
+
+#define DO_DT_REDUCE_LOC(_ptype, _srcs, _dst, _op, _count, _n_srcs)           \
+    do {                                                                       \
+        switch (_op) {                                                         \
+        case UCC_OP_MAXLOC:                                                    \
+            DO_DT_REDUCE_WITH_OP_LOC(_ptype, _srcs, _dst, _count, _n_srcs,     \
+                                     DO_LOC_GT);                               \
+            break;                                                             \
+        case UCC_OP_MINLOC:                                                    \
+            DO_DT_REDUCE_WITH_OP_LOC(_ptype, _srcs, _dst, _count, _n_srcs,     \
+                                     DO_LOC_LT);                               \
+            break;                                                             \
+        default:                                                               \
+            ec_error(&ucc_ec_cpu.super,                                        \
+                     "value-index pair dtype does not support "                \
+                     "requested reduce op: %s",                                \
+                     ucc_reduction_op_str(_op));                               \
+            return UCC_ERR_NOT_SUPPORTED;                                      \
+        }                                                                      \
+    } while (0)
+
+/* User-defined reduction: the callback is invoked once per source over the
+   whole vector, or once for all sources if they are equally strided. The op
+   and alpha are ignored, the callback defines the reduction. */
+static ucc_status_t ucc_ec_cpu_reduce_userdefined(ucc_eee_task_reduce_t *task,
+                                                  void *dst,
+                                                  void *const *srcs)
+{
+    ucc_dt_generic_t *dt     = ucc_dt_to_generic(task->dt);
+    size_t            n_srcs = task->n_srcs;
+    ptrdiff_t         stride;
+    ucc_status_t      status;
+    void             *acc;
+    size_t            i, first;
+
+    if (!UCC_DT_GENERIC_HAS_REDUCE(dt)) {
+        ec_error(&ucc_ec_cpu.super, "user-defined dtype has no reduction");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    ucc_assert(n_srcs >= 2);
+    first  = 0;
+    stride = (n_srcs > 2) ? (char *)srcs[2] - (char *)srcs[1] : 0;
+    for (i = 1; i < n_srcs; i++) {
+        if (srcs[i] == dst) {
+            first = i;
+        }
+        if (stride >= 0 &&
+            (char *)srcs[i] - (char *)srcs[1] != stride * (ptrdiff_t)(i - 1)) {
+            stride = -1;
+        }
+    }
+    if (first == 0 && stride >= 0) {
+        return ucc_dt_reduce_userdefined(srcs[0], srcs[1], dst, n_srcs - 1,
+                                         task->count, stride, dt);
+    }
+    /* source aliased by dst goes first so it is consumed before overwrite */
+    acc = srcs[first];
+    for (i = 0; i < n_srcs; i++) {
+        if (i == first) {
+            continue;
+        }
+        status = ucc_dt_reduce_userdefined(acc, srcs[i], dst, 1, task->count,
+                                           0, dt);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+        acc = dst;
+    }
+    return UCC_OK;
+}
+
+ucc_status_t
+ucc_ec_cpu_reduce_strided_userdefined(ucc_eee_task_reduce_strided_t *task)
+{
+    ucc_dt_generic_t *dt = ucc_dt_to_generic(task->dt);
+
+    if (!UCC_DT_GENERIC_HAS_REDUCE(dt)) {
+        ec_error(&ucc_ec_cpu.super, "user-defined dtype has no reduction");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    return ucc_dt_reduce_userdefined(task->src1, task->src2, task->dst,
+                                     task->n_src2, task->count, task->stride,
+                                     dt);
+}
+
 ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst,
                                void * const * restrict srcs, uint16_t flags)
 {
+    size_t start = 0;
+
+    if (ucc_unlikely(UCC_DT_IS_GENERIC(task->dt))) {
+        return ucc_ec_cpu_reduce_userdefined(task, dst, srcs);
+    }
     switch (task->dt) {
     case UCC_DT_INT8:
         DO_DT_REDUCE_INT(int8_t, srcs, dst, task->op, task->count,
@@ -260,6 +614,22 @@ ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst,
         DO_DT_REDUCE_INT(uint64_t, srcs, dst, task->op, task->count,
                          task->n_srcs);
         break;
+    case UCC_DT_INT128:
+#if SIZEOF___INT128 == 16
+        DO_DT_REDUCE_INT(ucc_ec_cpu_int128_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
+#else
+        return UCC_ERR_NOT_SUPPORTED;
+#endif
+    case UCC_DT_UINT128:
+#if SIZEOF___INT128 == 16
+        DO_DT_REDUCE_INT(ucc_ec_cpu_uint128_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
+#else
+        return UCC_ERR_NOT_SUPPORTED;
+#endif
     case UCC_DT_FLOAT32:
 #if SIZEOF_FLOAT == 4
         DO_DT_REDUCE_FLOAT(float, srcs, dst, task->op, task->count,
@@ -285,11 +655,41 @@ ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst,
         return UCC_ERR_NOT_SUPPORTED;
 #endif
     case UCC_DT_BFLOAT16:
-        DO_DT_REDUCE_BFLOAT16(srcs, dst, task->op, task->count,
-                              task->n_srcs);
+        DO_DT_REDUCE_LOWP(uint16_t, bfloat16tofloat32, float32tobfloat16,
+                          "bfloat16", srcs, dst, task->op, 0, task->count,
+                          task->n_srcs);
+        break;
+    case UCC_DT_FLOAT16:
+#ifdef HAVE_EC_CPU_FLOAT16_VEC
+        start = ucc_ec_cpu_reduce_float16_vec(
+            dst, srcs, task->count, task->n_srcs, task->op,
+            (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) ? task->alpha
+                                                          : 1.0f);
+#endif
+        DO_DT_REDUCE_LOWP(uint16_t, float16tofloat32, float32tofloat16,
+                          "float16", srcs, dst, task->op, start, task->count,
+                          task->n_srcs);
+        break;
+    case UCC_DT_FLOAT8_E4M3:
+        DO_DT_REDUCE_LOWP(uint8_t, float8e4m3tofloat32, float32tofloat8e4m3,
+                          "float8_e4m3", srcs, dst, task->op, 0, task->count,
+                          task->n_srcs);
+        break;
+    case UCC_DT_FLOAT8_E5M2:
+        DO_DT_REDUCE_LOWP(uint8_t, float8e5m2tofloat32, float32tofloat8e5m2,
+                          "float8_e5m2", srcs, dst, task->op, 0, task->count,
+                          task->n_srcs);
         break;
     case UCC_DT_FLOAT32_COMPLEX:
 #if SIZEOF_FLOAT__COMPLEX == 8
+#ifdef HAVE_EC_CPU_COMPLEX_VEC
+        if (ucc_ec_cpu_reduce_complex_float_vec(
+                dst, srcs, task->count, task->n_srcs, task->op,
+                (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) ? task->alpha
+                                                              : 1.0f)) {
+            break;
+        }
+#endif
         DO_DT_REDUCE_FLOAT_COMPLEX(float complex, srcs, dst, task->op,
                                    task->count, task->n_srcs);
         break;
@@ -298,6 +698,14 @@ ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst,
 #endif
     case UCC_DT_FLOAT64_COMPLEX:
 #if SIZEOF_DOUBLE__COMPLEX == 16
+#ifdef HAVE_EC_CPU_COMPLEX_VEC
+        if (ucc_ec_cpu_reduce_complex_double_vec(
+                dst, srcs, task->count, task->n_srcs, task->op,
+                (flags & UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA) ? task->alpha
+                                                              : 1.0)) {
+            break;
+        }
+#endif
         DO_DT_REDUCE_FLOAT_COMPLEX(double complex, srcs, dst, task->op,
                                    task->count, task->n_srcs);
         break;
@@ -312,6 +720,22 @@ ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst,
 #else
         return UCC_ERR_NOT_SUPPORTED;
 #endif
+    case UCC_DT_FLOAT32_INT32:
+        DO_DT_REDUCE_LOC(ucc_ec_cpu_float32_int32_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
+    case UCC_DT_FLOAT64_INT32:
+        DO_DT_REDUCE_LOC(ucc_ec_cpu_float64_int32_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
+    case UCC_DT_INT32_INT32:
+        DO_DT_REDUCE_LOC(ucc_ec_cpu_int32_int32_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
+    case UCC_DT_INT64_INT32:
+        DO_DT_REDUCE_LOC(ucc_ec_cpu_int64_int32_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
     default:
         ec_error(&ucc_ec_cpu.super, "unsupported reduction type (%s)",
                  ucc_datatype_str(task->dt));
@@ -320,3 +744,103 @@ ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst,
 
     return UCC_OK;
 }
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HAVE_EC_CPU_NT_STORE 1
+#endif
+
+/* Results are produced in blocks that stay in L1 and are written out to
+   every destination before the next block is reduced */
+#define UCC_EC_CPU_REDUCE_BLOCK 4096
+
+static inline void ucc_ec_cpu_copy_nt(void *dst, const void *src, size_t len)
+{
+#ifdef HAVE_EC_CPU_NT_STORE
+    size_t      head = ucc_min((-(uintptr_t)dst) & 15, len);
+    const char *s    = (const char *)src + head;
+    __m128i    *d    = PTR_OFFSET(dst, head);
+
+    memcpy(dst, src, head);
+    for (len -= head; len >= 16; len -= 16, s += 16, d++) {
+        _mm_stream_si128(d, _mm_loadu_si128((const __m128i *)s));
+    }
+    memcpy(d, s, len);
+#else
+    memcpy(dst, src, len);
+#endif
+}
+
+ucc_status_t ucc_ec_cpu_reduce_copy(ucc_eee_task_reduce_t *task, void *dst,
+                                    void * const *srcs, void * const *dst2,
+                                    int n_dst2, uint16_t flags)
+{
+    char                  block[UCC_EC_CPU_REDUCE_BLOCK]
+                          __attribute__((aligned(UCC_CACHE_LINE_SIZE)));
+    ucc_eee_task_reduce_t btask;
+    size_t                dt_size, data_size, block_count, offset, i;
+    void                **bsrcs;
+    void                 *bdst;
+    ucc_status_t          status;
+    int                   nt, j;
+
+#ifdef HAVE_EC_CPU_NT_STORE
+    nt = !!(flags & UCC_EEE_TASK_FLAG_NT_STORE);
+#else
+    nt = 0;
+#endif
+    if (UCC_DT_IS_GENERIC(task->dt) || (!nt && n_dst2 == 0)) {
+        status = ucc_ec_cpu_reduce(task, dst, srcs, flags);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+        if (n_dst2 > 0) {
+            /* ucc_dt_size asserts on non-contiguous generic datatypes */
+            data_size = ucc_dt_packed_size(task->dt, dst, task->count);
+            for (j = 0; j < n_dst2; j++) {
+                memcpy(dst2[j], dst, data_size);
+            }
+        }
+        return UCC_OK;
+    }
+
+    dt_size = ucc_dt_size(task->dt);
+
+    /* with non-temporal stores the block is reduced into the stack buffer,
+       otherwise into dst and the copies are made from it while it is hot */
+    block_count = UCC_EC_CPU_REDUCE_BLOCK / dt_size;
+    bsrcs       = alloca(task->n_srcs * sizeof(void *));
+    btask       = *task;
+    for (offset = 0; offset < task->count; offset += btask.count) {
+        btask.count = ucc_min(block_count, task->count - offset);
+        for (i = 0; i < task->n_srcs; i++) {
+            bsrcs[i] = PTR_OFFSET(srcs[i], offset * dt_size);
+        }
+        bdst   = nt ? block : PTR_OFFSET(dst, offset * dt_size);
+        status = ucc_ec_cpu_reduce(&btask, bdst, bsrcs, flags);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+        if (nt) {
+            ucc_ec_cpu_copy_nt(PTR_OFFSET(dst, offset * dt_size), block,
+                               btask.count * dt_size);
+        }
+        for (j = 0; j < n_dst2; j++) {
+            if (nt) {
+                ucc_ec_cpu_copy_nt(PTR_OFFSET(dst2[j], offset * dt_size),
+                                   block, btask.count * dt_size);
+            } else {
+                memcpy(PTR_OFFSET(dst2[j], offset * dt_size), bdst,
+                       btask.count * dt_size);
+            }
+        }
+    }
+#ifdef HAVE_EC_CPU_NT_STORE
+    if (nt) {
+        /* streaming stores are weakly ordered, make them visible before the
+           task is reported complete */
+        _mm_sfence();
+    }
+#endif
+    return UCC_OK;
+}
@@ -11,6 +11,7 @@
 #include "core/ucc_global_opts.h"
 #include "utils/ucc_malloc.h"
 #include "utils/ucc_log.h"
+#include "utils/ucc_timeline.h"
 
 static const ucc_ec_ops_t          *ec_ops[UCC_EE_LAST];
 static const ucc_ee_executor_ops_t *executor_ops[UCC_EE_LAST];
@@ -187,14 +188,29 @@ ucc_status_t ucc_ee_executor_task_post(ucc_ee_executor_t *executor,
                                        const ucc_ee_executor_task_args_t *task_args,
                                        ucc_ee_executor_task_t **task)
 {
+    ucc_status_t status;
+
     UCC_CHECK_EC_AVAILABLE(executor->ee_type);
-    return executor_ops[executor->ee_type]->task_post(executor, task_args, task);
+    status = executor_ops[executor->ee_type]->task_post(executor, task_args,
+                                                        task);
+    if (status == UCC_OK) {
+        UCC_TIMELINE_EVENT(UCC_TIMELINE_EXEC_TASK_POST, "executor_task", "EC",
+                           *task, task_args->task_type, 0, 0);
+    }
+    return status;
 }
 
 ucc_status_t ucc_ee_executor_task_test(const ucc_ee_executor_task_t *task)
 {
+    ucc_status_t status;
+
     UCC_CHECK_EC_AVAILABLE(task->eee->ee_type);
-    return executor_ops[task->eee->ee_type]->task_test(task);
+    status = executor_ops[task->eee->ee_type]->task_test(task);
+    if (status == UCC_OK) {
+        UCC_TIMELINE_EVENT(UCC_TIMELINE_EXEC_TASK_COMPLETE, "executor_task",
+                           "EC", task, 0, 0, 0);
+    }
+    return status;
 }
 
 ucc_status_t ucc_ee_executor_task_finalize(ucc_ee_executor_task_t *task)
@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "allgather.h"
+
+enum
+{
+    ALLGATHER_STAGE_PUBLISH,
+    ALLGATHER_STAGE_GATHER,
+    ALLGATHER_STAGE_WAIT_READS
+};
+
+ucc_base_coll_alg_info_t
+    ucc_tl_shm_allgather_algs[UCC_TL_SHM_ALLGATHER_ALG_LAST + 1] = {
+        [UCC_TL_SHM_ALLGATHER_ALG_FLAT] =
+            {.id   = UCC_TL_SHM_ALLGATHER_ALG_FLAT,
+             .name = "flat",
+             .desc = "every rank copies blocks from the slots of all peers"},
+        [UCC_TL_SHM_ALLGATHER_ALG_CMA] =
+            {.id   = UCC_TL_SHM_ALLGATHER_ALG_CMA,
+             .name = "cma",
+             .desc = "single-copy read of peer buffers with CMA"},
+        [UCC_TL_SHM_ALLGATHER_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
+static void ucc_tl_shm_allgather_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task  = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team  = TASK_TEAM(task);
+    ucc_coll_args_t   *args  = &TASK_ARGS(task);
+    ucc_rank_t         rank  = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    void              *dst   = args->dst.info.buffer;
+    size_t             block = args->dst.info.count / size *
+                               ucc_dt_size(args->dst.info.datatype);
+    void              *own   = PTR_OFFSET(dst, rank * block);
+    void              *src;
+    ucc_rank_t         peer;
+
+    if (!ucc_tl_shm_task_is_turn(task)) {
+        return;
+    }
+
+    switch (task->stage) {
+    case ALLGATHER_STAGE_PUBLISH:
+        if (!ucc_tl_shm_slot_is_free(team)) {
+            return;
+        }
+        src = UCC_IS_INPLACE(*args) ? own : args->src.info.buffer;
+        memcpy(UCC_TL_SHM_SLOT(team, rank), src, block);
+        ucc_tl_shm_slot_publish(team, &UCC_TL_SHM_CTRL(team, rank)->arrive,
+                                task->seq, size - 1);
+        if (!UCC_IS_INPLACE(*args)) {
+            memcpy(own, src, block);
+        }
+        task->cur   = 1;
+        task->stage = ALLGATHER_STAGE_GATHER;
+        /* fall through */
+    case ALLGATHER_STAGE_GATHER:
+        /* start from the next rank to spread the load over peer slots */
+        for (; task->cur < size; task->cur++) {
+            peer = (rank + task->cur) % size;
+            if (!ucc_tl_shm_flag_ready(&UCC_TL_SHM_CTRL(team, peer)->arrive,
+                                       task->seq)) {
+                return;
+            }
+            memcpy(PTR_OFFSET(dst, peer * block), UCC_TL_SHM_SLOT(team, peer),
+                   block);
+            ucc_tl_shm_slot_read_done(team, peer);
+        }
+        break;
+    }
+    ucc_tl_shm_task_complete(task, UCC_OK);
+}
+
+static void ucc_tl_shm_allgather_cma_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task  = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team  = TASK_TEAM(task);
+    ucc_coll_args_t   *args  = &TASK_ARGS(task);
+    ucc_rank_t         rank  = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    void              *dst   = args->dst.info.buffer;
+    size_t             block = args->dst.info.count / size *
+                               ucc_dt_size(args->dst.info.datatype);
+    void              *own   = PTR_OFFSET(dst, rank * block);
+    void              *src;
+    ucc_rank_t         peer;
+    ucc_status_t       status;
+
+    if (!ucc_tl_shm_task_is_turn(task)) {
+        return;
+    }
+
+    switch (task->stage) {
+    case ALLGATHER_STAGE_PUBLISH:
+        src = UCC_IS_INPLACE(*args) ? own : args->src.info.buffer;
+        ucc_tl_shm_buf_publish(team, src, task->seq, size - 1);
+        if (!UCC_IS_INPLACE(*args)) {
+            memcpy(own, src, block);
+        }
+        task->cur   = 1;
+        task->stage = ALLGATHER_STAGE_GATHER;
+        /* fall through */
+    case ALLGATHER_STAGE_GATHER:
+        for (; task->cur < size; task->cur++) {
+            peer = (rank + task->cur) % size;
+            if (!ucc_tl_shm_flag_ready(&UCC_TL_SHM_CTRL(team, peer)->arrive,
+                                       task->seq)) {
+                return;
+            }
+            status = ucc_tl_shm_cma_read(team, peer,
+                                         PTR_OFFSET(dst, peer * block),
+                                         UCC_TL_SHM_CTRL(team, peer)->buf,
+                                         block);
+            if (ucc_unlikely(status != UCC_OK)) {
+                ucc_tl_shm_task_complete(task, status);
+                return;
+            }
+            ucc_tl_shm_slot_read_done(team, peer);
+        }
+        task->stage = ALLGATHER_STAGE_WAIT_READS;
+        /* fall through */
+    case ALLGATHER_STAGE_WAIT_READS:
+        /* own block has to stay valid until all peers are done reading */
+        if (!ucc_tl_shm_slot_is_free(team)) {
+            return;
+        }
+        break;
+    }
+    ucc_tl_shm_task_complete(task, UCC_OK);
+}
+
+ucc_status_t ucc_tl_shm_allgather_flat_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *tl_team,
+                                            ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_coll_args_t   *args = &coll_args->args;
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    if (args->dst.info.count / UCC_TL_TEAM_SIZE(team) *
+        ucc_dt_size(args->dst.info.datatype) > team->slot_size) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    status = ucc_tl_shm_task_init(coll_args, team,
+                                  ucc_tl_shm_flat_radix(team), &task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    task->super.progress = ucc_tl_shm_allgather_progress;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_allgather_cma_init(ucc_base_coll_args_t *coll_args,
+                                           ucc_base_team_t      *tl_team,
+                                           ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    if (!team->cma) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    status = ucc_tl_shm_task_init(coll_args, team,
+                                  ucc_tl_shm_flat_radix(team), &task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    task->super.progress = ucc_tl_shm_allgather_cma_progress;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_allgather_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *tl_team,
+                                       ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_coll_args_t   *args = &coll_args->args;
+
+    if (args->dst.info.count / UCC_TL_TEAM_SIZE(team) *
+        ucc_dt_size(args->dst.info.datatype) > team->slot_size) {
+        return ucc_tl_shm_allgather_cma_init(coll_args, tl_team, task_h);
+    }
+    return ucc_tl_shm_allgather_flat_init(coll_args, tl_team, task_h);
+}
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "allreduce.h"
+#include "reduce/reduce.h"
+
+enum
+{
+    ALLREDUCE_STAGE_BCAST_RECV = UCC_TL_SHM_REDUCE_STAGE_LAST,
+    ALLREDUCE_STAGE_BCAST_SEND
+};
+
+ucc_base_coll_alg_info_t
+    ucc_tl_shm_allreduce_algs[UCC_TL_SHM_ALLREDUCE_ALG_LAST + 1] = {
+        [UCC_TL_SHM_ALLREDUCE_ALG_FLAT] =
+            {.id   = UCC_TL_SHM_ALLREDUCE_ALG_FLAT,
+             .name = "flat",
+             .desc = "flat reduce to rank 0 slot followed by flat bcast"},
+        [UCC_TL_SHM_ALLREDUCE_ALG_TREE] =
+            {.id   = UCC_TL_SHM_ALLREDUCE_ALG_TREE,
+             .name = "tree",
+             .desc = "k-ary tree reduce to rank 0 slot followed by tree bcast"},
+        [UCC_TL_SHM_ALLREDUCE_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
+static void ucc_tl_shm_allreduce_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task  = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team  = TASK_TEAM(task);
+    ucc_coll_args_t   *args  = &TASK_ARGS(task);
+    ucc_rank_t         rank  = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    void              *dst   = args->dst.info.buffer;
+    void              *slot  = UCC_TL_SHM_SLOT(team, rank);
+    size_t             count = args->dst.info.count;
+    ucc_datatype_t     dt    = args->dst.info.datatype;
+    size_t             len   = count * ucc_dt_size(dt);
+    ucc_rank_t         first, n_children, parent;
+    ucc_status_t       status;
+    void              *src;
+
+    if (!ucc_tl_shm_task_is_turn(task)) {
+        return;
+    }
+
+    /* result is reduced to the slot of rank 0 and then broadcast over the
+       same tree */
+    n_children = ucc_tl_shm_tree_children(rank, task->radix, size, &first);
+    switch (task->stage) {
+    case UCC_TL_SHM_REDUCE_STAGE_WAIT:
+    case UCC_TL_SHM_REDUCE_STAGE_REDUCE:
+        src    = UCC_IS_INPLACE(*args) ? dst : args->src.info.buffer;
+        status = ucc_tl_shm_reduce_tree_step(task, 0, src, slot, count, dt);
+        if (status == UCC_INPROGRESS) {
+            return;
+        } else if (ucc_unlikely(status < 0)) {
+            ucc_tl_shm_task_complete(task, status);
+            return;
+        }
+        if (rank == 0) {
+            ucc_tl_shm_slot_publish(team, &UCC_TL_SHM_CTRL(team, rank)->release,
+                                    task->seq, n_children);
+            memcpy(dst, slot, len);
+            break;
+        }
+        ucc_tl_shm_slot_publish(team, &UCC_TL_SHM_CTRL(team, rank)->arrive,
+                                task->seq, 1);
+        task->stage = ALLREDUCE_STAGE_BCAST_RECV;
+        /* fall through */
+    case ALLREDUCE_STAGE_BCAST_RECV:
+        parent = ucc_tl_shm_tree_parent(rank, task->radix);
+        if (!ucc_tl_shm_flag_ready(&UCC_TL_SHM_CTRL(team, parent)->release,
+                                   task->seq)) {
+            return;
+        }
+        memcpy(dst, UCC_TL_SHM_SLOT(team, parent), len);
+        ucc_tl_shm_slot_read_done(team, parent);
+        task->stage = ALLREDUCE_STAGE_BCAST_SEND;
+        /* fall through */
+    case ALLREDUCE_STAGE_BCAST_SEND:
+        if (n_children > 0) {
+            /* partial result in own slot has to be consumed by parent first */
+            if (!ucc_tl_shm_slot_is_free(team)) {
+                return;
+            }
+            memcpy(slot, dst, len);
+            ucc_tl_shm_slot_publish(team, &UCC_TL_SHM_CTRL(team, rank)->release,
+                                    task->seq, n_children);
+        }
+        break;
+    }
+    ucc_tl_shm_task_complete(task, UCC_OK);
+}
+
+static ucc_status_t
+ucc_tl_shm_allreduce_init_radix(ucc_base_coll_args_t *coll_args,
+                                ucc_tl_shm_team_t *team, ucc_rank_t radix,
+                                ucc_coll_task_t **task_h)
+{
+    ucc_coll_args_t   *args = &coll_args->args;
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    if (args->dst.info.count * ucc_dt_size(args->dst.info.datatype) >
+        team->slot_size) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    status = ucc_tl_shm_task_init(coll_args, team, radix, &task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    task->super.progress = ucc_tl_shm_allreduce_progress;
+    task->super.flags   |= UCC_COLL_TASK_FLAG_EXECUTOR;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_allreduce_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *tl_team,
+                                       ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_allreduce_init_radix(coll_args, team,
+                                           ucc_tl_shm_default_radix(team),
+                                           task_h);
+}
+
+ucc_status_t ucc_tl_shm_allreduce_flat_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *tl_team,
+                                            ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_allreduce_init_radix(coll_args, team,
+                                           ucc_tl_shm_flat_radix(team), task_h);
+}
+
+ucc_status_t ucc_tl_shm_allreduce_tree_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *tl_team,
+                                            ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_allreduce_init_radix(coll_args, team,
+                                           ucc_tl_shm_tree_radix(team), task_h);
+}
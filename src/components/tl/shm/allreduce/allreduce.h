@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef ALLREDUCE_H_
+#define ALLREDUCE_H_
+
+#include "tl_shm.h"
+#include "tl_shm_coll.h"
+
+enum
+{
+    UCC_TL_SHM_ALLREDUCE_ALG_FLAT,
+    UCC_TL_SHM_ALLREDUCE_ALG_TREE,
+    UCC_TL_SHM_ALLREDUCE_ALG_LAST
+};
+
+extern ucc_base_coll_alg_info_t
+    ucc_tl_shm_allreduce_algs[UCC_TL_SHM_ALLREDUCE_ALG_LAST + 1];
+
+ucc_status_t ucc_tl_shm_allreduce_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *tl_team,
+                                       ucc_coll_task_t     **task_h);
+
+ucc_status_t ucc_tl_shm_allreduce_flat_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *tl_team,
+                                            ucc_coll_task_t     **task_h);
+
+ucc_status_t ucc_tl_shm_allreduce_tree_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *tl_team,
+                                            ucc_coll_task_t     **task_h);
+
+#endif
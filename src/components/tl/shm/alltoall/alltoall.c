@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "alltoall.h"
+
+enum
+{
+    ALLTOALL_STAGE_PUBLISH,
+    ALLTOALL_STAGE_EXCHANGE,
+    ALLTOALL_STAGE_WAIT_READS
+};
+
+ucc_base_coll_alg_info_t
+    ucc_tl_shm_alltoall_algs[UCC_TL_SHM_ALLTOALL_ALG_LAST + 1] = {
+        [UCC_TL_SHM_ALLTOALL_ALG_CMA] =
+            {.id   = UCC_TL_SHM_ALLTOALL_ALG_CMA,
+             .name = "cma",
+             .desc = "single-copy read of peer buffers with CMA"},
+        [UCC_TL_SHM_ALLTOALL_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
+static void ucc_tl_shm_alltoall_cma_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task  = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team  = TASK_TEAM(task);
+    ucc_coll_args_t   *args  = &TASK_ARGS(task);
+    ucc_rank_t         rank  = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    void              *src   = args->src.info.buffer;
+    void              *dst   = args->dst.info.buffer;
+    size_t             block = args->src.info.count / size *
+                               ucc_dt_size(args->src.info.datatype);
+    ucc_rank_t         peer;
+    ucc_status_t       status;
+
+    if (!ucc_tl_shm_task_is_turn(task)) {
+        return;
+    }
+
+    switch (task->stage) {
+    case ALLTOALL_STAGE_PUBLISH:
+        ucc_tl_shm_buf_publish(team, src, task->seq, size - 1);
+        memcpy(PTR_OFFSET(dst, rank * block), PTR_OFFSET(src, rank * block),
+               block);
+        task->cur   = 1;
+        task->stage = ALLTOALL_STAGE_EXCHANGE;
+        /* fall through */
+    case ALLTOALL_STAGE_EXCHANGE:
+        /* every rank pulls its block from the source buffer of each peer */
+        for (; task->cur < size; task->cur++) {
+            peer = (rank + task->cur) % size;
+            if (!ucc_tl_shm_flag_ready(&UCC_TL_SHM_CTRL(team, peer)->arrive,
+                                       task->seq)) {
+                return;
+            }
+            status = ucc_tl_shm_cma_read(team, peer,
+                                         PTR_OFFSET(dst, peer * block),
+                                         UCC_TL_SHM_CTRL(team, peer)->buf +
+                                             rank * block,
+                                         block);
+            if (ucc_unlikely(status != UCC_OK)) {
+                ucc_tl_shm_task_complete(task, status);
+                return;
+            }
+            ucc_tl_shm_slot_read_done(team, peer);
+        }
+        task->stage = ALLTOALL_STAGE_WAIT_READS;
+        /* fall through */
+    case ALLTOALL_STAGE_WAIT_READS:
+        /* source buffer has to stay valid until all peers are done reading */
+        if (!ucc_tl_shm_slot_is_free(team)) {
+            return;
+        }
+        break;
+    }
+    ucc_tl_shm_task_complete(task, UCC_OK);
+}
+
+ucc_status_t ucc_tl_shm_alltoall_init(ucc_base_coll_args_t *coll_args,
+                                      ucc_base_team_t      *tl_team,
+                                      ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    if (!team->cma || UCC_IS_INPLACE(coll_args->args)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    status = ucc_tl_shm_task_init(coll_args, team,
+                                  ucc_tl_shm_flat_radix(team), &task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    task->super.progress = ucc_tl_shm_alltoall_cma_progress;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "barrier.h"
+
+enum
+{
+    BARRIER_STAGE_FANIN,
+    BARRIER_STAGE_FANOUT
+};
+
+ucc_base_coll_alg_info_t
+    ucc_tl_shm_barrier_algs[UCC_TL_SHM_BARRIER_ALG_LAST + 1] = {
+        [UCC_TL_SHM_BARRIER_ALG_FLAT] =
+            {.id   = UCC_TL_SHM_BARRIER_ALG_FLAT,
+             .name = "flat",
+             .desc = "flat fan-in/fan-out over shared memory flags"},
+        [UCC_TL_SHM_BARRIER_ALG_TREE] =
+            {.id   = UCC_TL_SHM_BARRIER_ALG_TREE,
+             .name = "tree",
+             .desc = "k-ary tree fan-in/fan-out over shared memory flags"},
+        [UCC_TL_SHM_BARRIER_ALG_LAST] = {.id = 0, .name = NULL, .desc = NULL}};
+
+static void ucc_tl_shm_barrier_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team = TASK_TEAM(task);
+    ucc_rank_t         rank = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         size = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         first, n_children, parent;
+
+    if (!ucc_tl_shm_task_is_turn(task)) {
+        return;
+    }
+
+    /* barrier tree is rooted at rank 0 */
+    n_children = ucc_tl_shm_tree_children(rank, task->radix, size, &first);
+    switch (task->stage) {
+    case BARRIER_STAGE_FANIN:
+        for (; task->cur < n_children; task->cur++) {
+            if (!ucc_tl_shm_flag_ready(
+                    &UCC_TL_SHM_CTRL(team, first + task->cur)->arrive,
+                    task->seq)) {
+                return;
+            }
+        }
+        if (rank != 0) {
+            ucc_tl_shm_flag_set(&UCC_TL_SHM_CTRL(team, rank)->arrive,
+                                task->seq);
+        }
+        task->stage = BARRIER_STAGE_FANOUT;
+        /* fall through */
+    case BARRIER_STAGE_FANOUT:
+        if (rank != 0) {
+            parent = ucc_tl_shm_tree_parent(rank, task->radix);
+            if (!ucc_tl_shm_flag_ready(&UCC_TL_SHM_CTRL(team, parent)->release,
+                                       task->seq)) {
+                return;
+            }
+        }
+        if (n_children > 0) {
+            ucc_tl_shm_flag_set(&UCC_TL_SHM_CTRL(team, rank)->release,
+                                task->seq);
+        }
+        break;
+    }
+    ucc_tl_shm_task_complete(task, UCC_OK);
+}
+
+static ucc_status_t
+ucc_tl_shm_barrier_init_radix(ucc_base_coll_args_t *coll_args,
+                              ucc_tl_shm_team_t *team, ucc_rank_t radix,
+                              ucc_coll_task_t **task_h)
+{
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    status = ucc_tl_shm_task_init(coll_args, team, radix, &task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    task->super.progress = ucc_tl_shm_barrier_progress;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_barrier_init(ucc_base_coll_args_t *coll_args,
+                                     ucc_base_team_t      *tl_team,
+                                     ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_barrier_init_radix(coll_args, team,
+                                         ucc_tl_shm_default_radix(team),
+                                         task_h);
+}
+
+ucc_status_t ucc_tl_shm_barrier_flat_init(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t      *tl_team,
+                                          ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_barrier_init_radix(coll_args, team,
+                                         ucc_tl_shm_flat_radix(team), task_h);
+}
+
+ucc_status_t ucc_tl_shm_barrier_tree_init(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t      *tl_team,
+                                          ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_barrier_init_radix(coll_args, team,
+                                         ucc_tl_shm_tree_radix(team), task_h);
+}
@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "bcast.h"
+
+enum
+{
+    BCAST_STAGE_RECV,
+    BCAST_STAGE_SEND,
+    BCAST_STAGE_WAIT_READS
+};
+
+ucc_base_coll_alg_info_t
+    ucc_tl_shm_bcast_algs[UCC_TL_SHM_BCAST_ALG_LAST + 1] = {
+        [UCC_TL_SHM_BCAST_ALG_FLAT] =
+            {.id   = UCC_TL_SHM_BCAST_ALG_FLAT,
+             .name = "flat",
+             .desc = "all ranks copy data from the root slot"},
+        [UCC_TL_SHM_BCAST_ALG_TREE] =
+            {.id   = UCC_TL_SHM_BCAST_ALG_TREE,
+             .name = "tree",
+             .desc = "k-ary tree, every rank copies data from the parent slot"},
+        [UCC_TL_SHM_BCAST_ALG_CMA] =
+            {.id   = UCC_TL_SHM_BCAST_ALG_CMA,
+             .name = "cma",
+             .desc = "single-copy read of the root buffer with CMA"},
+        [UCC_TL_SHM_BCAST_ALG_LAST] = {.id = 0, .name = NULL, .desc = NULL}};
+
+static void ucc_tl_shm_bcast_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task  = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team  = TASK_TEAM(task);
+    ucc_coll_args_t   *args  = &TASK_ARGS(task);
+    ucc_rank_t         rank  = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root  = args->root;
+    ucc_rank_t         vrank = ucc_tl_shm_vrank(rank, root, size);
+    void              *buf   = args->src.info.buffer;
+    size_t             len   = args->src.info.count *
+                               ucc_dt_size(args->src.info.datatype);
+    ucc_rank_t         first, n_children, parent;
+
+    if (!ucc_tl_shm_task_is_turn(task)) {
+        return;
+    }
+
+    n_children = ucc_tl_shm_tree_children(vrank, task->radix, size, &first);
+    switch (task->stage) {
+    case BCAST_STAGE_RECV:
+        if (vrank != 0) {
+            parent = ucc_tl_shm_rank(ucc_tl_shm_tree_parent(vrank, task->radix),
+                                     root, size);
+            if (!ucc_tl_shm_flag_ready(&UCC_TL_SHM_CTRL(team, parent)->release,
+                                       task->seq)) {
+                return;
+            }
+            memcpy(buf, UCC_TL_SHM_SLOT(team, parent), len);
+            ucc_tl_shm_slot_read_done(team, parent);
+        }
+        task->stage = BCAST_STAGE_SEND;
+        /* fall through */
+    case BCAST_STAGE_SEND:
+        if (n_children > 0) {
+            if (!ucc_tl_shm_slot_is_free(team)) {
+                return;
+            }
+            memcpy(UCC_TL_SHM_SLOT(team, rank), buf, len);
+            ucc_tl_shm_slot_publish(team, &UCC_TL_SHM_CTRL(team, rank)->release,
+                                    task->seq, n_children);
+        }
+        break;
+    }
+    ucc_tl_shm_task_complete(task, UCC_OK);
+}
+
+static void ucc_tl_shm_bcast_cma_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team = TASK_TEAM(task);
+    ucc_coll_args_t   *args = &TASK_ARGS(task);
+    ucc_rank_t         root = args->root;
+    void              *buf  = args->src.info.buffer;
+    size_t             len  = args->src.info.count *
+                              ucc_dt_size(args->src.info.datatype);
+    ucc_status_t       status;
+
+    if (!ucc_tl_shm_task_is_turn(task)) {
+        return;
+    }
+
+    switch (task->stage) {
+    case BCAST_STAGE_RECV:
+        if (UCC_TL_TEAM_RANK(team) == root) {
+            ucc_tl_shm_buf_publish(team, buf, task->seq,
+                                   UCC_TL_TEAM_SIZE(team) - 1);
+        } else {
+            if (!ucc_tl_shm_flag_ready(&UCC_TL_SHM_CTRL(team, root)->arrive,
+                                       task->seq)) {
+                return;
+            }
+            status = ucc_tl_shm_cma_read(team, root, buf,
+                                         UCC_TL_SHM_CTRL(team, root)->buf, len);
+            if (ucc_unlikely(status != UCC_OK)) {
+                ucc_tl_shm_task_complete(task, status);
+                return;
+            }
+            ucc_tl_shm_slot_read_done(team, root);
+        }
+        task->stage = BCAST_STAGE_WAIT_READS;
+        /* fall through */
+    case BCAST_STAGE_WAIT_READS:
+        /* root buffer has to stay valid until all peers are done reading */
+        if (!ucc_tl_shm_slot_is_free(team)) {
+            return;
+        }
+        break;
+    }
+    ucc_tl_shm_task_complete(task, UCC_OK);
+}
+
+ucc_status_t ucc_tl_shm_bcast_cma_init(ucc_base_coll_args_t *coll_args,
+                                      ucc_base_team_t      *tl_team,
+                                      ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    if (!team->cma) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    status = ucc_tl_shm_task_init(coll_args, team,
+                                  ucc_tl_shm_flat_radix(team), &task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    task->super.progress = ucc_tl_shm_bcast_cma_progress;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
+
+static ucc_status_t
+ucc_tl_shm_bcast_init_radix(ucc_base_coll_args_t *coll_args,
+                            ucc_tl_shm_team_t *team, ucc_rank_t radix,
+                            ucc_coll_task_t **task_h)
+{
+    ucc_coll_args_t   *args = &coll_args->args;
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    if (args->src.info.count * ucc_dt_size(args->src.info.datatype) >
+        team->slot_size) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    status = ucc_tl_shm_task_init(coll_args, team, radix, &task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    task->super.progress = ucc_tl_shm_bcast_progress;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_bcast_init(ucc_base_coll_args_t *coll_args,
+                                   ucc_base_team_t      *tl_team,
+                                   ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_coll_args_t   *args = &coll_args->args;
+
+    if (args->src.info.count * ucc_dt_size(args->src.info.datatype) >
+        team->slot_size) {
+        return ucc_tl_shm_bcast_cma_init(coll_args, tl_team, task_h);
+    }
+    return ucc_tl_shm_bcast_init_radix(coll_args, team,
+                                       ucc_tl_shm_default_radix(team), task_h);
+}
+
+ucc_status_t ucc_tl_shm_bcast_flat_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *tl_team,
+                                        ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_bcast_init_radix(coll_args, team,
+                                       ucc_tl_shm_flat_radix(team), task_h);
+}
+
+ucc_status_t ucc_tl_shm_bcast_tree_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *tl_team,
+                                        ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_bcast_init_radix(coll_args, team,
+                                       ucc_tl_shm_tree_radix(team), task_h);
+}
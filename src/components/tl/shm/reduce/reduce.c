@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "reduce.h"
+#include "utils/ucc_dt_reduce.h"
+
+ucc_base_coll_alg_info_t
+    ucc_tl_shm_reduce_algs[UCC_TL_SHM_REDUCE_ALG_LAST + 1] = {
+        [UCC_TL_SHM_REDUCE_ALG_FLAT] =
+            {.id   = UCC_TL_SHM_REDUCE_ALG_FLAT,
+             .name = "flat",
+             .desc = "root reduces data from the slots of all ranks"},
+        [UCC_TL_SHM_REDUCE_ALG_TREE] =
+            {.id   = UCC_TL_SHM_REDUCE_ALG_TREE,
+             .name = "tree",
+             .desc = "k-ary tree, every rank reduces slots of its children"},
+        [UCC_TL_SHM_REDUCE_ALG_LAST] = {.id = 0, .name = NULL, .desc = NULL}};
+
+ucc_status_t ucc_tl_shm_reduce_tree_step(ucc_tl_shm_task_t *task,
+                                         ucc_rank_t root, void *src, void *dst,
+                                         size_t count, ucc_datatype_t dt)
+{
+    ucc_tl_shm_team_t *team  = TASK_TEAM(task);
+    ucc_coll_args_t   *args  = &TASK_ARGS(task);
+    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         vrank = ucc_tl_shm_vrank(UCC_TL_TEAM_RANK(team), root,
+                                                size);
+    int                avg   = vrank == 0 && args->op == UCC_OP_AVG;
+    void              *srcs[UCC_EE_EXECUTOR_NUM_BUFS];
+    ucc_rank_t         first, n_children, n, i;
+    ucc_ee_executor_t *exec;
+    ucc_status_t       status;
+
+    n_children = ucc_tl_shm_tree_children(vrank, task->radix, size, &first);
+    switch (task->stage) {
+    case UCC_TL_SHM_REDUCE_STAGE_WAIT:
+        for (; task->cur < n_children; task->cur++) {
+            if (!ucc_tl_shm_flag_ready(
+                    &UCC_TL_SHM_CTRL(team, ucc_tl_shm_rank(first + task->cur,
+                                                           root, size))->arrive,
+                    task->seq)) {
+                return UCC_INPROGRESS;
+            }
+        }
+        if (dst == UCC_TL_SHM_SLOT(team, UCC_TL_TEAM_RANK(team)) &&
+            !ucc_tl_shm_slot_is_free(team)) {
+            return UCC_INPROGRESS;
+        }
+        if (n_children == 0) {
+            memcpy(dst, src, count * ucc_dt_size(dt));
+            return UCC_OK;
+        }
+        task->cur   = 0;
+        task->stage = UCC_TL_SHM_REDUCE_STAGE_REDUCE;
+        /* fall through */
+    case UCC_TL_SHM_REDUCE_STAGE_REDUCE:
+        status = ucc_tl_shm_etask_test(task);
+        if (status != UCC_OK) {
+            return status;
+        }
+        status = ucc_coll_task_get_executor(&task->super, &exec);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+        /* executor reduces up to UCC_EE_EXECUTOR_NUM_BUFS buffers at once,
+           larger fan-in is accumulated in dst */
+        while (task->cur < n_children) {
+            srcs[0] = (task->cur == 0) ? src : dst;
+            n       = ucc_min(n_children - task->cur,
+                              UCC_EE_EXECUTOR_NUM_BUFS - 1);
+            for (i = 0; i < n; i++) {
+                srcs[i + 1] = UCC_TL_SHM_SLOT(
+                    team, ucc_tl_shm_rank(first + task->cur + i, root, size));
+            }
+            task->cur += n;
+            status = ucc_dt_reduce_multi(
+                srcs, dst, n + 1, count, dt, args,
+                (avg && task->cur == n_children) ?
+                    UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA : 0,
+                1.0 / (double)size, exec, &task->etask);
+            if (ucc_unlikely(status != UCC_OK)) {
+                return status;
+            }
+            status = ucc_tl_shm_etask_test(task);
+            if (status != UCC_OK) {
+                return status;
+            }
+        }
+        for (i = 0; i < n_children; i++) {
+            ucc_tl_shm_slot_read_done(team,
+                                      ucc_tl_shm_rank(first + i, root, size));
+        }
+        break;
+    }
+    return UCC_OK;
+}
+
+static void ucc_tl_shm_reduce_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t      *task    = ucc_derived_of(coll_task,
+                                                     ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t      *team    = TASK_TEAM(task);
+    ucc_coll_args_t        *args    = &TASK_ARGS(task);
+    ucc_rank_t              rank    = UCC_TL_TEAM_RANK(team);
+    int                     is_root = rank == args->root;
+    ucc_coll_buffer_info_t *info;
+    ucc_status_t            status;
+    void                   *src, *dst;
+
+    if (!ucc_tl_shm_task_is_turn(task)) {
+        return;
+    }
+
+    if (is_root) {
+        info = &args->dst.info;
+        src  = UCC_IS_INPLACE(*args) ? args->dst.info.buffer :
+                                       args->src.info.buffer;
+        dst  = args->dst.info.buffer;
+    } else {
+        info = &args->src.info;
+        src  = args->src.info.buffer;
+        dst  = UCC_TL_SHM_SLOT(team, rank);
+    }
+
+    status = ucc_tl_shm_reduce_tree_step(task, args->root, src, dst,
+                                         info->count, info->datatype);
+    if (status == UCC_INPROGRESS) {
+        return;
+    } else if (ucc_unlikely(status < 0)) {
+        ucc_tl_shm_task_complete(task, status);
+        return;
+    }
+    if (!is_root) {
+        ucc_tl_shm_slot_publish(team, &UCC_TL_SHM_CTRL(team, rank)->arrive,
+                                task->seq, 1);
+    }
+    ucc_tl_shm_task_complete(task, UCC_OK);
+}
+
+static ucc_status_t
+ucc_tl_shm_reduce_init_radix(ucc_base_coll_args_t *coll_args,
+                             ucc_tl_shm_team_t *team, ucc_rank_t radix,
+                             ucc_coll_task_t **task_h)
+{
+    ucc_coll_args_t   *args = &coll_args->args;
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    if (ucc_coll_args_msgsize(args, UCC_TL_TEAM_RANK(team),
+                              UCC_TL_TEAM_SIZE(team)) > team->slot_size) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    status = ucc_tl_shm_task_init(coll_args, team, radix, &task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    task->super.progress = ucc_tl_shm_reduce_progress;
+    task->super.flags   |= UCC_COLL_TASK_FLAG_EXECUTOR;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_reduce_init(ucc_base_coll_args_t *coll_args,
+                                    ucc_base_team_t      *tl_team,
+                                    ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_reduce_init_radix(coll_args, team,
+                                        ucc_tl_shm_default_radix(team), task_h);
+}
+
+ucc_status_t ucc_tl_shm_reduce_flat_init(ucc_base_coll_args_t *coll_args,
+                                         ucc_base_team_t      *tl_team,
+                                         ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_reduce_init_radix(coll_args, team,
+                                        ucc_tl_shm_flat_radix(team), task_h);
+}
+
+ucc_status_t ucc_tl_shm_reduce_tree_init(ucc_base_coll_args_t *coll_args,
+                                         ucc_base_team_t      *tl_team,
+                                         ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+
+    return ucc_tl_shm_reduce_init_radix(coll_args, team,
+                                        ucc_tl_shm_tree_radix(team), task_h);
+}
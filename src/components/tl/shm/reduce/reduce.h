@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef REDUCE_H_
+#define REDUCE_H_
+
+#include "tl_shm.h"
+#include "tl_shm_coll.h"
+
+enum
+{
+    UCC_TL_SHM_REDUCE_ALG_FLAT,
+    UCC_TL_SHM_REDUCE_ALG_TREE,
+    UCC_TL_SHM_REDUCE_ALG_LAST
+};
+
+/* Stages of the tree reduction step, reused by allreduce */
+enum
+{
+    UCC_TL_SHM_REDUCE_STAGE_WAIT,
+    UCC_TL_SHM_REDUCE_STAGE_REDUCE,
+    UCC_TL_SHM_REDUCE_STAGE_LAST
+};
+
+extern ucc_base_coll_alg_info_t
+    ucc_tl_shm_reduce_algs[UCC_TL_SHM_REDUCE_ALG_LAST + 1];
+
+ucc_status_t ucc_tl_shm_reduce_init(ucc_base_coll_args_t *coll_args,
+                                    ucc_base_team_t      *tl_team,
+                                    ucc_coll_task_t     **task_h);
+
+ucc_status_t ucc_tl_shm_reduce_flat_init(ucc_base_coll_args_t *coll_args,
+                                         ucc_base_team_t      *tl_team,
+                                         ucc_coll_task_t     **task_h);
+
+ucc_status_t ucc_tl_shm_reduce_tree_init(ucc_base_coll_args_t *coll_args,
+                                         ucc_base_team_t      *tl_team,
+                                         ucc_coll_task_t     **task_h);
+
+/* Reduces own contribution "src" with the slots of tree children into "dst",
+   average is applied by the root. Children slots are released once reduction
+   is complete. Returns UCC_INPROGRESS if children data is not ready yet or
+   executor task is not completed. */
+ucc_status_t ucc_tl_shm_reduce_tree_step(ucc_tl_shm_task_t *task,
+                                         ucc_rank_t root, void *src, void *dst,
+                                         size_t count, ucc_datatype_t dt);
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_shm.h"
+#include "tl_shm_coll.h"
+#include "utils/ucc_malloc.h"
+#include "allgather/allgather.h"
+#include "allreduce/allreduce.h"
+#include "alltoall/alltoall.h"
+#include "barrier/barrier.h"
+#include "bcast/bcast.h"
+#include "reduce/reduce.h"
+
+ucc_status_t ucc_tl_shm_get_lib_attr(const ucc_base_lib_t *lib,
+                                     ucc_base_lib_attr_t  *base_attr);
+
+ucc_status_t ucc_tl_shm_get_context_attr(const ucc_base_context_t *context,
+                                         ucc_base_ctx_attr_t      *base_attr);
+
+ucc_status_t ucc_tl_shm_mem_map(const ucc_base_context_t *context, ucc_mem_map_mode_t mode,
+                                ucc_mem_map_memh_t *memh, ucc_mem_map_tl_t *tl_h);
+
+ucc_status_t ucc_tl_shm_mem_unmap(const ucc_base_context_t *context, ucc_mem_map_mode_t mode,
+                                  ucc_mem_map_tl_t *tl_h);
+
+ucc_status_t ucc_tl_shm_memh_pack(const ucc_base_context_t *context,
+                                  ucc_mem_map_mode_t mode, ucc_mem_map_tl_t *tl_h, void **pack_buffer);
+
+ucc_status_t ucc_tl_shm_get_lib_properties(ucc_base_lib_properties_t *prop);
+
+static ucc_config_field_t ucc_tl_shm_lib_config_table[] = {
+    {"", "", NULL, ucc_offsetof(ucc_tl_shm_lib_config_t, super),
+     UCC_CONFIG_TYPE_TABLE(ucc_tl_lib_config_table)},
+
+    {"SLOT_SIZE", "8k",
+     "Size of the per-rank data slot in the team shared segment. Collectives "
+     "with larger messages are not handled by TL SHM",
+     ucc_offsetof(ucc_tl_shm_lib_config_t, slot_size),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"TREE_RADIX", "4",
+     "Radix of the tree used by tree algorithms",
+     ucc_offsetof(ucc_tl_shm_lib_config_t, tree_radix),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"TREE_MIN_TEAM_SIZE", "16",
+     "Minimal team size for which tree algorithms are selected by default, "
+     "smaller teams use flat algorithms",
+     ucc_offsetof(ucc_tl_shm_lib_config_t, tree_min_team_size),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"CMA", "try",
+     "Use single-copy collectives reading peer buffers with process_vm_readv "
+     "for messages that do not fit into the data slot.\n"
+     "try - use CMA if the probe on team creation succeeds, it fails when "
+     "yama ptrace_scope is restricted\n"
+     "y   - additionally call prctl(PR_SET_PTRACER, PR_SET_PTRACER_ANY) on "
+     "context creation. WARNING: this makes the process ptrace attachable "
+     "by ANY process of the same user, not only by the node peers\n"
+     "n   - disable CMA",
+     ucc_offsetof(ucc_tl_shm_lib_config_t, cma),
+     UCC_CONFIG_TYPE_TERNARY},
+
+    {NULL}};
+
+static ucs_config_field_t ucc_tl_shm_context_config_table[] = {
+    {"", "", NULL, ucc_offsetof(ucc_tl_shm_context_config_t, super),
+     UCC_CONFIG_TYPE_TABLE(ucc_tl_context_config_table)},
+
+    {NULL}};
+
+UCC_CLASS_DEFINE_NEW_FUNC(ucc_tl_shm_lib_t, ucc_base_lib_t,
+                          const ucc_base_lib_params_t *,
+                          const ucc_base_config_t *);
+
+UCC_CLASS_DEFINE_DELETE_FUNC(ucc_tl_shm_lib_t, ucc_base_lib_t);
+
+UCC_CLASS_DEFINE_NEW_FUNC(ucc_tl_shm_context_t, ucc_base_context_t,
+                          const ucc_base_context_params_t *,
+                          const ucc_base_config_t *);
+
+UCC_CLASS_DEFINE_DELETE_FUNC(ucc_tl_shm_context_t, ucc_base_context_t);
+
+UCC_CLASS_DEFINE_NEW_FUNC(ucc_tl_shm_team_t, ucc_base_team_t,
+                          ucc_base_context_t *, const ucc_base_team_params_t *);
+
+ucc_status_t ucc_tl_shm_team_create_test(ucc_base_team_t *tl_team);
+
+ucc_status_t ucc_tl_shm_team_destroy(ucc_base_team_t *tl_team);
+
+ucc_status_t ucc_tl_shm_team_get_scores(ucc_base_team_t   *tl_team,
+                                        ucc_coll_score_t **score);
+
+UCC_TL_IFACE_DECLARE(shm, SHM);
+
+__attribute__((constructor)) static void tl_shm_iface_init(void)
+{
+    ucc_tl_shm.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_ALLGATHER)] =
+        ucc_tl_shm_allgather_algs;
+    ucc_tl_shm.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_ALLREDUCE)] =
+        ucc_tl_shm_allreduce_algs;
+    ucc_tl_shm.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_ALLTOALL)] =
+        ucc_tl_shm_alltoall_algs;
+    ucc_tl_shm.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_BARRIER)] =
+        ucc_tl_shm_barrier_algs;
+    ucc_tl_shm.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_BCAST)] =
+        ucc_tl_shm_bcast_algs;
+    ucc_tl_shm.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_REDUCE)] =
+        ucc_tl_shm_reduce_algs;
+}
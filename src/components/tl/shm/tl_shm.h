@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_TL_SHM_H_
+#define UCC_TL_SHM_H_
+
+#include "components/tl/ucc_tl.h"
+#include "components/tl/ucc_tl_log.h"
+#include "utils/ucc_mpool.h"
+#include "utils/arch/cpu.h"
+
+#ifndef UCC_TL_SHM_DEFAULT_SCORE
+#define UCC_TL_SHM_DEFAULT_SCORE 20
+#endif
+
+#ifdef HAVE_PROFILING_TL_SHM
+#include "utils/profile/ucc_profile.h"
+#else
+#include "utils/profile/ucc_profile_off.h"
+#endif
+
+#define UCC_TL_SHM_PROFILE_FUNC          UCC_PROFILE_FUNC
+#define UCC_TL_SHM_PROFILE_FUNC_VOID     UCC_PROFILE_FUNC_VOID
+#define UCC_TL_SHM_PROFILE_REQUEST_NEW   UCC_PROFILE_REQUEST_NEW
+#define UCC_TL_SHM_PROFILE_REQUEST_EVENT UCC_PROFILE_REQUEST_EVENT
+#define UCC_TL_SHM_PROFILE_REQUEST_FREE  UCC_PROFILE_REQUEST_FREE
+
+#define UCC_TL_SHM_SUPPORTED_COLLS                                             \
+    (UCC_COLL_TYPE_ALLREDUCE | UCC_COLL_TYPE_BCAST | UCC_COLL_TYPE_BARRIER |   \
+     UCC_COLL_TYPE_REDUCE | UCC_COLL_TYPE_ALLGATHER |                          \
+     UCC_COLL_TYPE_ALLTOALL)
+
+typedef struct ucc_tl_shm_iface {
+    ucc_tl_iface_t super;
+} ucc_tl_shm_iface_t;
+/* Extern iface should follow the pattern: ucc_tl_<tl_name> */
+extern ucc_tl_shm_iface_t ucc_tl_shm;
+
+typedef struct ucc_tl_shm_lib_config {
+    ucc_tl_lib_config_t      super;
+    size_t                   slot_size;
+    uint32_t                 tree_radix;
+    uint32_t                 tree_min_team_size;
+    ucc_ternary_auto_value_t cma;
+} ucc_tl_shm_lib_config_t;
+
+typedef struct ucc_tl_shm_context_config {
+    ucc_tl_context_config_t super;
+} ucc_tl_shm_context_config_t;
+
+typedef struct ucc_tl_shm_lib {
+    ucc_tl_lib_t            super;
+    ucc_tl_shm_lib_config_t cfg;
+} ucc_tl_shm_lib_t;
+UCC_CLASS_DECLARE(ucc_tl_shm_lib_t, const ucc_base_lib_params_t *,
+                  const ucc_base_config_t *);
+
+typedef struct ucc_tl_shm_context {
+    ucc_tl_context_t            super;
+    ucc_tl_shm_context_config_t cfg;
+    ucc_mpool_t                 req_mp;
+} ucc_tl_shm_context_t;
+UCC_CLASS_DECLARE(ucc_tl_shm_context_t, const ucc_base_context_params_t *,
+                  const ucc_base_config_t *);
+
+/* Segment header, counts ranks attached to the segment and ranks that
+   completed CMA probe during team creation */
+typedef struct ucc_tl_shm_seg_hdr {
+    volatile uint32_t n_attached;
+    volatile uint32_t n_probed;
+    char              pad[UCC_CACHE_LINE_SIZE - 2 * sizeof(uint32_t)];
+} ucc_tl_shm_seg_hdr_t;
+
+/* Per-rank control block of the team segment. Every field lives on its own
+   cache line: "arrive" and "release" are written only by the owner rank and
+   polled by peers, "reads" is incremented atomically by peers once they are
+   done reading the owner's data slot or user buffer. "buf" exposes the owner's
+   user buffer to peers for single-copy CMA collectives, it is published
+   together with "arrive". */
+typedef struct ucc_tl_shm_ctrl {
+    volatile uint64_t arrive;
+    volatile uint64_t buf;
+    char              pad0[UCC_CACHE_LINE_SIZE - 2 * sizeof(uint64_t)];
+    volatile uint64_t release;
+    char              pad1[UCC_CACHE_LINE_SIZE - sizeof(uint64_t)];
+    volatile uint64_t reads;
+    char              pad2[UCC_CACHE_LINE_SIZE - sizeof(uint64_t)];
+    /* set once on team creation */
+    int32_t           pid;
+    int32_t           cma_ok;
+    char              pad3[UCC_CACHE_LINE_SIZE - 2 * sizeof(int32_t)];
+} ucc_tl_shm_ctrl_t;
+
+typedef struct ucc_tl_shm_team {
+    ucc_tl_team_t         super;
+    ucc_team_oob_coll_t   oob;
+    void                 *oob_req;
+    int                  *shm_ids;
+    ucc_tl_shm_seg_hdr_t *seg;
+    ucc_tl_shm_ctrl_t    *ctrl;
+    void                 *data;
+    size_t                slot_size;
+    /* order of the last posted collective, collectives are executed in
+       the order of posting */
+    uint64_t              seq_num;
+    /* number of collectives created */
+    uint64_t              n_created;
+    /* order of the last collective completed by this rank */
+    uint64_t              done_seq;
+    /* number of collectives executed, flag values are derived from it */
+    uint64_t              n_done;
+    /* executions completed inside of the current pipelined schedule */
+    uint64_t              pipe_done;
+    /* number of peer reads of own data slot expected so far */
+    uint64_t              slot_reads;
+    /* all ranks of the team can read peer memory with process_vm_readv */
+    int                   cma;
+    uint64_t              cma_probe;
+} ucc_tl_shm_team_t;
+UCC_CLASS_DECLARE(ucc_tl_shm_team_t, ucc_base_context_t *,
+                  const ucc_base_team_params_t *);
+
+#define UCC_TL_SHM_TEAM_LIB(_team)                                             \
+    (ucc_derived_of((_team)->super.super.context->lib, ucc_tl_shm_lib_t))
+
+#define UCC_TL_SHM_TEAM_CTX(_team)                                             \
+    (ucc_derived_of((_team)->super.super.context, ucc_tl_shm_context_t))
+
+#define UCC_TL_SHM_CTRL(_team, _rank) (&(_team)->ctrl[(_rank)])
+
+#define UCC_TL_SHM_SLOT(_team, _rank)                                          \
+    PTR_OFFSET((_team)->data, (_team)->slot_size * (_rank))
+
+ucc_status_t ucc_tl_shm_coll_init(ucc_base_coll_args_t *coll_args,
+                                  ucc_base_team_t      *team,
+                                  ucc_coll_task_t     **task_h);
+
+#endif
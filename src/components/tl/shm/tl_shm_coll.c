@@ -0,0 +1,365 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_shm_coll.h"
+#include "allgather/allgather.h"
+#include "allreduce/allreduce.h"
+#include "alltoall/alltoall.h"
+#include "barrier/barrier.h"
+#include "bcast/bcast.h"
+#include "reduce/reduce.h"
+#include "schedule/ucc_schedule_pipelined.h"
+#include <sys/uio.h>
+#include <errno.h>
+
+ucc_status_t ucc_tl_shm_task_init(ucc_base_coll_args_t *coll_args,
+                                  ucc_tl_shm_team_t    *team,
+                                  ucc_rank_t            radix,
+                                  ucc_tl_shm_task_t   **task_h)
+{
+    ucc_tl_shm_task_t *task;
+    ucc_status_t       status;
+
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    if (!ucc_coll_args_is_predefined_dt(&coll_args->args,
+                                        UCC_TL_TEAM_RANK(team))) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    task = ucc_tl_shm_task_get(team);
+    if (ucc_unlikely(!task)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+
+    status = ucc_coll_task_init(&task->super, coll_args, &team->super.super);
+    if (ucc_unlikely(status != UCC_OK)) {
+        ucc_tl_shm_task_put(task);
+        return status;
+    }
+
+    task->id             = ++team->n_created;
+    task->order          = 0;
+    task->n_posts        = 0;
+    task->radix          = radix;
+    task->super.post     = ucc_tl_shm_coll_start;
+    task->super.finalize = ucc_tl_shm_coll_finalize;
+    *task_h              = task;
+    return UCC_OK;
+}
+
+/* Counts tasks of the team in the schedule and its subschedules */
+static void ucc_tl_shm_schedule_count(ucc_schedule_t *schedule,
+                                      ucc_base_team_t *team, uint64_t *n,
+                                      uint64_t *first_id)
+{
+    ucc_coll_task_t *t;
+    int              i;
+
+    for (i = 0; i < schedule->n_tasks; i++) {
+        t = schedule->tasks[i];
+        if (t->team == team) {
+            *first_id = ucc_min(*first_id,
+                                ucc_derived_of(t, ucc_tl_shm_task_t)->id);
+            (*n)++;
+        } else if (t->flags & UCC_COLL_TASK_FLAG_IS_SCHEDULE) {
+            ucc_tl_shm_schedule_count(ucc_derived_of(t, ucc_schedule_t), team,
+                                      n, first_id);
+        }
+    }
+}
+
+/* Gives tasks of the team in the schedule and its subschedules the orders
+   following "base" by creation */
+static void ucc_tl_shm_schedule_reserve(ucc_schedule_t *schedule,
+                                        ucc_base_team_t *team,
+                                        uint64_t first_id, uint64_t base)
+{
+    ucc_tl_shm_task_t *task;
+    ucc_coll_task_t   *t;
+    int                i;
+
+    for (i = 0; i < schedule->n_tasks; i++) {
+        t = schedule->tasks[i];
+        if (t->team == team) {
+            task        = ucc_derived_of(t, ucc_tl_shm_task_t);
+            task->order = base + task->id - first_id;
+        } else if (t->flags & UCC_COLL_TASK_FLAG_IS_SCHEDULE) {
+            ucc_tl_shm_schedule_reserve(ucc_derived_of(t, ucc_schedule_t),
+                                        team, first_id, base);
+        }
+    }
+}
+
+/* Fragments of a pipelined schedule are created one after another, so tasks
+   of the team in fragment i are the i-th block of "len / n_frags" tasks
+   starting at "first_id". The first task of the pipeline to start reserves
+   "len" places in the team order for all of them. Fragment i is reposted for
+   every n_frags-th portion of data, all executions of the team tasks of the
+   pipeline are ordered by portion and by position in the fragment. */
+static void ucc_tl_shm_task_pipe_setup(ucc_tl_shm_task_t *task)
+{
+    ucc_tl_shm_team_t        *team = TASK_TEAM(task);
+    ucc_schedule_t           *frag = task->super.schedule;
+    ucc_schedule_pipelined_t *sp;
+    uint64_t                  n_frag_tasks, frag_idx, n_gens, first_id, len;
+    int                       i;
+
+    task->pipe_idx = -1;
+    while (frag && !(frag->super.schedule &&
+                     (frag->super.schedule->super.flags &
+                      UCC_COLL_TASK_FLAG_IS_PIPELINED_SCHEDULE))) {
+        frag = frag->super.schedule;
+    }
+    if (!frag) {
+        return;
+    }
+    sp       = ucc_derived_of(frag->super.schedule, ucc_schedule_pipelined_t);
+    first_id = UINT64_MAX;
+    len      = 0;
+    for (i = 0; i < sp->n_frags; i++) {
+        ucc_tl_shm_schedule_count(sp->frags[i], task->super.team, &len,
+                                  &first_id);
+    }
+    if (task->order <= team->done_seq) {
+        /* first start of the pipeline or the pipeline is reposted */
+        for (i = 0; i < sp->n_frags; i++) {
+            ucc_tl_shm_schedule_reserve(sp->frags[i], task->super.team,
+                                        first_id, team->seq_num + 1);
+        }
+        team->seq_num += len;
+    }
+    n_frag_tasks     = len / sp->n_frags;
+    frag_idx         = (task->id - first_id) / n_frag_tasks;
+    n_gens           = (sp->super.n_tasks - frag_idx + sp->n_frags - 1) /
+                       sp->n_frags;
+    task->pipe_first = task->order - (task->id - first_id);
+    task->pipe_len   = len;
+    task->pipe_execs = sp->super.n_tasks * n_frag_tasks;
+    task->pipe_idx   = ((task->n_posts - 1) % n_gens) * len +
+                       (task->id - first_id);
+}
+
+ucc_status_t ucc_tl_shm_coll_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team = TASK_TEAM(task);
+
+    UCC_TL_SHM_PROFILE_REQUEST_EVENT(coll_task, "tl_shm_coll_start", 0);
+    task->n_posts++;
+    ucc_tl_shm_task_pipe_setup(task);
+    if (task->pipe_idx < 0) {
+        task->order = ++team->seq_num;
+    }
+    task->seq          = 0;
+    task->stage        = 0;
+    task->cur          = 0;
+    task->etask        = NULL;
+    task->super.status = UCC_INPROGRESS;
+
+    return ucc_progress_queue_enqueue(UCC_TASK_CORE_CTX(coll_task)->pq,
+                                      coll_task);
+}
+
+ucc_status_t ucc_tl_shm_coll_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+
+    tl_trace(UCC_TASK_LIB(task), "finalizing task %p", task);
+    ucc_tl_shm_task_put(task);
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_cma_read(ucc_tl_shm_team_t *team, ucc_rank_t peer,
+                                 void *dst, uint64_t src, size_t len)
+{
+    pid_t        pid = UCC_TL_SHM_CTRL(team, peer)->pid;
+    struct iovec local, remote;
+    ssize_t      ret;
+
+    while (len > 0) {
+        local.iov_base  = dst;
+        local.iov_len   = len;
+        remote.iov_base = (void *)(uintptr_t)src;
+        remote.iov_len  = len;
+        ret = process_vm_readv(pid, &local, 1, &remote, 1, 0);
+        if (ret <= 0) {
+            if (ret < 0 && errno == EINTR) {
+                continue;
+            }
+            tl_debug(UCC_TL_SHM_TEAM_LIB(team),
+                     "process_vm_readv from pid %d failed, errno: %d (%s)",
+                     pid, errno, strerror(errno));
+            return UCC_ERR_NO_MESSAGE;
+        }
+        /* partial read is possible for large transfers */
+        dst  = PTR_OFFSET(dst, ret);
+        src += ret;
+        len -= ret;
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_coll_init(ucc_base_coll_args_t *coll_args,
+                                  ucc_base_team_t      *team,
+                                  ucc_coll_task_t     **task_h)
+{
+    switch (coll_args->args.coll_type) {
+    case UCC_COLL_TYPE_ALLGATHER:
+        return ucc_tl_shm_allgather_init(coll_args, team, task_h);
+    case UCC_COLL_TYPE_ALLREDUCE:
+        return ucc_tl_shm_allreduce_init(coll_args, team, task_h);
+    case UCC_COLL_TYPE_ALLTOALL:
+        return ucc_tl_shm_alltoall_init(coll_args, team, task_h);
+    case UCC_COLL_TYPE_BARRIER:
+        return ucc_tl_shm_barrier_init(coll_args, team, task_h);
+    case UCC_COLL_TYPE_BCAST:
+        return ucc_tl_shm_bcast_init(coll_args, team, task_h);
+    case UCC_COLL_TYPE_REDUCE:
+        return ucc_tl_shm_reduce_init(coll_args, team, task_h);
+    default:
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+}
+
+static inline int alg_id_from_str(ucc_coll_type_t coll_type, const char *str)
+{
+    ucc_base_coll_alg_info_t *algs;
+    int                       i;
+
+    switch (coll_type) {
+    case UCC_COLL_TYPE_ALLGATHER:
+        algs = ucc_tl_shm_allgather_algs;
+        break;
+    case UCC_COLL_TYPE_ALLREDUCE:
+        algs = ucc_tl_shm_allreduce_algs;
+        break;
+    case UCC_COLL_TYPE_ALLTOALL:
+        algs = ucc_tl_shm_alltoall_algs;
+        break;
+    case UCC_COLL_TYPE_BARRIER:
+        algs = ucc_tl_shm_barrier_algs;
+        break;
+    case UCC_COLL_TYPE_BCAST:
+        algs = ucc_tl_shm_bcast_algs;
+        break;
+    case UCC_COLL_TYPE_REDUCE:
+        algs = ucc_tl_shm_reduce_algs;
+        break;
+    default:
+        return -1;
+    }
+
+    for (i = 0; algs[i].name; i++) {
+        if (0 == strcasecmp(str, algs[i].name)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+ucc_status_t ucc_tl_shm_alg_id_to_init(int alg_id, const char *alg_id_str,
+                                       ucc_coll_type_t          coll_type,
+                                       ucc_memory_type_t        mem_type,
+                                       ucc_base_coll_init_fn_t *init)
+{
+    ucc_status_t status = UCC_OK;
+
+    if (alg_id_str) {
+        alg_id = alg_id_from_str(coll_type, alg_id_str);
+    }
+
+    if (mem_type != UCC_MEMORY_TYPE_HOST) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    switch (coll_type) {
+    case UCC_COLL_TYPE_ALLGATHER:
+        switch (alg_id) {
+        case UCC_TL_SHM_ALLGATHER_ALG_FLAT:
+            *init = ucc_tl_shm_allgather_flat_init;
+            break;
+        case UCC_TL_SHM_ALLGATHER_ALG_CMA:
+            *init = ucc_tl_shm_allgather_cma_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_ALLREDUCE:
+        switch (alg_id) {
+        case UCC_TL_SHM_ALLREDUCE_ALG_FLAT:
+            *init = ucc_tl_shm_allreduce_flat_init;
+            break;
+        case UCC_TL_SHM_ALLREDUCE_ALG_TREE:
+            *init = ucc_tl_shm_allreduce_tree_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_ALLTOALL:
+        switch (alg_id) {
+        case UCC_TL_SHM_ALLTOALL_ALG_CMA:
+            *init = ucc_tl_shm_alltoall_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_BARRIER:
+        switch (alg_id) {
+        case UCC_TL_SHM_BARRIER_ALG_FLAT:
+            *init = ucc_tl_shm_barrier_flat_init;
+            break;
+        case UCC_TL_SHM_BARRIER_ALG_TREE:
+            *init = ucc_tl_shm_barrier_tree_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_BCAST:
+        switch (alg_id) {
+        case UCC_TL_SHM_BCAST_ALG_FLAT:
+            *init = ucc_tl_shm_bcast_flat_init;
+            break;
+        case UCC_TL_SHM_BCAST_ALG_TREE:
+            *init = ucc_tl_shm_bcast_tree_init;
+            break;
+        case UCC_TL_SHM_BCAST_ALG_CMA:
+            *init = ucc_tl_shm_bcast_cma_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_REDUCE:
+        switch (alg_id) {
+        case UCC_TL_SHM_REDUCE_ALG_FLAT:
+            *init = ucc_tl_shm_reduce_flat_init;
+            break;
+        case UCC_TL_SHM_REDUCE_ALG_TREE:
+            *init = ucc_tl_shm_reduce_tree_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    default:
+        status = UCC_ERR_NOT_SUPPORTED;
+        break;
+    }
+    return status;
+}
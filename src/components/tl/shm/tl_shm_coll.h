@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_TL_SHM_COLL_H_
+#define UCC_TL_SHM_COLL_H_
+
+#include "tl_shm.h"
+#include "utils/ucc_atomic.h"
+#include "utils/ucc_coll_utils.h"
+#include "components/ec/ucc_ec.h"
+
+#define TASK_TEAM(_task)                                                       \
+    (ucc_derived_of((_task)->super.team, ucc_tl_shm_team_t))
+
+#define TASK_ARGS(_task) (_task)->super.bargs.args
+
+#define TASK_LIB(_task) UCC_TL_SHM_TEAM_LIB(TASK_TEAM(_task))
+
+typedef struct ucc_tl_shm_task {
+    ucc_coll_task_t         super;
+    /* creation index, positions tasks inside of a pipelined schedule */
+    uint64_t                id;
+    /* position in the execution order of the team, assigned on post */
+    uint64_t                order;
+    /* flag value, assigned once the task takes its turn */
+    uint64_t                seq;
+    uint32_t                n_posts;
+    /* execution index inside of a pipelined schedule, -1 if the task is
+       not a fragment of one */
+    int64_t                 pipe_idx;
+    uint64_t                pipe_first;
+    uint64_t                pipe_len;
+    uint64_t                pipe_execs;
+    int                     stage;
+    ucc_rank_t              radix;
+    /* next child or peer to be processed */
+    ucc_rank_t              cur;
+    ucc_ee_executor_task_t *etask;
+} ucc_tl_shm_task_t;
+
+static inline ucc_tl_shm_task_t *ucc_tl_shm_task_get(ucc_tl_shm_team_t *team)
+{
+    ucc_tl_shm_context_t *ctx  = UCC_TL_SHM_TEAM_CTX(team);
+    ucc_tl_shm_task_t    *task = ucc_mpool_get(&ctx->req_mp);
+
+    if (ucc_unlikely(!task)) {
+        tl_error(UCC_TL_SHM_TEAM_LIB(team), "failed to get task from mpool");
+        return NULL;
+    }
+
+    UCC_TL_SHM_PROFILE_REQUEST_NEW(task, "tl_shm_task", 0);
+    task->etask = NULL;
+    return task;
+}
+
+static inline void ucc_tl_shm_task_put(ucc_tl_shm_task_t *task)
+{
+    UCC_TL_SHM_PROFILE_REQUEST_FREE(task);
+    ucc_mpool_put(task);
+}
+
+ucc_status_t ucc_tl_shm_task_init(ucc_base_coll_args_t *coll_args,
+                                  ucc_tl_shm_team_t    *team,
+                                  ucc_rank_t            radix,
+                                  ucc_tl_shm_task_t   **task_h);
+
+ucc_status_t ucc_tl_shm_coll_start(ucc_coll_task_t *coll_task);
+
+ucc_status_t ucc_tl_shm_coll_finalize(ucc_coll_task_t *coll_task);
+
+/* Single-copy read of "len" bytes at address "src" of the peer process */
+ucc_status_t ucc_tl_shm_cma_read(ucc_tl_shm_team_t *team, ucc_rank_t peer,
+                                 void *dst, uint64_t src, size_t len);
+
+ucc_status_t ucc_tl_shm_alg_id_to_init(int alg_id, const char *alg_id_str,
+                                       ucc_coll_type_t          coll_type,
+                                       ucc_memory_type_t        mem_type,
+                                       ucc_base_coll_init_fn_t *init);
+
+/* Flat algorithms are trees of radix size - 1 rooted at the root rank */
+static inline ucc_rank_t ucc_tl_shm_flat_radix(ucc_tl_shm_team_t *team)
+{
+    return UCC_TL_TEAM_SIZE(team) - 1;
+}
+
+static inline ucc_rank_t ucc_tl_shm_tree_radix(ucc_tl_shm_team_t *team)
+{
+    return ucc_min(UCC_TL_SHM_TEAM_LIB(team)->cfg.tree_radix,
+                   UCC_TL_TEAM_SIZE(team) - 1);
+}
+
+/* Radix used by the default algorithm selection: flat for small teams */
+static inline ucc_rank_t ucc_tl_shm_default_radix(ucc_tl_shm_team_t *team)
+{
+    ucc_tl_shm_lib_t *lib = UCC_TL_SHM_TEAM_LIB(team);
+
+    if (UCC_TL_TEAM_SIZE(team) < lib->cfg.tree_min_team_size) {
+        return ucc_tl_shm_flat_radix(team);
+    }
+    return ucc_tl_shm_tree_radix(team);
+}
+
+/* Collectives of a team are executed one at a time since all of them share
+   the same data slots. The order is the order of posting, so a collective
+   never waits for one that was created earlier but is not posted yet.
+   Fragments of a pipelined schedule are reposted, all their executions take
+   the place of the pipeline in the team order, see
+   ucc_tl_shm_task_pipe_setup. */
+static inline int ucc_tl_shm_task_is_turn(ucc_tl_shm_task_t *task)
+{
+    ucc_tl_shm_team_t *team = TASK_TEAM(task);
+
+    if (task->seq) {
+        return 1;
+    }
+    if (task->pipe_idx < 0) {
+        if (team->done_seq + 1 != task->order) {
+            return 0;
+        }
+    } else if (team->done_seq + 1 != task->pipe_first ||
+               team->pipe_done != task->pipe_idx) {
+        return 0;
+    }
+    task->seq = team->n_done + 1;
+    return 1;
+}
+
+/* Called for every terminal status, a failed task gives up its turn too so
+   that later collectives of the team are not blocked */
+static inline void ucc_tl_shm_task_complete(ucc_tl_shm_task_t *task,
+                                            ucc_status_t       status)
+{
+    ucc_tl_shm_team_t *team = TASK_TEAM(task);
+
+    team->n_done++;
+    if (task->pipe_idx < 0) {
+        team->done_seq = task->order;
+    } else if (++team->pipe_done == task->pipe_execs) {
+        team->done_seq  = task->pipe_first + task->pipe_len - 1;
+        team->pipe_done = 0;
+    }
+    task->super.status = status;
+}
+
+/* Tree helpers, tree is built over virtual ranks where root is 0 */
+static inline ucc_rank_t ucc_tl_shm_vrank(ucc_rank_t rank, ucc_rank_t root,
+                                          ucc_rank_t size)
+{
+    return (rank - root + size) % size;
+}
+
+static inline ucc_rank_t ucc_tl_shm_rank(ucc_rank_t vrank, ucc_rank_t root,
+                                         ucc_rank_t size)
+{
+    return (vrank + root) % size;
+}
+
+static inline ucc_rank_t ucc_tl_shm_tree_parent(ucc_rank_t vrank,
+                                                ucc_rank_t radix)
+{
+    return (vrank - 1) / radix;
+}
+
+static inline ucc_rank_t ucc_tl_shm_tree_children(ucc_rank_t  vrank,
+                                                  ucc_rank_t  radix,
+                                                  ucc_rank_t  size,
+                                                  ucc_rank_t *first)
+{
+    uint64_t f = (uint64_t)vrank * radix + 1;
+
+    if (f >= size) {
+        *first = size;
+        return 0;
+    }
+    *first = (ucc_rank_t)f;
+    return ucc_min(radix, size - (ucc_rank_t)f);
+}
+
+/* Flag and slot helpers. Writer publishes data with a store fence before
+   setting a flag, reader issues a load fence once the flag is observed. */
+static inline void ucc_tl_shm_flag_set(volatile uint64_t *flag, uint64_t seq)
+{
+    ucc_memory_cpu_store_fence();
+    *flag = seq;
+}
+
+static inline int ucc_tl_shm_flag_ready(volatile uint64_t *flag, uint64_t seq)
+{
+    if (*flag < seq) {
+        return 0;
+    }
+    ucc_memory_cpu_load_fence();
+    return 1;
+}
+
+/* Own slot can be overwritten once all peers have read previous data */
+static inline int ucc_tl_shm_slot_is_free(ucc_tl_shm_team_t *team)
+{
+    ucc_tl_shm_ctrl_t *ctrl = UCC_TL_SHM_CTRL(team, UCC_TL_TEAM_RANK(team));
+
+    if (ctrl->reads != team->slot_reads) {
+        return 0;
+    }
+    ucc_memory_cpu_fence();
+    return 1;
+}
+
+static inline void ucc_tl_shm_slot_publish(ucc_tl_shm_team_t *team,
+                                           volatile uint64_t *flag,
+                                           uint64_t seq, ucc_rank_t n_readers)
+{
+    team->slot_reads += n_readers;
+    ucc_tl_shm_flag_set(flag, seq);
+}
+
+static inline void ucc_tl_shm_slot_read_done(ucc_tl_shm_team_t *team,
+                                             ucc_rank_t         peer)
+{
+    ucc_memory_cpu_fence();
+    ucc_atomic_add64((uint64_t *)&UCC_TL_SHM_CTRL(team, peer)->reads, 1);
+}
+
+/* Exposes own user buffer to peers and expects "n_readers" reads of it */
+static inline void ucc_tl_shm_buf_publish(ucc_tl_shm_team_t *team,
+                                          const void *buf, uint64_t seq,
+                                          ucc_rank_t n_readers)
+{
+    ucc_tl_shm_ctrl_t *ctrl = UCC_TL_SHM_CTRL(team, UCC_TL_TEAM_RANK(team));
+
+    ctrl->buf = (uint64_t)(uintptr_t)buf;
+    ucc_tl_shm_slot_publish(team, &ctrl->arrive, seq, n_readers);
+}
+
+/* Checks completion of the executor task posted by previous progress call */
+static inline ucc_status_t ucc_tl_shm_etask_test(ucc_tl_shm_task_t *task)
+{
+    ucc_status_t status;
+
+    if (task->etask == NULL) {
+        return UCC_OK;
+    }
+    status = ucc_ee_executor_task_test(task->etask);
+    if (status == UCC_OPERATION_INITIALIZED || status == UCC_INPROGRESS) {
+        return UCC_INPROGRESS;
+    }
+    ucc_ee_executor_task_finalize(task->etask);
+    task->etask = NULL;
+    return status;
+}
+
+#endif
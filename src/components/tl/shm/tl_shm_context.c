@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_shm.h"
+#include "tl_shm_coll.h"
+#include "utils/arch/cpu.h"
+#include <limits.h>
+#include <sys/prctl.h>
+
+UCC_CLASS_INIT_FUNC(ucc_tl_shm_context_t,
+                    const ucc_base_context_params_t *params,
+                    const ucc_base_config_t         *config)
+{
+    ucc_tl_shm_context_config_t *tl_shm_config =
+        ucc_derived_of(config, ucc_tl_shm_context_config_t);
+    ucc_tl_shm_lib_t            *lib           =
+        ucc_derived_of(tl_shm_config->super.tl_lib, ucc_tl_shm_lib_t);
+    ucc_status_t status;
+
+    UCC_CLASS_CALL_SUPER_INIT(ucc_tl_context_t, &tl_shm_config->super,
+                              params->context);
+    memcpy(&self->cfg, tl_shm_config, sizeof(*tl_shm_config));
+
+    status = ucc_mpool_init(&self->req_mp, 0, sizeof(ucc_tl_shm_task_t), 0,
+                            UCC_CACHE_LINE_SIZE, 8, UINT_MAX,
+                            &ucc_coll_task_mpool_ops, params->thread_mode,
+                            "tl_shm_req_mp");
+    if (status != UCC_OK) {
+        tl_error(self->super.super.lib,
+                 "failed to initialize tl_shm_req mpool");
+        return status;
+    }
+
+#ifdef PR_SET_PTRACER
+    if (lib->cfg.cma == UCC_YES) {
+        /* explicit opt-in: allow node peers to read process memory when yama
+           ptrace scope is restricted, this also allows any other process of
+           the user to attach */
+        tl_debug(self->super.super.lib, "setting PR_SET_PTRACER_ANY for CMA");
+        prctl(PR_SET_PTRACER, PR_SET_PTRACER_ANY, 0, 0, 0);
+    }
+#endif
+    return status;
+}
+
+UCC_CLASS_CLEANUP_FUNC(ucc_tl_shm_context_t)
+{
+    tl_debug(self->super.super.lib, "finalizing tl context: %p", self);
+    ucc_mpool_cleanup(&self->req_mp, 1);
+}
+
+UCC_CLASS_DEFINE(ucc_tl_shm_context_t, ucc_tl_context_t);
+
+ucc_status_t
+ucc_tl_shm_get_context_attr(const ucc_base_context_t *context, /* NOLINT */
+                            ucc_base_ctx_attr_t      *attr) /* NOLINT */
+{
+    ucc_base_ctx_attr_clear(attr);
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_mem_map(const ucc_base_context_t *context, /* NOLINT */
+                                ucc_mem_map_mode_t mode, /* NOLINT */
+                                ucc_mem_map_memh_t *memh, /* NOLINT */
+                                ucc_mem_map_tl_t *tl_h) /* NOLINT */
+{
+    return UCC_ERR_NOT_SUPPORTED;
+}
+
+ucc_status_t ucc_tl_shm_mem_unmap(const ucc_base_context_t *context, /* NOLINT */
+                                  ucc_mem_map_mode_t mode, /* NOLINT */
+                                  ucc_mem_map_tl_t *tl_h) /* NOLINT */
+{
+    return UCC_ERR_NOT_SUPPORTED;
+}
+
+ucc_status_t ucc_tl_shm_memh_pack(const ucc_base_context_t *context, /* NOLINT */
+                                  ucc_mem_map_mode_t mode, /* NOLINT */
+                                  ucc_mem_map_tl_t *tl_h, /* NOLINT */
+                                  void **pack_buffer) /* NOLINT */
+{
+    return UCC_ERR_NOT_SUPPORTED;
+}
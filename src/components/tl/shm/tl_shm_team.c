@@ -0,0 +1,306 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_shm.h"
+#include "tl_shm_coll.h"
+#include "core/ucc_team.h"
+#include "coll_score/ucc_coll_score.h"
+#include "utils/ucc_sys.h"
+#include <sys/shm.h>
+#include <errno.h>
+#include <unistd.h>
+
+#define UCC_TL_SHM_CMA_PROBE 0x5348434d41ull
+
+static inline size_t ucc_tl_shm_seg_size(ucc_rank_t size, size_t slot_size)
+{
+    return sizeof(ucc_tl_shm_seg_hdr_t) + size * sizeof(ucc_tl_shm_ctrl_t) +
+           size * slot_size;
+}
+
+UCC_CLASS_INIT_FUNC(ucc_tl_shm_team_t, ucc_base_context_t *tl_context,
+                    const ucc_base_team_params_t *params)
+{
+    ucc_tl_shm_context_t *ctx =
+        ucc_derived_of(tl_context, ucc_tl_shm_context_t);
+    ucc_tl_shm_lib_t     *lib =
+        ucc_derived_of(tl_context->lib, ucc_tl_shm_lib_t);
+    size_t                seg_size;
+    ucc_status_t          status;
+    int                   shm_id;
+
+    UCC_CLASS_CALL_SUPER_INIT(ucc_tl_team_t, &ctx->super, params);
+
+    self->oob        = params->params.oob;
+    self->seg        = (void *)-1;
+    self->ctrl       = NULL;
+    self->data       = NULL;
+    self->slot_size  = lib->cfg.slot_size;
+    self->seq_num    = 0;
+    self->n_created  = 0;
+    self->done_seq   = 0;
+    self->n_done     = 0;
+    self->pipe_done  = 0;
+    self->slot_reads = 0;
+    self->cma        = 0;
+    self->cma_probe  = UCC_TL_SHM_CMA_PROBE;
+
+    if (!ucc_team_map_is_single_node(params->team, params->map)) {
+        tl_debug(tl_context->lib, "multinode team is not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    self->shm_ids = ucc_malloc((UCC_TL_TEAM_SIZE(self) + 1) *
+                               sizeof(*self->shm_ids), "shm_ids");
+    if (!self->shm_ids) {
+        tl_error(tl_context->lib, "failed to alloc shm ids");
+        return UCC_ERR_NO_MEMORY;
+    }
+
+    shm_id = -1;
+    if (UCC_TL_TEAM_RANK(self) == 0) {
+        seg_size = ucc_tl_shm_seg_size(UCC_TL_TEAM_SIZE(self),
+                                       self->slot_size);
+        status   = ucc_sysv_alloc(&seg_size, (void **)&self->seg, &shm_id);
+        if (status != UCC_OK) {
+            tl_error(tl_context->lib, "failed to alloc sysv segment");
+            /* proceed and notify other ranks about error */
+            shm_id    = -1;
+            self->seg = (void *)-1;
+        } else {
+            memset(self->seg, 0, sizeof(ucc_tl_shm_seg_hdr_t) +
+                   UCC_TL_TEAM_SIZE(self) * sizeof(ucc_tl_shm_ctrl_t));
+        }
+    }
+
+    self->shm_ids[UCC_TL_TEAM_SIZE(self)] = shm_id;
+    status = self->oob.allgather(&self->shm_ids[UCC_TL_TEAM_SIZE(self)],
+                                 self->shm_ids, sizeof(int),
+                                 self->oob.coll_info, &self->oob_req);
+    if (UCC_OK != status) {
+        tl_error(tl_context->lib, "failed to start oob allgather");
+        goto free_seg;
+    }
+    tl_debug(tl_context->lib, "posted tl team: %p", self);
+    return UCC_OK;
+
+free_seg:
+    if (shm_id != -1) {
+        ucc_sysv_free(self->seg);
+    }
+    ucc_free(self->shm_ids);
+    return status;
+}
+
+UCC_CLASS_CLEANUP_FUNC(ucc_tl_shm_team_t)
+{
+    tl_debug(self->super.super.context->lib, "finalizing tl team: %p", self);
+    if (self->seg != (void *)-1) {
+        ucc_sysv_free(self->seg);
+    }
+    ucc_free(self->shm_ids);
+}
+
+UCC_CLASS_DEFINE_DELETE_FUNC(ucc_tl_shm_team_t, ucc_base_team_t);
+
+UCC_CLASS_DEFINE(ucc_tl_shm_team_t, ucc_tl_team_t);
+
+ucc_status_t ucc_tl_shm_team_destroy(ucc_base_team_t *tl_team)
+{
+    UCC_CLASS_DELETE_FUNC_NAME(ucc_tl_shm_team_t)(tl_team);
+    return UCC_OK;
+}
+
+/* Checks that memory of the next rank can be read with process_vm_readv */
+static int ucc_tl_shm_team_cma_probe(ucc_tl_shm_team_t *team)
+{
+    ucc_rank_t peer = (UCC_TL_TEAM_RANK(team) + 1) % UCC_TL_TEAM_SIZE(team);
+    uint64_t   val  = 0;
+
+    if (UCC_TL_SHM_TEAM_LIB(team)->cfg.cma == UCC_NO) {
+        return 0;
+    }
+    if (ucc_tl_shm_cma_read(team, peer, &val,
+                            UCC_TL_SHM_CTRL(team, peer)->buf,
+                            sizeof(val)) != UCC_OK) {
+        return 0;
+    }
+    return val == UCC_TL_SHM_CMA_PROBE;
+}
+
+ucc_status_t ucc_tl_shm_team_create_test(ucc_base_team_t *tl_team)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_rank_t         size = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         rank = UCC_TL_TEAM_RANK(team);
+    ucc_tl_shm_ctrl_t *ctrl;
+    ucc_status_t       status;
+    ucc_rank_t         i;
+    int                shm_id;
+
+    if (team->oob_req == NULL) {
+        return UCC_OK;
+    } else if (team->oob_req == (void *)0x1) {
+        goto wait_attach;
+    } else if (team->oob_req == (void *)0x2) {
+        goto wait_probe;
+    }
+    status = team->oob.req_test(team->oob_req);
+    if (status == UCC_INPROGRESS) {
+        return UCC_INPROGRESS;
+    } else if (status < 0) {
+        tl_error(tl_team->context->lib, "oob allgather failed");
+        return status;
+    }
+    team->oob.req_free(team->oob_req);
+    team->oob_req = (void *)0x1;
+
+    shm_id = team->shm_ids[0];
+    if (shm_id < 0) {
+        tl_error(tl_team->context->lib, "failed to create shmem region");
+        return UCC_ERR_NO_MEMORY;
+    }
+    if (rank != 0) {
+        team->seg = shmat(shm_id, NULL, 0);
+        if (team->seg == (void *)-1) {
+            tl_error(tl_team->context->lib, "failed to shmat errno: %d (%s)",
+                     errno, strerror(errno));
+            return UCC_ERR_NO_MEMORY;
+        }
+    }
+    team->ctrl   = PTR_OFFSET(team->seg, sizeof(ucc_tl_shm_seg_hdr_t));
+    team->data   = PTR_OFFSET(team->ctrl, size * sizeof(ucc_tl_shm_ctrl_t));
+    ctrl         = UCC_TL_SHM_CTRL(team, rank);
+    ctrl->pid    = getpid();
+    ctrl->buf    = (uint64_t)(uintptr_t)&team->cma_probe;
+    ucc_memory_cpu_store_fence();
+    ucc_atomic_add32(&team->seg->n_attached, 1);
+
+wait_attach:
+    /* segment was marked for removal on allocation, rank 0 must not detach
+       before all peers are attached */
+    if (team->seg->n_attached != size) {
+        return UCC_INPROGRESS;
+    }
+    ucc_memory_cpu_load_fence();
+    UCC_TL_SHM_CTRL(team, rank)->cma_ok = ucc_tl_shm_team_cma_probe(team);
+    ucc_memory_cpu_store_fence();
+    ucc_atomic_add32(&team->seg->n_probed, 1);
+    team->oob_req = (void *)0x2;
+
+wait_probe:
+    /* all ranks have to agree on CMA support to select the same algorithms */
+    if (team->seg->n_probed != size) {
+        return UCC_INPROGRESS;
+    }
+    ucc_memory_cpu_load_fence();
+    team->cma = 1;
+    for (i = 0; i < size; i++) {
+        team->cma = team->cma && UCC_TL_SHM_CTRL(team, i)->cma_ok;
+    }
+    team->oob_req = NULL;
+    tl_debug(tl_team->context->lib, "initialized tl team: %p, cma %s", team,
+             team->cma ? "enabled" : "disabled");
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_team_get_scores(ucc_base_team_t   *tl_team,
+                                        ucc_coll_score_t **score_p)
+{
+    ucc_tl_shm_team_t  *team     = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_base_context_t *ctx      = UCC_TL_TEAM_CTX(team);
+    ucc_memory_type_t   mt       = UCC_MEMORY_TYPE_HOST;
+    size_t              max_size = team->slot_size;
+    ucc_coll_score_t   *score;
+    ucc_status_t        status;
+    ucc_coll_score_team_info_t team_info;
+
+    team_info.alg_fn              = ucc_tl_shm_alg_id_to_init;
+    team_info.default_score       = UCC_TL_SHM_DEFAULT_SCORE;
+    team_info.init                = ucc_tl_shm_coll_init;
+    team_info.num_mem_types       = 1;
+    team_info.supported_mem_types = &mt;
+    team_info.supported_colls     = UCC_TL_SHM_SUPPORTED_COLLS;
+    team_info.size                = UCC_TL_TEAM_SIZE(team);
+
+    status = ucc_coll_score_alloc(&score);
+    if (UCC_OK != status) {
+        return status;
+    }
+
+    /* data of every rank has to fit into its slot of the segment */
+    status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_BARRIER, mt, 0,
+                                      UCC_MSG_MAX, UCC_TL_SHM_DEFAULT_SCORE,
+                                      ucc_tl_shm_coll_init, tl_team);
+    if (UCC_OK != status) {
+        goto err;
+    }
+    status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_BCAST, mt, 0,
+                                      max_size, UCC_TL_SHM_DEFAULT_SCORE,
+                                      ucc_tl_shm_coll_init, tl_team);
+    if (UCC_OK != status) {
+        goto err;
+    }
+    status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_REDUCE, mt, 0,
+                                      max_size, UCC_TL_SHM_DEFAULT_SCORE,
+                                      ucc_tl_shm_coll_init, tl_team);
+    if (UCC_OK != status) {
+        goto err;
+    }
+    status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_ALLREDUCE, mt, 0,
+                                      max_size, UCC_TL_SHM_DEFAULT_SCORE,
+                                      ucc_tl_shm_coll_init, tl_team);
+    if (UCC_OK != status) {
+        goto err;
+    }
+    status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_ALLGATHER, mt, 0,
+                                      max_size * UCC_TL_TEAM_SIZE(team),
+                                      UCC_TL_SHM_DEFAULT_SCORE,
+                                      ucc_tl_shm_coll_init, tl_team);
+    if (UCC_OK != status) {
+        goto err;
+    }
+
+    if (team->cma) {
+        /* larger messages are read directly from peer user buffers */
+        status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_BCAST, mt,
+                                          max_size + 1, UCC_MSG_MAX,
+                                          UCC_TL_SHM_DEFAULT_SCORE,
+                                          ucc_tl_shm_coll_init, tl_team);
+        if (UCC_OK != status) {
+            goto err;
+        }
+        status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_ALLGATHER, mt,
+                                          max_size * UCC_TL_TEAM_SIZE(team) + 1,
+                                          UCC_MSG_MAX, UCC_TL_SHM_DEFAULT_SCORE,
+                                          ucc_tl_shm_coll_init, tl_team);
+        if (UCC_OK != status) {
+            goto err;
+        }
+        status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_ALLTOALL, mt,
+                                          max_size * UCC_TL_TEAM_SIZE(team) + 1,
+                                          UCC_MSG_MAX, UCC_TL_SHM_DEFAULT_SCORE,
+                                          ucc_tl_shm_coll_init, tl_team);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+
+    if (strlen(ctx->score_str) > 0) {
+        status = ucc_coll_score_update_from_str(ctx->score_str, &team_info,
+                                                &team->super.super, score);
+        if ((status < 0) && (status != UCC_ERR_INVALID_PARAM) &&
+            (status != UCC_ERR_NOT_SUPPORTED)) {
+            goto err;
+        }
+    }
+
+    *score_p = score;
+    return UCC_OK;
+err:
+    ucc_coll_score_free(score);
+    return status;
+}
@@ -43,6 +43,14 @@ ucc_base_coll_alg_info_t
             {.id   = UCC_TL_UCP_ALLGATHER_ALG_LINEAR_BATCHED,
              .name = "batched",
              .desc = "O(N - 1) Linear algorithm, K-send/receive in flight"},
+        [UCC_TL_UCP_ALLGATHER_ALG_ONESIDED_LINEAR] =
+            {.id   = UCC_TL_UCP_ALLGATHER_ALG_ONESIDED_LINEAR,
+             .name = "onesided_linear",
+             .desc = "O(N) one-sided linear algorithm, puts to all peers"},
+        [UCC_TL_UCP_ALLGATHER_ALG_ONESIDED_RING] =
+            {.id   = UCC_TL_UCP_ALLGATHER_ALG_ONESIDED_RING,
+             .name = "onesided_ring",
+             .desc = "O(N) one-sided ring algorithm"},
         [UCC_TL_UCP_ALLGATHER_ALG_LAST] = {
             .id = 0, .name = NULL, .desc = NULL}};
 
@@ -16,6 +16,8 @@ enum {
     UCC_TL_UCP_ALLGATHER_ALG_SPARBIT,
     UCC_TL_UCP_ALLGATHER_ALG_LINEAR,
     UCC_TL_UCP_ALLGATHER_ALG_LINEAR_BATCHED,
+    UCC_TL_UCP_ALLGATHER_ALG_ONESIDED_LINEAR,
+    UCC_TL_UCP_ALLGATHER_ALG_ONESIDED_RING,
     UCC_TL_UCP_ALLGATHER_ALG_LAST
 };
 
@@ -91,6 +93,18 @@ ucc_tl_ucp_allgather_linear_batched_init(ucc_base_coll_args_t *coll_args,
                                          ucc_base_team_t      *team,
                                          ucc_coll_task_t     **task_h);
 
+/* One-sided versions, require memory mapped buffers and global work
+   buffer */
+ucc_status_t
+ucc_tl_ucp_allgather_onesided_linear_init(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t      *team,
+                                          ucc_coll_task_t     **task_h);
+
+ucc_status_t
+ucc_tl_ucp_allgather_onesided_ring_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *team,
+                                        ucc_coll_task_t     **task_h);
+
 /* Uses allgather_kn_radix from config */
 ucc_status_t ucc_tl_ucp_allgather_knomial_init(ucc_base_coll_args_t *coll_args,
                                                ucc_base_team_t      *team,
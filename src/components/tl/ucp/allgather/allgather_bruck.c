@@ -19,7 +19,8 @@ ucc_status_t ucc_tl_ucp_allgather_bruck_init(ucc_base_coll_args_t *coll_args,
                                              ucc_coll_task_t     **task_h)
 {
     ucc_tl_ucp_team_t *tl_team      = ucc_derived_of(team, ucc_tl_ucp_team_t);
-    ucc_tl_ucp_task_t *task         = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_tl_ucp_task_t *task         = ucc_tl_ucp_init_task_sized(
+        coll_args, team, UCC_TL_UCP_TASK_SIZE(allgather_bruck));
     ucc_status_t       status       = UCC_OK;
     ucc_rank_t         trank        = UCC_TL_TEAM_RANK(tl_team);
     ucc_rank_t         tsize        = UCC_TL_TEAM_SIZE(tl_team);
@@ -287,7 +287,8 @@ ucc_status_t ucc_tl_ucp_allgather_knomial_init_r(
     ucc_tl_ucp_task_t *task;
     ucc_sbgp_t        *sbgp;
 
-    task = ucc_tl_ucp_init_task(coll_args, team);
+    task = ucc_tl_ucp_init_task_sized(coll_args, team,
+                                      UCC_TL_UCP_TASK_SIZE(allgather_kn));
     if (tl_team->cfg.use_reordering &&
         coll_args->args.coll_type == UCC_COLL_TYPE_ALLREDUCE) {
         sbgp = ucc_topo_get_sbgp(tl_team->topo, UCC_SBGP_FULL_HOST_ORDERED);
@@ -318,6 +319,9 @@ ucc_status_t ucc_tl_ucp_allgather_knomial_init(ucc_base_coll_args_t *coll_args,
     ucc_datatype_t     dtype   = GET_DT(&coll_args->args);
     ucc_kn_radix_t     radix;
 
+    if (ucc_coll_args_is_noncontig_dt(&coll_args->args, UCC_RANK_INVALID)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
     radix = ucc_tl_ucp_get_knomial_radix(tl_team, count, dtype, mtype, p, 0);
 
     return ucc_tl_ucp_allgather_knomial_init_r(coll_args, team, task_h, radix);
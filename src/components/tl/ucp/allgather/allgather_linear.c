@@ -63,7 +63,8 @@ ucc_status_t ucc_tl_ucp_allgather_batched_init(
     ucc_coll_task_t **task_h, unsigned long nreqs)
 {
     ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
-    ucc_tl_ucp_task_t *task    = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_tl_ucp_task_t *task    = ucc_tl_ucp_init_task_sized(
+        coll_args, team, UCC_TL_UCP_TASK_SIZE(allgather_linear));
 
     if (!ucc_coll_args_is_predefined_dt(&TASK_ARGS(task), UCC_RANK_INVALID)) {
         tl_error(UCC_TASK_LIB(task), "user defined datatype is not supported");
@@ -0,0 +1,255 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "allgather.h"
+#include "core/ucc_progress_queue.h"
+#include "utils/ucc_math.h"
+#include "tl_ucp_sendrecv.h"
+
+/* Both algorithms put the blocks directly to the dst buffers of the peers
+   and notify the peer by atomic increment of pSync, i.e. the first long of
+   the global work buffer. Worker fence orders the data puts before the
+   increment, so the receiver never matches or copies anything: the block
+   is in place once pSync is incremented. */
+
+static inline void
+ucc_tl_ucp_allgather_onesided_memh(ucc_tl_ucp_task_t  *task,
+                                   ucc_mem_map_mem_h  *src_memh,
+                                   ucc_mem_map_mem_h  *dst_local_memh,
+                                   ucc_mem_map_mem_h **dst_memh)
+{
+    ucc_coll_args_t *args  = &TASK_ARGS(task);
+    ucc_rank_t       grank = UCC_TL_TEAM_RANK(TASK_TEAM(task));
+
+    *src_memh       = args->src_memh.local_memh;
+    *dst_memh       = args->dst_memh.global_memh;
+    *dst_local_memh = *dst_memh ? (*dst_memh)[grank] : NULL;
+    if (args->flags & UCC_COLL_ARGS_FLAG_SRC_MEMH_GLOBAL) {
+        *src_memh = args->src_memh.global_memh[grank];
+    }
+}
+
+ucc_status_t ucc_tl_ucp_allgather_onesided_linear_start(ucc_coll_task_t *ctask)
+{
+    ucc_tl_ucp_task_t *task     = ucc_derived_of(ctask, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team     = TASK_TEAM(task);
+    ucc_coll_args_t   *args     = &TASK_ARGS(task);
+    ucc_rank_t         grank    = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         gsize    = UCC_TL_TEAM_SIZE(team);
+    long              *pSync    = args->global_work_buffer;
+    size_t             nbytes   = (args->dst.info.count / gsize) *
+                                  ucc_dt_size(args->dst.info.datatype);
+    void              *dst      = PTR_OFFSET(args->dst.info.buffer,
+                                             grank * nbytes);
+    void              *src      = UCC_IS_INPLACE(*args) ? dst :
+                                  args->src.info.buffer;
+    ucc_mem_map_mem_h  src_memh, dst_local_memh;
+    ucc_mem_map_mem_h *dst_memh;
+    ucc_rank_t         peer, i;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(ctask, "ucp_allgather_onesided_linear",
+                                     0);
+    ucc_tl_ucp_allgather_onesided_memh(task, &src_memh, &dst_local_memh,
+                                       &dst_memh);
+    if (UCC_IS_INPLACE(*args)) {
+        src_memh = dst_local_memh;
+    }
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    for (i = 0; i < gsize; i++) {
+        peer = (grank + 1 + i) % gsize;
+        if (peer == grank && UCC_IS_INPLACE(*args)) {
+            continue;
+        }
+        UCPCHECK_GOTO(ucc_tl_ucp_put_nb(src, dst, nbytes, peer, src_memh,
+                                        dst_memh, team, task),
+                      task, out);
+    }
+    ucp_worker_fence(team->worker->ucp_worker);
+    for (i = 0; i < gsize; i++) {
+        peer = (grank + 1 + i) % gsize;
+        UCPCHECK_GOTO(ucc_tl_ucp_atomic_inc(pSync, peer, dst_memh, team),
+                      task, out);
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+out:
+    return task->super.status;
+}
+
+void ucc_tl_ucp_allgather_onesided_linear_progress(ucc_coll_task_t *ctask)
+{
+    ucc_tl_ucp_task_t *task  = ucc_derived_of(ctask, ucc_tl_ucp_task_t);
+    ucc_rank_t         gsize = UCC_TL_TEAM_SIZE(TASK_TEAM(task));
+    long              *pSync = TASK_ARGS(task).global_work_buffer;
+
+    if (ucc_tl_ucp_test_onesided(task, gsize) == UCC_INPROGRESS) {
+        return;
+    }
+    pSync[0]           = 0;
+    task->super.status = UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_allgather_onesided_ring_start(ucc_coll_task_t *ctask)
+{
+    ucc_tl_ucp_task_t *task   = ucc_derived_of(ctask, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team   = TASK_TEAM(task);
+    ucc_coll_args_t   *args   = &TASK_ARGS(task);
+    ucc_rank_t         grank  = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         gsize  = UCC_TL_TEAM_SIZE(team);
+    size_t             nbytes = (args->dst.info.count / gsize) *
+                                ucc_dt_size(args->dst.info.datatype);
+    void              *dst    = PTR_OFFSET(args->dst.info.buffer,
+                                           grank * nbytes);
+    ucc_mem_map_mem_h  src_memh, dst_local_memh;
+    ucc_mem_map_mem_h *dst_memh;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(ctask, "ucp_allgather_onesided_ring", 0);
+    ucc_tl_ucp_allgather_onesided_memh(task, &src_memh, &dst_local_memh,
+                                       &dst_memh);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    task->allgather_onesided.step = 0;
+    if (!UCC_IS_INPLACE(*args)) {
+        UCPCHECK_GOTO(ucc_tl_ucp_put_nb(args->src.info.buffer, dst, nbytes,
+                                        grank, src_memh, dst_memh, team,
+                                        task),
+                      task, out);
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+out:
+    return task->super.status;
+}
+
+void ucc_tl_ucp_allgather_onesided_ring_progress(ucc_coll_task_t *ctask)
+{
+    ucc_tl_ucp_task_t *task   = ucc_derived_of(ctask, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team   = TASK_TEAM(task);
+    ucc_coll_args_t   *args   = &TASK_ARGS(task);
+    ucc_rank_t         grank  = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         gsize  = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         right  = (grank + 1) % gsize;
+    volatile long     *pSync  = args->global_work_buffer;
+    size_t             nbytes = (args->dst.info.count / gsize) *
+                                ucc_dt_size(args->dst.info.datatype);
+    int                polls  = 0;
+    ucc_mem_map_mem_h  src_memh, dst_local_memh;
+    ucc_mem_map_mem_h *dst_memh;
+    ucc_rank_t         step, block;
+    void              *src, *dst;
+
+    ucc_tl_ucp_allgather_onesided_memh(task, &src_memh, &dst_local_memh,
+                                       &dst_memh);
+    while ((step = task->allgather_onesided.step) < gsize - 1) {
+        /* block forwarded at step s is received from the left at step s-1 */
+        if (*pSync < step) {
+            if (polls++ >= task->n_polls) {
+                return;
+            }
+            ucp_worker_progress(team->worker->ucp_worker);
+            continue;
+        }
+        block = (grank - step + gsize) % gsize;
+        dst   = PTR_OFFSET(args->dst.info.buffer, block * nbytes);
+        if (step == 0 && !UCC_IS_INPLACE(*args)) {
+            /* own block may be still in flight to the local dst */
+            src = args->src.info.buffer;
+        } else {
+            src      = dst;
+            src_memh = dst_local_memh;
+        }
+        UCPCHECK_GOTO(ucc_tl_ucp_put_nb(src, dst, nbytes, right, src_memh,
+                                        dst_memh, team, task),
+                      task, out);
+        ucp_worker_fence(team->worker->ucp_worker);
+        UCPCHECK_GOTO(ucc_tl_ucp_atomic_inc(args->global_work_buffer, right,
+                                            dst_memh, team),
+                      task, out);
+        task->allgather_onesided.step++;
+    }
+
+    if (ucc_tl_ucp_test_onesided(task, gsize - 1) == UCC_INPROGRESS) {
+        return;
+    }
+    *pSync             = 0;
+    task->super.status = UCC_OK;
+out:
+    return;
+}
+
+static ucc_status_t
+ucc_tl_ucp_allgather_onesided_init_common(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t      *team,
+                                          ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_coll_args_t   *args    = &coll_args->args;
+
+    if (!ucc_coll_args_is_predefined_dt(args, UCC_RANK_INVALID)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "user defined datatype is not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (!(args->mask & UCC_COLL_ARGS_FIELD_GLOBAL_WORK_BUFFER)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "global work buffer not provided nor associated with team");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if ((args->mask & UCC_COLL_ARGS_FIELD_FLAGS) &&
+        !(args->flags & UCC_COLL_ARGS_FLAG_MEM_MAPPED_BUFFERS)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "non memory mapped buffers are not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (!(args->mask & UCC_COLL_ARGS_FIELD_MEM_MAP_SRC_MEMH)) {
+        args->src_memh.global_memh = NULL;
+    }
+    if (!(args->mask & UCC_COLL_ARGS_FIELD_MEM_MAP_DST_MEMH)) {
+        args->dst_memh.global_memh = NULL;
+    } else if (!(args->flags & UCC_COLL_ARGS_FLAG_DST_MEMH_GLOBAL)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "onesided allgather requires global memory handles for dst "
+                 "buffers");
+        return UCC_ERR_INVALID_PARAM;
+    }
+    *task_h = &ucc_tl_ucp_init_task_sized(
+                   coll_args, team, UCC_TL_UCP_TASK_SIZE(allgather_onesided))
+                   ->super;
+    return UCC_OK;
+}
+
+ucc_status_t
+ucc_tl_ucp_allgather_onesided_linear_init(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t      *team,
+                                          ucc_coll_task_t     **task_h)
+{
+    ucc_status_t status;
+
+    status = ucc_tl_ucp_allgather_onesided_init_common(coll_args, team,
+                                                       task_h);
+    if (status != UCC_OK) {
+        return status;
+    }
+    (*task_h)->post     = ucc_tl_ucp_allgather_onesided_linear_start;
+    (*task_h)->progress = ucc_tl_ucp_allgather_onesided_linear_progress;
+    return UCC_OK;
+}
+
+ucc_status_t
+ucc_tl_ucp_allgather_onesided_ring_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *team,
+                                        ucc_coll_task_t     **task_h)
+{
+    ucc_status_t status;
+
+    status = ucc_tl_ucp_allgather_onesided_init_common(coll_args, team,
+                                                       task_h);
+    if (status != UCC_OK) {
+        return status;
+    }
+    (*task_h)->post     = ucc_tl_ucp_allgather_onesided_ring_start;
+    (*task_h)->progress = ucc_tl_ucp_allgather_onesided_ring_progress;
+    return UCC_OK;
+}
@@ -108,21 +108,12 @@ ucc_status_t ucc_tl_ucp_allgather_ring_start(ucc_coll_task_t *coll_task)
 
 ucc_status_t ucc_tl_ucp_allgather_ring_init_common(ucc_tl_ucp_task_t *task)
 {
-    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
-    ucc_sbgp_t *sbgp;
-
     if (!ucc_coll_args_is_predefined_dt(&TASK_ARGS(task), UCC_RANK_INVALID)) {
         tl_error(UCC_TASK_LIB(task), "user defined datatype is not supported");
         return UCC_ERR_NOT_SUPPORTED;
     }
 
-    if (!(task->flags & UCC_TL_UCP_TASK_FLAG_SUBSET)) {
-        if (team->cfg.use_reordering) {
-            sbgp = ucc_topo_get_sbgp(team->topo, UCC_SBGP_FULL_HOST_ORDERED);
-            task->subset.myrank = sbgp->group_rank;
-            task->subset.map    = sbgp->map;
-        }
-    }
+    ucc_tl_ucp_task_reorder(task);
 
     task->allgather_ring.get_send_block = ucc_tl_ucp_allgather_ring_get_send_block;
     task->allgather_ring.get_recv_block = ucc_tl_ucp_allgather_ring_get_recv_block;
@@ -139,7 +130,8 @@ ucc_status_t ucc_tl_ucp_allgather_ring_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_status_t status;
 
-    task = ucc_tl_ucp_init_task(coll_args, team);
+    task = ucc_tl_ucp_init_task_sized(coll_args, team,
+                                      UCC_TL_UCP_TASK_SIZE(allgather_ring));
     status = ucc_tl_ucp_allgather_ring_init_common(task);
     if (status != UCC_OK) {
         ucc_tl_ucp_put_task(task);
@@ -29,6 +29,11 @@ ucc_base_coll_alg_info_t
             {.id   = UCC_TL_UCP_ALLREDUCE_ALG_SLIDING_WINDOW,
              .name = "sliding_window",
              .desc = "sliding window allreduce (optimized for running on DPU)"},
+        [UCC_TL_UCP_ALLREDUCE_ALG_REPRODUCIBLE] =
+            {.id   = UCC_TL_UCP_ALLREDUCE_ALG_REPRODUCIBLE,
+             .name = "reproducible",
+             .desc = "direct reduce-scatter with rank ordered reduction "
+                     "followed by allgather (bitwise reproducible)"},
         [UCC_TL_UCP_ALLREDUCE_ALG_LAST] = {
             .id = 0, .name = NULL, .desc = NULL}};
 
@@ -13,6 +13,7 @@ enum {
     UCC_TL_UCP_ALLREDUCE_ALG_SRA_KNOMIAL,
     UCC_TL_UCP_ALLREDUCE_ALG_SLIDING_WINDOW,
     UCC_TL_UCP_ALLREDUCE_ALG_DBT,
+    UCC_TL_UCP_ALLREDUCE_ALG_REPRODUCIBLE,
     UCC_TL_UCP_ALLREDUCE_ALG_LAST
 };
 
@@ -23,6 +24,17 @@ ucc_status_t ucc_tl_ucp_allreduce_init(ucc_tl_ucp_task_t *task);
 #define UCC_TL_UCP_ALLREDUCE_DEFAULT_ALG_SELECT_STR                            \
     "allreduce:0-4k:@0#allreduce:4k-inf:@1"
 
+/* Applied on top of the user settings when ALLREDUCE_REPRODUCIBLE is set */
+#define UCC_TL_UCP_ALLREDUCE_REPRODUCIBLE_SELECT_STR                           \
+    "allreduce:@reproducible:inf"
+
+/* Max message size for which every rank of the reproducible allreduce
+   reduces the whole vector and the allgather step is skipped. Every rank
+   then receives the full vector of each peer, the path is also limited by
+   the scratch size of team_size vectors */
+#define UCC_TL_UCP_ALLREDUCE_REPRODUCIBLE_WHOLE_MAX         4096
+#define UCC_TL_UCP_ALLREDUCE_REPRODUCIBLE_WHOLE_SCRATCH_MAX 65536
+
 #define CHECK_SAME_MEMTYPE(_args, _team)                                       \
     do {                                                                       \
         if (!UCC_IS_INPLACE(_args) &&                                          \
@@ -34,8 +46,19 @@ ucc_status_t ucc_tl_ucp_allreduce_init(ucc_tl_ucp_task_t *task);
         }                                                                      \
     } while (0)
 
+#define CHECK_AVG(_args, _team)                                                \
+    do {                                                                       \
+        status = ucc_tl_ucp_avg_check((_team), &(_args),                       \
+                                      (_args).dst.info.datatype,               \
+                                      (_args).dst.info.mem_type);              \
+        if (status != UCC_OK) {                                                \
+            goto out;                                                          \
+        }                                                                      \
+    } while (0)
+
 #define ALLREDUCE_TASK_CHECK(_args, _team)                                     \
-    CHECK_SAME_MEMTYPE((_args), (_team));
+    CHECK_SAME_MEMTYPE((_args), (_team));                                      \
+    CHECK_AVG((_args), (_team));
 
 
 ucc_status_t ucc_tl_ucp_allreduce_knomial_init(ucc_base_coll_args_t *coll_args,
@@ -77,6 +100,11 @@ ucc_status_t ucc_tl_ucp_allreduce_dbt_start(ucc_coll_task_t *task);
 
 ucc_status_t ucc_tl_ucp_allreduce_dbt_progress(ucc_coll_task_t *task);
 
+ucc_status_t
+ucc_tl_ucp_allreduce_reproducible_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *team,
+                                       ucc_coll_task_t     **task_h);
+
 static inline int ucc_tl_ucp_allreduce_alg_from_str(const char *str)
 {
     int i;
@@ -18,12 +18,164 @@
         task->allreduce_kn.phase = _phase;                                     \
     } while (0)
 
+static void ucc_tl_ucp_allreduce_knomial_prepost_cb(
+    void *request, ucs_status_t status,
+    const ucp_tag_recv_info_t *info, /* NOLINT */
+    void *user_data)
+{
+    ucc_tl_ucp_task_t *task = (ucc_tl_ucp_task_t *)user_data;
+    int                i;
+
+    for (i = 0; i < UCC_EE_EXECUTOR_NUM_BUFS - 1; i++) {
+        if (task->allreduce_kn.prepost_reqs[i] == request) {
+            task->allreduce_kn.prepost_reqs[i] = NULL;
+            break;
+        }
+    }
+    if (ucc_unlikely(UCS_OK != status && UCS_ERR_CANCELED != status)) {
+        tl_error(UCC_TASK_LIB(task), "failure in pre-posted recv completion %s",
+                 ucs_status_string(status));
+        /* the previous iteration may be completed already, its status is
+           not overwritten */
+        if (task->super.status == UCC_INPROGRESS) {
+            task->super.status = ucs_status_to_ucc_status(status);
+        } else {
+            task->allreduce_kn.prepost_status =
+                ucs_status_to_ucc_status(status);
+        }
+    }
+    ++task->tagged.recv_completed;
+    ucp_request_free(request);
+}
+
+static inline int
+ucc_tl_ucp_allreduce_knomial_prepost_pending(ucc_tl_ucp_task_t *task)
+{
+    int i;
+
+    for (i = 0; i < UCC_EE_EXECUTOR_NUM_BUFS - 1; i++) {
+        if (task->allreduce_kn.prepost_reqs[i]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void ucc_tl_ucp_allreduce_knomial_prepost_cancel(ucc_tl_ucp_task_t *task)
+{
+    ucp_worker_h worker = TASK_TEAM(task)->worker->ucp_worker;
+    int          i;
+
+    for (i = 0; i < UCC_EE_EXECUTOR_NUM_BUFS - 1; i++) {
+        if (task->allreduce_kn.prepost_reqs[i]) {
+            ucp_request_cancel(worker, task->allreduce_kn.prepost_reqs[i]);
+        }
+    }
+    while (ucc_tl_ucp_allreduce_knomial_prepost_pending(task)) {
+        ucp_worker_progress(worker);
+    }
+    task->allreduce_kn.preposted = 0;
+}
+
+static ucc_status_t
+ucc_tl_ucp_allreduce_knomial_prepost_recv(ucc_tl_ucp_task_t *task, void *buf,
+                                          size_t data_size, ucc_rank_t peer,
+                                          int slot)
+{
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucs_status_ptr_t   ucp_status;
+
+    ucp_status = ucc_tl_ucp_recv_common(
+        buf, data_size, TASK_ARGS(task).dst.info.mem_type, peer, team, task,
+        ucc_tl_ucp_allreduce_knomial_prepost_cb, (void *)task);
+    if (UCS_OK == ucp_status) {
+        ++task->tagged.recv_completed;
+        return UCC_OK;
+    }
+    if (ucc_unlikely(UCS_PTR_IS_ERR(ucp_status))) {
+        return ucs_status_to_ucc_status(UCS_PTR_STATUS(ucp_status));
+    }
+    task->allreduce_kn.prepost_reqs[slot] = ucp_status;
+    return UCC_OK;
+}
+
+static inline int
+ucc_tl_ucp_allreduce_knomial_prepost_enabled(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+
+    /* pre-posted requests are completed outside of the task progress,
+       their bookkeeping is not thread safe */
+    return UCC_IS_PERSISTENT(TASK_ARGS(task)) &&
+           team->cfg.allreduce_kn_prepost &&
+           UCC_TL_CORE_CTX(team)->thread_mode != UCC_THREAD_MULTIPLE &&
+           task->allreduce_kn.p.node_type != KN_NODE_EXTRA;
+}
+
+/* Posts the receives of the next iteration that land in scratch: the
+   receive from EXTRA on a PROXY rank and the first loop step receives on a
+   BASE rank. EXTRA ranks receive directly into dst and post nothing. */
+static void ucc_tl_ucp_allreduce_knomial_prepost(ucc_tl_ucp_task_t *task)
+{
+    ucc_coll_args_t       *args      = &TASK_ARGS(task);
+    ucc_knomial_pattern_t *p         = &task->allreduce_kn.p;
+    ucc_kn_radix_t         radix     = task->allreduce_kn.radix;
+    ucc_rank_t             size      = (ucc_rank_t)task->subset.map.ep_num;
+    ucc_rank_t             rank      = task->subset.myrank;
+    void                  *scratch   = task->allreduce_kn.scratch;
+    size_t                 data_size = args->dst.info.count *
+                                       ucc_dt_size(args->dst.info.datatype);
+    ptrdiff_t              recv_offset;
+    ucc_kn_radix_t         loop_step, index;
+    ucc_rank_t             peer;
+    ucc_status_t           status;
+    int                    slot;
+
+    ucc_knomial_pattern_init(size, rank, radix, p);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    slot   = 0;
+    status = UCC_OK;
+    if (KN_NODE_PROXY == p->node_type) {
+        peer   = ucc_ep_map_eval(task->subset.map,
+                                 ucc_knomial_pattern_get_extra(p, rank));
+        status = ucc_tl_ucp_allreduce_knomial_prepost_recv(task, scratch,
+                                                           data_size, peer,
+                                                           slot);
+    } else {
+        recv_offset = 0;
+        for (loop_step = radix - 1; loop_step > 0; loop_step--) {
+            peer = ucc_knomial_pattern_get_loop_peer(p, rank, loop_step);
+            if (peer == UCC_KN_PEER_NULL)
+                continue;
+            index = ucc_knomial_pattern_get_loop_index(p, peer);
+            peer  = ucc_ep_map_eval(task->subset.map, peer);
+            task->allreduce_kn.reduce_bufs[index] =
+                PTR_OFFSET(scratch, recv_offset);
+            status = ucc_tl_ucp_allreduce_knomial_prepost_recv(
+                task, PTR_OFFSET(scratch, recv_offset), data_size, peer,
+                slot++);
+            if (ucc_unlikely(status != UCC_OK)) {
+                break;
+            }
+            recv_offset += data_size;
+        }
+    }
+    task->allreduce_kn.preposted = 1;
+    if (ucc_unlikely(status != UCC_OK)) {
+        /* next iteration posts its receives as usual */
+        tl_debug(UCC_TASK_LIB(task), "failed to pre-post receives: %s",
+                 ucc_status_string(status));
+        ucc_tl_ucp_allreduce_knomial_prepost_cancel(task);
+    }
+}
+
 void ucc_tl_ucp_allreduce_knomial_progress(ucc_coll_task_t *coll_task)
 {
     ucc_tl_ucp_task_t     *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
     ucc_coll_args_t       *args = &TASK_ARGS(task);
     ucc_tl_ucp_team_t     *team = TASK_TEAM(task);
-    int                    avg_pre_op = team->cfg.reduce_avg_pre_op;
+    int                    avg_pre_op =
+        ucc_tl_ucp_avg_pre_op(team, args->dst.info.datatype);
     ucc_kn_radix_t         radix      = task->allreduce_kn.p.radix;
     uint8_t                node_type  = task->allreduce_kn.p.node_type;
     ucc_knomial_pattern_t *p          = &task->allreduce_kn.p;
@@ -41,6 +193,7 @@ void ucc_tl_ucp_allreduce_knomial_progress(ucc_coll_task_t *coll_task)
     ucc_status_t           status;
     ucc_kn_radix_t         loop_step;
     int                    is_avg;
+    uint16_t               flags;
     ucc_kn_radix_t         index;
 
     if (UCC_IS_INPLACE(*args)) {
@@ -59,7 +212,7 @@ void ucc_tl_ucp_allreduce_knomial_progress(ucc_coll_task_t *coll_task)
             task, out);
     }
 
-    if (KN_NODE_PROXY == node_type) {
+    if (KN_NODE_PROXY == node_type && !task->allreduce_kn.preposted) {
         peer = ucc_ep_map_eval(task->subset.map,
                                ucc_knomial_pattern_get_extra(p, rank));
         UCPCHECK_GOTO(
@@ -109,6 +262,11 @@ UCC_KN_PHASE_EXTRA_REDUCE:
 
         recv_offset = 0;
         for (loop_step = radix - 1 ; loop_step > 0; loop_step--) {
+            if (task->allreduce_kn.preposted && KN_NODE_BASE == node_type &&
+                ucc_knomial_pattern_loop_first_iteration(p)) {
+                /* posted at completion of the previous iteration */
+                break;
+            }
             peer = ucc_knomial_pattern_get_loop_peer(p, rank, loop_step);
             if (peer == UCC_KN_PEER_NULL)
                 continue;
@@ -140,11 +298,14 @@ UCC_KN_PHASE_EXTRA_REDUCE:
             is_avg = args->op == UCC_OP_AVG &&
                      (avg_pre_op ? ucc_knomial_pattern_loop_first_iteration(p)
                                  : ucc_knomial_pattern_loop_last_iteration(p));
+            flags  = is_avg ? UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA : 0;
+            if (ucc_knomial_pattern_loop_last_iteration(p)) {
+                flags |= ucc_tl_ucp_reduce_nt_flag(task, data_size);
+            }
 
             status = ucc_dt_reduce_multi(
                 task->allreduce_kn.reduce_bufs, rbuf, task->tagged.send_posted - p->iteration * (radix - 1) + 1,
-                count, dt, args,
-                is_avg ? UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA : 0, AVG_ALPHA(task),
+                count, dt, args, flags, AVG_ALPHA(task),
                 task->allreduce_kn.executor, &task->allreduce_kn.etask);
             if (ucc_unlikely(UCC_OK != status)) {
                 tl_error(UCC_TASK_LIB(task), "failed to perform dt reduction");
@@ -177,6 +338,10 @@ UCC_KN_PHASE_PROXY:
 
 completion:
     ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->allreduce_kn.preposted = 0;
+    if (ucc_tl_ucp_allreduce_knomial_prepost_enabled(task)) {
+        ucc_tl_ucp_allreduce_knomial_prepost(task);
+    }
     task->super.status = UCC_OK;
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allreduce_kn_done", 0);
 UCC_KN_PHASE_COMPLETE: /* unused label */
@@ -191,25 +356,31 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_start(ucc_coll_task_t *coll_task)
     ucc_rank_t         size      = (ucc_rank_t)task->subset.map.ep_num;
     ucc_rank_t         rank      = task->subset.myrank;
     ucc_memory_type_t  mem_type  = TASK_ARGS(task).dst.info.mem_type;
-    size_t             count     = TASK_ARGS(task).dst.info.count;
-    ucc_datatype_t     dt        = TASK_ARGS(task).dst.info.datatype;
-    size_t             data_size = count * ucc_dt_size(dt);
-    ucc_mrange_uint_t *p         = &team->cfg.allreduce_kn_radix;
-    ucc_kn_radix_t     cfg_radix, radix;
+    uint32_t           recv_posted, recv_completed;
     ucc_status_t       status;
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allreduce_kn_start", 0);
     task->allreduce_kn.phase = UCC_KN_PHASE_INIT;
     ucc_assert(UCC_IS_INPLACE(TASK_ARGS(task)) ||
                (TASK_ARGS(task).src.info.mem_type == mem_type));
-    cfg_radix = ucc_tl_ucp_get_radix_from_range(team, data_size, mem_type, p,
-                                                UCC_UUNITS_AUTO_RADIX);
-    radix = ucc_min(cfg_radix, size);
-    /* max radix is limited by the number of buffers in the executor */
-    radix = ucc_min(radix, UCC_EE_EXECUTOR_NUM_BUFS);
-    ucc_knomial_pattern_init(size, rank, radix,
+    if (ucc_unlikely(task->allreduce_kn.prepost_status != UCC_OK)) {
+        status = task->allreduce_kn.prepost_status;
+        task->allreduce_kn.prepost_status = UCC_OK;
+        ucc_tl_ucp_allreduce_knomial_prepost_cancel(task);
+        return status;
+    }
+    ucc_knomial_pattern_init(size, rank, task->allreduce_kn.radix,
                              &task->allreduce_kn.p);
-    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    if (task->allreduce_kn.preposted) {
+        /* keep the accounting of the receives posted at previous completion */
+        recv_posted    = task->tagged.recv_posted;
+        recv_completed = task->tagged.recv_completed;
+        ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+        task->tagged.recv_posted    = recv_posted;
+        task->tagged.recv_completed = recv_completed;
+    } else {
+        ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    }
     status =
         ucc_coll_task_get_executor(&task->super, &task->allreduce_kn.executor);
     if (ucc_unlikely(status != UCC_OK)) {
@@ -226,7 +397,6 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_init_common(ucc_tl_ucp_task_t *task)
     ucc_datatype_t     dt        = TASK_ARGS(task).dst.info.datatype;
     size_t             data_size = count * ucc_dt_size(dt);
     ucc_mrange_uint_t *p         = &team->cfg.allreduce_kn_radix;
-    ucc_sbgp_t        *sbgp;
     ucc_rank_t         size;
     ucc_kn_radix_t     radix, cfg_radix;
     ucc_status_t       status;
@@ -236,16 +406,19 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_init_common(ucc_tl_ucp_task_t *task)
     task->super.progress = ucc_tl_ucp_allreduce_knomial_progress;
     task->super.finalize = ucc_tl_ucp_allreduce_knomial_finalize;
 
-    if (!(task->flags & UCC_TL_UCP_TASK_FLAG_SUBSET) && team->cfg.use_reordering) {
-        sbgp = ucc_topo_get_sbgp(team->topo, UCC_SBGP_FULL_HOST_ORDERED);
-        task->subset.myrank = sbgp->group_rank;
-        task->subset.map    = sbgp->map;
-    }
+    ucc_tl_ucp_task_reorder(task);
 
     size      = (ucc_rank_t)task->subset.map.ep_num;
     cfg_radix = ucc_tl_ucp_get_radix_from_range(team, data_size, mem_type, p,
                                                 UCC_UUNITS_AUTO_RADIX);
     radix     = ucc_min(cfg_radix, size);
+    /* max radix is limited by the number of buffers in the executor */
+    radix     = ucc_min(radix, UCC_EE_EXECUTOR_NUM_BUFS);
+    task->allreduce_kn.radix     = radix;
+    task->allreduce_kn.preposted      = 0;
+    task->allreduce_kn.prepost_status = UCC_OK;
+    memset(task->allreduce_kn.prepost_reqs, 0,
+           sizeof(task->allreduce_kn.prepost_reqs));
     status    = ucc_mc_alloc(&task->allreduce_kn.scratch_mc_header,
                              (radix - 1) * data_size,
                              TASK_ARGS(task).dst.info.mem_type);
@@ -262,6 +435,9 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_finalize(ucc_coll_task_t *coll_task)
     ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
     ucc_status_t st, global_st;
 
+    if (task->allreduce_kn.preposted) {
+        ucc_tl_ucp_allreduce_knomial_prepost_cancel(task);
+    }
     global_st = ucc_mc_free(task->allreduce_kn.scratch_mc_header);
     if (ucc_unlikely(global_st != UCC_OK)) {
         tl_error(UCC_TASK_LIB(task), "failed to free scratch buffer");
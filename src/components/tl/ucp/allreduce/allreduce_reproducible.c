@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "allreduce.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+#include "utils/ucc_dt_reduce.h"
+#include "components/mc/ucc_mc.h"
+
+/* Allreduce whose result does not depend on the network pattern: every
+   element is reduced by a single rank as a left fold of the contributions
+   in team rank order 0..size-1, followed by the scale of AVG. The result is
+   bitwise identical for any message size and radix settings of the team.
+
+   Reduce-scatter: rank r receives block r of every peer into scratch slot
+   of that peer and reduces the slots in order with a single strided
+   reduction. Allgather: the reduced blocks are exchanged directly.
+   Small messages on small teams skip the allgather, every rank reduces the
+   whole vector. Blocks may be empty if the vector is shorter than the team,
+   ranks with an empty block only forward their data. */
+
+enum {
+    UCC_ALLREDUCE_REP_PHASE_INIT,
+    UCC_ALLREDUCE_REP_PHASE_SCATTER,
+    UCC_ALLREDUCE_REP_PHASE_REDUCE,
+    UCC_ALLREDUCE_REP_PHASE_ALLGATHER
+};
+
+#define SAVE_STATE(_phase)                                                     \
+    do {                                                                       \
+        task->allreduce_rep.phase = _phase;                                    \
+    } while (0)
+
+static inline void
+ucc_tl_ucp_allreduce_reproducible_block(ucc_tl_ucp_task_t *task,
+                                        ucc_rank_t block, size_t *offset,
+                                        size_t *count)
+{
+    size_t     total = TASK_ARGS(task).dst.info.count;
+    ucc_rank_t size  = UCC_TL_TEAM_SIZE(TASK_TEAM(task));
+
+    if (task->allreduce_rep.whole) {
+        *offset = 0;
+        *count  = total;
+    } else {
+        *offset = ucc_buffer_block_offset(total, size, block);
+        *count  = ucc_buffer_block_count(total, size, block);
+    }
+}
+
+static void
+ucc_tl_ucp_allreduce_reproducible_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task     = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team     = TASK_TEAM(task);
+    ucc_coll_args_t   *args     = &TASK_ARGS(task);
+    ucc_rank_t         rank     = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         size     = UCC_TL_TEAM_SIZE(team);
+    void              *sbuf     = args->src.info.buffer;
+    void              *rbuf     = args->dst.info.buffer;
+    ucc_memory_type_t  mem_type = args->dst.info.mem_type;
+    ucc_datatype_t     dt       = args->dst.info.datatype;
+    size_t             dt_size  = ucc_dt_size(dt);
+    void              *scratch  = task->allreduce_rep.scratch;
+    size_t             stride   = task->allreduce_rep.max_block_size;
+    size_t             my_offset, my_count, offset, count;
+    ucc_rank_t         i, peer;
+    uint16_t           flags;
+    ucc_status_t       status;
+
+    if (UCC_IS_INPLACE(*args)) {
+        sbuf = rbuf;
+    }
+    ucc_tl_ucp_allreduce_reproducible_block(task, rank, &my_offset,
+                                            &my_count);
+    switch (task->allreduce_rep.phase) {
+    case UCC_ALLREDUCE_REP_PHASE_SCATTER:
+        goto UCC_ALLREDUCE_REP_PHASE_SCATTER;
+    case UCC_ALLREDUCE_REP_PHASE_REDUCE:
+        goto UCC_ALLREDUCE_REP_PHASE_REDUCE;
+    case UCC_ALLREDUCE_REP_PHASE_ALLGATHER:
+        goto UCC_ALLREDUCE_REP_PHASE_ALLGATHER;
+    default:
+        break;
+    }
+
+    for (i = 1; i < size; i++) {
+        peer = (rank + i) % size;
+        ucc_tl_ucp_allreduce_reproducible_block(task, peer, &offset, &count);
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(PTR_OFFSET(sbuf, offset * dt_size),
+                                         count * dt_size, mem_type, peer,
+                                         team, task),
+                      task, out);
+        peer = (rank - i + size) % size;
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(PTR_OFFSET(scratch, peer * stride),
+                                         my_count * dt_size, mem_type, peer,
+                                         team, task),
+                      task, out);
+    }
+    /* own contribution takes its place in the rank order */
+    status = ucc_mc_memcpy(PTR_OFFSET(scratch, rank * stride),
+                           PTR_OFFSET(sbuf, my_offset * dt_size),
+                           my_count * dt_size, mem_type, mem_type);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TASK_LIB(task), "failed to copy local block");
+        task->super.status = status;
+        return;
+    }
+
+UCC_ALLREDUCE_REP_PHASE_SCATTER:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        SAVE_STATE(UCC_ALLREDUCE_REP_PHASE_SCATTER);
+        return;
+    }
+    if (size == 1) {
+        status = ucc_mc_memcpy(PTR_OFFSET(rbuf, my_offset * dt_size), scratch,
+                               my_count * dt_size, mem_type, mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.status = status;
+            return;
+        }
+        goto completion;
+    }
+    flags = args->op == UCC_OP_AVG ? UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA : 0;
+    if (task->allreduce_rep.whole) {
+        flags |= ucc_tl_ucp_reduce_nt_flag(task, my_count * dt_size);
+    }
+    if (my_count > 0) {
+        status = ucc_dt_reduce_strided(scratch, PTR_OFFSET(scratch, stride),
+                                       PTR_OFFSET(rbuf, my_offset * dt_size),
+                                       size - 1, my_count, stride, dt, args,
+                                       flags, AVG_ALPHA(task),
+                                       task->allreduce_rep.executor,
+                                       &task->allreduce_rep.etask);
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TASK_LIB(task), "failed to perform dt reduction");
+            task->super.status = status;
+            return;
+        }
+    }
+UCC_ALLREDUCE_REP_PHASE_REDUCE:
+    EXEC_TASK_TEST(UCC_ALLREDUCE_REP_PHASE_REDUCE,
+                   "failed to perform dt reduction",
+                   task->allreduce_rep.etask);
+    if (task->allreduce_rep.whole) {
+        goto completion;
+    }
+
+    for (i = 1; i < size; i++) {
+        peer = (rank + i) % size;
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(PTR_OFFSET(rbuf, my_offset * dt_size),
+                                         my_count * dt_size, mem_type, peer,
+                                         team, task),
+                      task, out);
+        peer = (rank - i + size) % size;
+        ucc_tl_ucp_allreduce_reproducible_block(task, peer, &offset, &count);
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(PTR_OFFSET(rbuf, offset * dt_size),
+                                         count * dt_size, mem_type, peer,
+                                         team, task),
+                      task, out);
+    }
+
+UCC_ALLREDUCE_REP_PHASE_ALLGATHER:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        SAVE_STATE(UCC_ALLREDUCE_REP_PHASE_ALLGATHER);
+        return;
+    }
+
+completion:
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allreduce_rep_done", 0);
+out:
+    return;
+}
+
+static ucc_status_t
+ucc_tl_ucp_allreduce_reproducible_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allreduce_rep_start", 0);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    task->allreduce_rep.phase = UCC_ALLREDUCE_REP_PHASE_INIT;
+    task->allreduce_rep.etask = NULL;
+    status = ucc_coll_task_get_executor(&task->super,
+                                        &task->allreduce_rep.executor);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+}
+
+static ucc_status_t
+ucc_tl_ucp_allreduce_reproducible_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_status_t       st, global_st;
+
+    global_st = ucc_mc_free(task->allreduce_rep.scratch_mc_header);
+    if (ucc_unlikely(global_st != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed to free scratch buffer");
+    }
+    st = ucc_tl_ucp_coll_finalize(&task->super);
+    if (ucc_unlikely(st != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed finalize collective");
+        global_st = st;
+    }
+    return global_st;
+}
+
+ucc_status_t
+ucc_tl_ucp_allreduce_reproducible_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *team,
+                                       ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team   = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_rank_t         size      = UCC_TL_TEAM_SIZE(tl_team);
+    size_t             count     = coll_args->args.dst.info.count;
+    ucc_datatype_t     dt        = coll_args->args.dst.info.datatype;
+    size_t             dt_size   = ucc_dt_size(dt);
+    size_t             data_size = count * dt_size;
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    ALLREDUCE_TASK_CHECK(coll_args->args, tl_team);
+    if (ucc_coll_args_is_noncontig_dt(&coll_args->args, UCC_RANK_INVALID)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task = ucc_tl_ucp_init_task_sized(coll_args, team,
+                                      UCC_TL_UCP_TASK_SIZE(allreduce_rep));
+    task->allreduce_rep.whole =
+        data_size <= UCC_TL_UCP_ALLREDUCE_REPRODUCIBLE_WHOLE_MAX &&
+        size * data_size <= UCC_TL_UCP_ALLREDUCE_REPRODUCIBLE_WHOLE_SCRATCH_MAX;
+    task->allreduce_rep.max_block_size =
+        task->allreduce_rep.whole ? data_size
+                                  : ucc_buffer_block_count(count, size, 0) *
+                                        dt_size;
+    status = ucc_mc_alloc(&task->allreduce_rep.scratch_mc_header,
+                          ucc_max(size * task->allreduce_rep.max_block_size, 1),
+                          coll_args->args.dst.info.mem_type);
+    if (ucc_unlikely(status != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed to allocate scratch buffer");
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
+    task->allreduce_rep.scratch = task->allreduce_rep.scratch_mc_header->addr;
+    task->super.flags    |= UCC_COLL_TASK_FLAG_EXECUTOR;
+    task->super.post     = ucc_tl_ucp_allreduce_reproducible_start;
+    task->super.progress = ucc_tl_ucp_allreduce_reproducible_progress;
+    task->super.finalize = ucc_tl_ucp_allreduce_reproducible_finalize;
+    *task_h              = &task->super;
+out:
+    return status;
+}
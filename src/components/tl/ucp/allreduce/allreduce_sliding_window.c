@@ -34,6 +34,7 @@ static inline void ucc_tl_ucp_allreduce_sliding_window_reset_pipeline(
     pipe->count_reduced  = pipe->count_serviced = 0;
     pipe->my_count       = pipe->my_offset      = 0;
     pipe->count_received = 0;
+    pipe->n_red          = pipe->self_copied    = 0;
 
     ucc_tl_ucp_allreduce_sliding_window_reset_buf(&pipe->accbuf);
     for (i = 0; i < pipe->num_buffers; i++) {
@@ -196,25 +197,55 @@ ucc_tl_ucp_allreduce_sliding_window_rdma_task_finalize(
     return st;
 }
 
+/* Reduces all the getbufs that arrived since the last reduction into accbuf
+   in one pass, so accbuf is read and written once per batch rather than once
+   per peer. The last batch applies the AVG scaling and also writes the result
+   to the own dst, which then needs no put. */
 static inline void ucc_tl_ucp_allreduce_sliding_window_reduction(
-    ucc_coll_task_t *coll_task, ucc_tl_ucp_allreduce_sw_buf_t *accbuf,
-    ucc_tl_ucp_allreduce_sw_buf_t *getbuf)
+    ucc_coll_task_t *coll_task, ucc_tl_ucp_allreduce_sw_pipeline_t *pipe,
+    ucc_rank_t host_team_size)
 {
-    ucc_status_t       status = UCC_OK;
-    ucc_tl_ucp_task_t *task   = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
-    ucc_coll_args_t   *args   = &TASK_ARGS(task);
-    ucc_datatype_t     dt     = TASK_ARGS(task).dst.info.datatype;
-    ucc_ee_executor_t *exec;
+    ucc_status_t                   status  = UCC_OK;
+    ucc_tl_ucp_task_t             *task    = ucc_derived_of(coll_task,
+                                                            ucc_tl_ucp_task_t);
+    ucc_coll_args_t               *args    = &TASK_ARGS(task);
+    ucc_datatype_t                 dt      = TASK_ARGS(task).dst.info.datatype;
+    ucc_tl_ucp_allreduce_sw_buf_t *accbuf  = &pipe->accbuf;
+    ucc_rank_t                     my_rank = UCC_TL_TEAM_RANK(TASK_TEAM(task));
+    void                          *dst2    = NULL;
+    uint16_t                       flags   = 0;
+    void                          *srcs[UCC_EE_EXECUTOR_NUM_BUFS];
+    ucc_ee_executor_t             *exec;
+    int                            i;
 
     status = ucc_coll_task_get_executor(&task->super, &exec);
     if (ucc_unlikely(status != UCC_OK)) {
         tl_error(UCC_TASK_LIB(task), "failed to get executor");
+        task->super.status = status;
+        return;
+    }
+
+    srcs[0] = accbuf->buf;
+    for (i = 0; i < pipe->n_red; i++) {
+        srcs[i + 1] =
+            pipe->getbuf[(pipe->red_idx + i) % pipe->num_buffers].buf;
+    }
+    if (pipe->done_red + pipe->n_red == host_team_size - 1) {
+        if (args->op == UCC_OP_AVG) {
+            flags |= UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA;
+        }
+        if (ucc_dt_reduce_copy_supported(exec)) {
+            dst2 = PTR_OFFSET(
+                task->allreduce_sliding_window.bufs->rbufs[my_rank],
+                pipe->count_serviced * ucc_dt_size(dt) + pipe->my_offset);
+            pipe->self_copied = 1;
+        }
     }
 
-    status =
-        ucc_dt_reduce(accbuf->buf, getbuf->buf, accbuf->buf, accbuf->count, dt,
-                      args, 0, 0, exec,
-                      &task->allreduce_sliding_window.reduce_task);
+    status = ucc_dt_reduce_multi_copy(
+        srcs, accbuf->buf, pipe->n_red + 1, &dst2, dst2 ? 1 : 0,
+        accbuf->count, dt, args, flags, 1.0 / (double)host_team_size, exec,
+        &task->allreduce_sliding_window.reduce_task);
 
     if (ucc_unlikely(UCC_OK != status)) {
         tl_error(UCC_TASK_LIB(task), "failed to perform dt reduction");
@@ -288,16 +319,56 @@ err:
     goto out;
 }
 
+/* Moves the consecutive getbufs whose data arrived into REDUCING state,
+   returns their number */
+static inline int ucc_tl_ucp_allreduce_sliding_window_ready_bufs(
+    ucc_tl_ucp_task_t *task, ucc_tl_ucp_allreduce_sw_pipeline_t *pipe,
+    ucc_rank_t host_team_size)
+{
+    int                            max_red = ucc_min(
+        ucc_min(UCC_EE_EXECUTOR_NUM_BUFS - 1, pipe->num_buffers),
+        host_team_size - 1 - pipe->done_red);
+    ucc_tl_ucp_allreduce_sw_buf_t *redbuf;
+    ucc_status_t                   status;
+    int                            n;
+
+    for (n = 0; n < max_red; n++) {
+        redbuf = &pipe->getbuf[(pipe->red_idx + n) % pipe->num_buffers];
+        if (redbuf->state != RECVING) {
+            break;
+        }
+        status = ucc_tl_ucp_allreduce_sliding_window_req_test(redbuf->ucp_req,
+                                                              task);
+        if (status != UCC_OK) {
+            if (status < 0) {
+                tl_error(UCC_TASK_LIB(task), "redbuf request failed: %s",
+                         ucc_status_string(status));
+            }
+            break;
+        }
+        if (redbuf->ucp_req) {
+            ucp_request_free(redbuf->ucp_req);
+        }
+        redbuf->state   = REDUCING;
+        redbuf->ucp_req = NULL;
+    }
+    return n;
+}
+
 static inline void ucc_tl_ucp_allreduce_sliding_window_mark_redbuf_free(
     ucc_tl_ucp_allreduce_sw_pipeline_t *pipe,
-    ucc_tl_ucp_allreduce_sw_buf_t      *accbuf,
-    ucc_tl_ucp_allreduce_sw_buf_t      *redbuf,
     ucc_rank_t                          host_team_size)
 {
-    redbuf->state = FREE;
-    pipe->avail_buffs++;
-    pipe->red_idx++;
-    pipe->done_red++;
+    ucc_tl_ucp_allreduce_sw_buf_t *accbuf = &pipe->accbuf;
+    int                            i;
+
+    for (i = 0; i < pipe->n_red; i++) {
+        pipe->getbuf[(pipe->red_idx + i) % pipe->num_buffers].state = FREE;
+    }
+    pipe->avail_buffs += pipe->n_red;
+    pipe->red_idx     += pipe->n_red;
+    pipe->done_red    += pipe->n_red;
+    pipe->n_red        = 0;
 
     if (pipe->done_red == host_team_size - 1) {
         accbuf->state = REDUCED;
@@ -332,7 +403,6 @@ void ucc_tl_ucp_allreduce_sliding_window_rdma_progress(ucc_coll_task_t *coll_tas
     ucc_rank_t                          put_window_size =
         UCC_TL_UCP_TEAM_LIB(tl_team)->
             cfg.allreduce_sliding_window_put_window_size;
-    ucc_tl_ucp_allreduce_sw_buf_t      *redbuf;
     ucc_tl_ucp_allreduce_sw_buf_t      *getbuf;
     size_t                              remaining_elems;
     ucc_rank_t                          get_idx;
@@ -344,7 +414,6 @@ void ucc_tl_ucp_allreduce_sliding_window_rdma_progress(ucc_coll_task_t *coll_tas
     void                               *src_addr;
     void                               *dst_addr;
     ucs_status_ptr_t                    request;
-    size_t                              red_idx;
     size_t                              put_offset;
     int                                 window;
     int                                 put_idx;
@@ -367,11 +436,8 @@ void ucc_tl_ucp_allreduce_sliding_window_rdma_progress(ucc_coll_task_t *coll_tas
             return;
         }
 
-        red_idx = pipe->red_idx % pipe->num_buffers;
-        redbuf  = &pipe->getbuf[red_idx];
-
-        ucc_tl_ucp_allreduce_sliding_window_mark_redbuf_free(
-            pipe, accbuf, redbuf, host_team_size);
+        ucc_tl_ucp_allreduce_sliding_window_mark_redbuf_free(pipe,
+                                                             host_team_size);
     }
 
     if (pipe->count_serviced < pipe->my_count) {
@@ -429,19 +495,15 @@ void ucc_tl_ucp_allreduce_sliding_window_rdma_progress(ucc_coll_task_t *coll_tas
             }
         }
 
-        red_idx = pipe->red_idx % pipe->num_buffers;
-        redbuf  = &pipe->getbuf[red_idx];
-        if (accbuf->state == REDUCING && redbuf->state == RECVING) {
-            request = redbuf->ucp_req;
-            status = ucc_tl_ucp_allreduce_sliding_window_req_test(request, task);
-            if (status == UCC_OK) {
-                if (request)
-                    ucp_request_free(request);
-                redbuf->state   = REDUCING;
-                redbuf->ucp_req = NULL;
-
-                ucc_tl_ucp_allreduce_sliding_window_reduction(coll_task, accbuf,
-                                                              redbuf);
+        if (accbuf->state == REDUCING) {
+            pipe->n_red = ucc_tl_ucp_allreduce_sliding_window_ready_bufs(
+                task, pipe, host_team_size);
+            if (pipe->n_red > 0) {
+                ucc_tl_ucp_allreduce_sliding_window_reduction(
+                    coll_task, pipe, host_team_size);
+                if (task->super.status < 0) {
+                    return;
+                }
 
                 ucc_tl_ucp_allreduce_sliding_window_test_reduction(task);
 
@@ -450,11 +512,7 @@ void ucc_tl_ucp_allreduce_sliding_window_rdma_progress(ucc_coll_task_t *coll_tas
                 }
 
                 ucc_tl_ucp_allreduce_sliding_window_mark_redbuf_free(
-                    pipe, accbuf, redbuf, host_team_size);
-
-            } else if (status < 0) {
-                tl_error(UCC_TL_TEAM_LIB(tl_team), "redbuf request failed: %s",
-                    ucc_status_string(status));
+                    pipe, host_team_size);
             }
         }
 
@@ -488,6 +546,15 @@ void ucc_tl_ucp_allreduce_sliding_window_rdma_progress(ucc_coll_task_t *coll_tas
                     break;
                 }
 
+                if (dst_rank == UCC_TL_TEAM_RANK(tl_team) &&
+                    pipe->self_copied) {
+                    // own dst was written by the last reduction, the slot is
+                    // left empty and counts as a completed put
+                    pipe->posted_put++;
+                    pipe->dst_rank = (dst_rank + 1) % host_team_size;
+                    continue;
+                }
+
                 ucp_worker_fence(tl_ctx->worker.ucp_worker);
                 ucc_tl_ucp_get_ep(tl_team, dst_rank, &ep);
                 task->allreduce_sliding_window.put_requests[put_idx] = 
@@ -527,6 +594,7 @@ void ucc_tl_ucp_allreduce_sliding_window_rdma_progress(ucc_coll_task_t *coll_tas
                 ucc_tl_ucp_allreduce_sliding_window_reset_buf(accbuf);
                 pipe->done_get = 0;
                 pipe->done_red = pipe->done_put = pipe->posted_put = 0;
+                pipe->self_copied = 0;
             }
         }
 
@@ -582,6 +650,20 @@ ucc_tl_ucp_allreduce_sliding_window_init(ucc_base_coll_args_t *coll_args,
         return UCC_ERR_NOT_SUPPORTED;
     }
 
+    /* partial sums are accumulated in the element type across pipeline
+       steps, AVG of types that need pre-op would wrap */
+    if (coll_args->args.op == UCC_OP_AVG &&
+        ucc_dt_is_integer(coll_args->args.dst.info.datatype) &&
+        ucc_tl_ucp_avg_pre_op(tl_team, coll_args->args.dst.info.datatype)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    status = ucc_tl_ucp_avg_check(tl_team, &coll_args->args,
+                                  coll_args->args.dst.info.datatype,
+                                  coll_args->args.dst.info.mem_type);
+    if (status != UCC_OK) {
+        return status;
+    }
+
     status = ucc_tl_ucp_get_schedule(tl_team, coll_args,
                                     (ucc_tl_ucp_schedule_t **)&schedule);
     if (ucc_unlikely(UCC_OK != status)) {
@@ -47,6 +47,8 @@ typedef struct ucc_tl_ucp_allreduce_sw_pipeline {
     int                            done_red;
     int                            done_put;
     int                            posted_put;
+    int                            n_red;       /* getbufs in the reduction */
+    int                            self_copied; /* no put to own rank */
 } ucc_tl_ucp_allreduce_sw_pipeline_t;
 
 void
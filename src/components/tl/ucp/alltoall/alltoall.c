@@ -64,7 +64,8 @@ ucc_status_t ucc_tl_ucp_alltoall_pairwise_init(ucc_base_coll_args_t *coll_args,
     ucc_status_t       status;
 
     ALLTOALL_TASK_CHECK(coll_args->args, tl_team);
-    task                 = ucc_tl_ucp_init_task(coll_args, team);
+    task                 = ucc_tl_ucp_init_task_sized(
+        coll_args, team, UCC_TL_UCP_TASK_SIZE_NO_STATE);
     *task_h              = &task->super;
     status = ucc_tl_ucp_alltoall_pairwise_init_common(task);
 out:
@@ -109,7 +110,8 @@ ucc_status_t ucc_tl_ucp_alltoall_onesided_init(ucc_base_coll_args_t *coll_args,
         }
     }
 
-    task                 = ucc_tl_ucp_init_task(coll_args, team);
+    task                 = ucc_tl_ucp_init_task_sized(
+        coll_args, team, UCC_TL_UCP_TASK_SIZE_NO_STATE);
     *task_h              = &task->super;
     task->super.post     = ucc_tl_ucp_alltoall_onesided_start;
     task->super.progress = ucc_tl_ucp_alltoall_onesided_progress;
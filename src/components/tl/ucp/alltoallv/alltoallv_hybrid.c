@@ -991,7 +991,8 @@ ucc_status_t ucc_tl_ucp_alltoallv_hybrid_init(ucc_base_coll_args_t *coll_args,
     if (UCC_COLL_ARGS_DISPL64(&coll_args->args) ||
         UCC_COLL_ARGS_COUNT64(&coll_args->args) ||
         coll_args->args.src.info_v.mem_type != UCC_MEMORY_TYPE_HOST ||
-        coll_args->args.dst.info_v.mem_type != UCC_MEMORY_TYPE_HOST) {
+        coll_args->args.dst.info_v.mem_type != UCC_MEMORY_TYPE_HOST ||
+        ucc_coll_args_is_noncontig_dt(&coll_args->args, UCC_RANK_INVALID)) {
         return UCC_ERR_NOT_SUPPORTED;
     }
 
@@ -24,14 +24,21 @@ ucc_base_coll_alg_info_t
              .name = "dbt",
              .desc = "bcast over double binary tree where a leaf in one tree "
                      "will be intermediate in other (optimized for BW)"},
+        [UCC_TL_UCP_BCAST_ALG_ONESIDED_KNOMIAL] =
+            {.id   = UCC_TL_UCP_BCAST_ALG_ONESIDED_KNOMIAL,
+             .name = "onesided_knomial",
+             .desc = "one-sided bcast over knomial tree, puts to children "
+                     "(requires memory mapped buffers)"},
         [UCC_TL_UCP_BCAST_ALG_LAST] = {
             .id = 0, .name = NULL, .desc = NULL}};
 
 ucc_status_t ucc_tl_ucp_bcast_init(ucc_tl_ucp_task_t *task)
 {
-    ucc_tl_ucp_team_t *team      = TASK_TEAM(task);
-    ucc_rank_t         team_size = (ucc_rank_t)task->subset.map.ep_num;
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_rank_t         team_size;
 
+    ucc_tl_ucp_task_reorder(task);
+    team_size            = (ucc_rank_t)task->subset.map.ep_num;
     task->bcast_kn.radix =
         ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.bcast_kn_radix, team_size);
 
@@ -47,7 +54,11 @@ ucc_status_t ucc_tl_ucp_bcast_knomial_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_status_t       status;
 
-    task    = ucc_tl_ucp_init_task(coll_args, team);
+    if (ucc_coll_args_is_noncontig_dt(&coll_args->args, UCC_RANK_INVALID)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task    = ucc_tl_ucp_init_task_sized(coll_args, team,
+                                         UCC_TL_UCP_TASK_SIZE(bcast_kn));
     status  = ucc_tl_ucp_bcast_init(task);
     *task_h = &task->super;
     return status;
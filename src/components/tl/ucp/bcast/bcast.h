@@ -12,6 +12,7 @@ enum {
     UCC_TL_UCP_BCAST_ALG_KNOMIAL,
     UCC_TL_UCP_BCAST_ALG_SAG_KNOMIAL,
     UCC_TL_UCP_BCAST_ALG_DBT,
+    UCC_TL_UCP_BCAST_ALG_ONESIDED_KNOMIAL,
     UCC_TL_UCP_BCAST_ALG_LAST
 };
 
@@ -52,4 +53,8 @@ ucc_status_t ucc_tl_ucp_bcast_dbt_init(
     ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
     ucc_coll_task_t **task_h);
 
+ucc_status_t ucc_tl_ucp_bcast_onesided_knomial_init(
+    ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
+    ucc_coll_task_t **task_h);
+
 #endif
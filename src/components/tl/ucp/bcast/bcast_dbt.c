@@ -254,6 +254,9 @@ ucc_status_t ucc_tl_ucp_bcast_dbt_init(
     ucc_tl_ucp_task_t *task;
     ucc_rank_t         rank, size;
 
+    if (ucc_coll_args_is_noncontig_dt(&coll_args->args, UCC_RANK_INVALID)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
     task                 = ucc_tl_ucp_init_task(coll_args, team);
     task->super.post     = ucc_tl_ucp_bcast_dbt_start;
     task->super.progress = ucc_tl_ucp_bcast_dbt_progress;
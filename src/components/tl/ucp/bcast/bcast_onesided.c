@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "bcast.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+
+/* Knomial tree bcast where every rank puts the data directly to the buffers
+   of its children and increments their pSync. A non-root rank forwards the
+   data once its own pSync is incremented by the parent. */
+
+static inline ucc_mem_map_mem_h *
+ucc_tl_ucp_bcast_onesided_memh(ucc_tl_ucp_task_t *task,
+                               ucc_mem_map_mem_h *local_memh)
+{
+    ucc_coll_args_t   *args  = &TASK_ARGS(task);
+    ucc_mem_map_mem_h *memh  = args->src_memh.global_memh;
+    ucc_rank_t         grank = UCC_TL_TEAM_RANK(TASK_TEAM(task));
+
+    *local_memh = memh ? memh[grank] : args->src_memh.local_memh;
+    return memh;
+}
+
+static void ucc_tl_ucp_bcast_onesided_forward(ucc_tl_ucp_task_t *task,
+                                              ucc_rank_t         vrank)
+{
+    ucc_tl_ucp_team_t *team   = TASK_TEAM(task);
+    ucc_coll_args_t   *args   = &TASK_ARGS(task);
+    ucc_rank_t         size   = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root   = (ucc_rank_t)args->root;
+    uint32_t           radix  = task->bcast_onesided.radix;
+    void              *buffer = args->src.info.buffer;
+    size_t             nbytes = args->src.info.count *
+                                ucc_dt_size(args->src.info.datatype);
+    ucc_mem_map_mem_h  local_memh;
+    ucc_mem_map_mem_h *memh;
+    ucc_rank_t         dist, vpeer, peer;
+    uint32_t           i;
+
+    memh = ucc_tl_ucp_bcast_onesided_memh(task, &local_memh);
+    CALC_KN_TREE_DIST(size, radix, dist);
+    for (; dist >= 1; dist /= radix) {
+        if (vrank % dist != 0 || (vrank / dist) % radix != 0) {
+            continue;
+        }
+        for (i = radix - 1; i >= 1; i--) {
+            vpeer = vrank + i * dist;
+            if (vpeer < size) {
+                peer = INV_VRANK(vpeer, root, size);
+                UCPCHECK_GOTO(ucc_tl_ucp_put_nb(buffer, buffer, nbytes, peer,
+                                                local_memh, memh, team, task),
+                              task, out);
+            }
+        }
+    }
+    /* data must land before the children observe the counter */
+    ucp_worker_fence(team->worker->ucp_worker);
+    CALC_KN_TREE_DIST(size, radix, dist);
+    for (; dist >= 1; dist /= radix) {
+        if (vrank % dist != 0 || (vrank / dist) % radix != 0) {
+            continue;
+        }
+        for (i = radix - 1; i >= 1; i--) {
+            vpeer = vrank + i * dist;
+            if (vpeer < size) {
+                peer = INV_VRANK(vpeer, root, size);
+                UCPCHECK_GOTO(ucc_tl_ucp_atomic_inc(args->global_work_buffer,
+                                                    peer, memh, team),
+                              task, out);
+            }
+        }
+    }
+    task->bcast_onesided.forwarded = 1;
+out:
+    return;
+}
+
+void ucc_tl_ucp_bcast_onesided_knomial_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task  = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team  = TASK_TEAM(task);
+    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         vrank = VRANK(UCC_TL_TEAM_RANK(team),
+                                     (ucc_rank_t)TASK_ARGS(task).root, size);
+    volatile long     *pSync = TASK_ARGS(task).global_work_buffer;
+    int                polls = 0;
+
+    if (!task->bcast_onesided.forwarded) {
+        while (vrank != 0 && *pSync < 1) {
+            if (polls++ >= task->n_polls) {
+                return;
+            }
+            ucp_worker_progress(team->worker->ucp_worker);
+        }
+        ucc_tl_ucp_bcast_onesided_forward(task, vrank);
+        if (!task->bcast_onesided.forwarded) {
+            /* error is set to the task status */
+            return;
+        }
+    }
+    if (ucc_tl_ucp_test_onesided(task, vrank == 0 ? 0 : 1) ==
+        UCC_INPROGRESS) {
+        return;
+    }
+    *pSync             = 0;
+    task->super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_bcast_onesided_done", 0);
+}
+
+ucc_status_t ucc_tl_ucp_bcast_onesided_knomial_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_bcast_onesided_start", 0);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    task->bcast_onesided.forwarded = 0;
+
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+}
+
+ucc_status_t
+ucc_tl_ucp_bcast_onesided_knomial_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *team,
+                                       ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_coll_args_t   *args    = &coll_args->args;
+    ucc_rank_t         size    = UCC_TL_TEAM_SIZE(tl_team);
+    ucc_tl_ucp_task_t *task;
+
+    if (ucc_coll_args_is_noncontig_dt(args, UCC_RANK_INVALID)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (!(args->mask & UCC_COLL_ARGS_FIELD_GLOBAL_WORK_BUFFER)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "global work buffer not provided nor associated with team");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if ((args->mask & UCC_COLL_ARGS_FIELD_FLAGS) &&
+        !(args->flags & UCC_COLL_ARGS_FLAG_MEM_MAPPED_BUFFERS)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "non memory mapped buffers are not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (!(args->mask & UCC_COLL_ARGS_FIELD_MEM_MAP_SRC_MEMH)) {
+        args->src_memh.global_memh = NULL;
+    } else if (!(args->flags & UCC_COLL_ARGS_FLAG_SRC_MEMH_GLOBAL)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "onesided bcast requires global memory handles for src "
+                 "buffers");
+        return UCC_ERR_INVALID_PARAM;
+    }
+
+    task                       = ucc_tl_ucp_init_task_sized(
+        coll_args, team, UCC_TL_UCP_TASK_SIZE(bcast_onesided));
+    task->bcast_onesided.radix =
+        ucc_max(2, ucc_min(UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.bcast_kn_radix,
+                           size));
+    task->super.post     = ucc_tl_ucp_bcast_onesided_knomial_start;
+    task->super.progress = ucc_tl_ucp_bcast_onesided_knomial_progress;
+    *task_h              = &task->super;
+    return UCC_OK;
+}
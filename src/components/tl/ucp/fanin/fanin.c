@@ -32,8 +32,10 @@ ucc_status_t ucc_tl_ucp_fanin_init(ucc_tl_ucp_task_t *task)
     TASK_ARGS(task).dst.info.mem_type = UCC_MEMORY_TYPE_UNKNOWN;
     TASK_ARGS(task).dst.info.datatype = UCC_DT_INT8;
 
+    ucc_tl_ucp_task_reorder(task);
     task->super.post      = ucc_tl_ucp_reduce_knomial_start;
     task->super.progress  = ucc_tl_ucp_reduce_knomial_progress;
+    task->reduce_kn.root  = ucc_tl_ucp_task_subset_root(task);
     task->reduce_kn.radix =
         ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.fanin_kn_radix, team_size);
 
@@ -26,6 +26,7 @@ ucc_status_t ucc_tl_ucp_fanout_init(ucc_tl_ucp_task_t *task)
     TASK_ARGS(task).src.info.count    = 0;
     TASK_ARGS(task).src.info.mem_type = UCC_MEMORY_TYPE_UNKNOWN;
     TASK_ARGS(task).src.info.datatype = UCC_DT_INT8;
+    ucc_tl_ucp_task_reorder(task);
     task->bcast_kn.radix =
         ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.fanout_kn_radix, team_size);
 
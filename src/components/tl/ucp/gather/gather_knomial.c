@@ -323,6 +323,10 @@ ucc_status_t ucc_tl_ucp_gather_knomial_init(ucc_base_coll_args_t *coll_args,
     ucc_status_t status;
     ucc_kn_radix_t radix;
 
+    if (ucc_coll_args_is_noncontig_dt(&coll_args->args,
+                                      UCC_TL_TEAM_RANK(tl_team))) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
     task = ucc_tl_ucp_init_task(coll_args, team);
     if (ucc_unlikely(!task)) {
         return UCC_ERR_NO_MEMORY;
@@ -30,17 +30,21 @@ ucc_status_t ucc_tl_ucp_reduce_init(ucc_tl_ucp_task_t *task)
 {
     ucc_coll_args_t   *args      = &TASK_ARGS(task);
     ucc_tl_ucp_team_t *team      = TASK_TEAM(task);
-    ucc_rank_t         myrank    = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         team_size = UCC_TL_TEAM_SIZE(team);
-    ucc_rank_t         root      = args->root;
-    ucc_rank_t         vrank     = (myrank - root + team_size) % team_size;
     ucc_status_t       status    = UCC_OK;
+    ucc_rank_t         myrank, team_size, root, vrank;
     ucc_memory_type_t  mtype;
     ucc_datatype_t     dt;
     size_t             count, data_size;
     int                isleaf;
     int                self_avg;
 
+    ucc_tl_ucp_task_reorder(task);
+    myrank               = task->subset.myrank;
+    team_size            = (ucc_rank_t)task->subset.map.ep_num;
+    root                 = ucc_tl_ucp_task_subset_root(task);
+    vrank                = (myrank - root + team_size) % team_size;
+    task->reduce_kn.root = root;
+
     if (root == myrank) {
         count = args->dst.info.count;
         dt    = args->dst.info.datatype;
@@ -50,6 +54,10 @@ ucc_status_t ucc_tl_ucp_reduce_init(ucc_tl_ucp_task_t *task)
         dt    = args->src.info.datatype;
         mtype = args->src.info.mem_type;
     }
+    status = ucc_tl_ucp_avg_check(team, args, dt, mtype);
+    if (status != UCC_OK) {
+        return status;
+    }
     data_size = count * ucc_dt_size(dt);
     task->super.flags    |= UCC_COLL_TASK_FLAG_EXECUTOR;
     task->super.post      = ucc_tl_ucp_reduce_knomial_start;
@@ -61,7 +69,7 @@ ucc_status_t ucc_tl_ucp_reduce_init(ucc_tl_ucp_task_t *task)
                       task->reduce_kn.max_dist);
     isleaf   = (vrank % task->reduce_kn.radix != 0 || vrank == team_size - 1);
     self_avg = (vrank % task->reduce_kn.radix == 0 && args->op == UCC_OP_AVG &&
-                UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_avg_pre_op);
+                ucc_tl_ucp_avg_pre_op(team, dt));
     task->reduce_kn.scratch_mc_header = NULL;
 
     if (!isleaf || self_avg) {
@@ -84,8 +92,13 @@ ucc_status_t ucc_tl_ucp_reduce_knomial_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_status_t       status;
 
-    task    = ucc_tl_ucp_init_task(coll_args, team);
+    task    = ucc_tl_ucp_init_task_sized(coll_args, team,
+                                         UCC_TL_UCP_TASK_SIZE(reduce_kn));
     status  = ucc_tl_ucp_reduce_init(task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
     *task_h = &task->super;
     return status;
 }
@@ -126,9 +126,9 @@ void ucc_tl_ucp_reduce_dbt_progress(ucc_coll_task_t *coll_task)
     data_size    = count * ucc_dt_size(dt);
     data_size_t1 = counts[0] * ucc_dt_size(dt);
     avg_pre_op   = ((args->op == UCC_OP_AVG) &&
-                    UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_avg_pre_op);
+                    ucc_tl_ucp_avg_pre_op(team, dt));
     avg_post_op  = ((args->op == UCC_OP_AVG) &&
-                    !UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_avg_pre_op);
+                    !ucc_tl_ucp_avg_pre_op(team, dt));
 
     rbuf[0] = task->reduce_dbt.scratch;
     rbuf[1] = PTR_OFFSET(rbuf[0], data_size_t1 * 2);;
@@ -250,8 +250,6 @@ ucc_status_t ucc_tl_ucp_reduce_dbt_start(ucc_coll_task_t *coll_task)
     ucc_coll_args_t   *args       = &TASK_ARGS(task);
     ucc_rank_t         rank       = UCC_TL_TEAM_RANK(team);
     ucc_rank_t         team_size  = UCC_TL_TEAM_SIZE(team);
-    int                avg_pre_op =
-        UCC_TL_UCP_TEAM_LIB(TASK_TEAM(task))->cfg.reduce_avg_pre_op;
     ucc_datatype_t     dt;
     size_t             count, data_size;
     ucc_status_t       status;
@@ -284,7 +282,7 @@ ucc_status_t ucc_tl_ucp_reduce_dbt_start(ucc_coll_task_t *coll_task)
         args->src.info.buffer = args->dst.info.buffer;
     }
 
-    if (avg_pre_op && args->op == UCC_OP_AVG) {
+    if (ucc_tl_ucp_avg_pre_op(team, dt) && args->op == UCC_OP_AVG) {
         /* In case of avg_pre_op, each process must divide itself by team_size */
         status =
             ucc_dt_reduce(args->src.info.buffer, args->src.info.buffer,
@@ -349,6 +347,11 @@ ucc_status_t ucc_tl_ucp_reduce_dbt_init(ucc_base_coll_args_t *coll_args,
         dt    = coll_args->args.src.info.datatype;
         mtype = coll_args->args.src.info.mem_type;
     }
+    status = ucc_tl_ucp_avg_check(tl_team, &coll_args->args, dt, mtype);
+    if (status != UCC_OK) {
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
     data_size                          = count * ucc_dt_size(dt);
     task->reduce_dbt.scratch_mc_header = NULL;
     status = ucc_mc_alloc(&task->reduce_dbt.scratch_mc_header, 3 * data_size,
@@ -22,11 +22,9 @@ void ucc_tl_ucp_reduce_knomial_progress(ucc_coll_task_t *coll_task)
                                                    ucc_tl_ucp_task_t);
     ucc_coll_args_t   *args       = &TASK_ARGS(task);
     ucc_tl_ucp_team_t *team       = TASK_TEAM(task);
-    int                avg_pre_op =
-        UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_avg_pre_op;
-    ucc_rank_t         rank       = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         size       = UCC_TL_TEAM_SIZE(team);
-    ucc_rank_t         root       = (ucc_rank_t)args->root;
+    ucc_rank_t         rank       = task->subset.myrank;
+    ucc_rank_t         size       = (ucc_rank_t)task->subset.map.ep_num;
+    ucc_rank_t         root       = task->reduce_kn.root;
     uint32_t           radix      = task->reduce_kn.radix;
     ucc_rank_t         vrank      = (rank - root + size) % size;
     void              *rbuf       = (rank == root) ? args->dst.info.buffer :
@@ -38,7 +36,7 @@ void ucc_tl_ucp_reduce_knomial_progress(ucc_coll_task_t *coll_task)
     ucc_rank_t         vpeer, peer, vroot_at_level, root_at_level, pos;
     uint32_t           i;
     ucc_status_t       status;
-    int                is_avg;
+    int                is_avg, avg_pre_op;
 
     if (root == rank) {
         count = args->dst.info.count;
@@ -51,6 +49,7 @@ void ucc_tl_ucp_reduce_knomial_progress(ucc_coll_task_t *coll_task)
         mtype = args->src.info.mem_type;
         dt = args->src.info.datatype;
     }
+    avg_pre_op = ucc_tl_ucp_avg_pre_op(team, dt);
     received_vectors = PTR_OFFSET(task->reduce_kn.scratch, data_size);
 
 UCC_REDUCE_KN_PHASE_PROGRESS:
@@ -74,7 +73,8 @@ UCC_REDUCE_KN_PHASE_INIT:
                     	break;
                     } else {
                         task->reduce_kn.children_per_cycle += 1;
-                        peer = (vpeer + root) % size;
+                        peer = ucc_ep_map_eval(task->subset.map,
+                                               (vpeer + root) % size);
                         UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(scratch_offset,
                                           data_size, mtype, peer, team, task),
                                           task, out);
@@ -108,7 +108,9 @@ UCC_REDUCE_KN_PHASE_MULTI:
                 }
             } else {
                 vroot_at_level = vrank - pos * task->reduce_kn.dist;
-                root_at_level  = (vroot_at_level + root) % size;
+                root_at_level  = ucc_ep_map_eval(task->subset.map,
+                                                 (vroot_at_level + root) %
+                                                 size);
                 UCPCHECK_GOTO(ucc_tl_ucp_send_nb(task->reduce_kn.scratch,
                                   data_size, mtype, root_at_level, team, task),
                                   task, out);
@@ -133,16 +135,13 @@ ucc_status_t ucc_tl_ucp_reduce_knomial_start(ucc_coll_task_t *coll_task)
     ucc_coll_args_t   *args       = &TASK_ARGS(task);
     ucc_tl_ucp_team_t *team       = TASK_TEAM(task);
     uint32_t           radix      = task->reduce_kn.radix;
-    ucc_rank_t         root       = (ucc_rank_t)args->root;
-    ucc_rank_t         rank       = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         size       = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root       = task->reduce_kn.root;
+    ucc_rank_t         rank       = task->subset.myrank;
+    ucc_rank_t         size       = (ucc_rank_t)task->subset.map.ep_num;
     ucc_rank_t         vrank      = (rank - root + size) % size;
     int                isleaf     =
         (vrank % radix != 0 || vrank == size - 1);
-    int                avg_pre_op =
-        UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_avg_pre_op;
-    int                self_avg   = (args->op == UCC_OP_AVG &&
-        avg_pre_op && vrank % radix == 0);
+    int                self_avg;
     size_t             count;
     ucc_datatype_t     dt;
     ucc_status_t       status;
@@ -154,6 +153,8 @@ ucc_status_t ucc_tl_ucp_reduce_knomial_start(ucc_coll_task_t *coll_task)
         count = args->src.info.count;
         dt    = args->src.info.datatype;
     }
+    self_avg = args->op == UCC_OP_AVG && ucc_tl_ucp_avg_pre_op(team, dt) &&
+               vrank % radix == 0;
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_kn_start", 0);
     ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
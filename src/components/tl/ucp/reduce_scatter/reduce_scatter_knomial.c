@@ -331,7 +331,7 @@ UCC_KN_PHASE_LOOP:
             get_rs_work_buf(task, block_count, &wb);
             local_data  = PTR_OFFSET(wb.src_loop, local_seg_offset * dt_size);
             is_avg      = (args->op == UCC_OP_AVG) &&
-                          (UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_avg_pre_op ?
+                          (ucc_tl_ucp_avg_pre_op(team, dt) ?
                                    ucc_knomial_pattern_loop_first_iteration(p) :
                                    ucc_knomial_pattern_loop_last_iteration(p));
             status = ucc_dt_reduce_strided(local_data, wb.dst_loop, wb.reduce_loop,
@@ -498,6 +498,11 @@ ucc_tl_ucp_reduce_scatter_knomial_init_r(ucc_base_coll_args_t *coll_args,
                       coll_args->args.dst.info.mem_type))) {
         return UCC_ERR_NOT_SUPPORTED;
     }
+    status = ucc_tl_ucp_avg_check(tl_team, &coll_args->args,
+                                  coll_args->args.dst.info.datatype, mem_type);
+    if (status != UCC_OK) {
+        return status;
+    }
 
     task                 = ucc_tl_ucp_init_task(coll_args, team);
     task->super.flags    |= UCC_COLL_TASK_FLAG_EXECUTOR;
@@ -102,6 +102,7 @@ static void ucc_tl_ucp_reduce_scatter_ring_progress(ucc_coll_task_t *coll_task)
     ucc_status_t            status;
     size_t max_block_size, block_offset, frag_count, frag_offset, final_offset;
     int    step, is_avg, id;
+    uint16_t flags;
     void  *r_scratch, *s_scratch[2], *reduce_target;
     volatile char *busy;
 
@@ -147,18 +148,24 @@ static void ucc_tl_ucp_reduce_scatter_ring_progress(ucc_coll_task_t *coll_task)
         ucc_ring_frag_count(task, count, prevblock, &frag_count);
         ucc_ring_frag_block_offset(task, count, prevblock, &block_offset,
                                    &frag_offset);
+        flags = 0;
         if (task->tagged.recv_completed == size - 1) {
             reduce_target = PTR_OFFSET(args->dst.info.buffer,
                                        (frag_offset + final_offset) * dt_size);
+            /* result block is not read again, only by the user */
+            flags = ucc_tl_ucp_reduce_nt_flag(task,
+                                              args->dst.info.count * dt_size);
         }
         is_avg = (args->op == UCC_OP_AVG) &&
                  (task->tagged.recv_completed == (size - 1));
+        if (is_avg) {
+            flags |= UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA;
+        }
         if (UCC_OK !=
             (status = ucc_dt_reduce(
                  r_scratch,
                  PTR_OFFSET(sbuf, (block_offset + frag_offset) * dt_size),
-                 reduce_target, frag_count, dt, args,
-                 is_avg ? UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA : 0,
+                 reduce_target, frag_count, dt, args, flags,
                  AVG_ALPHA(task), task->reduce_scatter_ring.executor,
                  &task->reduce_scatter_ring.etask))) {
             tl_error(UCC_TASK_LIB(task), "failed to perform dt reduction");
@@ -356,10 +363,14 @@ ucc_tl_ucp_reduce_scatter_ring_init(ucc_base_coll_args_t *coll_args,
     ucc_subset_t           s[2];
     int                    i, n_subsets;
 
-    if (UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.reduce_avg_pre_op &&
+    if (ucc_tl_ucp_avg_pre_op(tl_team, dt) &&
         coll_args->args.op == UCC_OP_AVG) {
         return UCC_ERR_NOT_SUPPORTED;
     }
+    status = ucc_tl_ucp_avg_check(tl_team, &coll_args->args, dt, mem_type);
+    if (status != UCC_OK) {
+        return status;
+    }
 
     if (!UCC_IS_INPLACE(coll_args->args)) {
         count *= size;
@@ -366,10 +366,14 @@ ucc_tl_ucp_reduce_scatterv_ring_init(ucc_base_coll_args_t *coll_args,
     ucc_subset_t           s[2];
     int                    i, n_subsets;
 
-    if (UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.reduce_avg_pre_op &&
+    if (ucc_tl_ucp_avg_pre_op(tl_team, dt) &&
         coll_args->args.op == UCC_OP_AVG) {
         return UCC_ERR_NOT_SUPPORTED;
     }
+    status = ucc_tl_ucp_avg_check(tl_team, &coll_args->args, dt, mem_type);
+    if (status != UCC_OK) {
+        return status;
+    }
 
     if (UCC_IS_INPLACE(coll_args->args)) {
         count = ucc_coll_args_get_total_count(
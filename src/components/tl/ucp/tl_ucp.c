@@ -119,6 +119,27 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_kn_radix),
      UCC_CONFIG_TYPE_UINT_RANGED},
 
+    {"ALLREDUCE_KN_PREPOST", "n",
+     "Pre-post the first step receives of the next iteration of a persistent\n"
+     "recursive-knomial allreduce when the current one completes. Receives\n"
+     "stay posted between iterations, so the collective tag of the task must\n"
+     "not be reused by other collectives of the team while it is alive.\n"
+     "Only the knomial allreduce implements it, other persistent collectives\n"
+     "and allreduce algorithms ignore the option. Ignored on THREAD_MULTIPLE\n"
+     "contexts. Off by default: the latency gain has not been measured yet",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_kn_prepost),
+     UCC_CONFIG_TYPE_BOOL},
+
+    {"ALLREDUCE_REPRODUCIBLE", "n",
+     "Select the reproducible allreduce algorithm for all message sizes,\n"
+     "overriding UCC_TL_UCP_TUNE. Its result is bitwise identical regardless\n"
+     "of message size and radix settings for a given team size, at the cost\n"
+     "of bandwidth and latency. Only applies to allreduce executed by tl/ucp:\n"
+     "allreduce selected on other TLs (e.g. nccl, sharp) or on CL hier is\n"
+     "not affected, use UCC_CLS=basic UCC_CL_BASIC_TLS=ucp to force tl/ucp",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_reproducible),
+     UCC_CONFIG_TYPE_BOOL},
+
     {"ALLREDUCE_SLIDING_WIN_BUF_SIZE", "65536",
      "Buffer size of the sliding window allreduce algorithm",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_sliding_window_buf_size),
@@ -203,13 +224,23 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, scatterv_linear_num_posts),
      UCC_CONFIG_TYPE_UINT},
 
-    {"REDUCE_AVG_PRE_OP", "1",
+    {"REDUCE_AVG_PRE_OP", "0",
      "Reduce will perform division by team_size in early stages of the "
      "algorithm,\n"
-     "else - in result",
+     "else - in result, fused into the final reduction step. Integer AVG\n"
+     "is divided in result, except for types narrower than int which are\n"
+     "always divided early so that partial sums do not wrap. 16 and 8 bit\n"
+     "floats are always divided early so that partial sums do not overflow",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_avg_pre_op),
      UCC_CONFIG_TYPE_BOOL},
 
+    {"REDUCE_NT_THRESH", "auto",
+     "Results of reductions at least this large that are not read back by\n"
+     "the algorithm are written with non-temporal stores bypassing the\n"
+     "cache. auto - size of the last level cache, inf - disable",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_nt_thresh),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
     {"REDUCE_SCATTER_RING_BIDIRECTIONAL", "y",
      "Launch 2 inverted rings concurrently during ReduceScatter Ring algorithm",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_scatter_ring_bidirectional),
@@ -221,6 +252,12 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_scatterv_ring_bidirectional),
      UCC_CONFIG_TYPE_BOOL},
 
+    {"GENERIC_DT_PIPELINE", "auto",
+     "Pipelining settings for collectives on non-contiguous generic "
+     "datatypes: fragsize bounds the scratch used by one pipeline stage",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, generic_dt_pipeline),
+     UCC_CONFIG_TYPE_PIPELINE_PARAMS},
+
     {"USE_TOPO", "try",
      "Allow usage of tl ucp topo",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, use_topo),
@@ -298,6 +335,36 @@ static ucs_config_field_t ucc_tl_ucp_context_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_context_config_t, exported_memory_handle),
      UCC_CONFIG_TYPE_BOOL},
 
+    {"REG_CACHE", "n",
+     "Register host src/dst buffers of large collectives once and keep the "
+     "registrations in a bounded LRU cache, so that the memory handle is "
+     "reused by the subsequent collectives on the same buffers. Cached "
+     "regions are invalidated when the memory is unmapped",
+     ucc_offsetof(ucc_tl_ucp_context_config_t, reg_cache),
+     UCC_CONFIG_TYPE_BOOL},
+
+    {"REG_CACHE_THRESH", "64k",
+     "Minimal size of a collective buffer registered through the cache",
+     ucc_offsetof(ucc_tl_ucp_context_config_t, reg_cache_thresh),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"REG_CACHE_MAX_REGIONS", "1024",
+     "Maximal number of regions in the registration cache, least recently "
+     "used unused regions are evicted above the limit",
+     ucc_offsetof(ucc_tl_ucp_context_config_t, reg_cache_max_regions),
+     UCC_CONFIG_TYPE_ULUNITS},
+
+    {"REG_CACHE_MAX_SIZE", "inf",
+     "Maximal total size of the regions in the registration cache",
+     ucc_offsetof(ucc_tl_ucp_context_config_t, reg_cache_max_size),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"SEND_STATS", "n",
+     "Count p2p sends and the sends to ranks on other hosts (requires topo "
+     "info). The counters are printed at context destroy with info log level",
+     ucc_offsetof(ucc_tl_ucp_context_config_t, send_stats),
+     UCC_CONFIG_TYPE_BOOL},
+
     {NULL}};
 
 UCC_CLASS_DEFINE_NEW_FUNC(ucc_tl_ucp_lib_t, ucc_base_lib_t,
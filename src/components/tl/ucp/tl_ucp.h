@@ -10,6 +10,7 @@
 #include "components/tl/ucc_tl_log.h"
 #include "core/ucc_ee.h"
 #include "utils/ucc_mpool.h"
+#include "utils/ucc_rcache.h"
 #include "tl_ucp_ep_hash.h"
 #include "schedule/ucc_schedule_pipelined.h"
 #include <ucp/api/ucp.h>
@@ -52,6 +53,8 @@ typedef struct ucc_tl_ucp_lib_config {
     uint32_t                 allreduce_sliding_window_put_window_size;
     uint32_t                 allreduce_sliding_window_num_get_bufs;
     ucc_mrange_uint_t        allreduce_kn_radix;
+    int                      allreduce_kn_prepost;
+    int                      allreduce_reproducible;
     ucc_mrange_uint_t        allreduce_sra_kn_radix;
     uint32_t                 reduce_scatter_kn_radix;
     ucc_mrange_uint_t        allgather_kn_radix;
@@ -70,6 +73,7 @@ typedef struct ucc_tl_ucp_lib_config {
     unsigned long            allgather_batched_num_posts;
     ucc_pipeline_params_t    allreduce_sra_kn_pipeline;
     int                      reduce_avg_pre_op;
+    size_t                   reduce_nt_thresh;
     int                      reduce_scatter_ring_bidirectional;
     int                      reduce_scatterv_ring_bidirectional;
     uint32_t                 alltoallv_hybrid_radix;
@@ -78,6 +82,7 @@ typedef struct ucc_tl_ucp_lib_config {
     uint32_t                 alltoallv_hybrid_num_scratch_sends;
     uint32_t                 alltoallv_hybrid_num_scratch_recvs;
     uint32_t                 alltoallv_hybrid_pairwise_num_posts;
+    ucc_pipeline_params_t    generic_dt_pipeline;
     ucc_ternary_auto_value_t use_topo;
     int                      use_reordering;
 } ucc_tl_ucp_lib_config_t;
@@ -101,6 +106,11 @@ typedef struct ucc_tl_ucp_context_config {
     ucc_tl_ucp_local_copy_type_t local_copy_type;
     int                          memtype_copy_enable;
     uint32_t                     exported_memory_handle;
+    int                          reg_cache;
+    size_t                       reg_cache_thresh;
+    unsigned long                reg_cache_max_regions;
+    size_t                       reg_cache_max_size;
+    int                          send_stats;
 } ucc_tl_ucp_context_config_t;
 
 typedef ucc_tl_ucp_lib_config_t ucc_tl_ucp_team_config_t;
@@ -128,6 +138,12 @@ typedef struct ucc_tl_ucp_memh_data {
     ucp_rkey_h               rkey;
 } ucc_tl_ucp_memh_data_t;
 
+/* Registration of a user buffer kept in the context registration cache */
+typedef struct ucc_tl_ucp_rcache_region {
+    ucc_rcache_region_t super;
+    ucp_mem_h           memh;
+} ucc_tl_ucp_rcache_region_t;
+
 typedef struct ucc_tl_ucp_worker {
     ucp_context_h     ucp_context;
     ucp_worker_h      ucp_worker;
@@ -207,6 +223,8 @@ typedef struct ucc_tl_ucp_context {
     } sendrecv_cbs;
     uint32_t                    service_worker_throttling_count;
     ucc_mpool_t                 req_mp;
+    /* tasks of algorithms with small state, see UCC_TL_UCP_TASK_SMALL_SIZE */
+    ucc_mpool_t                 req_mp_small;
     ucc_tl_ucp_remote_info_t *  remote_info;
     ucp_rkey_h *                rkeys;
     uint64_t                    n_rinfo_segs;
@@ -217,6 +235,15 @@ typedef struct ucc_tl_ucp_context {
         ucc_tl_ucp_copy_test_fn_t     test;
         ucc_tl_ucp_copy_finalize_fn_t finalize;
     } copy;
+    ucc_rcache_t               *rcache; /*< NULL if REG_CACHE is disabled */
+    struct {
+        uint64_t hits;
+        uint64_t misses;
+    } rcache_stats;
+    struct {
+        uint64_t sends;
+        uint64_t net_sends; /*< sends to ranks on other hosts */
+    } send_stats;
 } ucc_tl_ucp_context_t;
 UCC_CLASS_DECLARE(ucc_tl_ucp_context_t, const ucc_base_context_params_t *,
                     const ucc_base_config_t *);
@@ -293,6 +320,18 @@ extern ucs_memory_type_t ucc_memtype_to_ucs[UCC_MEMORY_TYPE_LAST+1];
 void ucc_tl_ucp_pre_register_mem(ucc_tl_ucp_team_t *team, void *addr,
                                  size_t length, ucc_memory_type_t mem_type);
 
+ucc_status_t ucc_tl_ucp_rcache_create(ucc_tl_ucp_context_t *ctx);
+
+void ucc_tl_ucp_rcache_destroy(ucc_tl_ucp_context_t *ctx);
+
+/* Returns the held registration covering [addr, addr + length) or NULL if
+   the buffer could not be registered */
+ucc_tl_ucp_rcache_region_t *
+ucc_tl_ucp_rcache_get(ucc_tl_ucp_context_t *ctx, void *addr, size_t length);
+
+void ucc_tl_ucp_rcache_put(ucc_tl_ucp_context_t       *ctx,
+                           ucc_tl_ucp_rcache_region_t *region);
+
 ucc_status_t ucc_tl_ucp_ctx_remote_populate(ucc_tl_ucp_context_t *ctx,
                                             ucc_mem_map_params_t  map,
                                             ucc_team_oob_coll_t   oob);
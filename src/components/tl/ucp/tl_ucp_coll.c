@@ -106,6 +106,9 @@ void ucc_tl_ucp_send_completion_cb_st(void *request, ucs_status_t status,
                  ucs_status_string(status));
         task->super.status = ucs_status_to_ucc_status(status);
     }
+    UCC_TIMELINE_EVENT(UCC_TIMELINE_P2P_COMPLETE, "send",
+                       UCC_TASK_LIB(task)->log_component.name, request,
+                       status, 0, 0);
     ++task->tagged.send_completed;
     ucp_request_free(request);
 }
@@ -119,6 +122,9 @@ void ucc_tl_ucp_send_completion_cb_mt(void *request, ucs_status_t status,
                  ucs_status_string(status));
         task->super.status = ucs_status_to_ucc_status(status);
     }
+    UCC_TIMELINE_EVENT(UCC_TIMELINE_P2P_COMPLETE, "send",
+                       UCC_TASK_LIB(task)->log_component.name, request,
+                       status, 0, 0);
     ucc_atomic_add32(&task->tagged.send_completed, 1);
     ucp_request_free(request);
 }
@@ -159,6 +165,9 @@ void ucc_tl_ucp_recv_completion_cb_mt(void *request, ucs_status_t status,
                  ucs_status_string(status));
         task->super.status = ucs_status_to_ucc_status(status);
     }
+    UCC_TIMELINE_EVENT(UCC_TIMELINE_P2P_COMPLETE, "recv",
+                       UCC_TASK_LIB(task)->log_component.name, request,
+                       status, 0, 0);
     ucc_atomic_add32(&task->tagged.recv_completed, 1);
     ucp_request_free(request);
 }
@@ -173,6 +182,9 @@ void ucc_tl_ucp_recv_completion_cb_st(void *request, ucs_status_t status,
                  ucs_status_string(status));
         task->super.status = ucs_status_to_ucc_status(status);
     }
+    UCC_TIMELINE_EVENT(UCC_TIMELINE_P2P_COMPLETE, "recv",
+                       UCC_TASK_LIB(task)->log_component.name, request,
+                       status, 0, 0);
     ++task->tagged.recv_completed;
     ucp_request_free(request);
 }
@@ -186,13 +198,35 @@ ucc_status_t ucc_tl_ucp_coll_finalize(ucc_coll_task_t *coll_task)
     return UCC_OK;
 }
 
+static inline size_t ucc_tl_ucp_coll_task_size(ucc_coll_type_t coll_type)
+{
+    switch (coll_type) {
+    case UCC_COLL_TYPE_BARRIER:
+        return UCC_TL_UCP_TASK_SIZE(barrier);
+    case UCC_COLL_TYPE_FANIN:
+        return UCC_TL_UCP_TASK_SIZE(reduce_kn);
+    case UCC_COLL_TYPE_FANOUT:
+        return UCC_TL_UCP_TASK_SIZE(bcast_kn);
+    default:
+        return sizeof(ucc_tl_ucp_task_t);
+    }
+}
+
 ucc_status_t ucc_tl_ucp_coll_init(ucc_base_coll_args_t *coll_args,
                                   ucc_base_team_t *team,
                                   ucc_coll_task_t **task_h)
 {
-    ucc_tl_ucp_task_t    *task = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_tl_ucp_team_t    *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t    *task;
     ucc_status_t          status;
 
+    if (ucc_unlikely(ucc_coll_args_is_noncontig_dt(&coll_args->args,
+                                                   UCC_TL_TEAM_RANK(tl_team)))) {
+        return ucc_tl_ucp_generic_dt_init(coll_args, team, task_h);
+    }
+    task = ucc_tl_ucp_init_task_sized(
+        coll_args, team, ucc_tl_ucp_coll_task_size(coll_args->args.coll_type));
+
     switch (coll_args->args.coll_type) {
     case UCC_COLL_TYPE_BARRIER:
         status = ucc_tl_ucp_barrier_init(task);
@@ -307,6 +341,12 @@ ucc_status_t ucc_tl_ucp_alg_id_to_init(int alg_id, const char *alg_id_str,
         case UCC_TL_UCP_ALLGATHER_ALG_LINEAR_BATCHED:
             *init = ucc_tl_ucp_allgather_linear_batched_init;
             break;
+        case UCC_TL_UCP_ALLGATHER_ALG_ONESIDED_LINEAR:
+            *init = ucc_tl_ucp_allgather_onesided_linear_init;
+            break;
+        case UCC_TL_UCP_ALLGATHER_ALG_ONESIDED_RING:
+            *init = ucc_tl_ucp_allgather_onesided_ring_init;
+            break;
         default:
             status = UCC_ERR_INVALID_PARAM;
             break;
@@ -339,6 +379,9 @@ ucc_status_t ucc_tl_ucp_alg_id_to_init(int alg_id, const char *alg_id_str,
         case UCC_TL_UCP_ALLREDUCE_ALG_SLIDING_WINDOW:
             *init = ucc_tl_ucp_allreduce_sliding_window_init;
             break;
+        case UCC_TL_UCP_ALLREDUCE_ALG_REPRODUCIBLE:
+            *init = ucc_tl_ucp_allreduce_reproducible_init;
+            break;
         default:
             status = UCC_ERR_INVALID_PARAM;
             break;
@@ -355,6 +398,9 @@ ucc_status_t ucc_tl_ucp_alg_id_to_init(int alg_id, const char *alg_id_str,
         case UCC_TL_UCP_BCAST_ALG_DBT:
             *init = ucc_tl_ucp_bcast_dbt_init;
             break;
+        case UCC_TL_UCP_BCAST_ALG_ONESIDED_KNOMIAL:
+            *init = ucc_tl_ucp_bcast_onesided_knomial_init;
+            break;
         default:
            status = UCC_ERR_INVALID_PARAM;
            break;
@@ -15,6 +15,7 @@
 #include "components/mc/base/ucc_mc_base.h"
 #include "components/ec/ucc_ec.h"
 #include "tl_ucp_tag.h"
+#include "utils/ucc_sys.h"
 
 #define UCC_UUNITS_AUTO_RADIX 4
 #define UCC_TL_UCP_TASK_PLUGIN_MAX_DATA 128
@@ -87,6 +88,8 @@ typedef struct ucc_tl_ucp_default_alg_desc {
 enum ucc_tl_ucp_task_flags {
     /*indicates whether subset field of tl_ucp_task is set*/
     UCC_TL_UCP_TASK_FLAG_SUBSET = UCC_BIT(0),
+    /*indicates that subset of tl_ucp_task is topology ordered team*/
+    UCC_TL_UCP_TASK_FLAG_REORDERED = UCC_BIT(1),
 };
 
 typedef struct ucc_tl_ucp_allreduce_sw_pipeline
@@ -116,6 +119,8 @@ typedef struct ucc_tl_ucp_task {
     };
     uint32_t        n_polls;
     ucc_subset_t    subset;
+    /* cached registrations of src and dst, see REG_CACHE */
+    ucc_tl_ucp_rcache_region_t *rcache_regs[2];
     union {
         struct {
             int                     phase;
@@ -129,6 +134,14 @@ typedef struct ucc_tl_ucp_task {
             ucc_mc_buffer_header_t *scratch_mc_header;
             ucc_ee_executor_task_t *etask;
             ucc_ee_executor_t      *executor;
+            ucc_kn_radix_t          radix;
+            /* receives of the next iteration posted at completion of a
+               persistent task, see ALLREDUCE_KN_PREPOST */
+            int                     preposted;
+            /* failure of a pre-posted receive completed while the task was
+               not in progress, reported by the next post */
+            ucc_status_t            prepost_status;
+            void                   *prepost_reqs[UCC_EE_EXECUTOR_NUM_BUFS - 1];
         } allreduce_kn;
         struct {
             ucc_tl_ucp_allreduce_sw_pipeline          *pipe;
@@ -138,6 +151,15 @@ typedef struct ucc_tl_ucp_task {
             ucc_ee_executor_task_t                    *reduce_task;
             ucc_tl_ucp_dpu_offload_buf_info_t         *bufs;
         } allreduce_sliding_window;
+        struct {
+            int                     phase;
+            int                     whole;
+            size_t                  max_block_size;
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+            ucc_ee_executor_task_t *etask;
+            ucc_ee_executor_t      *executor;
+        } allreduce_rep;
         struct {
             int                     phase;
             ucc_knomial_pattern_t   p;
@@ -211,10 +233,18 @@ typedef struct ucc_tl_ucp_task {
             uint32_t                i;
             int                     data_expected;
         } allgather_sparbit;
+        struct {
+            ucc_rank_t              step;
+        } allgather_onesided;
         struct {
             ucc_rank_t              dist;
             uint32_t                radix;
+            ucc_rank_t              root;
         } bcast_kn;
+        struct {
+            uint32_t                radix;
+            int                     forwarded;
+        } bcast_onesided;
         struct {
             ucc_dbt_single_tree_t   t1;
             ucc_dbt_single_tree_t   t2;
@@ -225,6 +255,7 @@ typedef struct ucc_tl_ucp_task {
             ucc_rank_t              max_dist;
             int                     children_per_cycle;
             uint32_t                radix;
+            ucc_rank_t              root;
             int                     phase;
             void                   *scratch;
             ucc_mc_buffer_header_t *scratch_mc_header;
@@ -273,16 +304,54 @@ typedef struct ucc_tl_ucp_task {
             ucc_rank_t              iteration;
             int                     phase;
         } alltoall_bruck;
+        struct {
+            struct ucc_tl_ucp_schedule *schedule;
+            void                       *scratch;
+            int                         frag;
+            int                         unpack;
+            ucc_rank_t                  block;
+        } generic_dt;
         char                        plugin_data[UCC_TL_UCP_TASK_PLUGIN_MAX_DATA];
     };
 } ucc_tl_ucp_task_t;
 
+/* Size of a task whose algorithm keeps its state in the union member
+   _member, the task is not used beyond that size. Tasks up to
+   UCC_TL_UCP_TASK_SMALL_SIZE come from the small pool of the context. */
+#define UCC_TL_UCP_TASK_SIZE(_member)                                          \
+    (ucc_offsetof(ucc_tl_ucp_task_t, _member) +                                \
+     sizeof(((ucc_tl_ucp_task_t *)NULL)->_member))
+
+/* algorithm with no state beyond the p2p counters */
+#define UCC_TL_UCP_TASK_SIZE_NO_STATE ucc_offsetof(ucc_tl_ucp_task_t, barrier)
+
+#define UCC_TL_UCP_TASK_SMALL_STATE 128
+
+#define UCC_TL_UCP_TASK_SMALL_SIZE                                             \
+    (UCC_TL_UCP_TASK_SIZE_NO_STATE + UCC_TL_UCP_TASK_SMALL_STATE)
+
 typedef struct ucc_tl_ucp_schedule {
     ucc_schedule_pipelined_t super;
     ucc_mc_buffer_header_t  *scratch_mc_header;
     union {
         ptrdiff_t frag_offset;
     } reduce_srg_kn;
+    struct {
+        ucc_dt_generic_t *dt;
+        void             *pack_state;
+        void             *unpack_state;
+        size_t            elem_size;     /* packed size of one element */
+        size_t            block_count;   /* elements per block, non-v only */
+        size_t            frag_count;    /* elements of a block per frag */
+        size_t            pack_offset;   /* element offset of the 1st block */
+        size_t            unpack_region; /* offset of the recv scratch */
+        size_t            slot_size;     /* scratch of one pipeline stage */
+        ucc_rank_t        n_pack_blocks;
+        ucc_rank_t        n_unpack_blocks;
+        ucc_rank_t        skip_block;    /* own block of inplace collective */
+        int               n_slots;
+        uint64_t         *v_bytes;       /* byte counts/displs of v colls */
+    } generic_dt;
 } ucc_tl_ucp_schedule_t;
 
 #define TASK_TEAM(_task)                                                       \
@@ -295,6 +364,68 @@ typedef struct ucc_tl_ucp_schedule {
 
 #define AVG_ALPHA(_task) (1.0 / (double)UCC_TL_TEAM_SIZE(TASK_TEAM(_task)))
 
+/* AVG inputs are scaled before the reduction if REDUCE_AVG_PRE_OP is set,
+   otherwise the scaling is fused into the final reduction step. Integer AVG
+   is post-op, the executor divides the sum exactly, except for types
+   narrower than int: partial sums are stored in the element type between
+   steps and would wrap, so those are always pre-op. For the same reason
+   16 and 8 bit floats are always pre-op: partial sums saturate or
+   overflow to Inf. */
+static inline int ucc_tl_ucp_avg_pre_op(ucc_tl_ucp_team_t *team,
+                                        ucc_datatype_t     dt)
+{
+    switch (dt) {
+    case UCC_DT_FLOAT16:
+    case UCC_DT_BFLOAT16:
+    case UCC_DT_FLOAT8_E4M3:
+    case UCC_DT_FLOAT8_E5M2:
+        return 1;
+    default:
+        break;
+    }
+    if (ucc_dt_is_integer(dt)) {
+        return ucc_dt_size(dt) < sizeof(int);
+    }
+    return UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_avg_pre_op;
+}
+
+/* Integer AVG is exact on the host executor only, the CUDA one scales by
+   alpha converted to the element type */
+static inline ucc_status_t ucc_tl_ucp_avg_check(ucc_tl_ucp_team_t *team,
+                                                ucc_coll_args_t   *args,
+                                                ucc_datatype_t     dt,
+                                                ucc_memory_type_t  mem_type)
+{
+    if (args->op == UCC_OP_AVG && ucc_dt_is_integer(dt) &&
+        mem_type != UCC_MEMORY_TYPE_HOST) {
+        tl_debug(UCC_TL_TEAM_LIB(team), "integer avg on %s memory is not "
+                 "supported", ucc_memory_type_names[mem_type]);
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    return UCC_OK;
+}
+
+/* Executor flag for a reduction producing "size" bytes of result that the
+   algorithm does not read back, eg the final block written to dst */
+static inline uint16_t ucc_tl_ucp_reduce_nt_flag(ucc_tl_ucp_task_t *task,
+                                                 size_t             size)
+{
+    size_t thresh = TASK_TEAM(task)->cfg.reduce_nt_thresh;
+
+    if (thresh == UCS_MEMUNITS_AUTO) {
+        thresh = ucc_get_llc_size();
+        if (thresh == 0) {
+            return 0;
+        }
+    }
+    return (size >= thresh) ? UCC_EEE_TASK_FLAG_NT_STORE : 0;
+}
+
+/* Looks up src/dst buffers of the collective in the registration cache */
+void ucc_tl_ucp_task_rcache_get(ucc_tl_ucp_task_t *task);
+
+void ucc_tl_ucp_task_rcache_put(ucc_tl_ucp_task_t *task);
+
 static inline void ucc_tl_ucp_task_reset(ucc_tl_ucp_task_t *task,
                                          ucc_status_t status)
 {
@@ -305,10 +436,17 @@ static inline void ucc_tl_ucp_task_reset(ucc_tl_ucp_task_t *task,
     task->super.status          = status;
 }
 
-static inline ucc_tl_ucp_task_t *ucc_tl_ucp_get_task(ucc_tl_ucp_team_t *team)
+static inline ucc_tl_ucp_task_t *
+ucc_tl_ucp_get_task_sized(ucc_tl_ucp_team_t *team, size_t size)
 {
     ucc_tl_ucp_context_t *ctx  = UCC_TL_UCP_TEAM_CTX(team);
-    ucc_tl_ucp_task_t    *task = ucc_mpool_get(&ctx->req_mp);;
+    ucc_tl_ucp_task_t    *task;
+
+    task = ucc_mpool_get(size <= UCC_TL_UCP_TASK_SMALL_SIZE ?
+                         &ctx->req_mp_small : &ctx->req_mp);
+    if (ucc_unlikely(!task)) {
+        return NULL;
+    }
 
     UCC_TL_UCP_PROFILE_REQUEST_NEW(task, "tl_ucp_task", 0);
     task->super.flags       = 0;
@@ -318,12 +456,22 @@ static inline ucc_tl_ucp_task_t *ucc_tl_ucp_get_task(ucc_tl_ucp_team_t *team)
     task->subset.map.type   = UCC_EP_MAP_FULL;
     task->subset.map.ep_num = UCC_TL_TEAM_SIZE(team);
     task->subset.myrank     = UCC_TL_TEAM_RANK(team);
+    task->rcache_regs[0]    = NULL;
+    task->rcache_regs[1]    = NULL;
     ucc_tl_ucp_task_reset(task, UCC_OPERATION_INITIALIZED);
     return task;
 }
 
+static inline ucc_tl_ucp_task_t *ucc_tl_ucp_get_task(ucc_tl_ucp_team_t *team)
+{
+    return ucc_tl_ucp_get_task_sized(team, sizeof(ucc_tl_ucp_task_t));
+}
+
 static inline void ucc_tl_ucp_put_task(ucc_tl_ucp_task_t *task)
 {
+    if (ucc_unlikely(task->rcache_regs[0] || task->rcache_regs[1])) {
+        ucc_tl_ucp_task_rcache_put(task);
+    }
     UCC_TL_UCP_PROFILE_REQUEST_FREE(task);
     ucc_mpool_put(task);
 }
@@ -357,11 +505,18 @@ ucc_status_t ucc_tl_ucp_coll_init(ucc_base_coll_args_t *coll_args,
 
 ucc_status_t ucc_tl_ucp_coll_finalize(ucc_coll_task_t *coll_task);
 
+/* Collectives on non-contiguous generic datatypes: the data is packed into
+   scratch, moved with the default algorithm on bytes and unpacked */
+ucc_status_t ucc_tl_ucp_generic_dt_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *team,
+                                        ucc_coll_task_t     **task_h);
+
 static inline ucc_tl_ucp_task_t *
-ucc_tl_ucp_init_task(ucc_base_coll_args_t *coll_args, ucc_base_team_t *team)
+ucc_tl_ucp_init_task_sized(ucc_base_coll_args_t *coll_args,
+                           ucc_base_team_t *team, size_t size)
 {
     ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
-    ucc_tl_ucp_task_t *task    = ucc_tl_ucp_get_task(tl_team);
+    ucc_tl_ucp_task_t *task    = ucc_tl_ucp_get_task_sized(tl_team, size);
 
     if (ucc_unlikely(!task)) {
         return NULL;
@@ -388,9 +543,53 @@ ucc_tl_ucp_init_task(ucc_base_coll_args_t *coll_args, ucc_base_team_t *team)
     }
 
     task->super.finalize       = ucc_tl_ucp_coll_finalize;
+    if (ucc_unlikely(UCC_TL_UCP_TEAM_CTX(tl_team)->rcache)) {
+        ucc_tl_ucp_task_rcache_get(task);
+    }
     return task;
 }
 
+static inline ucc_tl_ucp_task_t *
+ucc_tl_ucp_init_task(ucc_base_coll_args_t *coll_args, ucc_base_team_t *team)
+{
+    return ucc_tl_ucp_init_task_sized(coll_args, team,
+                                      sizeof(ucc_tl_ucp_task_t));
+}
+
+/* Switches the task to the topology ordered team (host, socket, numa), so
+   that ring neighbours and knomial subtrees stay node and socket local.
+   Only valid for algorithms that translate user visible ranks (root, block
+   index) through task->subset. */
+static inline void ucc_tl_ucp_task_reorder(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_sbgp_t        *sbgp;
+
+    if ((task->flags & UCC_TL_UCP_TASK_FLAG_SUBSET) ||
+        !team->cfg.use_reordering) {
+        return;
+    }
+    sbgp = ucc_topo_get_sbgp(team->topo, UCC_SBGP_FULL_HOST_ORDERED);
+    if (ucc_ep_map_is_identity(&sbgp->map)) {
+        return;
+    }
+    task->flags        |= UCC_TL_UCP_TASK_FLAG_REORDERED;
+    task->subset.myrank = sbgp->group_rank;
+    task->subset.map    = sbgp->map;
+}
+
+/* Returns root of the collective in the task subset numbering */
+static inline ucc_rank_t ucc_tl_ucp_task_subset_root(ucc_tl_ucp_task_t *task)
+{
+    ucc_rank_t root = (ucc_rank_t)TASK_ARGS(task).root;
+
+    if (UCC_COLL_ARGS_ACTIVE_SET(&TASK_ARGS(task)) ||
+        (task->flags & UCC_TL_UCP_TASK_FLAG_REORDERED)) {
+        return ucc_ep_map_local_rank(task->subset.map, root);
+    }
+    return root;
+}
+
 #define UCC_TL_UCP_TASK_P2P_COMPLETE(_task)                                    \
     (((_task)->tagged.send_posted == (_task)->tagged.send_completed) &&        \
      ((_task)->tagged.recv_posted == (_task)->tagged.recv_completed))
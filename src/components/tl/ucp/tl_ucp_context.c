@@ -14,6 +14,7 @@
 #include "schedule/ucc_schedule_pipelined.h"
 #include "tl_ucp_copy.h"
 #include <limits.h>
+#include <inttypes.h>
 
 #include "tl_ucp_sendrecv.h"
 
@@ -287,6 +288,17 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
         goto err_thread_mode;
     }
 
+    ucc_status = ucc_mpool_init(
+        &self->req_mp_small, 0, UCC_TL_UCP_TASK_SMALL_SIZE, 0,
+        UCC_CACHE_LINE_SIZE, 8, UINT_MAX, &ucc_coll_task_mpool_ops,
+        params->thread_mode, "tl_ucp_req_mp_small");
+    if (UCC_OK != ucc_status) {
+        tl_error(self->super.super.lib,
+                 "failed to initialize tl_ucp_req_small mpool");
+        ucc_mpool_cleanup(&self->req_mp, 1);
+        goto err_thread_mode;
+    }
+
     CHECK(UCC_OK != ucc_context_progress_register(
                         params->context,
                         (ucc_context_progress_fn_t)ucp_worker_progress,
@@ -351,6 +363,20 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
                  self->cfg.local_copy_type);
     };
 
+    self->rcache = NULL;
+    if (self->cfg.reg_cache) {
+        ucc_status = ucc_tl_ucp_rcache_create(self);
+        if (UCC_OK != ucc_status) {
+            /* collectives are still functional, ucp registers on its own */
+            tl_warn(self->super.super.lib,
+                    "failed to create registration cache: %s",
+                    ucc_status_string(ucc_status));
+            self->rcache = NULL;
+        }
+    }
+    self->send_stats.sends     = 0;
+    self->send_stats.net_sends = 0;
+
     tl_debug(self->super.super.lib, "initialized tl context: %p", self);
     return UCC_OK;
 
@@ -471,6 +497,15 @@ UCC_CLASS_CLEANUP_FUNC(ucc_tl_ucp_context_t)
             self);
     }
     ucc_mpool_cleanup(&self->req_mp, 1);
+    ucc_mpool_cleanup(&self->req_mp_small, 1);
+    if (self->rcache) {
+        ucc_tl_ucp_rcache_destroy(self);
+    }
+    if (self->cfg.send_stats) {
+        tl_info(self->super.super.lib,
+                "sends: %" PRIu64 " total, %" PRIu64 " to other hosts",
+                self->send_stats.sends, self->send_stats.net_sends);
+    }
     ucc_tl_ucp_eps_cleanup(&self->worker, self);
     if (self->cfg.service_worker != 0) {
         ucc_tl_ucp_eps_cleanup(&self->service_worker, self);
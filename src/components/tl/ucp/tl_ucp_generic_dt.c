@@ -0,0 +1,746 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "tl_ucp_coll.h"
+#include "core/ucc_progress_queue.h"
+#include "components/mc/ucc_mc.h"
+#include "utils/ucc_coll_utils.h"
+#include "utils/ucc_math.h"
+
+/* Collectives on non-contiguous generic datatypes.
+
+   The data of the rank is described by at most two packed streams: the pack
+   stream of the data it sends and the unpack stream of the data it receives.
+   Both are split into blocks, one per peer for the collectives that
+   exchange distinct data with every rank (e.g. alltoall), a single one
+   otherwise. Every fragment of the pipelined schedule
+      1. packs a fragment of each send block into scratch,
+      2. runs the default tl/ucp algorithm of the same collective on bytes,
+      3. unpacks a fragment of each recv block from scratch.
+   Each stage of the pipeline owns its scratch, so the byte collective is
+   set up once and only the pack/unpack tasks follow the fragment number.
+   The last fragment of a block may be partial, it is sent padded.
+
+   Packed streams are assumed to be linear in elements, i.e. element i of a
+   stream starts at offset i * packed_size(1 element).
+
+   The v collectives are not fragmented: the number of fragments can not be
+   agreed on without exchanging the counts, so the scratch mirrors the whole
+   packed layout. */
+
+#define UCC_TL_UCP_GENERIC_DT_COLLS                                            \
+    (UCC_COLL_TYPE_BCAST | UCC_COLL_TYPE_ALLGATHER |                           \
+     UCC_COLL_TYPE_ALLGATHERV | UCC_COLL_TYPE_ALLTOALL |                       \
+     UCC_COLL_TYPE_ALLTOALLV | UCC_COLL_TYPE_GATHER | UCC_COLL_TYPE_GATHERV)
+
+#define UCC_TL_UCP_GENERIC_DT_V_COLLS                                          \
+    (UCC_COLL_TYPE_ALLGATHERV | UCC_COLL_TYPE_ALLTOALLV |                      \
+     UCC_COLL_TYPE_GATHERV)
+
+#define GENERIC_DT(_schedule) (&(_schedule)->generic_dt)
+
+/* v_bytes layout: src counts, src displs, dst counts, dst displs */
+#define GENERIC_DT_V(_schedule, _i, _size)                                     \
+    (GENERIC_DT(_schedule)->v_bytes + (_i) * (_size))
+
+enum {
+    GENERIC_DT_SRC_COUNTS,
+    GENERIC_DT_SRC_DISPLS,
+    GENERIC_DT_DST_COUNTS,
+    GENERIC_DT_DST_DISPLS,
+    GENERIC_DT_V_LAST
+};
+
+static inline int ucc_tl_ucp_generic_dt_is_v(ucc_coll_args_t *args)
+{
+    return !!(args->coll_type & UCC_TL_UCP_GENERIC_DT_V_COLLS);
+}
+
+/* Elements [*offset, *offset + *count) of the stream handled by "block" in
+   fragment "frag" and the scratch offset they are packed at */
+static void ucc_tl_ucp_generic_dt_block(ucc_tl_ucp_schedule_t *schedule,
+                                        int unpack, ucc_rank_t block, int frag,
+                                        size_t *offset, size_t *count,
+                                        size_t *scratch_offset)
+{
+    ucc_coll_args_t *args = &schedule->super.super.super.bargs.args;
+    ucc_rank_t       size = UCC_TL_TEAM_SIZE(ucc_derived_of(
+                                schedule->super.super.super.team,
+                                ucc_tl_ucp_team_t));
+    size_t           pe   = GENERIC_DT(schedule)->elem_size;
+    size_t           fc   = GENERIC_DT(schedule)->frag_count;
+    size_t           bc   = GENERIC_DT(schedule)->block_count;
+    size_t           start;
+
+    if (ucc_tl_ucp_generic_dt_is_v(args)) {
+        if (unpack) {
+            *offset = ucc_coll_args_get_displacement(
+                args, args->dst.info_v.displacements, block);
+            *count  = ucc_coll_args_get_count(args, args->dst.info_v.counts,
+                                              block);
+            *scratch_offset = GENERIC_DT(schedule)->unpack_region +
+                GENERIC_DT_V(schedule, GENERIC_DT_DST_DISPLS, size)[block];
+        } else if (args->coll_type == UCC_COLL_TYPE_ALLTOALLV) {
+            *offset = ucc_coll_args_get_displacement(
+                args, args->src.info_v.displacements, block);
+            *count  = ucc_coll_args_get_count(args, args->src.info_v.counts,
+                                              block);
+            *scratch_offset =
+                GENERIC_DT_V(schedule, GENERIC_DT_SRC_DISPLS, size)[block];
+        } else {
+            *offset         = GENERIC_DT(schedule)->pack_offset;
+            *count          = bc;
+            *scratch_offset = 0;
+        }
+        return;
+    }
+
+    start   = (size_t)frag * fc;
+    *offset = (unpack ? 0 : GENERIC_DT(schedule)->pack_offset) +
+              block * bc + start;
+    *count  = (start < bc) ? ucc_min(fc, bc - start) : 0;
+    *scratch_offset = (unpack ? GENERIC_DT(schedule)->unpack_region : 0) +
+                      block * fc * pe;
+}
+
+static void ucc_tl_ucp_generic_dt_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t     *task     = ucc_derived_of(coll_task,
+                                                     ucc_tl_ucp_task_t);
+    ucc_tl_ucp_schedule_t *schedule = task->generic_dt.schedule;
+    ucc_dt_generic_t      *dt       = GENERIC_DT(schedule)->dt;
+    size_t                 pe       = GENERIC_DT(schedule)->elem_size;
+    int                    unpack   = task->generic_dt.unpack;
+    ucc_rank_t             n_blocks = unpack ?
+                                      GENERIC_DT(schedule)->n_unpack_blocks :
+                                      GENERIC_DT(schedule)->n_pack_blocks;
+    size_t                 offset, count, scratch_offset, len, done, packed;
+    void                  *scratch;
+    ucc_status_t           status;
+
+    /* one block per call, so that transfers of the other pipeline stages
+       progress in between */
+    for (; task->generic_dt.block < n_blocks; task->generic_dt.block++) {
+        /* in-place: own block of the dst is already in place, but it is
+           still packed as the contribution */
+        if (unpack &&
+            task->generic_dt.block == GENERIC_DT(schedule)->skip_block) {
+            continue;
+        }
+        ucc_tl_ucp_generic_dt_block(schedule, unpack, task->generic_dt.block,
+                                    task->generic_dt.frag, &offset, &count,
+                                    &scratch_offset);
+        if (count == 0) {
+            continue;
+        }
+        scratch = PTR_OFFSET(task->generic_dt.scratch, scratch_offset);
+        len     = count * pe;
+        if (unpack) {
+            status = dt->ops.unpack(GENERIC_DT(schedule)->unpack_state,
+                                    offset * pe, scratch, len);
+            if (ucc_unlikely(status != UCC_OK)) {
+                tl_error(UCC_TASK_LIB(task), "datatype unpack failed: %s",
+                         ucc_status_string(status));
+                task->super.status = status;
+                return;
+            }
+        } else {
+            for (done = 0; done < len;) {
+                packed = dt->ops.pack(GENERIC_DT(schedule)->pack_state,
+                                      offset * pe + done,
+                                      PTR_OFFSET(scratch, done), len - done);
+                if (ucc_unlikely(packed == 0)) {
+                    tl_error(UCC_TASK_LIB(task),
+                             "datatype pack made no progress at offset %zd",
+                             offset * pe + done);
+                    task->super.status = UCC_ERR_NO_MESSAGE;
+                    return;
+                }
+                done += packed;
+            }
+        }
+        task->generic_dt.block++;
+        if (task->generic_dt.block < n_blocks) {
+            return;
+        }
+        break;
+    }
+    task->super.status = UCC_OK;
+}
+
+static ucc_status_t ucc_tl_ucp_generic_dt_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    task->generic_dt.block = 0;
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+}
+
+/* pack/unpack tasks do not use p2p, so they don't take a collective tag
+   and ranks that have nothing to pack or unpack do not skew the tags */
+static ucc_status_t
+ucc_tl_ucp_generic_dt_task_init(ucc_base_coll_args_t  *coll_args,
+                                ucc_base_team_t       *team,
+                                ucc_tl_ucp_schedule_t *schedule, void *scratch,
+                                int unpack, ucc_coll_task_t **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t *task;
+
+    task = ucc_tl_ucp_get_task_sized(tl_team,
+                                     UCC_TL_UCP_TASK_SIZE(generic_dt));
+    if (ucc_unlikely(!task)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    ucc_coll_task_init(&task->super, coll_args, team);
+    task->generic_dt.schedule = schedule;
+    task->generic_dt.scratch  = scratch;
+    task->generic_dt.frag     = 0;
+    task->generic_dt.unpack   = unpack;
+    task->super.post          = ucc_tl_ucp_generic_dt_start;
+    task->super.progress      = ucc_tl_ucp_generic_dt_progress;
+    task->super.finalize      = ucc_tl_ucp_coll_finalize;
+    *task_h                   = &task->super;
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_tl_ucp_generic_dt_frag_start(ucc_coll_task_t *task)
+{
+    return ucc_schedule_start(task);
+}
+
+static ucc_status_t ucc_tl_ucp_generic_dt_frag_finalize(ucc_coll_task_t *task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(task, ucc_schedule_t);
+    ucc_status_t    status;
+
+    status = ucc_schedule_finalize(task);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
+
+static ucc_status_t
+ucc_tl_ucp_generic_dt_frag_setup(ucc_schedule_pipelined_t *schedule_p,
+                                 ucc_schedule_t *frag, int frag_num)
+{
+    ucc_tl_ucp_schedule_t *schedule = ucc_derived_of(schedule_p,
+                                                     ucc_tl_ucp_schedule_t);
+    ucc_tl_ucp_task_t     *task;
+
+    if (GENERIC_DT(schedule)->n_pack_blocks) {
+        task = ucc_derived_of(frag->tasks[0], ucc_tl_ucp_task_t);
+        task->generic_dt.frag = frag_num;
+    }
+    if (GENERIC_DT(schedule)->n_unpack_blocks) {
+        task = ucc_derived_of(frag->tasks[frag->n_tasks - 1],
+                              ucc_tl_ucp_task_t);
+        task->generic_dt.frag = frag_num;
+    }
+    return UCC_OK;
+}
+
+/* Arguments of the collective on bytes moved by one pipeline stage */
+static void ucc_tl_ucp_generic_dt_frag_args(ucc_tl_ucp_schedule_t *schedule,
+                                            ucc_coll_args_t *args,
+                                            void *scratch, ucc_rank_t size)
+{
+    size_t fb     = GENERIC_DT(schedule)->frag_count *
+                    GENERIC_DT(schedule)->elem_size;
+    void  *rbuf   = PTR_OFFSET(scratch, GENERIC_DT(schedule)->unpack_region);
+    int    is_v   = ucc_tl_ucp_generic_dt_is_v(args);
+
+    args->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+    args->flags &= ~(UCC_COLL_ARGS_FLAG_IN_PLACE |
+                     UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+                     UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT |
+                     UCC_COLL_ARGS_FLAG_MEM_MAPPED_BUFFERS);
+    if (is_v) {
+        args->flags |= UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+                       UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT;
+    }
+
+    if (args->coll_type == UCC_COLL_TYPE_ALLTOALLV) {
+        args->src.info_v.buffer        = scratch;
+        args->src.info_v.counts        = (ucc_count_t *)
+            GENERIC_DT_V(schedule, GENERIC_DT_SRC_COUNTS, size);
+        args->src.info_v.displacements = (ucc_aint_t *)
+            GENERIC_DT_V(schedule, GENERIC_DT_SRC_DISPLS, size);
+        args->src.info_v.datatype      = UCC_DT_UINT8;
+        args->src.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+    } else {
+        args->src.info.buffer   = scratch;
+        args->src.info.datatype = UCC_DT_UINT8;
+        args->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        if (args->coll_type == UCC_COLL_TYPE_ALLTOALL) {
+            args->src.info.count = fb * size;
+        } else if (is_v) {
+            args->src.info.count = GENERIC_DT(schedule)->block_count *
+                                   GENERIC_DT(schedule)->elem_size;
+        } else {
+            args->src.info.count = fb;
+        }
+    }
+    if (args->coll_type == UCC_COLL_TYPE_BCAST) {
+        return;
+    }
+
+    if (is_v) {
+        args->dst.info_v.buffer        = rbuf;
+        args->dst.info_v.counts        = (ucc_count_t *)
+            GENERIC_DT_V(schedule, GENERIC_DT_DST_COUNTS, size);
+        args->dst.info_v.displacements = (ucc_aint_t *)
+            GENERIC_DT_V(schedule, GENERIC_DT_DST_DISPLS, size);
+        args->dst.info_v.datatype      = UCC_DT_UINT8;
+        args->dst.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+    } else {
+        args->dst.info.buffer   = rbuf;
+        args->dst.info.count    = fb * size;
+        args->dst.info.datatype = UCC_DT_UINT8;
+        args->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    }
+}
+
+static ucc_status_t
+ucc_tl_ucp_generic_dt_frag_init(ucc_base_coll_args_t     *coll_args,
+                                ucc_schedule_pipelined_t *sp,
+                                ucc_base_team_t          *team,
+                                ucc_schedule_t          **frag_p)
+{
+    ucc_tl_ucp_team_t     *tl_team  = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_schedule_t *sched    = ucc_derived_of(sp,
+                                                     ucc_tl_ucp_schedule_t);
+    ucc_base_coll_args_t   args     = *coll_args;
+    ucc_coll_task_t       *prev     = NULL;
+    ucc_schedule_t        *schedule;
+    ucc_coll_task_t       *task;
+    ucc_status_t           status;
+    void                  *scratch;
+
+    status = ucc_tl_ucp_get_schedule(tl_team, coll_args,
+                                     (ucc_tl_ucp_schedule_t **)&schedule);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    scratch = PTR_OFFSET(sched->scratch_mc_header->addr,
+                         GENERIC_DT(sched)->n_slots *
+                         GENERIC_DT(sched)->slot_size);
+    GENERIC_DT(sched)->n_slots++;
+
+    if (GENERIC_DT(sched)->n_pack_blocks) {
+        UCC_CHECK_GOTO(ucc_tl_ucp_generic_dt_task_init(coll_args, team, sched,
+                                                       scratch, 0, &task),
+                       err, status);
+        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, task), err, status);
+        UCC_CHECK_GOTO(ucc_task_subscribe_dep(&schedule->super, task,
+                                              UCC_EVENT_SCHEDULE_STARTED),
+                       err, status);
+        prev = task;
+    }
+
+    args.mask &= ~UCC_BASE_CARGS_MAX_FRAG_COUNT;
+    ucc_tl_ucp_generic_dt_frag_args(sched, &args.args, scratch,
+                                    UCC_TL_TEAM_SIZE(tl_team));
+    UCC_CHECK_GOTO(ucc_tl_ucp_coll_init(&args, team, &task), err, status);
+    UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, task), err, status);
+    UCC_CHECK_GOTO(prev ? ucc_task_subscribe_dep(prev, task,
+                                                 UCC_EVENT_COMPLETED) :
+                          ucc_task_subscribe_dep(&schedule->super, task,
+                                                 UCC_EVENT_SCHEDULE_STARTED),
+                   err, status);
+    prev = task;
+
+    if (GENERIC_DT(sched)->n_unpack_blocks) {
+        UCC_CHECK_GOTO(ucc_tl_ucp_generic_dt_task_init(coll_args, team, sched,
+                                                       scratch, 1, &task),
+                       err, status);
+        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, task), err, status);
+        UCC_CHECK_GOTO(ucc_task_subscribe_dep(prev, task, UCC_EVENT_COMPLETED),
+                       err, status);
+    }
+    schedule->super.finalize = ucc_tl_ucp_generic_dt_frag_finalize;
+    schedule->super.post     = ucc_tl_ucp_generic_dt_frag_start;
+    *frag_p                  = schedule;
+    return UCC_OK;
+err:
+    ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
+
+static void ucc_tl_ucp_generic_dt_cleanup(ucc_tl_ucp_schedule_t *schedule)
+{
+    ucc_dt_generic_t *dt = GENERIC_DT(schedule)->dt;
+
+    if (GENERIC_DT(schedule)->pack_state) {
+        dt->ops.finish(GENERIC_DT(schedule)->pack_state);
+    }
+    if (GENERIC_DT(schedule)->unpack_state) {
+        dt->ops.finish(GENERIC_DT(schedule)->unpack_state);
+    }
+    if (schedule->scratch_mc_header) {
+        ucc_mc_free(schedule->scratch_mc_header);
+    }
+    ucc_free(GENERIC_DT(schedule)->v_bytes);
+}
+
+static ucc_status_t ucc_tl_ucp_generic_dt_finalize(ucc_coll_task_t *task)
+{
+    ucc_tl_ucp_schedule_t *schedule = ucc_derived_of(task,
+                                                     ucc_tl_ucp_schedule_t);
+    ucc_status_t           status;
+
+    status = ucc_schedule_pipelined_finalize(task);
+    ucc_tl_ucp_generic_dt_cleanup(schedule);
+    ucc_tl_ucp_put_schedule(&schedule->super.super);
+    return status;
+}
+
+static ucc_status_t ucc_tl_ucp_generic_dt_post(ucc_coll_task_t *task)
+{
+    return ucc_schedule_pipelined_post(task);
+}
+
+static void
+ucc_tl_ucp_generic_dt_get_pipeline_params(ucc_tl_ucp_team_t     *team,
+                                          ucc_pipeline_params_t *pp)
+{
+    if (!ucc_pipeline_params_is_auto(&team->cfg.generic_dt_pipeline)) {
+        *pp = team->cfg.generic_dt_pipeline;
+        return;
+    }
+    pp->threshold = 0;
+    pp->frag_size = 256 * 1024;
+    pp->n_frags   = 0;
+    pp->pdepth    = 2;
+    pp->order     = UCC_PIPELINE_ORDERED;
+}
+
+/* The rank must use a single datatype on host buffers */
+static ucc_status_t ucc_tl_ucp_generic_dt_check(ucc_coll_args_t *args,
+                                                ucc_rank_t rank,
+                                                ucc_datatype_t *dt)
+{
+    ucc_coll_type_t   ct       = args->coll_type;
+    int               src_used = !UCC_IS_INPLACE(*args);
+    int               dst_used = (ct != UCC_COLL_TYPE_BCAST) &&
+                                 (UCC_IS_ROOT(*args, rank) ||
+                                  !(ct & (UCC_COLL_TYPE_GATHER |
+                                          UCC_COLL_TYPE_GATHERV)));
+    ucc_datatype_t    src_dt, dst_dt;
+    ucc_memory_type_t src_mt, dst_mt;
+
+    if (!(ct & UCC_TL_UCP_GENERIC_DT_COLLS) ||
+        ((ct & (UCC_COLL_TYPE_ALLTOALL | UCC_COLL_TYPE_ALLTOALLV)) &&
+         UCC_IS_INPLACE(*args))) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (ct == UCC_COLL_TYPE_ALLTOALLV) {
+        src_dt = args->src.info_v.datatype;
+        src_mt = args->src.info_v.mem_type;
+    } else {
+        src_dt = args->src.info.datatype;
+        src_mt = args->src.info.mem_type;
+    }
+    if (ucc_tl_ucp_generic_dt_is_v(args)) {
+        dst_dt = args->dst.info_v.datatype;
+        dst_mt = args->dst.info_v.mem_type;
+    } else {
+        dst_dt = args->dst.info.datatype;
+        dst_mt = args->dst.info.mem_type;
+    }
+    if ((src_used && src_mt != UCC_MEMORY_TYPE_HOST) ||
+        (dst_used && dst_mt != UCC_MEMORY_TYPE_HOST) ||
+        (src_used && dst_used && src_dt != dst_dt)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    *dt = src_used ? src_dt : dst_dt;
+    return UCC_DT_IS_NONCONTIG(*dt) ? UCC_OK : UCC_ERR_NOT_SUPPORTED;
+}
+
+/* Element counts of the collective on the rank: "pack_count" and
+   "unpack_count" elements of the pack and unpack streams starting at
+   "pack_buf" and "unpack_buf". Sets up the blocks of both streams. */
+static ucc_status_t
+ucc_tl_ucp_generic_dt_layout(ucc_tl_ucp_schedule_t *schedule,
+                             ucc_coll_args_t *args, ucc_rank_t rank,
+                             ucc_rank_t size, const void **pack_buf,
+                             size_t *pack_count, void **unpack_buf,
+                             size_t *unpack_count)
+{
+    ucc_coll_type_t ct      = args->coll_type;
+    int             is_root = UCC_IS_ROOT(*args, rank);
+    int             inplace = UCC_IS_INPLACE(*args);
+    ucc_rank_t      i;
+    size_t          c;
+
+    *pack_buf     = args->src.info.buffer;
+    *pack_count   = args->src.info.count;
+    *unpack_buf   = args->dst.info.buffer;
+    *unpack_count = 0;
+    GENERIC_DT(schedule)->n_pack_blocks   = 1;
+    GENERIC_DT(schedule)->n_unpack_blocks = size;
+    GENERIC_DT(schedule)->skip_block      = UCC_RANK_INVALID;
+    GENERIC_DT(schedule)->pack_offset     = 0;
+
+    switch (ct) {
+    case UCC_COLL_TYPE_BCAST:
+        GENERIC_DT(schedule)->block_count     = args->src.info.count;
+        GENERIC_DT(schedule)->n_pack_blocks   = is_root ? 1 : 0;
+        GENERIC_DT(schedule)->n_unpack_blocks = is_root ? 0 : 1;
+        *pack_count   = is_root ? args->src.info.count : 0;
+        *unpack_buf   = args->src.info.buffer;
+        *unpack_count = is_root ? 0 : args->src.info.count;
+        break;
+    case UCC_COLL_TYPE_ALLTOALL:
+        GENERIC_DT(schedule)->block_count   = args->src.info.count / size;
+        GENERIC_DT(schedule)->n_pack_blocks = size;
+        *unpack_count = args->dst.info.count;
+        break;
+    case UCC_COLL_TYPE_ALLGATHER:
+    case UCC_COLL_TYPE_GATHER:
+        GENERIC_DT(schedule)->block_count = args->dst.info.count / size;
+        if (ct == UCC_COLL_TYPE_GATHER && !is_root) {
+            GENERIC_DT(schedule)->block_count     = args->src.info.count;
+            GENERIC_DT(schedule)->n_unpack_blocks = 0;
+            break;
+        }
+        *unpack_count = args->dst.info.count;
+        if (inplace) {
+            *pack_buf   = args->dst.info.buffer;
+            *pack_count = args->dst.info.count;
+            GENERIC_DT(schedule)->pack_offset =
+                rank * GENERIC_DT(schedule)->block_count;
+            GENERIC_DT(schedule)->skip_block  = rank;
+        }
+        break;
+    case UCC_COLL_TYPE_ALLTOALLV:
+        GENERIC_DT(schedule)->n_pack_blocks = size;
+        *pack_buf   = args->src.info_v.buffer;
+        *pack_count = 0;
+        for (i = 0; i < size; i++) {
+            c = ucc_coll_args_get_displacement(args,
+                    args->src.info_v.displacements, i) +
+                ucc_coll_args_get_count(args, args->src.info_v.counts, i);
+            *pack_count = ucc_max(*pack_count, c);
+        }
+        /* fall through */
+    case UCC_COLL_TYPE_ALLGATHERV:
+    case UCC_COLL_TYPE_GATHERV:
+        if (ct != UCC_COLL_TYPE_ALLTOALLV) {
+            GENERIC_DT(schedule)->block_count = args->src.info.count;
+        }
+        if (ct == UCC_COLL_TYPE_GATHERV && !is_root) {
+            GENERIC_DT(schedule)->n_unpack_blocks = 0;
+            break;
+        }
+        *unpack_buf = args->dst.info_v.buffer;
+        for (i = 0; i < size; i++) {
+            c = ucc_coll_args_get_displacement(args,
+                    args->dst.info_v.displacements, i) +
+                ucc_coll_args_get_count(args, args->dst.info_v.counts, i);
+            *unpack_count = ucc_max(*unpack_count, c);
+        }
+        if (inplace && ct != UCC_COLL_TYPE_ALLTOALLV) {
+            *pack_buf   = args->dst.info_v.buffer;
+            *pack_count = *unpack_count;
+            GENERIC_DT(schedule)->pack_offset =
+                ucc_coll_args_get_displacement(
+                    args, args->dst.info_v.displacements, rank);
+            GENERIC_DT(schedule)->block_count =
+                ucc_coll_args_get_count(args, args->dst.info_v.counts, rank);
+            GENERIC_DT(schedule)->skip_block  = rank;
+        }
+        break;
+    default:
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    return UCC_OK;
+}
+
+/* Byte counts and displacements of the v collective on bytes, the recv
+   scratch mirrors the packed layout of the dst buffer */
+static ucc_status_t
+ucc_tl_ucp_generic_dt_v_init(ucc_tl_ucp_schedule_t *schedule,
+                             ucc_coll_args_t *args, ucc_rank_t size,
+                             size_t pack_count, size_t unpack_count)
+{
+    size_t    pe = GENERIC_DT(schedule)->elem_size;
+    uint64_t *v;
+    ucc_rank_t i;
+
+    v = ucc_calloc(GENERIC_DT_V_LAST * size, sizeof(uint64_t),
+                   "generic_dt_v_bytes");
+    if (ucc_unlikely(!v)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    GENERIC_DT(schedule)->v_bytes = v;
+    for (i = 0; i < size; i++) {
+        if (args->coll_type == UCC_COLL_TYPE_ALLTOALLV) {
+            v[GENERIC_DT_SRC_COUNTS * size + i] = pe *
+                ucc_coll_args_get_count(args, args->src.info_v.counts, i);
+            v[GENERIC_DT_SRC_DISPLS * size + i] = pe *
+                ucc_coll_args_get_displacement(
+                    args, args->src.info_v.displacements, i);
+        }
+        if (GENERIC_DT(schedule)->n_unpack_blocks) {
+            v[GENERIC_DT_DST_COUNTS * size + i] = pe *
+                ucc_coll_args_get_count(args, args->dst.info_v.counts, i);
+            v[GENERIC_DT_DST_DISPLS * size + i] = pe *
+                ucc_coll_args_get_displacement(
+                    args, args->dst.info_v.displacements, i);
+        }
+    }
+    GENERIC_DT(schedule)->frag_count    = 0;
+    GENERIC_DT(schedule)->unpack_region =
+        (args->coll_type == UCC_COLL_TYPE_ALLTOALLV) ? pack_count * pe :
+        GENERIC_DT(schedule)->block_count * pe;
+    GENERIC_DT(schedule)->slot_size     = GENERIC_DT(schedule)->unpack_region +
+                                          unpack_count * pe;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_generic_dt_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *team,
+                                        ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t     *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_coll_args_t       *args    = &coll_args->args;
+    ucc_rank_t             rank    = UCC_TL_TEAM_RANK(tl_team);
+    ucc_rank_t             size    = UCC_TL_TEAM_SIZE(tl_team);
+    int                    n_frags = 1, pdepth = 1;
+    ucc_pipeline_order_t   order   = UCC_PIPELINE_ORDERED;
+    ucc_pipeline_params_t  pp;
+    ucc_tl_ucp_schedule_t *schedule;
+    ucc_datatype_t         dt;
+    ucc_dt_generic_t      *gdt;
+    const void            *pack_buf;
+    void                  *unpack_buf;
+    size_t                 pack_count, unpack_count, n_blocks;
+    ucc_status_t           status;
+
+    status = ucc_tl_ucp_generic_dt_check(args, rank, &dt);
+    if (status != UCC_OK) {
+        tl_debug(UCC_TL_TEAM_LIB(tl_team), "%s on generic datatype is not "
+                 "supported", ucc_coll_type_str(args->coll_type));
+        return status;
+    }
+    gdt = ucc_dt_to_generic(dt);
+
+    status = ucc_tl_ucp_get_schedule(tl_team, coll_args, &schedule);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    memset(GENERIC_DT(schedule), 0, sizeof(*GENERIC_DT(schedule)));
+    schedule->scratch_mc_header = NULL;
+    GENERIC_DT(schedule)->dt    = gdt;
+
+    UCC_CHECK_GOTO(ucc_tl_ucp_generic_dt_layout(schedule, args, rank, size,
+                                                &pack_buf, &pack_count,
+                                                &unpack_buf, &unpack_count),
+                   err, status);
+
+    /* same on all ranks of the collective since the datatype is */
+    GENERIC_DT(schedule)->elem_size =
+        ucc_dt_packed_size(dt, GENERIC_DT(schedule)->n_pack_blocks ?
+                               pack_buf : unpack_buf, 1);
+    if (GENERIC_DT(schedule)->elem_size == SIZE_MAX) {
+        status = UCC_ERR_NO_RESOURCE;
+        goto err;
+    }
+    if (GENERIC_DT(schedule)->n_pack_blocks) {
+        GENERIC_DT(schedule)->pack_state =
+            gdt->ops.start_pack(gdt->context, pack_buf, pack_count);
+        if (!GENERIC_DT(schedule)->pack_state) {
+            status = UCC_ERR_NO_RESOURCE;
+            goto err;
+        }
+        if (gdt->ops.packed_size(GENERIC_DT(schedule)->pack_state) !=
+            pack_count * GENERIC_DT(schedule)->elem_size) {
+            tl_debug(UCC_TL_TEAM_LIB(tl_team), "packed size of generic "
+                     "datatype is not linear in the number of elements");
+            status = UCC_ERR_NOT_SUPPORTED;
+            goto err;
+        }
+    }
+    if (GENERIC_DT(schedule)->n_unpack_blocks) {
+        GENERIC_DT(schedule)->unpack_state =
+            gdt->ops.start_unpack(gdt->context, unpack_buf, unpack_count);
+        if (!GENERIC_DT(schedule)->unpack_state) {
+            status = UCC_ERR_NO_RESOURCE;
+            goto err;
+        }
+    }
+
+    if (ucc_tl_ucp_generic_dt_is_v(args)) {
+        UCC_CHECK_GOTO(ucc_tl_ucp_generic_dt_v_init(schedule, args, size,
+                                                    pack_count, unpack_count),
+                       err, status);
+    } else {
+        /* scratch of a stage holds a fragment of every send and recv block */
+        n_blocks = (args->coll_type == UCC_COLL_TYPE_BCAST) ? 1 :
+                   ((args->coll_type == UCC_COLL_TYPE_ALLTOALL) ? 2 * size :
+                                                                1 + size);
+        ucc_tl_ucp_generic_dt_get_pipeline_params(tl_team, &pp);
+        ucc_pipeline_nfrags_pdepth(&pp, GENERIC_DT(schedule)->block_count *
+                                   GENERIC_DT(schedule)->elem_size * n_blocks,
+                                   &n_frags, &pdepth);
+        GENERIC_DT(schedule)->frag_count =
+            ucc_div_round_up(GENERIC_DT(schedule)->block_count, n_frags);
+        if (GENERIC_DT(schedule)->frag_count) {
+            n_frags = ucc_div_round_up(GENERIC_DT(schedule)->block_count,
+                                       GENERIC_DT(schedule)->frag_count);
+        }
+        pdepth = ucc_max(1, ucc_min(ucc_min(pdepth, n_frags),
+                                    UCC_SCHEDULE_PIPELINED_MAX_FRAGS));
+        order  = pp.order;
+        GENERIC_DT(schedule)->unpack_region =
+            (args->coll_type == UCC_COLL_TYPE_BCAST) ? 0 :
+            GENERIC_DT(schedule)->frag_count *
+            GENERIC_DT(schedule)->elem_size *
+            GENERIC_DT(schedule)->n_pack_blocks;
+        GENERIC_DT(schedule)->slot_size =
+            GENERIC_DT(schedule)->frag_count *
+            GENERIC_DT(schedule)->elem_size * n_blocks;
+    }
+
+    status = ucc_mc_alloc(&schedule->scratch_mc_header,
+                          ucc_max(GENERIC_DT(schedule)->slot_size, 1) * pdepth,
+                          UCC_MEMORY_TYPE_HOST);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "failed to allocate generic datatype scratch");
+        schedule->scratch_mc_header = NULL;
+        goto err;
+    }
+
+    tl_debug(UCC_TL_TEAM_LIB(tl_team), "generic datatype %s: elem size %zd, "
+             "n_frags %d, pdepth %d, stage scratch %zd",
+             ucc_coll_type_str(args->coll_type),
+             GENERIC_DT(schedule)->elem_size, n_frags, pdepth,
+             GENERIC_DT(schedule)->slot_size);
+    status = ucc_schedule_pipelined_init(coll_args, team,
+                                         ucc_tl_ucp_generic_dt_frag_init,
+                                         ucc_tl_ucp_generic_dt_frag_setup,
+                                         pdepth, n_frags, order,
+                                         &schedule->super);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team), "failed to init pipelined schedule");
+        goto err;
+    }
+    schedule->super.super.super.finalize = ucc_tl_ucp_generic_dt_finalize;
+    schedule->super.super.super.post     = ucc_tl_ucp_generic_dt_post;
+    *task_h = &schedule->super.super.super;
+    return UCC_OK;
+
+err:
+    ucc_tl_ucp_generic_dt_cleanup(schedule);
+    ucc_tl_ucp_put_schedule(&schedule->super.super);
+    return status;
+}
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_ucp.h"
+#include "tl_ucp_coll.h"
+#include "utils/ucc_atomic.h"
+#include "utils/ucc_coll_utils.h"
+#include <inttypes.h>
+
+/* collectives whose src (resp. dst) is described by a vector of counts,
+   those buffers are not looked up in the cache */
+#define UCC_TL_UCP_RCACHE_SRC_V                                                \
+    (UCC_COLL_TYPE_ALLTOALLV | UCC_COLL_TYPE_SCATTERV)
+
+#define UCC_TL_UCP_RCACHE_DST_V                                                \
+    (UCC_COLL_TYPE_ALLTOALLV | UCC_COLL_TYPE_ALLGATHERV |                      \
+     UCC_COLL_TYPE_GATHERV | UCC_COLL_TYPE_REDUCE_SCATTERV)
+
+#define UCC_TL_UCP_RCACHE_NO_BUFS                                              \
+    (UCC_COLL_TYPE_BARRIER | UCC_COLL_TYPE_FANIN | UCC_COLL_TYPE_FANOUT)
+
+static ucs_status_t
+ucc_tl_ucp_rcache_mem_reg(void *context,
+                          ucc_rcache_t *rcache, //NOLINT: rcache is unused
+                          void *arg, ucc_rcache_region_t *rregion,
+                          uint16_t flags) //NOLINT: flags is unused
+{
+    ucc_tl_ucp_context_t       *ctx     = (ucc_tl_ucp_context_t *)context;
+    ucc_tl_ucp_rcache_region_t *region  =
+        ucc_derived_of(rregion, ucc_tl_ucp_rcache_region_t);
+    int                        *is_miss = (int *)arg;
+    ucp_mem_map_params_t        mmap_params;
+    ucs_status_t                status;
+
+    *is_miss                = 1;
+    mmap_params.field_mask  = UCP_MEM_MAP_PARAM_FIELD_ADDRESS |
+                              UCP_MEM_MAP_PARAM_FIELD_LENGTH  |
+                              UCP_MEM_MAP_PARAM_FIELD_MEMORY_TYPE;
+    mmap_params.address     = (void *)rregion->super.start;
+    mmap_params.length      = (size_t)(rregion->super.end -
+                                       rregion->super.start);
+    mmap_params.memory_type = UCS_MEMORY_TYPE_HOST;
+
+    status = ucp_mem_map(ctx->worker.ucp_context, &mmap_params,
+                         &region->memh);
+    if (ucc_unlikely(status != UCS_OK)) {
+        tl_debug(ctx->super.super.lib, "failed to register %p len %zd: %s",
+                 mmap_params.address, mmap_params.length,
+                 ucs_status_string(status));
+        return status;
+    }
+    return UCS_OK;
+}
+
+static void
+ucc_tl_ucp_rcache_mem_dereg(void *context,
+                            ucc_rcache_t *rcache, //NOLINT: rcache is unused
+                            ucc_rcache_region_t *rregion)
+{
+    ucc_tl_ucp_context_t       *ctx    = (ucc_tl_ucp_context_t *)context;
+    ucc_tl_ucp_rcache_region_t *region =
+        ucc_derived_of(rregion, ucc_tl_ucp_rcache_region_t);
+
+    ucp_mem_unmap(ctx->worker.ucp_context, region->memh);
+}
+
+static void ucc_tl_ucp_rcache_dump_region(void *context, //NOLINT
+                                          ucc_rcache_t *rcache, //NOLINT
+                                          ucc_rcache_region_t *rregion,
+                                          char *buf, size_t max)
+{
+    ucc_tl_ucp_rcache_region_t *region =
+        ucc_derived_of(rregion, ucc_tl_ucp_rcache_region_t);
+
+    snprintf(buf, max, "memh:%p", region->memh);
+}
+
+static ucc_rcache_ops_t ucc_tl_ucp_rcache_ops = {
+    .mem_reg     = ucc_tl_ucp_rcache_mem_reg,
+    .mem_dereg   = ucc_tl_ucp_rcache_mem_dereg,
+    .dump_region = ucc_tl_ucp_rcache_dump_region,
+#ifdef UCS_HAVE_RCACHE_MERGE_CB
+    .merge       = ucc_rcache_merge_cb_empty
+#endif
+};
+
+ucc_status_t ucc_tl_ucp_rcache_create(ucc_tl_ucp_context_t *ctx)
+{
+    ucc_rcache_params_t rcache_params;
+
+    ucc_rcache_set_default_params(&rcache_params);
+    rcache_params.region_struct_size = sizeof(ucc_tl_ucp_rcache_region_t);
+    rcache_params.context            = ctx;
+    rcache_params.ops                = &ucc_tl_ucp_rcache_ops;
+    rcache_params.ucm_events         = UCM_EVENT_VM_UNMAPPED |
+                                       UCM_EVENT_MEM_TYPE_FREE;
+    rcache_params.max_regions        = ctx->cfg.reg_cache_max_regions;
+    rcache_params.max_size           = ctx->cfg.reg_cache_max_size;
+
+    ctx->rcache_stats.hits   = 0;
+    ctx->rcache_stats.misses = 0;
+    return ucc_rcache_create(&rcache_params, "TL_UCP", &ctx->rcache);
+}
+
+void ucc_tl_ucp_rcache_destroy(ucc_tl_ucp_context_t *ctx)
+{
+    tl_info(ctx->super.super.lib,
+            "registration cache: %" PRIu64 " hits, %" PRIu64 " misses",
+            ctx->rcache_stats.hits, ctx->rcache_stats.misses);
+    ucc_rcache_destroy(ctx->rcache);
+    ctx->rcache = NULL;
+}
+
+ucc_tl_ucp_rcache_region_t *
+ucc_tl_ucp_rcache_get(ucc_tl_ucp_context_t *ctx, void *addr, size_t length)
+{
+    ucc_rcache_region_t *rregion;
+    int                  is_miss = 0;
+
+    if (UCC_OK != ucc_rcache_get(ctx->rcache, addr, length, &is_miss,
+                                 &rregion)) {
+        return NULL;
+    }
+    if (is_miss) {
+        ucc_atomic_add64(&ctx->rcache_stats.misses, 1);
+    } else {
+        ucc_atomic_add64(&ctx->rcache_stats.hits, 1);
+    }
+    return ucc_derived_of(rregion, ucc_tl_ucp_rcache_region_t);
+}
+
+void ucc_tl_ucp_rcache_put(ucc_tl_ucp_context_t       *ctx,
+                           ucc_tl_ucp_rcache_region_t *region)
+{
+    ucc_rcache_region_put(ctx->rcache, &region->super);
+}
+
+static ucc_tl_ucp_rcache_region_t *
+ucc_tl_ucp_task_rcache_lookup(ucc_tl_ucp_context_t *ctx,
+                              ucc_coll_buffer_info_t *info)
+{
+    size_t len;
+
+    if (!info->buffer || info->mem_type != UCC_MEMORY_TYPE_HOST) {
+        return NULL;
+    }
+    len = info->count * ucc_dt_size(info->datatype);
+    if (len < ctx->cfg.reg_cache_thresh) {
+        return NULL;
+    }
+    return ucc_tl_ucp_rcache_get(ctx, info->buffer, len);
+}
+
+void ucc_tl_ucp_task_rcache_get(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_context_t *ctx     = TASK_CTX(task);
+    ucc_coll_args_t      *args    = &TASK_ARGS(task);
+    ucc_coll_type_t       ct      = args->coll_type;
+    ucc_rank_t            rank    = UCC_TL_TEAM_RANK(TASK_TEAM(task));
+    int                   is_root = UCC_IS_ROOT(*args, rank);
+
+    if ((ct & UCC_TL_UCP_RCACHE_NO_BUFS) ||
+        !ucc_coll_args_is_predefined_dt(args, UCC_RANK_INVALID)) {
+        return;
+    }
+    /* scatter src and gather/reduce dst are meaningful on root only */
+    if (!UCC_IS_INPLACE(*args) && !(ct & UCC_TL_UCP_RCACHE_SRC_V) &&
+        (is_root || !(ct & UCC_COLL_TYPE_SCATTER))) {
+        task->rcache_regs[0] =
+            ucc_tl_ucp_task_rcache_lookup(ctx, &args->src.info);
+    }
+    if (!(ct & (UCC_TL_UCP_RCACHE_DST_V | UCC_COLL_TYPE_BCAST)) &&
+        (is_root || !(ct & (UCC_COLL_TYPE_GATHER | UCC_COLL_TYPE_REDUCE)))) {
+        task->rcache_regs[1] =
+            ucc_tl_ucp_task_rcache_lookup(ctx, &args->dst.info);
+    }
+}
+
+void ucc_tl_ucp_task_rcache_put(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_context_t *ctx = TASK_CTX(task);
+    int                   i;
+
+    for (i = 0; i < 2; i++) {
+        if (task->rcache_regs[i]) {
+            ucc_tl_ucp_rcache_put(ctx, task->rcache_regs[i]);
+            task->rcache_regs[i] = NULL;
+        }
+    }
+}
@@ -13,6 +13,7 @@
 #include "tl_ucp_tag.h"
 #include "tl_ucp_ep.h"
 #include "utils/ucc_compiler_def.h"
+#include "utils/ucc_timeline.h"
 #include "components/mc/base/ucc_mc_base.h"
 
 void ucc_tl_ucp_send_completion_cb_st(void *request, ucs_status_t status,
@@ -71,6 +72,48 @@ void ucc_tl_ucp_recv_completion_cb_mt(void *request, ucs_status_t status,
         }                                                                      \
     } while (0)
 
+/* Begins the timeline slice of a p2p request, p2p that completed at post is
+   recorded as an instant event of the task */
+#define UCC_TL_UCP_TIMELINE_P2P_POST(_name, _ucp_status, _peer, _len, _task)  \
+    UCC_TIMELINE_EVENT(UCS_PTR_IS_PTR(_ucp_status) ? UCC_TIMELINE_P2P_POST     \
+                                                   : UCC_TIMELINE_P2P_INLINE,  \
+                       (_name), UCC_TASK_LIB(_task)->log_component.name,       \
+                       UCS_PTR_IS_PTR(_ucp_status) ? (void *)(_ucp_status)     \
+                                                   : (void *)(_task),          \
+                       (_peer), (_len), (uintptr_t)(_task))
+
+/* Passes the cached registration of the task buffer to ucp, so that the
+   rendezvous protocol does not look up the buffer in the ucp cache */
+static inline void ucc_tl_ucp_task_set_memh(ucc_tl_ucp_task_t   *task,
+                                            void *buffer, size_t msglen,
+                                            ucp_request_param_t *req_param)
+{
+    ucc_tl_ucp_rcache_region_t *region;
+    int                         i;
+
+    for (i = 0; i < 2; i++) {
+        region = task->rcache_regs[i];
+        if (region && (uintptr_t)buffer >= region->super.super.start &&
+            (uintptr_t)buffer + msglen <= region->super.super.end) {
+            req_param->op_attr_mask |= UCP_OP_ATTR_FIELD_MEMH;
+            req_param->memh          = region->memh;
+            return;
+        }
+    }
+}
+
+/* Updates SEND_STATS counters, host locality needs team topo */
+static inline void ucc_tl_ucp_send_stats_add(ucc_tl_ucp_team_t *team,
+                                             ucc_rank_t dest_group_rank)
+{
+    ucc_tl_ucp_context_t *ctx = UCC_TL_UCP_TEAM_CTX(team);
+
+    ucc_atomic_add64(&ctx->send_stats.sends, 1);
+    if (team->topo && !ucc_rank_on_local_node(dest_group_rank, team->topo)) {
+        ucc_atomic_add64(&ctx->send_stats.net_sends, 1);
+    }
+}
+
 static inline ucs_status_ptr_t
 ucc_tl_ucp_send_common(void *buffer, size_t msglen, ucc_memory_type_t mtype,
                        ucc_rank_t dest_group_rank, ucc_tl_ucp_team_t *team,
@@ -81,6 +124,7 @@ ucc_tl_ucp_send_common(void *buffer, size_t msglen, ucc_memory_type_t mtype,
     ucc_status_t        status;
     ucp_ep_h            ep;
     ucp_tag_t           ucp_tag;
+    ucs_status_ptr_t    ucp_status;
 
     status = ucc_tl_ucp_get_ep(team, dest_group_rank, &ep);
     if (ucc_unlikely(UCC_OK != status)) {
@@ -96,8 +140,17 @@ ucc_tl_ucp_send_common(void *buffer, size_t msglen, ucc_memory_type_t mtype,
     req_param.cb.send     = cb;
     req_param.memory_type = ucc_memtype_to_ucs[mtype];
     req_param.user_data   = user_data;
+    if (ucc_unlikely(task->rcache_regs[0] || task->rcache_regs[1])) {
+        ucc_tl_ucp_task_set_memh(task, buffer, msglen, &req_param);
+    }
+    if (ucc_unlikely(UCC_TL_UCP_TEAM_CTX(team)->cfg.send_stats)) {
+        ucc_tl_ucp_send_stats_add(team, dest_group_rank);
+    }
     task->tagged.send_posted++;
-    return ucp_tag_send_nbx(ep, buffer, 1, ucp_tag, &req_param);
+    ucp_status = ucp_tag_send_nbx(ep, buffer, 1, ucp_tag, &req_param);
+    UCC_TL_UCP_TIMELINE_P2P_POST("send", ucp_status, dest_group_rank, msglen,
+                                 task);
+    return ucp_status;
 }
 
 static inline ucc_status_t ucc_tl_ucp_send_nb_st(void *buffer, size_t msglen,
@@ -173,6 +226,7 @@ ucc_tl_ucp_recv_common(void *buffer, size_t msglen, ucc_memory_type_t mtype,
     ucc_coll_args_t    *args = &TASK_ARGS(task);
     ucp_request_param_t req_param;
     ucp_tag_t           ucp_tag, ucp_tag_mask;
+    ucs_status_ptr_t    ucp_status;
 
     // coverity[result_independent_of_operands:FALSE]
     UCC_TL_UCP_MAKE_RECV_TAG(ucp_tag, ucp_tag_mask,
@@ -188,9 +242,15 @@ ucc_tl_ucp_recv_common(void *buffer, size_t msglen, ucc_memory_type_t mtype,
     req_param.cb.recv     = cb;
     req_param.memory_type = ucc_memtype_to_ucs[mtype];
     req_param.user_data   = user_data;
+    if (ucc_unlikely(task->rcache_regs[0] || task->rcache_regs[1])) {
+        ucc_tl_ucp_task_set_memh(task, buffer, msglen, &req_param);
+    }
     task->tagged.recv_posted++;
-    return ucp_tag_recv_nbx(team->worker->ucp_worker, buffer, 1, ucp_tag,
-                            ucp_tag_mask, &req_param);
+    ucp_status = ucp_tag_recv_nbx(team->worker->ucp_worker, buffer, 1,
+                                  ucp_tag, ucp_tag_mask, &req_param);
+    UCC_TL_UCP_TIMELINE_P2P_POST("recv", ucp_status, dest_group_rank, msglen,
+                                 task);
+    return ucp_status;
 }
 
 static inline ucc_status_t ucc_tl_ucp_recv_nb_mt(void *buffer, size_t msglen,
@@ -12,6 +12,7 @@
 #include "utils/ucc_parser.h"
 #include "utils/ucc_string.h"
 #include "coll_score/ucc_coll_score.h"
+#include "allreduce/allreduce.h"
 
 static inline ucc_status_t ucc_tl_ucp_get_topo(ucc_tl_ucp_team_t *team)
 {
@@ -291,6 +292,16 @@ ucc_status_t ucc_tl_ucp_team_get_scores(ucc_base_team_t   *tl_team,
         (status != UCC_ERR_NOT_SUPPORTED)) {
         goto err;
     }
+    if (team->cfg.allreduce_reproducible) {
+        status = ucc_coll_score_update_from_str(
+            UCC_TL_UCP_ALLREDUCE_REPRODUCIBLE_SELECT_STR, &team_info,
+            &team->super.super, score);
+        if (UCC_OK != status) {
+            tl_error(tl_team->context->lib,
+                     "failed to select reproducible allreduce");
+            goto err;
+        }
+    }
 
     for (i = 0; i < plugins->n_components; i++) {
         tlcp = ucc_derived_of(plugins->components[i],
@@ -97,14 +97,55 @@ static inline ucc_status_t sbgp_create_sn(ucc_topo_t *topo, ucc_sbgp_t *sbgp,
     return UCC_OK;
 }
 
+ucc_status_t ucc_sbgp_create_node_from_ranks(ucc_topo_t *topo,
+                                             ucc_sbgp_t *sbgp,
+                                             ucc_rank_t *local_ranks,
+                                             ucc_rank_t  node_size,
+                                             ucc_rank_t  node_rank)
+{
+    ucc_rank_t ctx_nlr = topo->node_leader_rank_id;
+    ucc_rank_t i;
+
+    ucc_assert(node_size > 0 && node_rank < node_size);
+    sbgp->group_size = node_size;
+    sbgp->group_rank = node_rank;
+    sbgp->rank_map   = local_ranks;
+    if (0 < ctx_nlr && ctx_nlr < node_size) {
+        /* Rotate local_ranks array so that node_leader_rank_id becomes first
+           in that array */
+        sbgp->rank_map = ucc_malloc(node_size * sizeof(ucc_rank_t), "rank_map");
+        if (!sbgp->rank_map) {
+            ucc_error("failed to allocate %zd bytes for rank_map array",
+                      node_size * sizeof(ucc_rank_t));
+            ucc_free(local_ranks);
+            return UCC_ERR_NO_MEMORY;
+        }
+        for (i = ctx_nlr; i < node_size; i++) {
+            sbgp->rank_map[i - ctx_nlr] = local_ranks[i];
+        }
+
+        for (i = 0; i < ctx_nlr; i++) {
+            sbgp->rank_map[node_size - ctx_nlr + i] = local_ranks[i];
+        }
+        sbgp->group_rank = (node_rank + node_size - ctx_nlr) % node_size;
+        ucc_free(local_ranks);
+    }
+    if (node_size > 1) {
+        sbgp->status = UCC_SBGP_ENABLED;
+    } else {
+        sbgp->status = UCC_SBGP_NOT_EXISTS;
+    }
+    return UCC_OK;
+}
+
 ucc_status_t ucc_sbgp_create_node(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
 {
     ucc_subset_t *set            = &topo->set;
     ucc_rank_t    group_size     = ucc_subset_size(set);
     ucc_rank_t    group_rank     = set->myrank;
     ucc_rank_t    max_local_size = 256;
-    ucc_rank_t    ctx_nlr        = topo->node_leader_rank_id;
     ucc_rank_t    node_rank = 0, node_size = 0;
+    ucc_status_t  status;
     int           i;
     ucc_rank_t   *local_ranks, *tmp;
     local_ranks =
@@ -142,35 +183,12 @@ ucc_status_t ucc_sbgp_create_node(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
         ucc_free(local_ranks);
         return UCC_ERR_NOT_FOUND;
     }
-    sbgp->group_size = node_size;
-    sbgp->group_rank = node_rank;
-    sbgp->rank_map   = local_ranks;
-    if (0 < ctx_nlr && ctx_nlr < node_size) {
-        /* Rotate local_ranks array so that node_leader_rank_id becomes first
-           in that array */
-        sbgp->rank_map = ucc_malloc(node_size * sizeof(ucc_rank_t), "rank_map");
-        if (!sbgp->rank_map) {
-            ucc_error("failed to allocate %zd bytes for rank_map array",
-                      node_size * sizeof(ucc_rank_t));
-            ucc_free(local_ranks);
-            return UCC_ERR_NO_MEMORY;
-        }
-        for (i = ctx_nlr; i < node_size; i++) {
-            sbgp->rank_map[i - ctx_nlr] = local_ranks[i];
-        }
-
-        for (i = 0; i < ctx_nlr; i++) {
-            sbgp->rank_map[node_size - ctx_nlr + i] = local_ranks[i];
-        }
-        sbgp->group_rank = (node_rank + node_size - ctx_nlr) % node_size;
-        ucc_free(local_ranks);
+    status = ucc_sbgp_create_node_from_ranks(topo, sbgp, local_ranks,
+                                             node_size, node_rank);
+    if (UCC_OK != status) {
+        return status;
     }
     topo->node_leader_rank = sbgp->rank_map[0];
-    if (node_size > 1) {
-        sbgp->status = UCC_SBGP_ENABLED;
-    } else {
-        sbgp->status = UCC_SBGP_NOT_EXISTS;
-    }
     return UCC_OK;
 }
 
@@ -452,35 +470,43 @@ static inline ucc_status_t sbgp_create_full(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
     return UCC_OK;
 }
 
-typedef struct proc_info_id {
-    ucc_proc_info_t info;
-    ucc_rank_t      id;
-} proc_info_id_t;
+typedef struct proc_order_key {
+    ucc_rank_t      host_order; /*< position of the host in the team: hosts
+                                    are ordered by their lowest team rank */
+    ucc_socket_id_t socket_id;
+    ucc_numa_id_t   numa_id;
+    ucc_rank_t      rank;
+} proc_order_key_t;
 
-static int ucc_compare_proc_info_id(const void *a, const void *b)
+static int ucc_compare_proc_order_key(const void *a, const void *b)
 {
-    const ucc_proc_info_t *d1 = &((const proc_info_id_t *)a)->info;
-    const ucc_proc_info_t *d2 = &((const proc_info_id_t *)b)->info;
-
-    if (d1->host_hash != d2->host_hash) {
-        return d1->host_hash > d2->host_hash ? 1 : -1;
-    } else if (d1->socket_id != d2->socket_id) {
-        return d1->socket_id - d2->socket_id;
-    } else if (d1->numa_id != d2->numa_id) {
-        return d1->numa_id - d2->numa_id;
-    } else {
-        return 0;
-    }
+    const proc_order_key_t *k1 = (const proc_order_key_t *)a;
+    const proc_order_key_t *k2 = (const proc_order_key_t *)b;
+
+    if (k1->host_order != k2->host_order) {
+        return k1->host_order < k2->host_order ? -1 : 1;
+    } else if (k1->socket_id != k2->socket_id) {
+        return k1->socket_id < k2->socket_id ? -1 : 1;
+    } else if (k1->numa_id != k2->numa_id) {
+        return k1->numa_id < k2->numa_id ? -1 : 1;
+    }
+    /* keep original order inside the same numa so the result is a total
+       order and is identical on all the ranks */
+    return k1->rank < k2->rank ? -1 : (k1->rank > k2->rank);
 }
 
+/* Builds the team ordering where ranks of the same host are contiguous and,
+   within a host, ranks of the same socket and numa are contiguous. Ring
+   neighbours then cross the host boundary once per host and knomial
+   subtrees of the size up to ppn stay host local. */
 static ucc_status_t sbgp_create_full_ordered(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
 {
-    ucc_rank_t       gsize = ucc_subset_size(&topo->set);
-    ucc_proc_info_t *pinfo = topo->topo->procs;
-    ucc_host_id_t   *visited;
-    proc_info_id_t  *sorted;
-    ucc_rank_t       i, j, num_visited;
-    int              is_sorted, d;
+    ucc_rank_t        gsize  = ucc_subset_size(&topo->set);
+    ucc_rank_t        nnodes = topo->topo->nnodes;
+    ucc_proc_info_t  *pinfo;
+    ucc_rank_t       *host_order;
+    proc_order_key_t *keys;
+    ucc_rank_t        i, n_hosts;
 
     ucc_assert(gsize > 0);
     sbgp->status     = UCC_SBGP_ENABLED;
@@ -493,79 +519,49 @@ static ucc_status_t sbgp_create_full_ordered(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
         return UCC_ERR_NO_MEMORY;
     }
 
-    visited = (ucc_host_id_t *)ucc_malloc(gsize * sizeof(ucc_host_id_t),
-                                          "visited host");
-    if (ucc_unlikely(!visited)) {
-        ucc_error("failed to allocate %zd bytes for list of visited nodes",
-                  gsize * sizeof(ucc_host_id_t));
+    host_order = ucc_malloc(nnodes * sizeof(ucc_rank_t), "host_order");
+    if (ucc_unlikely(!host_order)) {
+        ucc_error("failed to allocate %zd bytes for host order",
+                  nnodes * sizeof(ucc_rank_t));
         ucc_free(sbgp->rank_map);
         return UCC_ERR_NO_MEMORY;
     }
 
-    is_sorted   = 1;
-    num_visited = 1;
-    visited[0] = pinfo[0].host_hash;
-    for (i = 1; i < gsize; i++) {
-        if (pinfo[i].host_hash != pinfo[i-1].host_hash) {
-            /* check if we saw that host_has before*/
-            for (j = 0; j < num_visited; j++) {
-                if (visited[j] == pinfo[i].host_hash) {
-                    break;
-                }
-            }
-            if (j < num_visited) {
-                /* this host was present already, ranks are not ordered */
-                is_sorted = 0;
-                break;
-            }
-            /* add new host to the list of visited */
-            visited[num_visited++] = pinfo[i].host_hash;
-        } else {
-            d = ucc_compare_proc_info_id(&pinfo[i - 1].host_hash,
-                                         &pinfo[i].host_hash);
-
-            if (d > 0) {
-                is_sorted = 0;
-                break;
-            }
-        }
-    }
-    ucc_free(visited);
-
-    if (is_sorted) {
-        for (i = 0; i < gsize; i++) {
-            sbgp->rank_map[i] = i;
-        }
-        return UCC_OK;
-    }
-
-    sorted = (proc_info_id_t *)ucc_malloc(gsize * sizeof(proc_info_id_t),
-                                          "proc_sorted");
-    if (ucc_unlikely(!sorted)) {
-        ucc_error("failed to allocate %zd bytes for sorted proc info",
-                  gsize * sizeof(proc_info_id_t));
+    keys = ucc_malloc(gsize * sizeof(proc_order_key_t), "proc_order_keys");
+    if (ucc_unlikely(!keys)) {
+        ucc_error("failed to allocate %zd bytes for proc order keys",
+                  gsize * sizeof(proc_order_key_t));
+        ucc_free(host_order);
         ucc_free(sbgp->rank_map);
         return UCC_ERR_NO_MEMORY;
     }
 
+    for (i = 0; i < nnodes; i++) {
+        host_order[i] = UCC_RANK_INVALID;
+    }
+    n_hosts = 0;
     for (i = 0; i < gsize; i++) {
-        sorted[i].info = topo->topo->procs[i];
-        sorted[i].id   = i;
+        pinfo = &topo->topo->procs[ucc_ep_map_eval(topo->set.map, i)];
+        if (host_order[pinfo->host_id] == UCC_RANK_INVALID) {
+            host_order[pinfo->host_id] = n_hosts++;
+        }
+        keys[i].host_order = host_order[pinfo->host_id];
+        keys[i].socket_id  = pinfo->socket_id;
+        keys[i].numa_id    = pinfo->numa_id;
+        keys[i].rank       = i;
     }
+    ucc_free(host_order);
 
-    qsort(sorted, gsize, sizeof(proc_info_id_t), ucc_compare_proc_info_id);
+    qsort(keys, gsize, sizeof(proc_order_key_t), ucc_compare_proc_order_key);
     for (i = 0; i < gsize; i++) {
-        if (sorted[i].id == topo->set.myrank) {
+        if (keys[i].rank == topo->set.myrank) {
             sbgp->group_rank = i;
         }
-        sbgp->rank_map[i] = sorted[i].id;
+        sbgp->rank_map[i] = keys[i].rank;
     }
-
-    /*TODO: try to detect map by numa,socket,node and use UCC_EP_MAP_CB to save
-     *      memory
-     */
-
-    ucc_free(sorted);
+    /* identity ordering is detected by ucc_ep_map_from_array and converted
+       to full map */
+    ucc_free(keys);
     return UCC_OK;
 }
 
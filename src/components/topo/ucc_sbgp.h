@@ -88,6 +88,15 @@ ucc_status_t ucc_sbgp_create_all_numas(ucc_topo_t *topo, ucc_sbgp_t **sbgps,
 
 ucc_status_t ucc_sbgp_create_node(ucc_topo_t *topo, ucc_sbgp_t *sbgp);
 
+/* Initializes node sbgp from the team ranks of the node given in increasing
+   order, node_rank is the position of the group rank in local_ranks. Takes
+   ownership of local_ranks. */
+ucc_status_t ucc_sbgp_create_node_from_ranks(ucc_topo_t *topo,
+                                             ucc_sbgp_t *sbgp,
+                                             ucc_rank_t *local_ranks,
+                                             ucc_rank_t  node_size,
+                                             ucc_rank_t  node_rank);
+
 static inline ucc_subset_t ucc_sbgp_to_subset(ucc_sbgp_t *sbgp)
 {
     ucc_subset_t s = {
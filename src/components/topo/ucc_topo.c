@@ -12,85 +12,70 @@
 #include <string.h>
 #include <limits.h>
 
-static int ucc_compare_proc_info(const void *a, const void *b)
+typedef struct ucc_topo_host_key {
+    ucc_host_id_t host_hash;
+    ucc_rank_t    rank;
+} ucc_topo_host_key_t;
+
+static int ucc_compare_host_key(const void *a, const void *b)
 {
-    const ucc_proc_info_t *d1 = (const ucc_proc_info_t *)a;
-    const ucc_proc_info_t *d2 = (const ucc_proc_info_t *)b;
-
-    if (d1->host_hash != d2->host_hash) {
-        return d1->host_hash > d2->host_hash ? 1 : -1;
-    } else if (d1->socket_id != d2->socket_id) {
-        return d1->socket_id - d2->socket_id;
-    } else if (d1->numa_id != d2->numa_id) {
-        return d1->numa_id - d2->numa_id;
-    } else {
-        return d1->pid - d2->pid;
+    const ucc_topo_host_key_t *k1 = (const ucc_topo_host_key_t *)a;
+    const ucc_topo_host_key_t *k2 = (const ucc_topo_host_key_t *)b;
+
+    if (k1->host_hash != k2->host_hash) {
+        return k1->host_hash > k2->host_hash ? 1 : -1;
     }
+    return k1->rank < k2->rank ? -1 : (k1->rank > k2->rank);
 }
 
+/* Procs are sorted by host hash once, host ids are then assigned in a single
+   pass over the sorted array in the order of host hashes */
 static ucc_status_t ucc_context_topo_compute_layout(ucc_context_topo_t *topo,
                                                     ucc_rank_t          size)
 {
-    ucc_rank_t       current_ppn = 1;
-    ucc_rank_t       min_ppn     = UCC_RANK_MAX;
-    ucc_rank_t       max_ppn     = 0;
-    ucc_rank_t       nnodes      = 1;
-    int              max_sockid  = 0;
-    int              max_numaid  = 0;
-    ucc_proc_info_t *sorted;
-    ucc_host_id_t    current_hash, hash;
-    int              i, j;
-
-    sorted = (ucc_proc_info_t *)ucc_malloc(size * sizeof(ucc_proc_info_t),
-                                           "proc_sorted");
-    if (!sorted) {
-        ucc_error("failed to allocate %zd bytes for proc sorted",
-                  size * sizeof(ucc_proc_info_t));
+    ucc_rank_t           current_ppn = 0;
+    ucc_rank_t           min_ppn     = UCC_RANK_MAX;
+    ucc_rank_t           max_ppn     = 0;
+    ucc_rank_t           nnodes      = 0;
+    int                  max_sockid  = 0;
+    int                  max_numaid  = 0;
+    ucc_topo_host_key_t *keys;
+    ucc_rank_t           i;
+
+    keys = (ucc_topo_host_key_t *)ucc_malloc(size * sizeof(*keys),
+                                             "topo_host_keys");
+    if (!keys) {
+        ucc_error("failed to allocate %zd bytes for topo host keys",
+                  size * sizeof(*keys));
         return UCC_ERR_NO_MEMORY;
     }
-    memcpy(sorted, topo->procs, size * sizeof(ucc_proc_info_t));
-    qsort(sorted, size, sizeof(ucc_proc_info_t), ucc_compare_proc_info);
-    current_hash = sorted[0].host_hash;
-
-    for (i = 1; i < size; i++) {
-        hash = sorted[i].host_hash;
-        if (hash != current_hash) {
-            for (j = 0; j < size; j++) {
-                if (topo->procs[j].host_hash == current_hash) {
-                    topo->procs[j].host_id = nnodes - 1;
-                }
-            }
-            if (current_ppn > max_ppn)
-                max_ppn = current_ppn;
-            if (current_ppn < min_ppn)
-                min_ppn = current_ppn;
-            nnodes++;
-            current_hash = hash;
-            current_ppn  = 1;
-        } else {
-            current_ppn++;
-        }
-    }
-    for (j = 0; j < size; j++) {
-        if (topo->procs[j].socket_id > max_sockid) {
-            max_sockid = topo->procs[j].socket_id;
-        }
-        if (topo->procs[j].numa_id > max_numaid) {
-            max_numaid = topo->procs[j].numa_id;
+    for (i = 0; i < size; i++) {
+        keys[i].host_hash = topo->procs[i].host_hash;
+        keys[i].rank      = i;
+        if (topo->procs[i].socket_id > max_sockid) {
+            max_sockid = topo->procs[i].socket_id;
         }
-        if (topo->procs[j].host_hash == current_hash) {
-            topo->procs[j].host_id = nnodes - 1;
+        if (topo->procs[i].numa_id > max_numaid) {
+            max_numaid = topo->procs[i].numa_id;
         }
     }
+    qsort(keys, size, sizeof(*keys), ucc_compare_host_key);
 
-    if (current_ppn > max_ppn) {
-        max_ppn = current_ppn;
-    }
-    if (current_ppn < min_ppn) {
-        min_ppn = current_ppn;
+    for (i = 0; i < size; i++) {
+        if (i > 0 && keys[i].host_hash != keys[i - 1].host_hash) {
+            min_ppn     = ucc_min(min_ppn, current_ppn);
+            max_ppn     = ucc_max(max_ppn, current_ppn);
+            current_ppn = 0;
+            nnodes++;
+        }
+        topo->procs[keys[i].rank].host_id = nnodes;
+        current_ppn++;
     }
+    min_ppn = ucc_min(min_ppn, current_ppn);
+    max_ppn = ucc_max(max_ppn, current_ppn);
+    nnodes++;
 
-    ucc_free(sorted);
+    ucc_free(keys);
 
     topo->nnodes        = nnodes;
     topo->min_ppn       = min_ppn;
@@ -285,18 +270,32 @@ ucc_status_t ucc_topo_get_all_numas(ucc_topo_t *topo, ucc_sbgp_t **sbgps,
     return status;
 }
 
+static inline ucc_host_id_t ucc_topo_rank_host_id(ucc_topo_t *topo,
+                                                  ucc_rank_t  rank)
+{
+    return topo->topo->procs[ucc_ep_map_eval(topo->set.map, rank)].host_id;
+}
+
 /* Returns invalid param if there's only one node in the team (leader sbgp does
    not exist). Otherwise, creates a node sbgp for every node. One or more sbgps
-   may be UCC_SBGP_NOT_EXISTS if they have only one rank */
+   may be UCC_SBGP_NOT_EXISTS if they have only one rank.
+   Team ranks are bucketed by host id in one pass, so the cost is linear in
+   the team size and does not depend on the number of nodes. */
 ucc_status_t ucc_sbgp_create_all_nodes(ucc_topo_t *topo, ucc_sbgp_t **_sbgps,
                                       int *n_sbgps)
 {
-    ucc_rank_t   myrank      = topo->set.myrank;
-    ucc_rank_t   leader_rank = UCC_RANK_INVALID;
-    ucc_sbgp_t  *sbgps, *leader_sbgp;
-    ucc_rank_t   i;
-    ucc_status_t status;
-    ucc_rank_t   nnodes;
+    ucc_rank_t    size        = ucc_subset_size(&topo->set);
+    ucc_rank_t    ctx_nnodes  = topo->topo->nnodes;
+    ucc_host_id_t my_host     = ucc_topo_rank_host_id(topo, topo->set.myrank);
+    ucc_rank_t    leader_rank = UCC_RANK_INVALID;
+    ucc_rank_t   *first       = NULL;
+    ucc_rank_t   *ranks       = NULL;
+    ucc_rank_t   *local_ranks;
+    ucc_sbgp_t   *sbgps, *leader_sbgp;
+    ucc_rank_t    i, j, ldr, node_size, node_rank;
+    ucc_host_id_t host;
+    ucc_status_t  status;
+    ucc_rank_t    nnodes;
 
     leader_sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_NODE_LEADERS);
 
@@ -315,50 +314,83 @@ ucc_status_t ucc_sbgp_create_all_nodes(ucc_topo_t *topo, ucc_sbgp_t **_sbgps,
                   nnodes * sizeof(ucc_sbgp_t));
         return UCC_ERR_NO_MEMORY;
     }
+    first = ucc_calloc(ctx_nnodes + 1, sizeof(ucc_rank_t), "node_first");
+    ranks = ucc_malloc(size * sizeof(ucc_rank_t), "node_ranks");
+    if (!first || !ranks) {
+        ucc_error("failed to allocate %zd bytes for node ranks",
+                  (ctx_nnodes + 1 + size) * sizeof(ucc_rank_t));
+        status = UCC_ERR_NO_MEMORY;
+        goto error;
+    }
+
+    /* ranks of host h are ranks[first[h]..first[h + 1]) in team order */
+    for (i = 0; i < size; i++) {
+        first[ucc_topo_rank_host_id(topo, i)]++;
+    }
+    for (i = 1; i <= ctx_nnodes; i++) {
+        first[i] += first[i - 1];
+    }
+    for (i = size; i-- > 0;) {
+        ranks[--first[ucc_topo_rank_host_id(topo, i)]] = i;
+    }
 
     for (i = 0; i < nnodes; i++) {
-        ucc_rank_t ldr_team_rank = ucc_ep_map_eval(leader_sbgp->map, i);
-        topo->set.myrank = ldr_team_rank;
-        if (ucc_rank_on_local_node(myrank, topo)) {
-            leader_rank = topo->node_leader_rank;
+        ldr         = ucc_ep_map_eval(leader_sbgp->map, i);
+        host        = ucc_topo_rank_host_id(topo, ldr);
+        node_size   = first[host + 1] - first[host];
+        node_rank   = 0;
+        local_ranks = ucc_malloc(node_size * sizeof(ucc_rank_t),
+                                 "local_ranks");
+        if (!local_ranks) {
+            ucc_error("failed to allocate %zd bytes for local_ranks array",
+                      node_size * sizeof(ucc_rank_t));
+            status = UCC_ERR_NO_MEMORY;
+            goto error;
+        }
+        for (j = 0; j < node_size; j++) {
+            local_ranks[j] = ranks[first[host] + j];
+            if (local_ranks[j] == ldr) {
+                node_rank = j;
+            }
         }
-        status = ucc_sbgp_create_node(topo, &sbgps[i]);
-        if (status == UCC_ERR_NOT_FOUND) {
-            /* ucc_sbgp_create_node returned because 0 == node_size */
-            sbgps[i].status = UCC_SBGP_NOT_EXISTS;
-            continue;
-        } else if (status != UCC_OK) {
+        sbgps[i].type = UCC_SBGP_NODE;
+        status = ucc_sbgp_create_node_from_ranks(topo, &sbgps[i], local_ranks,
+                                                 node_size, node_rank);
+        if (status != UCC_OK) {
             ucc_error("failed to create all_node subgroup %d", i);
             goto error;
         }
-        if (sbgps[i].rank_map && sbgps[i].type != UCC_SBGP_FULL) {
-            sbgps[i].map = ucc_ep_map_from_array(
-                                &sbgps[i].rank_map, sbgps[i].group_size,
-                                ucc_subset_size(&topo->set), 1);
+        if (host == my_host) {
+            leader_rank = sbgps[i].rank_map[0];
         }
-        if (sbgps[i].rank_map && sbgps[i].status == UCC_SBGP_NOT_EXISTS) {
+        if (sbgps[i].status == UCC_SBGP_NOT_EXISTS) {
             ucc_free(sbgps[i].rank_map);
+            sbgps[i].rank_map = NULL;
+        } else {
+            sbgps[i].map = ucc_ep_map_from_array(
+                                &sbgps[i].rank_map, sbgps[i].group_size,
+                                size, 1);
         }
     }
 
-    /* Reset myrank and node_leader_rank because the calls to
-       ucc_sbgp_create_node above will have changed them */
-    topo->set.myrank = myrank;
     ucc_assert(leader_rank != UCC_RANK_INVALID);
     topo->node_leader_rank = leader_rank;
+    ucc_free(first);
+    ucc_free(ranks);
 
     *_sbgps  = sbgps;
     *n_sbgps = nnodes;
 
     return UCC_OK;
 error:
-    topo->set.myrank = myrank;
     for (i = 0; i < nnodes; i++) {
         if (sbgps[i].rank_map) {
             ucc_free(sbgps[i].rank_map);
         }
     }
     ucc_free(sbgps);
+    ucc_free(first);
+    ucc_free(ranks);
     return status;
 }
 
@@ -76,9 +76,9 @@ typedef struct ucc_topo {
 
 /* Initializes ctx level topo structure using addr_storage.
    Each address contains ucc_proc_info_t which is extracted and placed
-   into array for each participating proc. The array is then sorted
-   (see ucc_compare_proc_info in ucc_topo.c) that allows O(N) local
-   subgroup discoveries */
+   into array for each participating proc. Host ids are assigned after a
+   single sort of the procs by host hash, so the cost is O(N log N)
+   regardless of the number of nodes */
 ucc_status_t ucc_context_topo_init(ucc_addr_storage_t * storage,
                                    ucc_context_topo_t **topo);
 void         ucc_context_topo_cleanup(ucc_context_topo_t *topo);
@@ -294,6 +294,11 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_init,
     ucc_assert(task->super.status == UCC_OPERATION_INITIALIZED);
 
 print_trace:
+    if (ucc_global_config.telemetry) {
+        task->flags            |= UCC_COLL_TASK_FLAG_TELEMETRY;
+        task->telemetry_bucket  = ucc_telemetry_msg_bucket(
+            &task->bargs.args, team->rank, team->size);
+    }
     *request = &task->super;
     if (ucc_unlikely(ucc_global_config.coll_trace.log_level >=
                      UCC_LOG_LEVEL_DIAG)) {
@@ -339,6 +344,31 @@ free_scratch:
         }                                                               \
     } while(0)
 
+ucc_status_t ucc_collective_post_prologue(ucc_coll_task_t *task)
+{
+    ucc_status_t status;
+
+    if (task->bargs.asymmetric_save_info.scratch != NULL &&
+        (task->bargs.args.coll_type == UCC_COLL_TYPE_SCATTER ||
+         task->bargs.args.coll_type == UCC_COLL_TYPE_SCATTERV)) {
+        status = ucc_copy_asymmetric_buffer(task);
+        if (status != UCC_OK) {
+            ucc_error("failure copying in asymmetric buffer: %s",
+                        ucc_status_string(status));
+            return status;
+        }
+    }
+
+    COLL_POST_STATUS_CHECK(task);
+    if (UCC_COLL_TIMEOUT_REQUIRED(task)) {
+        task->start_time = ucc_get_time();
+    }
+    if (task->flags & UCC_COLL_TASK_FLAG_TELEMETRY) {
+        task->telemetry_ts = ucc_telemetry_timestamp();
+    }
+    return UCC_OK;
+}
+
 UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_post, (request),
                       ucc_coll_req_h request)
 {
@@ -361,22 +391,17 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_post, (request),
         }
     }
 
-    if (task->bargs.asymmetric_save_info.scratch != NULL &&
-        (task->bargs.args.coll_type == UCC_COLL_TYPE_SCATTER ||
-         task->bargs.args.coll_type == UCC_COLL_TYPE_SCATTERV)) {
-        status = ucc_copy_asymmetric_buffer(task);
-        if (status != UCC_OK) {
-            ucc_error("failure copying in asymmetric buffer: %s",
-                        ucc_status_string(status));
+    status = ucc_collective_post_prologue(task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    if (ucc_unlikely(task->bargs.team->fusion.active)) {
+        status = ucc_coll_fusion_add(task);
+        if (status != UCC_ERR_NOT_SUPPORTED) {
             return status;
         }
     }
 
-    COLL_POST_STATUS_CHECK(task);
-    if (UCC_COLL_TIMEOUT_REQUIRED(task)) {
-        task->start_time = ucc_get_time();
-    }
-
     if (task->flags & UCC_COLL_TASK_FLAG_EXECUTOR) {
         status = ucc_ee_executor_start(task->executor, NULL);
         if (ucc_unlikely(status != UCC_OK)) {
@@ -384,6 +409,7 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_post, (request),
                       ucc_status_string(status));
         }
     }
+    UCC_TASK_TIMELINE_POST(task);
     return task->post(task);
 }
 
@@ -412,6 +438,9 @@ ucc_status_t ucc_collective_triggered_post(ucc_ee_h ee, ucc_ev_t *ev)
     if (UCC_COLL_TIMEOUT_REQUIRED(task)) {
         task->start_time = ucc_get_time();
     }
+    if (task->flags & UCC_COLL_TASK_FLAG_TELEMETRY) {
+        task->telemetry_ts = ucc_telemetry_timestamp();
+    }
     return task->triggered_post(ee, ev, task);
 }
 
@@ -500,7 +529,12 @@ static ucc_status_t ucc_trigger_complete(ucc_coll_task_t *parent_task,
         task->flags |= (UCC_COLL_TASK_FLAG_EXECUTOR_STOP |
                         UCC_COLL_TASK_FLAG_EXECUTOR_DESTROY);
     }
+    if (task->ee->ee_type == UCC_EE_CPU_THREAD) {
+        /* no stream to order on, completion is signaled on the ee */
+        task->flags |= UCC_COLL_TASK_FLAG_EE_COMPLETE_EVENT;
+    }
 
+    UCC_TASK_TIMELINE_POST(task);
     status = task->post(task);
     if (ucc_unlikely(status != UCC_OK)) {
         ucc_error("failed to post triggered coll, task %p, seq_num %u, %s",
@@ -525,10 +559,12 @@ static void ucc_trigger_test(ucc_coll_task_t *task)
         } else if (UCC_OK == ucc_ee_get_event_internal(task->ee, &ev,
                                                  &task->ee->event_in_queue)) {
             ucc_trace("triggered event arrived, ev_task %p", task);
-            task->ev       = ev;
+            /* event is consumed, only the fact of arrival is kept */
+            ucc_ee_ack_event(task->ee, ev);
+            task->ev       = (ucc_ev_t *) 0xFFFF; /* dummy event */
             task->executor = NULL;
         } else {
-            task->status = UCC_OK;
+            /* keep waiting for the event set by ucc_ee_set_event */
             return;
         }
     }
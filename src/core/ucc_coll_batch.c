@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_team.h"
+#include "ucc_context.h"
+#include "components/cl/ucc_cl.h"
+#include "components/ec/ucc_ec.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_log.h"
+#include "utils/ucc_coll_utils.h"
+#include "schedule/ucc_schedule.h"
+#include "ucc_service_coll.h"
+
+/* Schedule can hold up to UCC_SCHEDULE_MAX_TASKS tasks, larger batches
+   are split into groups, each group is a schedule of the batch */
+#define UCC_COLL_BATCH_MAX_COLLS                                               \
+    (UCC_SCHEDULE_MAX_TASKS * UCC_SCHEDULE_MAX_TASKS)
+
+typedef struct ucc_coll_batch {
+    ucc_schedule_t    super;
+    ucc_schedule_t   *groups;
+    uint32_t          n_groups;
+    uint32_t          n_colls;
+    ucc_coll_task_t **colls;
+} ucc_coll_batch_t;
+
+static ucc_status_t ucc_coll_batch_post(ucc_coll_task_t *task)
+{
+    ucc_coll_batch_t *batch = ucc_derived_of(task, ucc_coll_batch_t);
+    ucc_status_t      status;
+    int               i;
+
+    /* collectives are started by the schedule, not by ucc_collective_post,
+       so its checks, timestamps and executor start are done here */
+    for (i = 0; i < batch->n_colls; i++) {
+        status = ucc_collective_post_prologue(batch->colls[i]);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+        if (batch->colls[i]->flags & UCC_COLL_TASK_FLAG_EXECUTOR) {
+            status = ucc_ee_executor_start(batch->colls[i]->executor, NULL);
+            if (ucc_unlikely(status != UCC_OK)) {
+                ucc_error("failed to start executor: %s",
+                          ucc_status_string(status));
+                return status;
+            }
+        }
+    }
+    return ucc_schedule_start(task);
+}
+
+static ucc_status_t ucc_coll_batch_finalize(ucc_coll_task_t *task)
+{
+    ucc_coll_batch_t *batch          = ucc_derived_of(task, ucc_coll_batch_t);
+    ucc_status_t      status_overall = UCC_OK;
+    ucc_status_t      status;
+    int               i;
+
+    for (i = 0; i < batch->n_colls; i++) {
+        status = ucc_collective_finalize_internal(batch->colls[i]);
+        if (ucc_unlikely(status != UCC_OK)) {
+            status_overall = status;
+        }
+    }
+    for (i = 0; i < batch->n_groups; i++) {
+        ucc_coll_task_destruct(&batch->groups[i].super);
+    }
+    ucc_coll_task_destruct(&batch->super.super);
+    ucc_free(batch->groups);
+    ucc_free(batch->colls);
+    ucc_free(batch);
+    return status_overall;
+}
+
+static ucc_status_t ucc_coll_batch_add(ucc_schedule_t  *schedule,
+                                       ucc_coll_task_t *task)
+{
+    ucc_status_t status;
+
+    status = ucc_schedule_add_task(schedule, task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    /* executors stay owned by the collectives, see ucc_coll_batch_post */
+    schedule->super.flags &= ~UCC_COLL_TASK_FLAG_EXECUTOR;
+    return ucc_event_manager_subscribe(&schedule->super,
+                                       UCC_EVENT_SCHEDULE_STARTED, task,
+                                       ucc_task_start_handler);
+}
+
+static ucc_status_t ucc_coll_batch_build(ucc_coll_batch_t *batch)
+{
+    ucc_base_team_t *team = batch->super.super.team;
+    ucc_status_t     status;
+    ucc_schedule_t  *group;
+    int              i;
+
+    if (batch->n_colls <= UCC_SCHEDULE_MAX_TASKS) {
+        for (i = 0; i < batch->n_colls; i++) {
+            status = ucc_coll_batch_add(&batch->super, batch->colls[i]);
+            if (ucc_unlikely(status != UCC_OK)) {
+                return status;
+            }
+        }
+        return UCC_OK;
+    }
+
+    batch->n_groups = ucc_div_round_up(batch->n_colls, UCC_SCHEDULE_MAX_TASKS);
+    batch->groups   = ucc_calloc(batch->n_groups, sizeof(*batch->groups),
+                                 "batch_groups");
+    if (!batch->groups) {
+        ucc_error("failed to allocate %zd bytes for batch groups",
+                  batch->n_groups * sizeof(*batch->groups));
+        batch->n_groups = 0;
+        return UCC_ERR_NO_MEMORY;
+    }
+    for (i = 0; i < batch->n_groups; i++) {
+        ucc_coll_task_construct(&batch->groups[i].super);
+    }
+    for (i = 0; i < batch->n_colls; i++) {
+        group = &batch->groups[i / UCC_SCHEDULE_MAX_TASKS];
+        if (i % UCC_SCHEDULE_MAX_TASKS == 0) {
+            status = ucc_schedule_init(group, &batch->super.super.bargs, team);
+            if (ucc_unlikely(status != UCC_OK)) {
+                return status;
+            }
+            group->super.post     = ucc_schedule_start;
+            group->super.finalize = NULL;
+            status = ucc_coll_batch_add(&batch->super, &group->super);
+            if (ucc_unlikely(status != UCC_OK)) {
+                return status;
+            }
+        }
+        status = ucc_coll_batch_add(group, batch->colls[i]);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_collective_init_batch(ucc_coll_args_t *coll_args,
+                                       ucc_team_h *teams, uint32_t n_colls,
+                                       ucc_coll_req_h *request)
+{
+    ucc_base_coll_args_t bargs;
+    ucc_coll_batch_t    *batch;
+    ucc_coll_req_h       req;
+    ucc_status_t         status;
+    int                  persistent;
+    int                  i;
+
+    if (n_colls == 0 || n_colls > UCC_COLL_BATCH_MAX_COLLS) {
+        ucc_error("invalid number of collectives in batch %u, max %d",
+                  n_colls, UCC_COLL_BATCH_MAX_COLLS);
+        return UCC_ERR_INVALID_PARAM;
+    }
+    batch = ucc_calloc(1, sizeof(*batch), "coll_batch");
+    if (!batch) {
+        ucc_error("failed to allocate %zd bytes for collective batch",
+                  sizeof(*batch));
+        return UCC_ERR_NO_MEMORY;
+    }
+    batch->colls = ucc_calloc(n_colls, sizeof(*batch->colls), "batch_colls");
+    if (!batch->colls) {
+        ucc_error("failed to allocate %zd bytes for batch collectives",
+                  n_colls * sizeof(*batch->colls));
+        ucc_free(batch);
+        return UCC_ERR_NO_MEMORY;
+    }
+    ucc_coll_task_construct(&batch->super.super);
+
+    persistent = 1;
+    for (i = 0; i < n_colls; i++) {
+        status = ucc_collective_init(&coll_args[i], &req, teams[i]);
+        if (ucc_unlikely(status != UCC_OK)) {
+            ucc_debug("failed to init collective %d of batch: %s", i,
+                      ucc_status_string(status));
+            goto err_colls;
+        }
+        batch->colls[batch->n_colls++] = ucc_derived_of(req, ucc_coll_task_t);
+        persistent = persistent && UCC_IS_PERSISTENT(coll_args[i]);
+    }
+
+    memset(&bargs, 0, sizeof(bargs));
+    bargs.team           = teams[0];
+    bargs.args.coll_type = coll_args[0].coll_type;
+    if (persistent) {
+        bargs.args.mask  = UCC_COLL_ARGS_FIELD_FLAGS;
+        bargs.args.flags = UCC_COLL_ARGS_FLAG_PERSISTENT;
+    }
+    /* any CL team of the first team, schedule only needs the context */
+    status = ucc_schedule_init(&batch->super, &bargs,
+                               &teams[0]->cl_teams[0]->super);
+    if (ucc_unlikely(status != UCC_OK)) {
+        goto err_colls;
+    }
+    batch->super.super.post     = ucc_coll_batch_post;
+    batch->super.super.finalize = ucc_coll_batch_finalize;
+    batch->super.super.flags   |= UCC_COLL_TASK_FLAG_TOP_LEVEL |
+                                  UCC_COLL_TASK_FLAG_BATCH;
+    status = ucc_coll_batch_build(batch);
+    if (ucc_unlikely(status != UCC_OK)) {
+        ucc_error("failed to build schedule of collective batch: %s",
+                  ucc_status_string(status));
+        ucc_coll_batch_finalize(&batch->super.super);
+        return status;
+    }
+    batch->super.super.seq_num = batch->colls[0]->seq_num;
+    ucc_coll_trace_debug("coll_init_batch: req %p, %u collectives", batch,
+                         n_colls);
+    *request = &batch->super.super.super;
+    return UCC_OK;
+
+err_colls:
+    for (i = 0; i < batch->n_colls; i++) {
+        ucc_collective_finalize_internal(batch->colls[i]);
+    }
+    ucc_coll_task_destruct(&batch->super.super);
+    ucc_free(batch->colls);
+    ucc_free(batch);
+    return status;
+}
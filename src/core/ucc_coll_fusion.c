@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "ucc_coll_fusion.h"
+#include "ucc_team.h"
+#include "ucc_context.h"
+#include "ucc_dt.h"
+#include "schedule/ucc_schedule.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_log.h"
+#include "utils/ucc_coll_utils.h"
+
+typedef struct ucc_coll_fusion_batch {
+    ucc_list_link_t list_elem;
+    ucc_list_link_t members;
+    ucc_coll_req_h  req;
+    void           *buffer;
+    volatile int    completed;
+} ucc_coll_fusion_batch_t;
+
+void ucc_coll_fusion_init(ucc_coll_fusion_t *fusion)
+{
+    memset(fusion, 0, sizeof(*fusion));
+    ucc_list_head_init(&fusion->pending);
+    ucc_list_head_init(&fusion->batches);
+}
+
+static inline size_t ucc_coll_fusion_task_bytes(ucc_coll_task_t *task)
+{
+    ucc_coll_args_t *args = &task->bargs.args;
+
+    return args->dst.info.count * ucc_dt_size(args->dst.info.datatype);
+}
+
+static int ucc_coll_fusion_eligible(ucc_coll_task_t                *task,
+                                    const ucc_coll_fusion_config_t *cfg)
+{
+    ucc_coll_args_t *args = &task->bargs.args;
+
+    if ((task->flags & UCC_COLL_TASK_FLAG_BATCH) ||
+        args->coll_type != UCC_COLL_TYPE_ALLREDUCE ||
+        (args->mask & UCC_COLL_ARGS_FIELD_ACTIVE_SET) ||
+        UCC_IS_PERSISTENT(*args) || UCC_COLL_TIMEOUT_REQUIRED(task) ||
+        ((args->mask & UCC_COLL_ARGS_FIELD_FLAGS) &&
+         (args->flags & UCC_COLL_ARGS_FLAG_MEM_MAPPED_BUFFERS)) ||
+        !UCC_DT_IS_PREDEFINED(args->dst.info.datatype) ||
+        args->dst.info.mem_type != UCC_MEMORY_TYPE_HOST ||
+        (!UCC_IS_INPLACE(*args) &&
+         args->src.info.mem_type != UCC_MEMORY_TYPE_HOST)) {
+        return 0;
+    }
+    return ucc_coll_fusion_task_bytes(task) <= cfg->max_msgsize;
+}
+
+/* Completes the task that was never posted to the transport */
+static void ucc_coll_fusion_complete_member(ucc_coll_task_t *task,
+                                            ucc_status_t     status)
+{
+    /* executor of the deferred task was not started */
+    task->flags  &= ~UCC_COLL_TASK_FLAG_EXECUTOR_STOP;
+    task->status  = status;
+    ucc_task_complete(task);
+}
+
+static void ucc_coll_fusion_batch_cb(void *data, ucc_status_t status)
+{
+    ucc_coll_fusion_batch_t *batch  = data;
+    size_t                   offset = 0;
+    ucc_coll_task_t         *task, *tmp;
+    size_t                   bytes;
+
+    ucc_list_for_each_safe(task, tmp, &batch->members, list_elem) {
+        bytes = ucc_coll_fusion_task_bytes(task);
+        if (ucc_likely(status == UCC_OK)) {
+            memcpy(task->bargs.args.dst.info.buffer,
+                   PTR_OFFSET(batch->buffer, offset), bytes);
+        }
+        offset += bytes;
+        ucc_list_del(&task->list_elem);
+        ucc_coll_fusion_complete_member(task, status);
+    }
+    batch->completed = 1;
+}
+
+static void ucc_coll_fusion_batch_free(ucc_coll_fusion_batch_t *batch)
+{
+    if (batch->req) {
+        ucc_collective_finalize(batch->req);
+    }
+    ucc_free(batch->buffer);
+    ucc_free(batch);
+}
+
+/* Releases the fused collectives whose members are all completed */
+static void ucc_coll_fusion_reap(ucc_coll_fusion_t *fusion)
+{
+    ucc_coll_fusion_batch_t *batch, *tmp;
+
+    ucc_list_for_each_safe(batch, tmp, &fusion->batches, list_elem) {
+        if (batch->completed) {
+            ucc_list_del(&batch->list_elem);
+            ucc_coll_fusion_batch_free(batch);
+        }
+    }
+}
+
+static ucc_status_t ucc_coll_fusion_post_batch(ucc_team_t              *team,
+                                               ucc_coll_fusion_batch_t *batch)
+{
+    ucc_coll_fusion_t *fusion = &team->fusion;
+    ucc_coll_args_t    args;
+    ucc_coll_task_t   *task;
+    size_t             offset;
+    ucc_status_t       status;
+
+    batch->buffer = ucc_malloc(fusion->bytes, "fusion_buffer");
+    if (!batch->buffer) {
+        ucc_error("failed to allocate %zd bytes for fusion buffer",
+                  fusion->bytes);
+        return UCC_ERR_NO_MEMORY;
+    }
+    offset = 0;
+    ucc_list_for_each(task, &batch->members, list_elem) {
+        memcpy(PTR_OFFSET(batch->buffer, offset),
+               UCC_IS_INPLACE(task->bargs.args)
+                   ? task->bargs.args.dst.info.buffer
+                   : task->bargs.args.src.info.buffer,
+               ucc_coll_fusion_task_bytes(task));
+        offset += ucc_coll_fusion_task_bytes(task);
+    }
+
+    memset(&args, 0, sizeof(args));
+    args.mask              = UCC_COLL_ARGS_FIELD_FLAGS |
+                             UCC_COLL_ARGS_FIELD_CB;
+    args.flags             = UCC_COLL_ARGS_FLAG_IN_PLACE;
+    args.coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+    args.op                = fusion->op;
+    args.dst.info.buffer   = batch->buffer;
+    args.dst.info.count    = fusion->bytes / ucc_dt_size(fusion->dt);
+    args.dst.info.datatype = fusion->dt;
+    args.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    args.cb.cb             = ucc_coll_fusion_batch_cb;
+    args.cb.data           = batch;
+
+    /* members hold transport tasks that are never posted, transports must
+       not order the fused collective after them, see tl/shm team order */
+    status = ucc_collective_init(&args, &batch->req, team);
+    if (ucc_unlikely(status != UCC_OK)) {
+        batch->req = NULL;
+        return status;
+    }
+    /* members are accounted by telemetry individually */
+    ucc_derived_of(batch->req, ucc_coll_task_t)->flags &=
+        ~UCC_COLL_TASK_FLAG_TELEMETRY;
+    return ucc_collective_post(batch->req);
+}
+
+ucc_status_t ucc_coll_fusion_flush(ucc_team_t *team)
+{
+    ucc_coll_fusion_t       *fusion = &team->fusion;
+    int                      active = fusion->active;
+    ucc_coll_fusion_batch_t *batch;
+    ucc_coll_task_t         *task;
+    ucc_status_t             status;
+
+    ucc_coll_fusion_reap(fusion);
+    if (fusion->n_pending == 0) {
+        return UCC_OK;
+    }
+    /* collectives posted by the flush itself must not be deferred */
+    fusion->active = 0;
+    if (fusion->n_pending == 1) {
+        task = ucc_list_extract_head(&fusion->pending, ucc_coll_task_t,
+                                     list_elem);
+        task->super.status = UCC_OPERATION_INITIALIZED;
+        status             = ucc_collective_post(&task->super);
+        if (ucc_unlikely(status != UCC_OK)) {
+            ucc_coll_fusion_complete_member(task, status);
+        }
+        goto out;
+    }
+
+    batch = ucc_calloc(1, sizeof(*batch), "fusion_batch");
+    if (!batch) {
+        ucc_error("failed to allocate %zd bytes for fusion batch",
+                  sizeof(*batch));
+        status = UCC_ERR_NO_MEMORY;
+    } else {
+        ucc_list_head_init(&batch->members);
+        while (!ucc_list_is_empty(&fusion->pending)) {
+            task = ucc_list_extract_head(&fusion->pending, ucc_coll_task_t,
+                                         list_elem);
+            ucc_list_add_tail(&batch->members, &task->list_elem);
+        }
+        status = ucc_coll_fusion_post_batch(team, batch);
+    }
+    if (ucc_unlikely(status != UCC_OK)) {
+        ucc_error("failed to post fused allreduce of %u collectives: %s",
+                  fusion->n_pending, ucc_status_string(status));
+        if (batch) {
+            ucc_coll_fusion_batch_cb(batch, status);
+            ucc_coll_fusion_batch_free(batch);
+        } else {
+            while (!ucc_list_is_empty(&fusion->pending)) {
+                task = ucc_list_extract_head(&fusion->pending,
+                                             ucc_coll_task_t, list_elem);
+                ucc_coll_fusion_complete_member(task, status);
+            }
+        }
+        goto out;
+    }
+    ucc_list_add_tail(&fusion->batches, &batch->list_elem);
+    fusion->n_fused += fusion->n_pending;
+    fusion->n_batches++;
+out:
+    fusion->n_pending = 0;
+    fusion->bytes     = 0;
+    fusion->active    = active;
+    return status;
+}
+
+ucc_status_t ucc_coll_fusion_add(ucc_coll_task_t *task)
+{
+    ucc_team_t                     *team   = task->bargs.team;
+    ucc_coll_fusion_t              *fusion = &team->fusion;
+    const ucc_coll_fusion_config_t *cfg    = &team->contexts[0]->fusion_cfg;
+    ucc_coll_args_t                *args   = &task->bargs.args;
+    size_t                          bytes;
+
+    fusion->n_posted++;
+    if (!ucc_coll_fusion_eligible(task, cfg)) {
+        /* the batch was posted earlier and goes first to keep the order */
+        ucc_coll_fusion_flush(team);
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    bytes = ucc_coll_fusion_task_bytes(task);
+    if (fusion->n_pending &&
+        (fusion->dt != args->dst.info.datatype || fusion->op != args->op ||
+         fusion->bytes + bytes > cfg->max_bytes)) {
+        ucc_coll_fusion_flush(team);
+    }
+    if (fusion->n_pending == 0) {
+        fusion->dt = args->dst.info.datatype;
+        fusion->op = args->op;
+    }
+    ucc_list_add_tail(&fusion->pending, &task->list_elem);
+    fusion->n_pending++;
+    fusion->bytes      += bytes;
+    task->super.status  = UCC_INPROGRESS;
+    if (fusion->n_pending >= cfg->max_colls) {
+        ucc_coll_fusion_flush(team);
+    }
+    return UCC_OK;
+}
+
+void ucc_coll_fusion_cleanup(ucc_team_t *team)
+{
+    ucc_coll_fusion_t       *fusion = &team->fusion;
+    ucc_coll_fusion_batch_t *batch, *tmp;
+
+    if (fusion->n_pending) {
+        ucc_warn("team %p is destroyed with %u collectives pending in the "
+                 "open fusion window", team, fusion->n_pending);
+    }
+    ucc_list_for_each_safe(batch, tmp, &fusion->batches, list_elem) {
+        if (!batch->completed) {
+            ucc_warn("team %p is destroyed with fused collective in "
+                     "progress", team);
+        }
+        ucc_list_del(&batch->list_elem);
+        ucc_coll_fusion_batch_free(batch);
+    }
+}
+
+void ucc_coll_fusion_print(ucc_team_t *team)
+{
+    ucc_coll_fusion_t *fusion = &team->fusion;
+
+    if (fusion->n_posted == 0) {
+        return;
+    }
+    ucc_coll_trace_info("fusion team_id %d rank %u: fused %lu of %lu "
+                        "collectives (%.1f%%) into %lu allreduces",
+                        team->id, team->rank, fusion->n_fused,
+                        fusion->n_posted,
+                        100.0 * fusion->n_fused / fusion->n_posted,
+                        fusion->n_batches);
+}
+
+ucc_status_t ucc_collective_fusion_start(ucc_team_h team)
+{
+    if (team->state != UCC_TEAM_ACTIVE) {
+        ucc_error("fusion window can not be opened on inactive team %p",
+                  team);
+        return UCC_ERR_INVALID_PARAM;
+    }
+    if (team->fusion.active) {
+        ucc_error("fusion window is already open on team %p", team);
+        return UCC_ERR_INVALID_PARAM;
+    }
+    team->fusion.active = 1;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_collective_fusion_end(ucc_team_h team)
+{
+    ucc_status_t status;
+
+    if (!team->fusion.active) {
+        ucc_error("fusion window is not open on team %p", team);
+        return UCC_ERR_INVALID_PARAM;
+    }
+    status              = ucc_coll_fusion_flush(team);
+    team->fusion.active = 0;
+    return status;
+}
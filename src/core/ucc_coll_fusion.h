@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_COLL_FUSION_H_
+#define UCC_COLL_FUSION_H_
+
+#include "config.h"
+#include "ucc/api/ucc.h"
+#include "utils/ucc_list.h"
+
+typedef struct ucc_coll_task ucc_coll_task_t;
+typedef struct ucc_team      ucc_team_t;
+
+typedef struct ucc_coll_fusion_config {
+    size_t   max_msgsize; /*< larger allreduces are posted as is */
+    size_t   max_bytes;   /*< max size of the fused buffer */
+    unsigned max_colls;   /*< max number of collectives in one batch */
+} ucc_coll_fusion_config_t;
+
+/* Fusion window of the team, opened by ucc_collective_fusion_start.
+   Small host allreduces posted inside the window are deferred and packed
+   into one allreduce. Batch boundaries depend only on the posting order
+   (batch limits, change of dt/op, non fusable collective, end of window),
+   so all the ranks build identical batches. */
+typedef struct ucc_coll_fusion {
+    int                active;
+    ucc_list_link_t    pending;   /*< deferred tasks of the current batch */
+    unsigned           n_pending;
+    size_t             bytes;     /*< packed size of the current batch */
+    ucc_datatype_t     dt;
+    ucc_reduction_op_t op;
+    ucc_list_link_t    batches;   /*< posted fused collectives */
+    uint64_t           n_posted;  /*< collectives posted inside the window */
+    uint64_t           n_fused;   /*< collectives completed by a batch */
+    uint64_t           n_batches;
+} ucc_coll_fusion_t;
+
+void ucc_coll_fusion_init(ucc_coll_fusion_t *fusion);
+
+void ucc_coll_fusion_cleanup(ucc_team_t *team);
+
+/* Called on post of a task inside the fusion window. Returns UCC_OK if the
+   task is deferred, UCC_ERR_NOT_SUPPORTED if it has to be posted as is. */
+ucc_status_t ucc_coll_fusion_add(ucc_coll_task_t *task);
+
+ucc_status_t ucc_coll_fusion_flush(ucc_team_t *team);
+
+void ucc_coll_fusion_print(ucc_team_t *team);
+
+#endif
@@ -13,6 +13,7 @@
 #include "utils/ucc_string.h"
 #include "utils/ucc_proc_info.h"
 #include "utils/profile/ucc_profile.h"
+#include "utils/ucc_timeline.h"
 #include "ucc/api/ucc_version.h"
 #include <dlfcn.h>
 #include <pthread.h>
@@ -178,6 +179,7 @@ ucc_status_t ucc_constructor(void)
     ucc_profile_init(cfg->profile_mode, cfg->profile_file,
                      cfg->profile_log_size);
 #endif
+    ucc_timeline_init(cfg->timeline_file, cfg->timeline_size);
     if (ucc_global_config.log_component.log_level >= UCC_LOG_LEVEL_INFO) {
         ret = dladdr(ucc_init_version, &dl_info);
         if (ret == 0) {
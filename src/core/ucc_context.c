@@ -12,6 +12,7 @@
 #include "utils/ucc_log.h"
 #include "utils/ucc_list.h"
 #include "utils/ucc_string.h"
+#include "utils/ucc_timeline.h"
 #include "ucc_progress_queue.h"
 
 static uint32_t ucc_context_seq_num = 0;
@@ -53,9 +54,51 @@ static ucc_config_field_t ucc_context_config_table[] = {
     {"NET_DEVICES", "all",
      "Specifies which network device(s) to use. The order is not meaningful.\n"
      "\"all\" would use all available devices. Only TLs that support this "
-     "parameter will be affected. The parameter is only supported by UCX TL.",
+     "parameter will be affected. The parameter is only supported by UCX TL.\n"
+     "The devices are also counted as rails by hierarchical algorithms,\n"
+     "with \"all\" every active InfiniBand port is a rail.",
      ucc_offsetof(ucc_context_config_t, net_devices), UCC_CONFIG_TYPE_STRING_ARRAY},
 
+    {"PROGRESS_THREAD", "n",
+     "Progress the context by an internal thread, so that nonblocking "
+     "collectives advance while the application does not call "
+     "ucc_context_progress. Requires UCC_THREAD_MULTIPLE library thread mode",
+     ucc_offsetof(ucc_context_config_t, progress_thread),
+     UCC_CONFIG_TYPE_BOOL},
+
+    {"PROGRESS_THREAD_CPU", "-1",
+     "CPU core to pin the progress thread to, -1 - no pinning",
+     ucc_offsetof(ucc_context_config_t, progress_thread_cpu),
+     UCC_CONFIG_TYPE_INT},
+
+    {"PROGRESS_THREAD_SPIN", "1000",
+     "Number of idle progress iterations after which the progress thread "
+     "goes to sleep until a new collective is posted",
+     ucc_offsetof(ucc_context_config_t, progress_thread_spin),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"PROGRESS_THREAD_SLEEP", "100",
+     "Max time in microseconds the idle progress thread sleeps before "
+     "progressing the transports again",
+     ucc_offsetof(ucc_context_config_t, progress_thread_sleep),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"FUSION_MAX_MSGSIZE", "4k",
+     "Max message size of allreduce that is fused with other allreduces "
+     "posted inside the fusion window, see ucc_collective_fusion_start",
+     ucc_offsetof(ucc_context_config_t, fusion.max_msgsize),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"FUSION_MAX_BYTES", "256k",
+     "Max size of the buffer of fused allreduce",
+     ucc_offsetof(ucc_context_config_t, fusion.max_bytes),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"FUSION_MAX_COLLS", "64",
+     "Max number of allreduces fused into one",
+     ucc_offsetof(ucc_context_config_t, fusion.max_colls),
+     UCC_CONFIG_TYPE_UINT},
+
     {NULL}};
 UCC_CONFIG_REGISTER_TABLE(ucc_context_config_table, "UCC context", NULL,
                           ucc_context_config_t, &ucc_config_global_list);
@@ -631,10 +674,12 @@ ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
     ucc_config_names_array_dup(&ctx->net_devices, &config->net_devices);
 
     ctx->throttle_progress = config->throttle_progress;
+    ctx->fusion_cfg        = config->fusion;
     ctx->rank              = UCC_RANK_MAX;
     ctx->lib               = lib;
     ctx->ids.pool_size     = config->team_ids_pool_size;
     ucc_list_head_init(&ctx->progress_list);
+    ucc_spinlock_init(&ctx->progress_list_lock, 0);
     ucc_copy_context_params(&ctx->params, params);
     ucc_copy_context_params(&b_params.params, params);
     b_params.context           = ctx;
@@ -644,6 +689,7 @@ ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
     b_params.thread_mode       = lib->attr.thread_mode;
     if (params->mask & UCC_CONTEXT_PARAM_FIELD_OOB) {
         ctx->rank = params->oob.oob_ep;
+        ucc_timeline_set_rank(ctx->rank);
     }
     status = ucc_create_tl_contexts(ctx, config, b_params);
     if (UCC_OK != status) {
@@ -851,6 +897,25 @@ ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
         goto error_ctx_create_epilog;
     }
 
+    if (config->progress_thread) {
+        if (ctx->thread_mode != UCC_THREAD_MULTIPLE) {
+            ucc_warn("progress thread requires UCC_THREAD_MULTIPLE thread "
+                     "mode, context %p is %s", ctx,
+                     ucc_thread_mode_str(ctx->thread_mode));
+        } else {
+            ucc_progress_thread_config_t pt_cfg;
+
+            pt_cfg.cpu          = config->progress_thread_cpu;
+            pt_cfg.spin_count   = config->progress_thread_spin;
+            pt_cfg.max_sleep_us = config->progress_thread_sleep;
+            status = ucc_progress_thread_start(ctx, &pt_cfg,
+                                               &ctx->progress_thread);
+            if (UCC_OK != status) {
+                goto error_ctx_create_epilog;
+            }
+        }
+    }
+
     ucc_debug("created ucc context %p for lib %s: type %s, thread mode %s, oob %s, num eps %d, num ppn %d",
               ctx, lib->full_prefix,
               params->mask & UCC_CONTEXT_PARAM_FIELD_TYPE ? ucc_context_type_str(params->type) : "n/a",
@@ -884,8 +949,16 @@ ucc_status_t ucc_context_create(ucc_lib_h lib,
                                 const ucc_context_config_h  config,
                                 ucc_context_h *context)
 {
+    ucc_proc_info_t proc_info = ucc_local_proc;
+    int             all_devs  =
+        ucc_config_names_array_is_all(&config->net_devices);
+
+    /* rails depend on NET_DEVICES, so they are detected per context */
+    ucc_proc_info_init_rails(&proc_info,
+                             all_devs ? NULL : config->net_devices.names,
+                             all_devs ? 0 : config->net_devices.count);
     return ucc_context_create_proc_info(lib, params, config, context,
-                                        &ucc_local_proc);
+                                        &proc_info);
 }
 
 static ucc_status_t ucc_context_free_attr(ucc_context_attr_t *context_attr)
@@ -905,6 +978,10 @@ ucc_status_t ucc_context_destroy(ucc_context_t *context)
     int               i;
     ucc_status_t      status;
 
+    if (context->progress_thread) {
+        ucc_progress_thread_stop(context->progress_thread);
+        context->progress_thread = NULL;
+    }
     if (UCC_OK != ucc_context_free_attr(&context->attr)) {
         ucc_error("failed to free context attributes");
     }
@@ -951,6 +1028,7 @@ ucc_status_t ucc_context_destroy(ucc_context_t *context)
     ucc_config_names_array_free(&context->net_devices);
     ucc_context_topo_cleanup(context->topo);
     ucc_progress_queue_finalize(context->pq);
+    ucc_spinlock_destroy(&context->progress_list_lock);
     ucc_free(context->addr_storage.storage);
     ucc_free(context->all_tls.names);
     ucc_free(context->tl_ctx);
@@ -978,7 +1056,9 @@ ucc_status_t ucc_context_progress_register(ucc_context_t *ctx,
     }
     entry->fn  = fn;
     entry->arg = progress_arg;
+    ucc_spin_lock(&ctx->progress_list_lock);
     ucc_list_add_tail(&ctx->progress_list, &entry->list_elem);
+    ucc_spin_unlock(&ctx->progress_list_lock);
     return UCC_OK;
 }
 
@@ -987,22 +1067,38 @@ ucc_status_t ucc_context_progress_deregister(ucc_context_t *ctx,
                                              void *progress_arg)
 {
     ucc_context_progress_entry_t *entry, *tmp;
+
+    ucc_spin_lock(&ctx->progress_list_lock);
     ucc_list_for_each_safe(entry, tmp, &ctx->progress_list, list_elem) {
         if (entry->fn == fn && entry->arg == progress_arg) {
             ucc_list_del(&entry->list_elem);
+            ucc_spin_unlock(&ctx->progress_list_lock);
             ucc_free(entry);
             return UCC_OK;
         }
     }
+    ucc_spin_unlock(&ctx->progress_list_lock);
     return UCC_ERR_NOT_FOUND;
 }
 
-ucc_status_t ucc_context_progress(ucc_context_h context)
+unsigned ucc_context_progress_fns(ucc_context_t *ctx)
 {
-    static int                    call_num = 0;
-    ucc_status_t                  status;
     ucc_context_progress_entry_t *entry;
-    int                           is_empty;
+    unsigned                      count = 0;
+
+    ucc_spin_lock(&ctx->progress_list_lock);
+    ucc_list_for_each(entry, &ctx->progress_list, list_elem) {
+        count += entry->fn(entry->arg);
+    }
+    ucc_spin_unlock(&ctx->progress_list_lock);
+    return count;
+}
+
+ucc_status_t ucc_context_progress(ucc_context_h context)
+{
+    static int   call_num = 0;
+    ucc_status_t status;
+    int          is_empty;
 
     is_empty = ucc_progress_queue_is_empty(context->pq);
     if (ucc_likely(is_empty)) {
@@ -1010,10 +1106,9 @@ ucc_status_t ucc_context_progress(ucc_context_h context)
         if (ucc_likely(call_num >= 0)) {
             return UCC_OK;
         }
-        /* progress registered progress fns */
-        ucc_list_for_each(entry, &context->progress_list, list_elem) {
-            entry->fn(entry->arg);
-        }
+        /* progress registered progress fns, under the lock since they
+           can be deregistered concurrently */
+        ucc_context_progress_fns(context);
         call_num = context->throttle_progress;
         return UCC_OK;
     }
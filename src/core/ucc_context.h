@@ -9,7 +9,9 @@
 
 #include "ucc/api/ucc.h"
 #include "ucc_progress_queue.h"
+#include "ucc_coll_fusion.h"
 #include "utils/ucc_list.h"
+#include "utils/ucc_spinlock.h"
 #include "utils/ucc_proc_info.h"
 #include "components/topo/ucc_topo.h"
 
@@ -69,7 +71,9 @@ typedef struct ucc_context {
     ucc_config_names_array_t all_tls;
     ucc_config_names_array_t net_devices;
     ucc_list_link_t          progress_list;
+    ucc_spinlock_t           progress_list_lock;
     ucc_progress_queue_t    *pq;
+    ucc_progress_thread_t   *progress_thread;
     ucc_team_id_pool_t       ids;
     ucc_context_id_t         id;
     ucc_addr_storage_t       addr_storage;
@@ -81,6 +85,7 @@ typedef struct ucc_context {
     uint64_t                 cl_flags;
     ucc_tl_team_t           *service_team;
     int32_t                  throttle_progress;
+    ucc_coll_fusion_config_t fusion_cfg;
 } ucc_context_t;
 
 typedef struct ucc_context_config {
@@ -96,6 +101,11 @@ typedef struct ucc_context_config {
     uint32_t                  internal_oob;
     uint32_t                  throttle_progress;
     ucs_config_names_array_t  net_devices;
+    int                       progress_thread;
+    int                       progress_thread_cpu;
+    unsigned                  progress_thread_spin;
+    unsigned                  progress_thread_sleep;
+    ucc_coll_fusion_config_t  fusion;
 } ucc_context_config_t;
 
 typedef struct ucc_mem_map_tl_t {
@@ -136,6 +146,9 @@ ucc_status_t ucc_context_progress_register(ucc_context_t *ctx,
 ucc_status_t ucc_context_progress_deregister(ucc_context_t *ctx,
                                              ucc_context_progress_fn_t fn,
                                              void *progress_arg);
+
+/* Calls all the registered progress fns, returns the sum of their results */
+unsigned ucc_context_progress_fns(ucc_context_t *ctx);
 /* Performs address exchange between the processes group defined by OOB.
    This function can be used either at context creation time
    (if ctx is global) or at team creation time.
@@ -32,6 +32,9 @@ typedef struct ucc_dt_generic {
 #define UCC_DT_IS_CONTIG(_dt) (UCC_DT_IS_GENERIC(_dt) && \
                                UCC_DT_GENERIC_IS_CONTIG(ucc_dt_to_generic(_dt)))
 
+#define UCC_DT_IS_NONCONTIG(_dt) (UCC_DT_IS_GENERIC(_dt) && \
+                                  !UCC_DT_GENERIC_IS_CONTIG(ucc_dt_to_generic(_dt)))
+
 #define UCC_DT_HAS_REDUCE(_dt) (UCC_DT_IS_GENERIC(_dt) && \
                                 UCC_DT_GENERIC_HAS_REDUCE(ucc_dt_to_generic(_dt)))
 
@@ -67,4 +70,45 @@ static inline size_t ucc_dt_size(ucc_datatype_t dt)
     ucc_assert(0);
     return SIZE_MAX;
 }
+
+static inline int ucc_dt_is_integer(ucc_datatype_t dt)
+{
+    switch (dt) {
+    case UCC_DT_INT8:
+    case UCC_DT_INT16:
+    case UCC_DT_INT32:
+    case UCC_DT_INT64:
+    case UCC_DT_INT128:
+    case UCC_DT_UINT8:
+    case UCC_DT_UINT16:
+    case UCC_DT_UINT32:
+    case UCC_DT_UINT64:
+    case UCC_DT_UINT128:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* Size of "count" elements of "dt" located at "buffer" once packed. For
+   non-contiguous generic datatypes this queries the pack callbacks. */
+static inline size_t ucc_dt_packed_size(ucc_datatype_t dt, const void *buffer,
+                                        size_t count)
+{
+    ucc_dt_generic_t *gdt;
+    void             *state;
+    size_t            size;
+
+    if (!UCC_DT_IS_NONCONTIG(dt)) {
+        return count * ucc_dt_size(dt);
+    }
+    gdt   = ucc_dt_to_generic(dt);
+    state = gdt->ops.start_pack(gdt->context, buffer, count);
+    if (!state) {
+        return SIZE_MAX;
+    }
+    size = gdt->ops.packed_size(state);
+    gdt->ops.finish(state);
+    return size;
+}
 #endif
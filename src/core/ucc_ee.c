@@ -10,6 +10,7 @@
 #include "ucc_lib.h"
 #include "components/cl/ucc_cl.h"
 #include "components/tl/ucc_tl.h"
+#include "schedule/ucc_schedule.h"
 
 const char *ucc_ee_ev_names[] = {
     [UCC_EVENT_COLLECTIVE_POST]     = "COLL_POST",
@@ -116,7 +117,33 @@ ucc_status_t ucc_ee_set_event_internal(ucc_ee_h ee, ucc_ev_t *ev, ucc_queue_head
 
 ucc_status_t ucc_ee_set_event(ucc_ee_h ee, ucc_ev_t *ev)
 {
-    return ucc_ee_set_event_internal(ee, ev, &ee->event_in_queue);
+    ucc_context_t *ctx;
+    ucc_status_t   status;
+
+    status = ucc_ee_set_event_internal(ee, ev, &ee->event_in_queue);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    ctx = ee->team->contexts[0];
+    if (ee->ee_type == UCC_EE_CPU_THREAD &&
+        ctx->thread_mode == UCC_THREAD_MULTIPLE) {
+        /* start collectives waiting for the event right away from the
+           calling thread instead of the next progress call */
+        ucc_progress_queue(ctx->pq);
+    }
+    return UCC_OK;
+}
+
+void ucc_coll_task_ee_complete(ucc_coll_task_t *task)
+{
+    ucc_ev_t ev;
+
+    task->flags        &= ~UCC_COLL_TASK_FLAG_EE_COMPLETE_EVENT;
+    ev.ev_type          = UCC_EVENT_COLLECTIVE_COMPLETE;
+    ev.ev_context       = NULL;
+    ev.ev_context_size  = 0;
+    ev.req              = &task->super;
+    ucc_ee_set_event_internal(task->ee, &ev, &task->ee->event_out_queue);
 }
 
 ucc_status_t ucc_ee_wait(ucc_ee_h ee, ucc_ev_t *ev)
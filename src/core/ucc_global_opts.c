@@ -12,15 +12,19 @@
 UCC_LIST_HEAD(ucc_config_global_list);
 
 ucc_global_config_t ucc_global_config = {
-    .log_component    = {UCC_LOG_LEVEL_WARN, "UCC"},
-    .coll_trace       = {UCC_LOG_LEVEL_WARN, "UCC_COLL"},
-    .component_path   = NULL,
-    .install_path     = NULL,
-    .initialized      = 0,
-    .profile_mode     = 0,
-    .profile_file     = "",
-    .profile_log_size = 0,
-    .file_cfg         = 0};
+    .log_component     = {UCC_LOG_LEVEL_WARN, "UCC"},
+    .coll_trace        = {UCC_LOG_LEVEL_WARN, "UCC_COLL"},
+    .component_path    = NULL,
+    .install_path      = NULL,
+    .initialized       = 0,
+    .profile_mode      = 0,
+    .profile_file      = "",
+    .profile_log_size  = 0,
+    .file_cfg          = 0,
+    .mpool_tcache_size = 64,
+    .telemetry         = 1,
+    .timeline_file     = "",
+    .timeline_size     = 65536};
 
 ucc_config_field_t ucc_global_config_table[] = {
     {"LOG_LEVEL", "warn",
@@ -65,4 +69,32 @@ ucc_config_field_t ucc_global_config_table[] = {
      "empty string \"\" - disable use of config file",
      ucc_offsetof(ucc_global_config_t, cfg_filename), UCC_CONFIG_TYPE_STRING},
 
+    {"MPOOL_TCACHE_SIZE", "64",
+     "Number of objects each thread may cache locally in a memory pool used "
+     "with UCC_THREAD_MULTIPLE. Objects are moved between the local cache and "
+     "the shared pool in batches of half this size.\n"
+     "0 - disable per-thread caches, every get/put takes the pool lock",
+     ucc_offsetof(ucc_global_config_t, mpool_tcache_size),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"TELEMETRY", "y",
+     "Collect per-team counters and latency histograms of collectives, "
+     "grouped by collective type and message size. The data is available "
+     "through ucc_team_get_attr and is printed on team destroy when "
+     "UCC_COLL_TRACE is info or higher.",
+     ucc_offsetof(ucc_global_config_t, telemetry), UCC_CONFIG_TYPE_BOOL},
+
+    {"TIMELINE_FILE", "",
+     "File name to write the timeline of collective tasks, executor tasks "
+     "and p2p operations to, in Chrome trace JSON format. The file is written "
+     "on ucc_finalize. Empty string disables the timeline.\n"
+     "Substitutions: %h: host, %p: pid, %c: cpu, %t: time, %u: user, %e: "
+     "exe.\n",
+     ucc_offsetof(ucc_global_config_t, timeline_file), UCC_CONFIG_TYPE_STRING},
+
+    {"TIMELINE_SIZE", "65536",
+     "Number of timeline events kept per thread, older events are "
+     "overwritten.",
+     ucc_offsetof(ucc_global_config_t, timeline_size), UCC_CONFIG_TYPE_UINT},
+
     {NULL}};
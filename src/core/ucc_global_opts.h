@@ -37,6 +37,18 @@ typedef struct ucc_global_config {
     size_t                     profile_log_size;
     char                      *cfg_filename;
     ucc_file_config_t         *file_cfg;
+
+    /* Capacity of per-thread object caches of thread-safe mpools */
+    unsigned                   mpool_tcache_size;
+
+    /* Collect per-team collective counters and latency histograms */
+    int                        telemetry;
+
+    /* Timeline (Chrome trace) output file name, empty if disabled */
+    char                      *timeline_file;
+
+    /* Number of timeline events kept per thread */
+    unsigned                   timeline_size;
 } ucc_global_config_t;
 
 extern ucc_global_config_t ucc_global_config;
@@ -12,6 +12,7 @@
 #include "utils/ucc_malloc.h"
 #include "utils/ucc_parser.h"
 #include "utils/ucc_math.h"
+#include "utils/ucc_timeline.h"
 #include "components/cl/ucc_cl.h"
 #include "components/tl/ucc_tl.h"
 #include "components/mc/ucc_mc.h"
@@ -482,6 +483,9 @@ ucc_status_t ucc_finalize(ucc_lib_info_t *lib)
     ucc_assert(lib->n_cl_libs_opened > 0);
     ucc_assert(lib->cl_libs != NULL);
 
+    /* component names referenced by timeline events are valid until
+       the component libs are finalized */
+    ucc_timeline_dump();
     ucc_mpool_cleanup(&lib->stub_tasks_mp, 1);
     for (i = 0; i < lib->n_tl_libs_opened; i++) {
         lib->tl_libs[i]->iface->lib.finalize(&lib->tl_libs[i]->super);
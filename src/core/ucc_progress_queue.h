@@ -9,6 +9,7 @@
 
 #include "ucc/api/ucc.h"
 #include "schedule/ucc_schedule.h"
+#include "ucc_progress_thread.h"
 
 typedef struct ucc_progress_queue ucc_progress_queue_t;
 struct ucc_progress_queue {
@@ -17,6 +18,8 @@ struct ucc_progress_queue {
     int  (*progress)(ucc_progress_queue_t *pq);
     int  (*is_empty)(ucc_progress_queue_t *pq);
     void (*finalize)(ucc_progress_queue_t *pq);
+    /* progress thread of the context, woken up on enqueue */
+    ucc_progress_thread_t *progress_thread;
 };
 
 ucc_status_t ucc_progress_queue_init(ucc_progress_queue_t **pq,
@@ -27,6 +30,9 @@ static inline void ucc_progress_enqueue(ucc_progress_queue_t *pq,
                                         ucc_coll_task_t *task)
 {
     pq->enqueue(pq, task);
+    if (pq->progress_thread) {
+        ucc_progress_thread_wake(pq->progress_thread);
+    }
 }
 
 static inline ucc_status_t ucc_progress_queue_enqueue(ucc_progress_queue_t *pq,
@@ -39,7 +45,7 @@ static inline ucc_status_t ucc_progress_queue_enqueue(ucc_progress_queue_t *pq,
     }
     /* set user visible status */
     task->super.status = UCC_INPROGRESS;
-    pq->enqueue(pq, task);
+    ucc_progress_enqueue(pq, task);
     return UCC_OK;
 }
 
@@ -88,6 +88,7 @@ ucc_status_t ucc_pq_st_init(ucc_progress_queue_t **pq)
     pq_st->super.progress = ucc_pq_st_progress;
     pq_st->super.finalize = ucc_pq_st_finalize;
     pq_st->super.is_empty = ucc_pq_st_is_empty;
+    pq_st->super.progress_thread = NULL;
 
     *pq                   = &pq_st->super;
     return UCC_OK;
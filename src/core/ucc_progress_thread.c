@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "ucc_progress_thread.h"
+#include "ucc_context.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_log.h"
+#include "utils/ucc_math.h"
+#include <sched.h>
+#include <time.h>
+
+#define UCC_PROGRESS_THREAD_MIN_SLEEP_US 1
+
+static void ucc_progress_thread_sleep(ucc_progress_thread_t *pt,
+                                      unsigned               sleep_us)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_nsec += (long)sleep_us * 1000;
+    ts.tv_sec  += ts.tv_nsec / 1000000000;
+    ts.tv_nsec %= 1000000000;
+
+    pthread_mutex_lock(&pt->lock);
+    pt->sleeping = 1;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (!pt->stop && ucc_progress_queue_is_empty(pt->ctx->pq)) {
+        pthread_cond_timedwait(&pt->cond, &pt->lock, &ts);
+    }
+    pt->sleeping = 0;
+    pthread_mutex_unlock(&pt->lock);
+}
+
+/* Returns non-zero if the context had any activity */
+static int ucc_progress_thread_progress(ucc_context_t *ctx)
+{
+    int n_completed;
+
+    if (!ucc_progress_queue_is_empty(ctx->pq)) {
+        /* tasks progress the transports they use themselves */
+        n_completed = ucc_progress_queue(ctx->pq);
+        if (ucc_unlikely(n_completed < 0)) {
+            ucc_debug("progress thread of ctx %p: progress queue returned %s",
+                      ctx, ucc_status_string((ucc_status_t)n_completed));
+        }
+        return 1;
+    }
+    return ucc_context_progress_fns(ctx) > 0;
+}
+
+static void *ucc_progress_thread_func(void *arg)
+{
+    ucc_progress_thread_t *pt       = arg;
+    unsigned               n_idle   = 0;
+    unsigned               sleep_us = UCC_PROGRESS_THREAD_MIN_SLEEP_US;
+
+    while (!pt->stop) {
+        if (ucc_progress_thread_progress(pt->ctx)) {
+            n_idle   = 0;
+            sleep_us = UCC_PROGRESS_THREAD_MIN_SLEEP_US;
+            continue;
+        }
+        if (++n_idle < pt->cfg.spin_count) {
+            continue;
+        }
+        ucc_progress_thread_sleep(pt, sleep_us);
+        sleep_us = ucc_min(sleep_us * 2, pt->cfg.max_sleep_us);
+    }
+    return NULL;
+}
+
+ucc_status_t ucc_progress_thread_start(ucc_context_t                      *ctx,
+                                       const ucc_progress_thread_config_t *cfg,
+                                       ucc_progress_thread_t             **pt_p)
+{
+    ucc_progress_thread_t *pt;
+    pthread_attr_t         attr;
+    cpu_set_t              cpuset;
+    ucc_status_t           status;
+    int                    ret;
+
+    pt = ucc_calloc(1, sizeof(*pt), "progress_thread");
+    if (!pt) {
+        ucc_error("failed to allocate %zd bytes for progress thread",
+                  sizeof(*pt));
+        return UCC_ERR_NO_MEMORY;
+    }
+    pt->ctx              = ctx;
+    pt->cfg              = *cfg;
+    pt->cfg.max_sleep_us = ucc_max(pt->cfg.max_sleep_us,
+                                   UCC_PROGRESS_THREAD_MIN_SLEEP_US);
+    pthread_mutex_init(&pt->lock, NULL);
+    pthread_cond_init(&pt->cond, NULL);
+
+    pthread_attr_init(&attr);
+    if (cfg->cpu >= 0) {
+        CPU_ZERO(&cpuset);
+        CPU_SET(cfg->cpu, &cpuset);
+        ret = pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset);
+        if (ret != 0) {
+            ucc_warn("failed to set progress thread affinity to cpu %d: %s",
+                     cfg->cpu, strerror(ret));
+        }
+    }
+    ret = pthread_create(&pt->thread, &attr, ucc_progress_thread_func, pt);
+    pthread_attr_destroy(&attr);
+    if (ret != 0) {
+        ucc_error("failed to create progress thread: %s", strerror(ret));
+        status = UCC_ERR_NO_RESOURCE;
+        goto err_create;
+    }
+    ctx->pq->progress_thread = pt;
+    ucc_debug("started progress thread for ctx %p, cpu %d", ctx, cfg->cpu);
+    *pt_p = pt;
+    return UCC_OK;
+
+err_create:
+    pthread_cond_destroy(&pt->cond);
+    pthread_mutex_destroy(&pt->lock);
+    ucc_free(pt);
+    return status;
+}
+
+void ucc_progress_thread_stop(ucc_progress_thread_t *pt)
+{
+    pt->ctx->pq->progress_thread = NULL;
+    pthread_mutex_lock(&pt->lock);
+    pt->stop = 1;
+    pthread_cond_signal(&pt->cond);
+    pthread_mutex_unlock(&pt->lock);
+    pthread_join(pt->thread, NULL);
+
+    pthread_cond_destroy(&pt->cond);
+    pthread_mutex_destroy(&pt->lock);
+    ucc_free(pt);
+}
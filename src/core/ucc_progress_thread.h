@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_PROGRESS_THREAD_H_
+#define UCC_PROGRESS_THREAD_H_
+
+#include "config.h"
+#include "ucc/api/ucc.h"
+#include "utils/ucc_compiler_def.h"
+#include <pthread.h>
+
+typedef struct ucc_context ucc_context_t;
+
+typedef struct ucc_progress_thread_config {
+    int      cpu;          /*< core to pin the thread to, -1 - no pinning */
+    unsigned spin_count;   /*< idle iterations before the thread sleeps */
+    unsigned max_sleep_us; /*< upper bound of a single sleep */
+} ucc_progress_thread_config_t;
+
+/* Internal thread progressing the context: it drives the progress queue
+   while there are collectives in flight and the registered progress fns
+   (e.g. ucp worker progress) otherwise. After spin_count idle iterations
+   the thread sleeps with exponential backoff up to max_sleep_us, enqueue
+   of a new task to the progress queue wakes it up. */
+typedef struct ucc_progress_thread {
+    pthread_t                    thread;
+    pthread_mutex_t              lock;
+    pthread_cond_t               cond;
+    ucc_context_t               *ctx;
+    ucc_progress_thread_config_t cfg;
+    volatile int                 stop;
+    volatile int                 sleeping;
+} ucc_progress_thread_t;
+
+ucc_status_t ucc_progress_thread_start(ucc_context_t                      *ctx,
+                                       const ucc_progress_thread_config_t *cfg,
+                                       ucc_progress_thread_t             **pt);
+
+void ucc_progress_thread_stop(ucc_progress_thread_t *pt);
+
+static inline void ucc_progress_thread_wake(ucc_progress_thread_t *pt)
+{
+    /* pairs with the fence in ucc_progress_thread_sleep: either the thread
+       sees the enqueued task or the task owner sees the thread sleeping */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (ucc_unlikely(pt->sleeping)) {
+        pthread_mutex_lock(&pt->lock);
+        pthread_cond_signal(&pt->cond);
+        pthread_mutex_unlock(&pt->lock);
+    }
+}
+
+#endif
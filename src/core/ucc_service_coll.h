@@ -40,4 +40,8 @@ void ucc_internal_oob_finalize(ucc_team_oob_coll_t *oob);
 
 ucc_status_t ucc_collective_finalize_internal(ucc_coll_task_t *task);
 
+/* Post time checks and timestamps of a collective, done by
+   ucc_collective_post and by a batch for its collectives */
+ucc_status_t ucc_collective_post_prologue(ucc_coll_task_t *task);
+
 #endif
@@ -37,8 +37,9 @@ void ucc_copy_team_params(ucc_team_params_t *dst, const ucc_team_params_t *src)
 
 ucc_status_t ucc_team_get_attr(ucc_team_h team, ucc_team_attr_t *team_attr)
 {
-    uint64_t supported_fields =
-        UCC_TEAM_ATTR_FIELD_SIZE | UCC_TEAM_ATTR_FIELD_EP;
+    uint64_t supported_fields = UCC_TEAM_ATTR_FIELD_SIZE |
+                                UCC_TEAM_ATTR_FIELD_EP |
+                                UCC_TEAM_ATTR_FIELD_TELEMETRY;
 
     if (team_attr->mask & ~supported_fields) {
         ucc_error("ucc_team_get_attr() is not implemented for specified field");
@@ -53,6 +54,12 @@ ucc_status_t ucc_team_get_attr(ucc_team_h team, ucc_team_attr_t *team_attr)
         team_attr->ep = team->rank;
     }
 
+    if (team_attr->mask & UCC_TEAM_ATTR_FIELD_TELEMETRY) {
+        team_attr->telemetry.n_fused_colls    = team->fusion.n_fused;
+        team_attr->telemetry.n_fusion_batches = team->fusion.n_batches;
+        return ucc_telemetry_query(&team->telemetry, &team_attr->telemetry);
+    }
+
     return UCC_OK;
 }
 
@@ -187,6 +194,8 @@ ucc_status_t ucc_team_create_post(ucc_context_h *contexts, uint32_t num_contexts
     team->size         = (ucc_rank_t)team_size;
     team->rank         = (ucc_rank_t)team_rank;
     team->seq_num      = 0;
+    ucc_telemetry_init(&team->telemetry);
+    ucc_coll_fusion_init(&team->fusion);
     team->contexts     = ucc_malloc(sizeof(ucc_context_t *) * num_contexts,
                                     "ucc_team_ctx");
     if (!team->contexts) {
@@ -209,6 +218,7 @@ ucc_status_t ucc_team_create_post(ucc_context_h *contexts, uint32_t num_contexts
 
 err_ctx_alloc:
     *new_team = NULL;
+    ucc_telemetry_cleanup(&team->telemetry);
     ucc_free(team);
     return status;
 }
@@ -499,6 +509,7 @@ static ucc_status_t ucc_team_destroy_single(ucc_team_h team)
     int             i;
     ucc_status_t    status;
 
+    ucc_coll_fusion_cleanup(team);
     if (team->service_team) {
         if (UCC_OK != (status = UCC_TL_CTX_IFACE(team->contexts[0]->service_ctx)
                        ->team.destroy(&team->service_team->super))) {
@@ -529,6 +540,19 @@ static ucc_status_t ucc_team_destroy_single(ucc_team_h team)
         ucc_info("team destroyed, team_id %d", team->id);
     }
 
+    if (ucc_global_config.telemetry &&
+        (ucc_global_config.coll_trace.log_level >= UCC_LOG_LEVEL_INFO) &&
+        (team->rank == 0 ||
+         ucc_global_config.coll_trace.log_level >= UCC_LOG_LEVEL_DEBUG)) {
+        ucc_telemetry_print(team);
+    }
+    if ((ucc_global_config.coll_trace.log_level >= UCC_LOG_LEVEL_INFO) &&
+        (team->rank == 0 ||
+         ucc_global_config.coll_trace.log_level >= UCC_LOG_LEVEL_DEBUG)) {
+        ucc_coll_fusion_print(team);
+    }
+    ucc_telemetry_cleanup(&team->telemetry);
+
     ucc_coll_score_free_map(team->score_map);
     ucc_free(team->addr_storage.storage);
     ucc_free(team->ctx_ranks);
@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "ucc_telemetry.h"
+#include "ucc_team.h"
+#include "ucc_global_opts.h"
+#include "schedule/ucc_schedule.h"
+#include "utils/ucc_atomic.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_string.h"
+
+/* Index of the telemetry shard owned by the calling thread, -1 if not
+   assigned yet. The index is the same for all the teams. */
+static __thread int   ucc_telemetry_thread_slot = -1;
+static uint32_t       ucc_telemetry_n_threads   = 0;
+
+static inline int ucc_telemetry_slot(void)
+{
+    if (ucc_unlikely(ucc_telemetry_thread_slot < 0)) {
+        ucc_telemetry_thread_slot =
+            ucc_min(ucc_atomic_fadd32(&ucc_telemetry_n_threads, 1),
+                    UCC_TELEMETRY_MAX_THREADS);
+    }
+    return ucc_telemetry_thread_slot;
+}
+
+static inline uint32_t ucc_telemetry_lat_bucket(uint64_t ns)
+{
+    if (ns < UCC_BIT(9)) {
+        return 0;
+    }
+    return ucc_min(ucc_ilog2(ns) - 8, UCC_COLL_TELEMETRY_LAT_BUCKETS - 1);
+}
+
+static inline void ucc_telemetry_update(ucc_telemetry_counters_t *c,
+                                        uint64_t ns, ucc_status_t status)
+{
+    c->n_colls++;
+    c->n_errors += (status != UCC_OK);
+    c->total_ns += ns;
+    c->lat_hist[ucc_telemetry_lat_bucket(ns)]++;
+}
+
+void ucc_telemetry_init(ucc_telemetry_t *tm)
+{
+    memset(tm->shards, 0, sizeof(tm->shards));
+    ucc_spinlock_init(&tm->lock, 0);
+}
+
+void ucc_telemetry_cleanup(ucc_telemetry_t *tm)
+{
+    int i;
+
+    for (i = 0; i <= UCC_TELEMETRY_MAX_THREADS; i++) {
+        ucc_free(tm->shards[i]);
+        tm->shards[i] = NULL;
+    }
+    ucc_spinlock_destroy(&tm->lock);
+}
+
+static ucc_telemetry_shard_t *ucc_telemetry_shard_alloc(ucc_telemetry_t *tm,
+                                                        int slot)
+{
+    ucc_telemetry_shard_t *shard;
+
+    ucc_spin_lock(&tm->lock);
+    shard = tm->shards[slot];
+    if (!shard) {
+        shard = ucc_calloc(1, sizeof(*shard), "telemetry_shard");
+        if (!shard) {
+            ucc_warn("failed to allocate %zd bytes for telemetry shard",
+                     sizeof(*shard));
+        }
+        tm->shards[slot] = shard;
+    }
+    ucc_spin_unlock(&tm->lock);
+    return shard;
+}
+
+void ucc_coll_task_telemetry_record(ucc_coll_task_t *task, ucc_status_t status)
+{
+    ucc_telemetry_t          *tm   = &task->bargs.team->telemetry;
+    int                       slot = ucc_telemetry_slot();
+    uint64_t                  ns;
+    ucc_telemetry_shard_t    *shard;
+    ucc_telemetry_counters_t *c;
+
+    ns    = (uint64_t)ucs_time_to_nsec(ucc_telemetry_timestamp() -
+                                       task->telemetry_ts);
+    shard = tm->shards[slot];
+    if (ucc_unlikely(!shard)) {
+        shard = ucc_telemetry_shard_alloc(tm, slot);
+        if (!shard) {
+            return;
+        }
+    }
+    c = &shard->counters[ucc_ilog2(task->bargs.args.coll_type)]
+                        [task->telemetry_bucket];
+    if (ucc_likely(slot < UCC_TELEMETRY_MAX_THREADS)) {
+        ucc_telemetry_update(c, ns, status);
+    } else {
+        ucc_spin_lock(&tm->lock);
+        ucc_telemetry_update(c, ns, status);
+        ucc_spin_unlock(&tm->lock);
+    }
+}
+
+/* Sums the counters over all the shards. Shards of other threads are read
+   without synchronization, so the result is a snapshot that can miss the
+   collectives completing concurrently. */
+static void ucc_telemetry_collect(ucc_telemetry_t *tm, int coll, int bucket,
+                                  ucc_telemetry_counters_t *sum)
+{
+    ucc_telemetry_counters_t *c;
+    int                       i, k;
+
+    memset(sum, 0, sizeof(*sum));
+    for (i = 0; i <= UCC_TELEMETRY_MAX_THREADS; i++) {
+        if (!tm->shards[i]) {
+            continue;
+        }
+        c              = &tm->shards[i]->counters[coll][bucket];
+        sum->n_colls  += c->n_colls;
+        sum->n_errors += c->n_errors;
+        sum->total_ns += c->total_ns;
+        for (k = 0; k < UCC_COLL_TELEMETRY_LAT_BUCKETS; k++) {
+            sum->lat_hist[k] += c->lat_hist[k];
+        }
+    }
+}
+
+ucc_status_t ucc_telemetry_query(ucc_telemetry_t *tm, ucc_coll_telemetry_t *out)
+{
+    uint32_t                    capacity = out->n_entries;
+    uint32_t                    n        = 0;
+    ucc_telemetry_counters_t    sum;
+    ucc_coll_telemetry_entry_t *e;
+    int                         i, j;
+
+    for (i = 0; i < UCC_COLL_TYPE_NUM; i++) {
+        for (j = 0; j < UCC_COLL_TELEMETRY_MSG_BUCKETS; j++) {
+            ucc_telemetry_collect(tm, i, j, &sum);
+            if (sum.n_colls == 0) {
+                continue;
+            }
+            if (out->entries && n < capacity) {
+                e                 = &out->entries[n];
+                e->coll_type      = (ucc_coll_type_t)UCC_BIT(i);
+                e->msgsize_bucket = j;
+                e->n_colls        = sum.n_colls;
+                e->n_errors       = sum.n_errors;
+                e->total_ns       = sum.total_ns;
+                memcpy(e->lat_hist, sum.lat_hist, sizeof(e->lat_hist));
+            }
+            n++;
+        }
+    }
+    out->n_entries = n;
+    return UCC_OK;
+}
+
+/* Upper bound of the latency bucket containing given percentile */
+static uint64_t ucc_telemetry_percentile(const ucc_telemetry_counters_t *c,
+                                         int pct)
+{
+    uint64_t target = (c->n_colls * pct + 99) / 100;
+    uint64_t acc    = 0;
+    int      k;
+
+    for (k = 0; k < UCC_COLL_TELEMETRY_LAT_BUCKETS - 1; k++) {
+        acc += c->lat_hist[k];
+        if (acc >= target) {
+            break;
+        }
+    }
+    return UCC_BIT(k + 9);
+}
+
+void ucc_telemetry_print(ucc_team_t *team)
+{
+    ucc_telemetry_counters_t sum;
+    int                      i, j;
+    char                     range_str[64];
+
+    for (i = 0; i < UCC_COLL_TYPE_NUM; i++) {
+        for (j = 0; j < UCC_COLL_TELEMETRY_MSG_BUCKETS; j++) {
+            ucc_telemetry_collect(&team->telemetry, i, j, &sum);
+            if (sum.n_colls == 0) {
+                continue;
+            }
+            if (j == UCC_COLL_TELEMETRY_MSG_BUCKETS - 1) {
+                ucc_strncpy_safe(range_str, "unknown", sizeof(range_str));
+            } else {
+                ucc_memunits_range_str(
+                    j ? UCC_BIT(2 * j) : 0,
+                    j == UCC_COLL_TELEMETRY_MSG_BUCKETS - 2
+                        ? UCC_MSG_MAX
+                        : UCC_BIT(2 * j + 2) - 1,
+                    range_str, sizeof(range_str));
+            }
+            ucc_coll_trace_info(
+                "telemetry team_id %d rank %u: %s msgsize {%s} count %lu "
+                "errors %lu avg %.2f us p50 < %.2f us p99 < %.2f us",
+                team->id, team->rank,
+                ucc_coll_type_str((ucc_coll_type_t)UCC_BIT(i)), range_str,
+                sum.n_colls, sum.n_errors,
+                sum.total_ns / 1e3 / sum.n_colls,
+                ucc_telemetry_percentile(&sum, 50) / 1e3,
+                ucc_telemetry_percentile(&sum, 99) / 1e3);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_TELEMETRY_H_
+#define UCC_TELEMETRY_H_
+
+#include "ucc/api/ucc.h"
+#include "utils/ucc_coll_utils.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_spinlock.h"
+#include <ucs/time/time.h>
+
+/* Max number of threads that get a private telemetry shard. Threads beyond
+   this limit share one shard that is updated under the lock. */
+#define UCC_TELEMETRY_MAX_THREADS 64
+
+typedef struct ucc_telemetry_counters {
+    uint64_t n_colls;
+    uint64_t n_errors;
+    uint64_t total_ns;
+    uint64_t lat_hist[UCC_COLL_TELEMETRY_LAT_BUCKETS];
+} ucc_telemetry_counters_t;
+
+/* Counters accumulated by a single thread, allocated on the first
+   collective completed by that thread on the team */
+typedef struct ucc_telemetry_shard {
+    ucc_telemetry_counters_t
+        counters[UCC_COLL_TYPE_NUM][UCC_COLL_TELEMETRY_MSG_BUCKETS];
+} ucc_telemetry_shard_t;
+
+typedef struct ucc_telemetry {
+    ucc_spinlock_t         lock;
+    ucc_telemetry_shard_t *shards[UCC_TELEMETRY_MAX_THREADS + 1];
+} ucc_telemetry_t;
+
+typedef struct ucc_team ucc_team_t;
+
+static inline uint64_t ucc_telemetry_timestamp(void)
+{
+    return ucs_get_time();
+}
+
+/* Message size bucket of the collective, computed once at init so that
+   post and completion paths only touch precomputed values */
+static inline uint32_t ucc_telemetry_msg_bucket(const ucc_coll_args_t *args,
+                                                ucc_rank_t rank,
+                                                ucc_rank_t size)
+{
+    size_t msgsize;
+
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_ALLGATHERV:
+    case UCC_COLL_TYPE_REDUCE_SCATTERV:
+    case UCC_COLL_TYPE_ALLTOALLV:
+    case UCC_COLL_TYPE_GATHERV:
+    case UCC_COLL_TYPE_SCATTERV:
+        /* total size requires pass over the counts array */
+        return UCC_COLL_TELEMETRY_MSG_BUCKETS - 1;
+    default:
+        break;
+    }
+    msgsize = ucc_coll_args_msgsize(args, rank, size);
+    if (msgsize == 0) {
+        return 0;
+    }
+    return ucc_min(ucc_ilog2(msgsize) / 2, UCC_COLL_TELEMETRY_MSG_BUCKETS - 2);
+}
+
+void ucc_telemetry_init(ucc_telemetry_t *tm);
+
+void ucc_telemetry_cleanup(ucc_telemetry_t *tm);
+
+ucc_status_t ucc_telemetry_query(ucc_telemetry_t *tm,
+                                 ucc_coll_telemetry_t *out);
+
+void ucc_telemetry_print(ucc_team_t *team);
+
+#endif
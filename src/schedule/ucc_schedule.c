@@ -127,6 +127,10 @@ ucc_status_t ucc_coll_task_init(ucc_coll_task_t *task,
         memcpy(&task->bargs, bargs, sizeof(*bargs));
     }
     ucc_lf_queue_init_elem(&task->lf_elem);
+    UCC_TASK_TIMELINE_EVENT(UCC_TIMELINE_TASK_INIT, task,
+                            bargs ? ucc_coll_type_str(bargs->args.coll_type)
+                                  : "task",
+                            0, 0, 0);
     return ucc_event_manager_init(task);
 }
 
@@ -148,6 +152,14 @@ ucc_status_t ucc_coll_task_get_executor(ucc_coll_task_t *task,
     return st;
 }
 
+static const char *ucc_event_names[UCC_EVENT_LAST] = {
+    [UCC_EVENT_COMPLETED]          = "completed",
+    [UCC_EVENT_SCHEDULE_STARTED]   = "schedule_started",
+    [UCC_EVENT_TASK_STARTED]       = "task_started",
+    [UCC_EVENT_COMPLETED_SCHEDULE] = "completed_schedule",
+    [UCC_EVENT_ERROR]              = "error",
+};
+
 static ucc_status_t ucc_task_error_handler(ucc_coll_task_t *parent_task,
                                            ucc_coll_task_t *task)
 {
@@ -185,6 +197,9 @@ ucc_status_t ucc_event_manager_notify(ucc_coll_task_t *parent_task,
                 continue;
             }
             if (em->listeners[i].event == event) {
+                UCC_TASK_TIMELINE_EVENT(UCC_TIMELINE_TASK_EVENT, parent_task,
+                                        ucc_event_names[event],
+                                        (uintptr_t)task, 0, 0);
                 status = em->listeners[i].handler(parent_task, task);
                 if (ucc_unlikely(status != UCC_OK)) {
                     return status;
@@ -255,6 +270,7 @@ ucc_status_t ucc_task_start_handler(ucc_coll_task_t *parent,
                                     ucc_coll_task_t *task)
 {
     task->start_time = parent->start_time;
+    UCC_TASK_TIMELINE_POST(task);
     return task->post(task);
 }
 
@@ -12,6 +12,7 @@
 #include "utils/ucc_log.h"
 #include "utils/ucc_lock_free_queue.h"
 #include "utils/ucc_coll_utils.h"
+#include "utils/ucc_timeline.h"
 #include "components/base/ucc_base_iface.h"
 #include "components/ec/ucc_ec.h"
 #include "components/mc/ucc_mc.h"
@@ -75,6 +76,13 @@ enum {
     UCC_COLL_TASK_FLAG_IS_SCHEDULE           = UCC_BIT(5),
     /* if set task can be casted to scheulde */
     UCC_COLL_TASK_FLAG_IS_PIPELINED_SCHEDULE = UCC_BIT(6),
+    /* record latency of user visible task in team telemetry */
+    UCC_COLL_TASK_FLAG_TELEMETRY             = UCC_BIT(7),
+    /* triggered on CPU thread ee, completion is reported by
+       UCC_EVENT_COLLECTIVE_COMPLETE on the ee */
+    UCC_COLL_TASK_FLAG_EE_COMPLETE_EVENT     = UCC_BIT(8),
+    /* schedule of user collectives created by ucc_collective_init_batch */
+    UCC_COLL_TASK_FLAG_BATCH                 = UCC_BIT(9),
 
 };
 
@@ -86,33 +94,39 @@ typedef struct ucc_coll_task {
      *  by core level to avoid potential races
      */
     ucc_status_t                       status;
-    ucc_list_link_t                    em_list;
-    ucc_base_coll_args_t               bargs;
-    ucc_base_team_t                   *team; /* CL/TL team pointer */
-    ucc_schedule_t                    *schedule;
+    /* status and the fields below up to schedule are touched by the
+       progress queue and task completion, they fill the first cache line,
+       see test_obj_size */
     uint32_t                           flags;
-    ucc_coll_post_fn_t                 post;
-    ucc_coll_triggered_post_setup_fn_t triggered_post_setup;
-    ucc_coll_triggered_post_fn_t       triggered_post;
+    uint32_t                           seq_num;
     ucc_coll_progress_fn_t             progress;
-    ucc_coll_finalize_fn_t             finalize;
-    ucc_coll_callback_t                cb;
-    ucc_ee_h                           ee;
-    ucc_ev_t                          *ev;
-    ucc_coll_task_t                   *triggered_task;
-    ucc_ee_executor_t                 *executor;
     union {
         /* used for st & locked mt progress queue */
         ucc_list_link_t                list_elem;
         /* used for lf mt progress queue */
         ucc_lf_queue_elem_t            lf_elem;
     };
+    ucc_base_team_t                   *team; /* CL/TL team pointer */
+    ucc_schedule_t                    *schedule;
+    ucc_ee_executor_t                 *executor;
+    ucc_coll_callback_t                cb;
+    ucc_list_link_t                    em_list;
+    ucc_coll_post_fn_t                 post;
+    ucc_coll_finalize_fn_t             finalize;
+    ucc_coll_triggered_post_setup_fn_t triggered_post_setup;
+    ucc_coll_triggered_post_fn_t       triggered_post;
+    ucc_ee_h                           ee;
+    ucc_ev_t                          *ev;
+    ucc_coll_task_t                   *triggered_task;
     uint32_t                           n_deps;
     uint32_t                           n_deps_satisfied;
     uint32_t                           n_deps_base;
+    /* msg size bucket and post timestamp, used if telemetry is enabled */
+    uint32_t                           telemetry_bucket;
+    uint64_t                           telemetry_ts;
     /* timestamp of the start time: either post or triggered_post */
     double                             start_time;
-    uint32_t                           seq_num;
+    ucc_base_coll_args_t               bargs;
 } ucc_coll_task_t;
 
 extern struct ucc_mpool_ops ucc_coll_task_mpool_ops;
@@ -166,6 +180,24 @@ ucc_status_t ucc_dependency_handler(ucc_coll_task_t *parent,
 ucc_status_t ucc_triggered_post(ucc_ee_h ee, ucc_ev_t *ev,
                                 ucc_coll_task_t *task);
 
+void ucc_coll_task_telemetry_record(ucc_coll_task_t *task, ucc_status_t status);
+
+void ucc_coll_task_ee_complete(ucc_coll_task_t *task);
+
+#define UCC_TASK_TIMELINE_EVENT(_type, _task, _name, _arg0, _arg1, _arg2)     \
+    UCC_TIMELINE_EVENT((_type), (_name),                                       \
+                       (_task)->team                                           \
+                           ? (_task)->team->context->lib->log_component.name   \
+                           : "UCC",                                            \
+                       (_task), (_arg0), (_arg1), (_arg2))
+
+/* Begins the timeline slice of the task, to be used right before post */
+#define UCC_TASK_TIMELINE_POST(_task)                                          \
+    UCC_TASK_TIMELINE_EVENT(UCC_TIMELINE_TASK_POST, (_task),                   \
+                            ucc_coll_type_str((_task)->bargs.args.coll_type),  \
+                            (_task)->seq_num, (uintptr_t)(_task)->schedule,    \
+                            (_task)->flags)
+
 static inline ucc_status_t ucc_task_complete(ucc_coll_task_t *task)
 {
     ucc_status_t        status    = task->status;
@@ -228,6 +260,17 @@ static inline ucc_status_t ucc_task_complete(ucc_coll_task_t *task)
         task->executor = NULL;
     }
 
+    if (task->flags & UCC_COLL_TASK_FLAG_TELEMETRY) {
+        ucc_coll_task_telemetry_record(task, status);
+    }
+    UCC_TASK_TIMELINE_EVENT(UCC_TIMELINE_TASK_COMPLETE, task,
+                            ucc_coll_type_str(task->bargs.args.coll_type),
+                            status, 0, 0);
+
+    if (task->flags & UCC_COLL_TASK_FLAG_EE_COMPLETE_EVENT) {
+        /* before status update, task can be released right after it */
+        ucc_coll_task_ee_complete(task);
+    }
     task->super.status = status;
     if (has_cb) {
         cb.cb(cb.data, status);
@@ -41,6 +41,7 @@ static ucc_status_t ucc_frag_start_handler(ucc_coll_task_t *parent,
                   schedule->next_frag_to_post);
     schedule->n_frags_started++;
     schedule->n_frags_in_pipeline++;
+    UCC_TASK_TIMELINE_POST(task);
     return task->post(task);
 }
 
@@ -263,6 +264,7 @@ ucc_status_t ucc_dependency_handler(ucc_coll_task_t *parent,
                   n_deps_satisfied);
     if (task->n_deps == n_deps_satisfied + 1) {
         task->start_time = parent->start_time;
+        UCC_TASK_TIMELINE_POST(task);
         status = task->post(task);
         if (status >= 0) {
             ucc_event_manager_notify(task, UCC_EVENT_TASK_STARTED);
@@ -189,8 +189,11 @@ typedef enum ucc_memory_type {
  *
  *  @ref ucc_datatype_t represents the datatypes supported by the UCC library’s
  *  collective and reduction operations. The predefined operations
- *  are signed and unsigned integers of various sizes, float 16, 32, and 64, and
- *  user-defined datatypes. User-defined datatypes are created using
+ *  are signed and unsigned integers of various sizes, float 16, 32, and 64,
+ *  8-bit floats in E4M3 and E5M2 encodings, value-index pairs, and
+ *  user-defined datatypes. The value-index pairs have the layout of the C
+ *  structure {value; int32_t index;} and are used with @ref UCC_OP_MAXLOC
+ *  and @ref UCC_OP_MINLOC. User-defined datatypes are created using
  *  @ref ucc_dt_create_generic interface and can support user-defined reduction
  *  operations. Predefined reduction operations can be used only with
  *  predefined datatypes.
@@ -218,7 +221,13 @@ typedef uint64_t ucc_datatype_t;
 #define UCC_DT_FLOAT32_COMPLEX  UCC_PREDEFINED_DT(15)
 #define UCC_DT_FLOAT64_COMPLEX  UCC_PREDEFINED_DT(16)
 #define UCC_DT_FLOAT128_COMPLEX UCC_PREDEFINED_DT(17)
-#define UCC_DT_PREDEFINED_LAST  18
+#define UCC_DT_FLOAT8_E4M3      UCC_PREDEFINED_DT(18)
+#define UCC_DT_FLOAT8_E5M2      UCC_PREDEFINED_DT(19)
+#define UCC_DT_FLOAT32_INT32    UCC_PREDEFINED_DT(20)
+#define UCC_DT_FLOAT64_INT32    UCC_PREDEFINED_DT(21)
+#define UCC_DT_INT32_INT32      UCC_PREDEFINED_DT(22)
+#define UCC_DT_INT64_INT32      UCC_PREDEFINED_DT(23)
+#define UCC_DT_PREDEFINED_LAST  24
 
 /**
  * @ingroup UCC_DATATYPE
@@ -446,7 +455,8 @@ void ucc_dt_destroy(ucc_datatype_t datatype);
  *  @ref ucc_reduction_op_t  represents the UCC reduction operations. It is used by the
  *  library initialization routine @ref ucc_init to request the operations expected by the user.
  *  It is used by the @ref ucc_lib_attr_t to communicate the operations supported by
- *  the library.
+ *  the library. @ref UCC_OP_MAXLOC and @ref UCC_OP_MINLOC select the pair with
+ *  the largest (smallest) value, the smallest index wins on equal values.
  *
  *  @endparblock
  *
@@ -1222,7 +1232,8 @@ enum ucc_team_attr_field {
     UCC_TEAM_ATTR_FIELD_SYNC_TYPE              = UCC_BIT(4),
     UCC_TEAM_ATTR_FIELD_MEM_PARAMS             = UCC_BIT(5),
     UCC_TEAM_ATTR_FIELD_SIZE                   = UCC_BIT(6),
-    UCC_TEAM_ATTR_FIELD_EPS                    = UCC_BIT(7)
+    UCC_TEAM_ATTR_FIELD_EPS                    = UCC_BIT(7),
+    UCC_TEAM_ATTR_FIELD_TELEMETRY              = UCC_BIT(8)
 };
 
 /**
@@ -1483,6 +1494,75 @@ typedef struct ucc_team_params {
     uint64_t                id;
 } ucc_team_params_t;
 
+/**
+ *  @ingroup UCC_TEAM_DT
+ *
+ *  Number of message size buckets of the collective telemetry. Bucket "b"
+ *  counts collectives with the local message size in [4^b, 4^(b+1)) bytes,
+ *  zero size collectives go to bucket 0 and the largest sizes are accumulated
+ *  in bucket UCC_COLL_TELEMETRY_MSG_BUCKETS - 2. The last bucket is used for
+ *  collectives whose message size is not known locally (e.g. alltoallv).
+ */
+#define UCC_COLL_TELEMETRY_MSG_BUCKETS 16
+
+/**
+ *  @ingroup UCC_TEAM_DT
+ *
+ *  Number of latency histogram buckets of the collective telemetry. Bucket "k"
+ *  counts collectives completed in [2^(k+8), 2^(k+9)) nanoseconds, the first
+ *  and the last buckets are open ended.
+ */
+#define UCC_COLL_TELEMETRY_LAT_BUCKETS 24
+
+/**
+ *
+ *  @ingroup UCC_TEAM_DT
+ *
+ *  @brief Telemetry of the collectives of one type and message size bucket
+ *
+ *  Latency is measured locally from @ref ucc_collective_post (or triggered
+ *  post) to the completion of the request.
+ */
+typedef struct ucc_coll_telemetry_entry {
+    ucc_coll_type_t coll_type;
+    uint32_t        msgsize_bucket; /*< see UCC_COLL_TELEMETRY_MSG_BUCKETS */
+    uint64_t        n_colls;        /*< number of completed collectives */
+    uint64_t        n_errors;       /*< number of collectives completed with
+                                        error */
+    uint64_t        total_ns;       /*< accumulated latency */
+    uint64_t        lat_hist[UCC_COLL_TELEMETRY_LAT_BUCKETS];
+} ucc_coll_telemetry_entry_t;
+
+/**
+ *
+ *  @ingroup UCC_TEAM_DT
+ *
+ *  @brief Collective telemetry of the team
+ *
+ *  @parblock
+ *
+ *  Description
+ *
+ *  On input @ref ucc_coll_telemetry.n_entries is the capacity of the
+ *  user provided @ref ucc_coll_telemetry.entries array. On output it is set
+ *  to the number of non-empty (coll_type, msgsize_bucket) entries of the
+ *  team, only the first "capacity" of them are written. The entries may be
+ *  NULL to query the required capacity.
+ *
+ *  @ref ucc_coll_telemetry.n_fused_colls and
+ *  @ref ucc_coll_telemetry.n_fusion_batches report the collectives that were
+ *  fused by @ref ucc_collective_fusion_start window and the number of fused
+ *  collectives they were packed into.
+ *
+ *  @endparblock
+ */
+typedef struct ucc_coll_telemetry {
+    uint32_t                    n_entries;
+    ucc_coll_telemetry_entry_t *entries;
+    uint64_t                    n_fused_colls;
+    uint64_t                    n_fusion_batches;
+} ucc_coll_telemetry_t;
+
 /**
  *
  *  @ingroup UCC_TEAM_DT
@@ -1512,6 +1592,7 @@ typedef struct ucc_team_attr {
     ucc_mem_map_params_t   mem_params;
     uint32_t               size;
     uint64_t              *eps;
+    ucc_coll_telemetry_t   telemetry;
 } ucc_team_attr_t;
 
 
@@ -1944,6 +2025,40 @@ typedef struct ucc_coll_args {
 ucc_status_t ucc_collective_init(ucc_coll_args_t *coll_args,
                                  ucc_coll_req_h *request, ucc_team_h team);
 
+/**
+ *  @ingroup UCC_COLLECTIVES
+ *
+ *  @brief The routine to initialize a batch of collective operations.
+ *
+ *  @param [in]     coll_args   Array of collective arguments descriptors
+ *  @param [in]     teams       Array of team handles, teams[i] is the team
+ *                              of coll_args[i]
+ *  @param [in]     n_colls     Number of collectives in the batch, up to 64
+ *  @param [out]    request     Request handle representing the batch
+ *
+ *  @parblock
+ *
+ *  @b Description
+ *
+ *  @ref ucc_collective_init_batch initializes each collective as
+ *  @ref ucc_collective_init does and returns one request for all of them.
+ *  The collectives may be on different teams and contexts. A single
+ *  @ref ucc_collective_post starts all the collectives of the batch, so
+ *  their communication phases overlap and are advanced by the same progress
+ *  calls. The request completes when all the collectives complete, its
+ *  status is an error if any of them fails. Per collective callbacks
+ *  provided in coll_args are called on completion of each collective. The
+ *  request is finalized with @ref ucc_collective_finalize. It can be posted
+ *  again if all the collectives are persistent.
+ *
+ *  @endparblock
+ *
+ *  @return Error code as defined by @ref ucc_status_t
+ */
+ucc_status_t ucc_collective_init_batch(ucc_coll_args_t *coll_args,
+                                       ucc_team_h *teams, uint32_t n_colls,
+                                       ucc_coll_req_h *request);
+
 /**
  *  @ingroup UCC_COLLECTIVES
  *
@@ -1966,6 +2081,56 @@ ucc_status_t ucc_collective_init(ucc_coll_args_t *coll_args,
  */
 ucc_status_t ucc_collective_post(ucc_coll_req_h request);
 
+/**
+ *  @ingroup UCC_COLLECTIVES
+ *
+ *  @brief The routine opens the fusion window on the team.
+ *
+ *  @param [in]     team        Team handle
+ *
+ *  @parblock
+ *
+ *  @b Description
+ *
+ *  @ref ucc_collective_fusion_start opens the fusion window on the team.
+ *  Small allreduce operations on host memory posted on the team until
+ *  @ref ucc_collective_fusion_end may be deferred and packed into a single
+ *  allreduce; their requests are completed individually once it finishes.
+ *  Allreduce operations are packed together if they have the same datatype
+ *  and reduction operation. The size limits are defined by
+ *  UCC_FUSION_MAX_MSGSIZE, UCC_FUSION_MAX_BYTES and UCC_FUSION_MAX_COLLS
+ *  context parameters. A deferred request does not complete until the
+ *  window is closed, so the user must not wait for it inside the window.
+ *  Posting any other collective on the team inside the window first posts
+ *  the deferred ones. All the participants must post the same sequence of
+ *  collectives inside the window. The routine is local.
+ *
+ *  @endparblock
+ *
+ *  @return Error code as defined by @ref ucc_status_t
+ */
+ucc_status_t ucc_collective_fusion_start(ucc_team_h team);
+
+/**
+ *  @ingroup UCC_COLLECTIVES
+ *
+ *  @brief The routine closes the fusion window on the team.
+ *
+ *  @param [in]     team        Team handle
+ *
+ *  @parblock
+ *
+ *  @b Description
+ *
+ *  @ref ucc_collective_fusion_end posts the collectives deferred since
+ *  @ref ucc_collective_fusion_start and closes the fusion window.
+ *
+ *  @endparblock
+ *
+ *  @return Error code as defined by @ref ucc_status_t
+ */
+ucc_status_t ucc_collective_fusion_end(ucc_team_h team);
+
 
 /**
  *
@@ -2206,7 +2371,9 @@ ucc_status_t ucc_ee_ack_event(ucc_ee_h ee, ucc_ev_t *ev);
  * @ref ucc_ee_set_event sets the event on the execution engine. If the
  * operations are waiting on the event when the user sets the event, the
  * operations are launched. The events created by the user need to be destroyed
- * by the user.
+ * by the user. For @ref UCC_EE_CPU_THREAD execution engine of the context with
+ * UCC_THREAD_MULTIPLE thread mode the waiting operations are launched from the
+ * calling thread before the routine returns.
  *
  * @endparblock
  *
@@ -2252,6 +2419,10 @@ ucc_status_t ucc_ee_wait(ucc_ee_h ee, ucc_ev_t *ev);
  * operation that executes in the future when an event occurs on the execution
  * engine. On error, request handle associated with event becomes invalid,
  * user is responsible to call ucc_collective_finalize to free allocated resources.
+ * For @ref UCC_EE_CPU_THREAD execution engine the operation waits for
+ * UCC_EVENT_COMPUTE_COMPLETE event set with @ref ucc_ee_set_event, and its
+ * completion is reported by UCC_EVENT_COLLECTIVE_COMPLETE event on the
+ * execution engine in addition to the request status.
  *
  * @endparblock
  *
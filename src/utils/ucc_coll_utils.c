@@ -340,6 +340,70 @@ int ucc_coll_args_is_predefined_dt(const ucc_coll_args_t *args, ucc_rank_t rank)
     }
 }
 
+int ucc_coll_args_is_noncontig_dt(const ucc_coll_args_t *args, ucc_rank_t rank)
+{
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_BARRIER:
+    case UCC_COLL_TYPE_FANIN:
+    case UCC_COLL_TYPE_FANOUT:
+        return 0;
+    case UCC_COLL_TYPE_ALLREDUCE:
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+    case UCC_COLL_TYPE_ALLGATHER:
+    case UCC_COLL_TYPE_ALLTOALL:
+        return UCC_DT_IS_NONCONTIG(args->dst.info.datatype) ||
+               (!UCC_IS_INPLACE(*args) &&
+                UCC_DT_IS_NONCONTIG(args->src.info.datatype));
+    case UCC_COLL_TYPE_ALLGATHERV:
+    case UCC_COLL_TYPE_REDUCE_SCATTERV:
+        return UCC_DT_IS_NONCONTIG(args->dst.info_v.datatype) ||
+               (!UCC_IS_INPLACE(*args) &&
+                UCC_DT_IS_NONCONTIG(args->src.info.datatype));
+    case UCC_COLL_TYPE_ALLTOALLV:
+        return UCC_DT_IS_NONCONTIG(args->dst.info_v.datatype) ||
+               (!UCC_IS_INPLACE(*args) &&
+                UCC_DT_IS_NONCONTIG(args->src.info_v.datatype));
+    case UCC_COLL_TYPE_BCAST:
+        return UCC_DT_IS_NONCONTIG(args->src.info.datatype);
+    case UCC_COLL_TYPE_GATHER:
+    case UCC_COLL_TYPE_REDUCE:
+        if (UCC_IS_ROOT(*args, rank)) {
+            return UCC_DT_IS_NONCONTIG(args->dst.info.datatype) ||
+                   (!UCC_IS_INPLACE(*args) &&
+                    UCC_DT_IS_NONCONTIG(args->src.info.datatype));
+        } else {
+            return UCC_DT_IS_NONCONTIG(args->src.info.datatype);
+        }
+    case UCC_COLL_TYPE_GATHERV:
+        if (UCC_IS_ROOT(*args, rank)) {
+            return UCC_DT_IS_NONCONTIG(args->dst.info_v.datatype) ||
+                   (!UCC_IS_INPLACE(*args) &&
+                    UCC_DT_IS_NONCONTIG(args->src.info.datatype));
+        } else {
+            return UCC_DT_IS_NONCONTIG(args->src.info.datatype);
+        }
+    case UCC_COLL_TYPE_SCATTER:
+        if (UCC_IS_ROOT(*args, rank)) {
+            return UCC_DT_IS_NONCONTIG(args->src.info.datatype) ||
+                   (!UCC_IS_INPLACE(*args) &&
+                    UCC_DT_IS_NONCONTIG(args->dst.info.datatype));
+        } else {
+            return UCC_DT_IS_NONCONTIG(args->dst.info.datatype);
+        }
+    case UCC_COLL_TYPE_SCATTERV:
+        if (UCC_IS_ROOT(*args, rank)) {
+            return UCC_DT_IS_NONCONTIG(args->src.info_v.datatype) ||
+                   (!UCC_IS_INPLACE(*args) &&
+                    UCC_DT_IS_NONCONTIG(args->dst.info.datatype));
+        } else {
+            return UCC_DT_IS_NONCONTIG(args->dst.info.datatype);
+        }
+    default:
+        ucc_error("invalid collective type %d", args->coll_type);
+        return -1;
+    }
+}
+
 ucc_memory_type_t ucc_coll_args_mem_type(const ucc_coll_args_t *args,
                                          ucc_rank_t rank)
 {
@@ -380,6 +444,9 @@ ucc_memory_type_t ucc_coll_args_mem_type(const ucc_coll_args_t *args,
     return UCC_MEMORY_TYPE_UNKNOWN;
 }
 
+#define UCC_BUFFER_INFO_MSGSIZE(_info, _count)                                 \
+    ucc_dt_packed_size((_info).datatype, (_info).buffer, (_count))
+
 size_t ucc_coll_args_msgsize(const ucc_coll_args_t *args, ucc_rank_t rank,
                              ucc_rank_t size)
 {
@@ -391,17 +458,17 @@ size_t ucc_coll_args_msgsize(const ucc_coll_args_t *args, ucc_rank_t rank,
     case UCC_COLL_TYPE_FANOUT:
         return 0;
     case UCC_COLL_TYPE_BCAST:
-        return args->src.info.count * ucc_dt_size(args->src.info.datatype);
+        return UCC_BUFFER_INFO_MSGSIZE(args->src.info, args->src.info.count);
     case UCC_COLL_TYPE_ALLREDUCE:
     case UCC_COLL_TYPE_ALLTOALL:
     case UCC_COLL_TYPE_ALLGATHER:
     case UCC_COLL_TYPE_REDUCE_SCATTER:
-        return args->dst.info.count * ucc_dt_size(args->dst.info.datatype);
+        return UCC_BUFFER_INFO_MSGSIZE(args->dst.info, args->dst.info.count);
     case UCC_COLL_TYPE_ALLGATHERV:
     case UCC_COLL_TYPE_REDUCE_SCATTERV:
-        return ucc_coll_args_get_total_count(args, args->dst.info_v.counts,
-                                             size) *
-               ucc_dt_size(args->dst.info_v.datatype);
+        return UCC_BUFFER_INFO_MSGSIZE(args->dst.info_v,
+                   ucc_coll_args_get_total_count(args, args->dst.info_v.counts,
+                                                 size));
     case UCC_COLL_TYPE_ALLTOALLV:
     case UCC_COLL_TYPE_GATHERV:
     case UCC_COLL_TYPE_SCATTERV:
@@ -412,19 +479,20 @@ size_t ucc_coll_args_msgsize(const ucc_coll_args_t *args, ucc_rank_t rank,
         return UCC_MSG_SIZE_ASYMMETRIC;
     case UCC_COLL_TYPE_REDUCE:
         return (root == rank)
-                   ? args->dst.info.count * ucc_dt_size(args->dst.info.datatype)
-                   : args->src.info.count *
-                         ucc_dt_size(args->src.info.datatype);
+                   ? UCC_BUFFER_INFO_MSGSIZE(args->dst.info,
+                                             args->dst.info.count)
+                   : UCC_BUFFER_INFO_MSGSIZE(args->src.info,
+                                             args->src.info.count);
     case UCC_COLL_TYPE_GATHER:
         return (root == rank)
-                 ? args->dst.info.count * ucc_dt_size(args->dst.info.datatype)
-                 : args->src.info.count * ucc_dt_size(args->src.info.datatype) *
-                   size;
+                 ? UCC_BUFFER_INFO_MSGSIZE(args->dst.info, args->dst.info.count)
+                 : UCC_BUFFER_INFO_MSGSIZE(args->src.info,
+                                           args->src.info.count) * size;
     case UCC_COLL_TYPE_SCATTER:
         return (root == rank)
-                 ? args->src.info.count * ucc_dt_size(args->src.info.datatype)
-                 : args->dst.info.count * ucc_dt_size(args->dst.info.datatype) *
-                   size;
+                 ? UCC_BUFFER_INFO_MSGSIZE(args->src.info, args->src.info.count)
+                 : UCC_BUFFER_INFO_MSGSIZE(args->dst.info,
+                                           args->dst.info.count) * size;
     default:
         ucc_assert(args->coll_type == UCC_COLL_TYPE_LAST);
     }
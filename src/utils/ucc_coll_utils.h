@@ -426,6 +426,11 @@ static inline size_t ucc_buffer_block_offset_aligned(size_t total_count,
                            operations. */
 int ucc_coll_args_is_predefined_dt(const ucc_coll_args_t *args, ucc_rank_t rank);
 
+/* Returns non-zero if any buffer of the collective defined by args that is
+   used by the rank is described by a non-contiguous generic datatype, i.e.
+   has to be packed/unpacked with the datatype callbacks. */
+int ucc_coll_args_is_noncontig_dt(const ucc_coll_args_t *args, ucc_rank_t rank);
+
 int ucc_coll_args_is_mem_symmetric(const ucc_coll_args_t *args, ucc_rank_t rank);
 
 int ucc_coll_args_is_rooted(ucc_coll_type_t ct);
@@ -21,11 +21,22 @@ ucc_dt_reduce_userdefined(void *src1, void *src2, void *dst, size_t n_vectors,
                                      .n_vectors = n_vectors,
                                      .count     = count,
                                      .stride    = stride,
-                                     .dt        = dt};
+                                     .dt        = dt,
+                                     .cb_ctx    = dt->ops.reduce.cb_ctx};
 
     return dt->ops.reduce.cb(&params);
 }
 
+/* User-defined reductions are run by the host executor which batches the
+   callback over whole vectors. Other executors can not call into the user
+   code, for them the callback is invoked in place. */
+static inline int ucc_dt_reduce_userdefined_inline(ucc_datatype_t     dt,
+                                                   ucc_ee_executor_t *exec)
+{
+    ucc_assert(UCC_DT_HAS_REDUCE(dt));
+    return !exec || exec->ee_type != UCC_EE_CPU_THREAD;
+}
+
 static inline ucc_status_t
 ucc_dt_reduce_strided(void *src1, void *src2, void *dst, size_t n_vectors,
                       size_t count, size_t stride, ucc_datatype_t dt,
@@ -38,8 +49,8 @@ ucc_dt_reduce_strided(void *src1, void *src2, void *dst, size_t n_vectors,
         *task = NULL;
         return UCC_OK;
     }
-    if (!UCC_DT_IS_PREDEFINED(dt)) {
-        ucc_assert(UCC_DT_HAS_REDUCE(dt));
+    if (!UCC_DT_IS_PREDEFINED(dt) &&
+        ucc_dt_reduce_userdefined_inline(dt, exec)) {
         *task = NULL;
         return ucc_dt_reduce_userdefined(src1, src2, dst, n_vectors, count,
                                          stride, ucc_dt_to_generic(dt));
@@ -79,6 +90,9 @@ static inline ucc_status_t ucc_dt_reduce_multi(void **srcs, void *dst,
                                                ucc_ee_executor_task_t **task)
 {
     ucc_ee_executor_task_args_t eargs;
+    ucc_status_t                status;
+    size_t                      i, first;
+    void                       *acc;
 
     ucc_assert(n_srcs <= UCC_EE_EXECUTOR_NUM_BUFS);
     if (count == 0 || n_srcs == 0) {
@@ -86,11 +100,30 @@ static inline ucc_status_t ucc_dt_reduce_multi(void **srcs, void *dst,
         return UCC_OK;
     }
 
-    if (!UCC_DT_IS_PREDEFINED(dt)) {
-        ucc_assert(UCC_DT_HAS_REDUCE(dt));
+    if (!UCC_DT_IS_PREDEFINED(dt) &&
+        ucc_dt_reduce_userdefined_inline(dt, exec)) {
         *task = NULL;
-        return ucc_dt_reduce_userdefined(srcs, NULL, dst, n_srcs, count, 0,
-                                         ucc_dt_to_generic(dt));
+        /* source aliased by dst goes first so it is consumed before
+           overwrite, same as the host executor does */
+        first = 0;
+        for (i = 1; i < n_srcs; i++) {
+            if (srcs[i] == dst) {
+                first = i;
+            }
+        }
+        acc = srcs[first];
+        for (i = 0; i < n_srcs; i++) {
+            if (i == first) {
+                continue;
+            }
+            status = ucc_dt_reduce_userdefined(acc, srcs[i], dst, 1, count, 0,
+                                               ucc_dt_to_generic(dt));
+            if (ucc_unlikely(UCC_OK != status)) {
+                return status;
+            }
+            acc = dst;
+        }
+        return UCC_OK;
     } else {
         eargs.task_type = UCC_EE_EXECUTOR_TASK_REDUCE;
         eargs.flags = flags;
@@ -100,7 +133,7 @@ static inline ucc_status_t ucc_dt_reduce_multi(void **srcs, void *dst,
         eargs.reduce.op = args->op;
         eargs.reduce.dst = dst;
         eargs.reduce.n_srcs = n_srcs;
-        for (size_t i = 0; i < n_srcs; i++) {
+        for (i = 0; i < n_srcs; i++) {
             eargs.reduce.srcs[i] = srcs[i];
         }
 
@@ -108,4 +141,51 @@ static inline ucc_status_t ucc_dt_reduce_multi(void **srcs, void *dst,
     }
 }
 
+/* Reduction that also copies the result to "n_dst2" extra buffers, it is
+   implemented by the host executor only */
+static inline int ucc_dt_reduce_copy_supported(ucc_ee_executor_t *exec)
+{
+    return exec && exec->ee_type == UCC_EE_CPU_THREAD;
+}
+
+static inline ucc_status_t
+ucc_dt_reduce_multi_copy(void **srcs, void *dst, size_t n_srcs, void **dst2,
+                         size_t n_dst2, size_t count, ucc_datatype_t dt,
+                         ucc_coll_args_t *args, uint16_t flags, double alpha,
+                         ucc_ee_executor_t *exec, ucc_ee_executor_task_t **task)
+{
+    ucc_ee_executor_task_args_t eargs;
+    size_t                      i;
+
+    if (n_dst2 == 0) {
+        return ucc_dt_reduce_multi(srcs, dst, n_srcs, count, dt, args, flags,
+                                   alpha, exec, task);
+    }
+    ucc_assert(n_srcs <= UCC_EE_EXECUTOR_NUM_BUFS);
+    ucc_assert(n_dst2 <= UCC_EE_EXECUTOR_REDUCE_COPY_NUM_DST);
+    ucc_assert(ucc_dt_reduce_copy_supported(exec));
+    if (count == 0 || n_srcs == 0) {
+        *task = NULL;
+        return UCC_OK;
+    }
+
+    eargs.task_type = UCC_EE_EXECUTOR_TASK_REDUCE_COPY;
+    eargs.flags     = flags;
+    eargs.reduce_copy.reduce.alpha  = alpha;
+    eargs.reduce_copy.reduce.count  = count;
+    eargs.reduce_copy.reduce.dt     = dt;
+    eargs.reduce_copy.reduce.op     = args->op;
+    eargs.reduce_copy.reduce.dst    = dst;
+    eargs.reduce_copy.reduce.n_srcs = n_srcs;
+    for (i = 0; i < n_srcs; i++) {
+        eargs.reduce_copy.reduce.srcs[i] = srcs[i];
+    }
+    eargs.reduce_copy.n_dst2 = n_dst2;
+    for (i = 0; i < n_dst2; i++) {
+        eargs.reduce_copy.dst2[i] = dst2[i];
+    }
+
+    return ucc_ee_executor_task_post(exec, &eargs, task);
+}
+
 #endif
@@ -158,6 +158,18 @@ static inline const char* ucc_datatype_str(ucc_datatype_t dt)
         return "float64";
     case UCC_DT_FLOAT128:
         return "float128";
+    case UCC_DT_FLOAT8_E4M3:
+        return "float8_e4m3";
+    case UCC_DT_FLOAT8_E5M2:
+        return "float8_e5m2";
+    case UCC_DT_FLOAT32_INT32:
+        return "float32_int32";
+    case UCC_DT_FLOAT64_INT32:
+        return "float64_int32";
+    case UCC_DT_INT32_INT32:
+        return "int32_int32";
+    case UCC_DT_INT64_INT32:
+        return "int64_int32";
     case UCC_DT_INT128:
         return "int128";
     case UCC_DT_UINT128:
@@ -12,6 +12,10 @@
 #include "ucc_datastruct.h"
 #include "ucc/api/ucc.h"
 #include "ucc_compiler_def.h"
+#include <string.h>
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
 
 #define ucc_min(_a, _b) ucs_min((_a), (_b))
 #define ucc_max(_a, _b) ucs_max((_a), (_b))
@@ -102,6 +106,170 @@ static inline void float32tobfloat16(float float_val, void *bfloat16_ptr)
 #endif
 }
 
+static inline float ucc_float32_from_bits(uint32_t bits)
+{
+    float res;
+
+    memcpy(&res, &bits, sizeof(res));
+    return res;
+}
+
+static inline uint32_t ucc_float32_to_bits(float val)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &val, sizeof(bits));
+    return bits;
+}
+
+/* Rounds the magnitude of fp32 to a narrow float with the given number of
+   mantissa bits and exponent bias using round-to-nearest-even, subnormals of
+   the target format are produced. Returns the magnitude encoding, values
+   above max_code are encoded as ovf_code. NaN/Inf are handled by callers. */
+static inline uint32_t ucc_float32_to_narrow(uint32_t absx, int man_bits,
+                                             int bias, uint32_t max_code,
+                                             uint32_t ovf_code)
+{
+    int      exp = (int)(absx >> 23) - 127 + bias;
+    uint32_t q, rem, half, shift;
+
+    if (exp >= 1) {
+        shift = 23 - man_bits;
+        q     = ((uint32_t)exp << man_bits) | ((absx & 0x7fffff) >> shift);
+        rem   = absx & ((1u << shift) - 1);
+    } else {
+        /* target subnormal: significand with the implicit bit in units of
+           the smallest target subnormal */
+        shift = 24 - man_bits - exp;
+        if (absx < 0x800000 || shift > 25) {
+            return 0;
+        }
+        absx = (absx & 0x7fffff) | 0x800000;
+        q    = absx >> shift;
+        rem  = absx & ((1u << shift) - 1);
+    }
+    half = 1u << (shift - 1);
+    if (rem > half || (rem == half && (q & 1))) {
+        q++;
+    }
+    return (q > max_code) ? ovf_code : q;
+}
+
+/* Decodes a finite narrow float magnitude to fp32 */
+static inline float ucc_narrow_to_float32(uint32_t v, int man_bits, int bias)
+{
+    uint32_t exp  = v >> man_bits;
+    uint32_t mant = v & ((1u << man_bits) - 1);
+
+    if (exp == 0) {
+        return (float)mant *
+               ucc_float32_from_bits((uint32_t)(128 - bias - man_bits) << 23);
+    }
+    return ucc_float32_from_bits(((exp - bias + 127) << 23) |
+                                 (mant << (23 - man_bits)));
+}
+
+/* IEEE 754 binary16 */
+static inline float float16tofloat32(const void *float16_ptr)
+{
+#ifdef __F16C__
+    return _cvtsh_ss(*((uint16_t *)float16_ptr));
+#else
+    uint16_t h    = *((uint16_t *)float16_ptr);
+    uint32_t sign = ((uint32_t)h & 0x8000) << 16;
+    float    res;
+
+    if ((h & 0x7c00) == 0x7c00) {
+        /* Inf or NaN, NaNs are quieted */
+        return ucc_float32_from_bits(sign | 0x7f800000 |
+                                     ((h & 0x3ff) ? 0x400000 : 0) |
+                                     ((uint32_t)(h & 0x3ff) << 13));
+    }
+    res = ucc_narrow_to_float32(h & 0x7fff, 10, 15);
+    return sign ? -res : res;
+#endif
+}
+
+static inline void float32tofloat16(float float_val, void *float16_ptr)
+{
+#ifdef __F16C__
+    *((uint16_t *)float16_ptr) =
+        _cvtss_sh(float_val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+    uint32_t x    = ucc_float32_to_bits(float_val);
+    uint32_t sign = (x >> 16) & 0x8000;
+    uint32_t absx = x & 0x7fffffff;
+
+    if (absx > 0x7f800000) {
+        /* quiet NaN, keep the top payload bits */
+        *((uint16_t *)float16_ptr) = sign | 0x7e00 | ((absx >> 13) & 0x3ff);
+        return;
+    }
+    *((uint16_t *)float16_ptr) =
+        sign | ucc_float32_to_narrow(absx, 10, 15, 0x7bff, 0x7c00);
+#endif
+}
+
+/* OCP FP8 E4M3: no infinities, S.1111.111 is NaN, max finite is 448.
+   Overflow and infinities saturate to the max finite value. */
+static inline float float8e4m3tofloat32(const void *fp8_ptr)
+{
+    uint8_t v = *((uint8_t *)fp8_ptr);
+    float   res;
+
+    if ((v & 0x7f) == 0x7f) {
+        return ucc_float32_from_bits(((uint32_t)(v & 0x80) << 24) |
+                                     0x7fc00000);
+    }
+    res = ucc_narrow_to_float32(v & 0x7f, 3, 7);
+    return (v & 0x80) ? -res : res;
+}
+
+static inline void float32tofloat8e4m3(float float_val, void *fp8_ptr)
+{
+    uint32_t x    = ucc_float32_to_bits(float_val);
+    uint32_t sign = (x >> 24) & 0x80;
+    uint32_t absx = x & 0x7fffffff;
+
+    if (absx > 0x7f800000) {
+        *((uint8_t *)fp8_ptr) = sign | 0x7f;
+    } else if (absx == 0x7f800000) {
+        *((uint8_t *)fp8_ptr) = sign | 0x7e;
+    } else {
+        *((uint8_t *)fp8_ptr) =
+            sign | ucc_float32_to_narrow(absx, 3, 7, 0x7e, 0x7e);
+    }
+}
+
+/* OCP FP8 E5M2: IEEE-like, overflow goes to infinity */
+static inline float float8e5m2tofloat32(const void *fp8_ptr)
+{
+    uint8_t  v    = *((uint8_t *)fp8_ptr);
+    uint32_t sign = (uint32_t)(v & 0x80) << 24;
+    float    res;
+
+    if ((v & 0x7c) == 0x7c) {
+        return ucc_float32_from_bits(sign | 0x7f800000 |
+                                     ((uint32_t)(v & 0x3) << 21));
+    }
+    res = ucc_narrow_to_float32(v & 0x7f, 2, 15);
+    return sign ? -res : res;
+}
+
+static inline void float32tofloat8e5m2(float float_val, void *fp8_ptr)
+{
+    uint32_t x    = ucc_float32_to_bits(float_val);
+    uint32_t sign = (x >> 24) & 0x80;
+    uint32_t absx = x & 0x7fffffff;
+
+    if (absx > 0x7f800000) {
+        *((uint8_t *)fp8_ptr) = sign | 0x7e;
+    } else {
+        *((uint8_t *)fp8_ptr) =
+            sign | ucc_float32_to_narrow(absx, 2, 15, 0x7b, 0x7c);
+    }
+}
+
 #define ucc_padding(_n, _alignment)                                            \
     ( ((_alignment) - (_n) % (_alignment)) % (_alignment) )
 
@@ -1,6 +1,16 @@
 #include "ucc_mpool.h"
 #include "ucc_malloc.h"
 #include "ucc_log.h"
+#include "ucc_math.h"
+#include "core/ucc_global_opts.h"
+#include <pthread.h>
+
+__thread int ucc_mpool_thread_slot = 0;
+
+static pthread_once_t  ucc_mpool_tslot_once  = PTHREAD_ONCE_INIT;
+static pthread_key_t   ucc_mpool_tslot_key;
+static pthread_mutex_t ucc_mpool_tslot_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t        ucc_mpool_tslot_used  = 0;
 
 static ucc_mpool_ops_t ucc_default_mpool_ops = {
     .chunk_alloc   = ucc_mpool_hugetlb_malloc,
@@ -37,6 +47,103 @@ static void ucc_mpool_obj_cleanup_wrapper(ucs_mpool_t *mp, void *obj)
     mpool->ucc_ops->obj_cleanup(mpool, obj);
 }
 
+static void ucc_mpool_tslot_release(void *arg)
+{
+    int slot = (int)(uintptr_t)arg - 1;
+
+    pthread_mutex_lock(&ucc_mpool_tslot_mutex);
+    ucc_mpool_tslot_used &= ~UCC_BIT(slot);
+    pthread_mutex_unlock(&ucc_mpool_tslot_mutex);
+}
+
+static void ucc_mpool_tslot_key_init(void)
+{
+    pthread_key_create(&ucc_mpool_tslot_key, ucc_mpool_tslot_release);
+}
+
+/* Assigns a cache slot to the calling thread. The slot goes back to the
+   free set on thread exit, so the cache of the exited thread (and objects
+   in it) is inherited by the next thread that gets the same slot. */
+static int ucc_mpool_tslot_assign(void)
+{
+    int slot = -1;
+    int i;
+
+    pthread_once(&ucc_mpool_tslot_once, ucc_mpool_tslot_key_init);
+    pthread_mutex_lock(&ucc_mpool_tslot_mutex);
+    for (i = 0; i < UCC_MPOOL_TCACHE_MAX_THREADS; i++) {
+        if (!(ucc_mpool_tslot_used & UCC_BIT(i))) {
+            ucc_mpool_tslot_used |= UCC_BIT(i);
+            slot = i;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&ucc_mpool_tslot_mutex);
+    if (slot < 0) {
+        return -1;
+    }
+    pthread_setspecific(ucc_mpool_tslot_key, (void *)(uintptr_t)(slot + 1));
+    ucc_mpool_thread_slot = slot + 1;
+    return slot;
+}
+
+ucc_mpool_tcache_t *ucc_mpool_tcache_get_slow(ucc_mpool_t *mp)
+{
+    int                 slot = ucc_mpool_thread_slot - 1;
+    ucc_mpool_tcache_t *tc;
+
+    if (slot < 0) {
+        if (ucc_mpool_thread_slot < 0) {
+            /* all slots are taken, use locked path */
+            return NULL;
+        }
+        slot = ucc_mpool_tslot_assign();
+        if (slot < 0) {
+            ucc_mpool_thread_slot = -1;
+            return NULL;
+        }
+        if (mp->tcache[slot]) {
+            return mp->tcache[slot];
+        }
+    }
+    tc = ucc_malloc(sizeof(*tc) + mp->tcache_size * sizeof(void *),
+                    "mpool_tcache");
+    if (!tc) {
+        return NULL;
+    }
+    tc->count        = 0;
+    mp->tcache[slot] = tc;
+    return tc;
+}
+
+void *ucc_mpool_tcache_refill(ucc_mpool_t *mp, ucc_mpool_tcache_t *tc)
+{
+    unsigned batch = ucc_max(mp->tcache_size / 2, 1);
+    void    *obj;
+
+    ucc_spin_lock(&mp->lock);
+    while (tc->count < batch) {
+        obj = ucs_mpool_get(&mp->super);
+        if (!obj) {
+            break;
+        }
+        tc->objs[tc->count++] = obj;
+    }
+    ucc_spin_unlock(&mp->lock);
+    return tc->count ? tc->objs[--tc->count] : NULL;
+}
+
+void ucc_mpool_tcache_drain(ucc_mpool_t *mp, ucc_mpool_tcache_t *tc)
+{
+    unsigned keep = mp->tcache_size / 2;
+
+    ucc_spin_lock(&mp->lock);
+    while (tc->count > keep) {
+        ucs_mpool_put(tc->objs[--tc->count]);
+    }
+    ucc_spin_unlock(&mp->lock);
+}
+
 ucc_status_t ucc_mpool_init(ucc_mpool_t *mp, size_t priv_size, size_t elem_size,
                             size_t align_offset, size_t alignment,
                             unsigned elems_per_chunk, unsigned max_elems,
@@ -44,6 +151,7 @@ ucc_status_t ucc_mpool_init(ucc_mpool_t *mp, size_t priv_size, size_t elem_size,
                             const char *name)
 {
     ucs_mpool_ops_t *ucs_ops = ucc_calloc(1, sizeof(*ucs_ops), "mpool_ops");
+    ucc_status_t     status;
 #if UCS_HAVE_MPOOL_PARAMS
     ucs_mpool_params_t params;
 #endif
@@ -56,6 +164,22 @@ ucc_status_t ucc_mpool_init(ucc_mpool_t *mp, size_t priv_size, size_t elem_size,
 
     ucc_spinlock_init(&mp->lock, 0);
     mp->tm                 = tm;
+    mp->tcache_size        = 0;
+    mp->tcache             = NULL;
+    /* Bounded pools keep the locked path: per-thread caches could hold
+       objects other threads are starving for */
+    if (UCC_THREAD_MULTIPLE == tm && max_elems == UINT_MAX &&
+        ucc_global_config.mpool_tcache_size > 0) {
+        mp->tcache = ucc_calloc(UCC_MPOOL_TCACHE_MAX_THREADS,
+                                sizeof(*mp->tcache), "mpool_tcache_array");
+        if (!mp->tcache) {
+            ucc_error("failed to allocate %zd bytes for mpool tcache array",
+                      UCC_MPOOL_TCACHE_MAX_THREADS * sizeof(*mp->tcache));
+            ucc_free(ucs_ops);
+            return UCC_ERR_NO_MEMORY;
+        }
+        mp->tcache_size = ucc_global_config.mpool_tcache_size;
+    }
     mp->ucc_ops            = ops ? ops : &ucc_default_mpool_ops;
     ucs_ops->chunk_alloc   = ucc_mpool_chunk_alloc_wrapper;
     ucs_ops->chunk_release = ucc_mpool_chunk_release_wrapper;
@@ -79,18 +203,36 @@ ucc_status_t ucc_mpool_init(ucc_mpool_t *mp, size_t priv_size, size_t elem_size,
     params.ops             = ucs_ops;
     params.name            = name;
 
-    return ucs_status_to_ucc_status(ucs_mpool_init(&params, &mp->super));
+    status = ucs_status_to_ucc_status(ucs_mpool_init(&params, &mp->super));
 #else
-    return ucs_status_to_ucc_status(
+    status = ucs_status_to_ucc_status(
         ucs_mpool_init(&mp->super, priv_size, elem_size, align_offset,
                        alignment, elems_per_chunk, max_elems, ucs_ops, name));
 #endif
+    if (UCC_OK != status) {
+        ucc_free(mp->tcache);
+        mp->tcache = NULL;
+    }
+    return status;
 }
 
 void ucc_mpool_cleanup(ucc_mpool_t *mp, int leak_check)
 {
     void *ops = (void*)mp->super.data->ops;
+    int   i;
 
+    if (mp->tcache) {
+        for (i = 0; i < UCC_MPOOL_TCACHE_MAX_THREADS; i++) {
+            if (!mp->tcache[i]) {
+                continue;
+            }
+            while (mp->tcache[i]->count) {
+                ucs_mpool_put(mp->tcache[i]->objs[--mp->tcache[i]->count]);
+            }
+            ucc_free(mp->tcache[i]);
+        }
+        ucc_free(mp->tcache);
+    }
     ucs_mpool_cleanup(&mp->super, leak_check);
     ucc_free(ops);
     ucc_spinlock_destroy(&mp->lock);
@@ -22,13 +22,31 @@ typedef struct ucc_mpool_ops {
     void (*obj_cleanup)(ucc_mpool_t *mp, void *obj);
 } ucc_mpool_ops_t;
 
+/* Max number of threads that can own a per-thread cache at the same time.
+   Threads beyond this limit fall back to the locked path. */
+#define UCC_MPOOL_TCACHE_MAX_THREADS 64
+
+/* Per-thread cache (magazine) of objects. Only the owning thread touches
+   it, objects are moved to/from the global pool in batches under the lock. */
+typedef struct ucc_mpool_tcache {
+    unsigned count;
+    void    *objs[];
+} ucc_mpool_tcache_t;
+
 struct ucc_mpool {
-    ucs_mpool_t       super;
-    ucc_mpool_ops_t * ucc_ops;
-    ucc_thread_mode_t tm;
-    ucc_spinlock_t    lock;
+    ucs_mpool_t          super;
+    ucc_mpool_ops_t *    ucc_ops;
+    ucc_thread_mode_t    tm;
+    ucc_spinlock_t       lock;
+    /* Per-thread caches capacity, 0 if caches are disabled */
+    unsigned             tcache_size;
+    ucc_mpool_tcache_t **tcache;
 };
 
+/* Index (+1) of the per-thread cache slot owned by calling thread,
+   0 if not assigned yet */
+extern __thread int ucc_mpool_thread_slot;
+
 ucc_status_t ucc_mpool_init(ucc_mpool_t *mp, size_t priv_size, size_t elem_size,
                             size_t align_offset, size_t alignment,
                             unsigned elems_per_chunk, unsigned max_elems,
@@ -42,13 +60,36 @@ ucc_status_t ucc_mpool_hugetlb_malloc(ucc_mpool_t *mp, size_t *size_p,
 
 void ucc_mpool_hugetlb_free(ucc_mpool_t *mp, void *chunk);
 
+ucc_mpool_tcache_t *ucc_mpool_tcache_get_slow(ucc_mpool_t *mp);
+
+void *ucc_mpool_tcache_refill(ucc_mpool_t *mp, ucc_mpool_tcache_t *tc);
+
+void ucc_mpool_tcache_drain(ucc_mpool_t *mp, ucc_mpool_tcache_t *tc);
+
+static inline ucc_mpool_tcache_t *ucc_mpool_tcache(ucc_mpool_t *mp)
+{
+    int slot = ucc_mpool_thread_slot - 1;
+
+    if (ucc_likely(slot >= 0 && mp->tcache[slot])) {
+        return mp->tcache[slot];
+    }
+    return ucc_mpool_tcache_get_slow(mp);
+}
+
 static inline void *ucc_mpool_get(ucc_mpool_t *mp)
 {
-    void *ret;
+    ucc_mpool_tcache_t *tc;
+    void *              ret;
 
     if (UCC_THREAD_SINGLE == mp->tm) {
         return ucs_mpool_get(&mp->super);
     }
+    if (mp->tcache_size && (tc = ucc_mpool_tcache(mp))) {
+        if (ucc_likely(tc->count)) {
+            return tc->objs[--tc->count];
+        }
+        return ucc_mpool_tcache_refill(mp, tc);
+    }
     ucc_spin_lock(&mp->lock);
     ret = ucs_mpool_get(&mp->super);
     ucc_spin_unlock(&mp->lock);
@@ -57,13 +98,21 @@ static inline void *ucc_mpool_get(ucc_mpool_t *mp)
 
 static inline void ucc_mpool_put(void *obj)
 {
-    ucs_mpool_elem_t *elem = (ucs_mpool_elem_t *)obj - 1;
-    ucc_mpool_t *     mp   = ucc_derived_of(elem->mpool, ucc_mpool_t);
+    ucs_mpool_elem_t *  elem = (ucs_mpool_elem_t *)obj - 1;
+    ucc_mpool_t *       mp   = ucc_derived_of(elem->mpool, ucc_mpool_t);
+    ucc_mpool_tcache_t *tc;
 
     if (UCC_THREAD_SINGLE == mp->tm) {
         ucs_mpool_put(obj);
         return;
     }
+    if (mp->tcache_size && (tc = ucc_mpool_tcache(mp))) {
+        if (ucc_unlikely(tc->count == mp->tcache_size)) {
+            ucc_mpool_tcache_drain(mp, tc);
+        }
+        tc->objs[tc->count++] = obj;
+        return;
+    }
     ucc_spin_lock(&mp->lock);
     ucs_mpool_put(obj);
     ucc_spin_unlock(&mp->lock);
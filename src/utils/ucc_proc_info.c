@@ -17,6 +17,7 @@
 #include <ucs/sys/uid.h>
 #endif
 #include <dlfcn.h>
+#include <dirent.h>
 
 ucc_proc_info_t ucc_local_proc;
 static char ucc_local_hostname[HOST_NAME_MAX];
@@ -283,6 +284,166 @@ error:
     return status;
 }
 
+#define UCC_SYSFS_IB_PATH       "/sys/class/infiniband"
+#define UCC_SYSFS_NET_PATH      "/sys/class/net"
+#define UCC_MAX_NET_DEVICES     64
+#define UCC_NET_DEVICE_NAME_MAX 64
+
+/* Reads numa node of network device "name[:port]", it is -1 if the device
+   is not attached to a particular numa node */
+static ucc_status_t ucc_net_device_numa_node(const char *dev, int *numa_node)
+{
+    char   name[UCC_NET_DEVICE_NAME_MAX];
+    char   path[PATH_MAX];
+    FILE  *fptr;
+    size_t len;
+
+    len = strcspn(dev, ":");
+    if (len >= sizeof(name)) {
+        return UCC_ERR_INVALID_PARAM;
+    }
+    memcpy(name, dev, len);
+    name[len] = '\0';
+
+    snprintf(path, sizeof(path), UCC_SYSFS_IB_PATH "/%s/device/numa_node",
+             name);
+    fptr = fopen(path, "r");
+    if (!fptr) {
+        snprintf(path, sizeof(path), UCC_SYSFS_NET_PATH "/%s/device/numa_node",
+                 name);
+        fptr = fopen(path, "r");
+    }
+    if (!fptr) {
+        return UCC_ERR_NOT_FOUND;
+    }
+    if (1 != fscanf(fptr, "%d", numa_node)) {
+        *numa_node = -1;
+    }
+    fclose(fptr);
+    return UCC_OK;
+}
+
+static int ucc_net_device_name_cmp(const void *a, const void *b)
+{
+    return strcmp(*(const char **)a, *(const char **)b);
+}
+
+/* Reads the first line of sysfs attribute "path" into "buf" */
+static ucc_status_t ucc_sysfs_read(const char *path, char *buf, int len)
+{
+    FILE *fptr = fopen(path, "r");
+    char *ret;
+
+    if (!fptr) {
+        return UCC_ERR_NOT_FOUND;
+    }
+    ret = fgets(buf, len, fptr);
+    fclose(fptr);
+    return ret ? UCC_OK : UCC_ERR_NO_MESSAGE;
+}
+
+/* Port "port" of IB device "dev" is a rail if it is up and its link layer
+   is InfiniBand, RoCE ports and ports without a link are skipped */
+static int ucc_ib_port_is_rail(const char *dev, const char *port)
+{
+    char path[PATH_MAX];
+    char buf[64];
+
+    snprintf(path, sizeof(path), UCC_SYSFS_IB_PATH "/%s/ports/%s/state", dev,
+             port);
+    /* "4: ACTIVE" */
+    if (UCC_OK != ucc_sysfs_read(path, buf, sizeof(buf)) ||
+        !strstr(buf, "ACTIVE")) {
+        return 0;
+    }
+    snprintf(path, sizeof(path), UCC_SYSFS_IB_PATH "/%s/ports/%s/link_layer",
+             dev, port);
+    return UCC_OK == ucc_sysfs_read(path, buf, sizeof(buf)) &&
+           !strncmp(buf, "InfiniBand", strlen("InfiniBand"));
+}
+
+/* Appends "dev:port" of the active IB ports of "dev" to "names" */
+static unsigned ucc_ib_device_rails(const char *dev,
+                                    char names[][UCC_NET_DEVICE_NAME_MAX],
+                                    unsigned n_names, unsigned max_names)
+{
+    char           path[PATH_MAX];
+    DIR           *dir;
+    struct dirent *entry;
+    int            len;
+
+    snprintf(path, sizeof(path), UCC_SYSFS_IB_PATH "/%s/ports", dev);
+    dir = opendir(path);
+    if (!dir) {
+        return n_names;
+    }
+    while (n_names < max_names && (entry = readdir(dir))) {
+        if (entry->d_name[0] == '.' || !ucc_ib_port_is_rail(dev,
+                                                             entry->d_name)) {
+            continue;
+        }
+        len = snprintf(names[n_names], UCC_NET_DEVICE_NAME_MAX, "%s:%s", dev,
+                       entry->d_name);
+        if (len > 0 && len < UCC_NET_DEVICE_NAME_MAX) {
+            n_names++;
+        }
+    }
+    closedir(dir);
+    return n_names;
+}
+
+void ucc_proc_info_init_rails(ucc_proc_info_t *pi, char **net_devices,
+                              unsigned n_net_devices)
+{
+    char           names[UCC_MAX_NET_DEVICES][UCC_NET_DEVICE_NAME_MAX];
+    char          *all_devices[UCC_MAX_NET_DEVICES];
+    char         **devices   = net_devices;
+    unsigned       n_devices = n_net_devices;
+    DIR           *dir;
+    struct dirent *entry;
+    int            numa_node;
+    unsigned       i;
+
+    pi->n_rails   = 0;
+    pi->rail_mask = 0;
+    if (n_devices == 0) {
+        dir = opendir(UCC_SYSFS_IB_PATH);
+        if (!dir) {
+            ucc_debug("no network devices found in %s", UCC_SYSFS_IB_PATH);
+            return;
+        }
+        while (n_devices < UCC_MAX_NET_DEVICES && (entry = readdir(dir))) {
+            if (entry->d_name[0] == '.') {
+                continue;
+            }
+            n_devices = ucc_ib_device_rails(entry->d_name, names, n_devices,
+                                            UCC_MAX_NET_DEVICES);
+        }
+        closedir(dir);
+        for (i = 0; i < n_devices; i++) {
+            all_devices[i] = names[i];
+        }
+        /* readdir order is arbitrary while rail index must be the same for
+           all the processes of a host */
+        qsort(all_devices, n_devices, sizeof(*all_devices),
+              ucc_net_device_name_cmp);
+        devices = all_devices;
+    }
+
+    for (i = 0; i < n_devices && pi->n_rails < UCC_MAX_RAILS; i++) {
+        if (UCC_OK != ucc_net_device_numa_node(devices[i], &numa_node)) {
+            ucc_debug("network device %s is not found", devices[i]);
+            continue;
+        }
+        if (pi->numa_id != UCC_NUMA_ID_INVALID && numa_node == pi->numa_id) {
+            pi->rail_mask |= UCC_BIT(pi->n_rails);
+        }
+        pi->n_rails++;
+    }
+    ucc_debug("proc pid %d, n_rails %d, rail_mask 0x%x", pi->pid,
+              (int)pi->n_rails, (unsigned)pi->rail_mask);
+}
+
 ucc_status_t ucc_local_proc_info_init()
 {
     ucc_local_proc.host_hash = gethostid();
@@ -297,6 +458,8 @@ ucc_status_t ucc_local_proc_info_init()
     ucc_local_proc.pid       = getpid();
     ucc_local_proc.socket_id = UCC_SOCKET_ID_INVALID;
     ucc_local_proc.numa_id   = UCC_NUMA_ID_INVALID;
+    ucc_local_proc.n_rails   = 0;
+    ucc_local_proc.rail_mask = 0;
 
     if (UCC_OK != ucc_get_bound_socket_id(&ucc_local_proc.socket_id)) {
         ucc_debug("failed to get bound socket id");
@@ -13,6 +13,7 @@
 typedef uint64_t ucc_host_id_t;
 typedef uint8_t  ucc_socket_id_t;
 typedef uint8_t  ucc_numa_id_t;
+typedef uint16_t ucc_rail_mask_t;
 
 #define UCC_SOCKET_ID_INVALID ((ucc_socket_id_t)-1)
 #define UCC_NUMA_ID_INVALID   ((ucc_numa_id_t)-1)
@@ -20,10 +21,15 @@ typedef uint8_t  ucc_numa_id_t;
 #define UCC_MAX_SOCKET_ID (UCC_SOCKET_ID_INVALID - 1)
 #define UCC_MAX_NUMA_ID   (UCC_NUMA_ID_INVALID - 1)
 
+/* Max number of network devices (rails) tracked per process */
+#define UCC_MAX_RAILS     (8 * sizeof(ucc_rail_mask_t))
+
 typedef struct ucc_proc_info {
     ucc_host_id_t   host_hash;
     ucc_socket_id_t socket_id;
     ucc_numa_id_t   numa_id;
+    uint8_t         n_rails;   /*< number of network devices of the host */
+    ucc_rail_mask_t rail_mask; /*< devices on the numa node of the process */
     ucc_host_id_t   host_id;
     pid_t           pid;
 } ucc_proc_info_t;
@@ -36,6 +42,12 @@ extern ucc_proc_info_t ucc_local_proc;
 
 ucc_status_t ucc_local_proc_info_init();
 
+/* Fills n_rails and rail_mask of @pi from sysfs. @net_devices is the list of
+   "device[:port]" names to consider, if it is empty every active InfiniBand
+   port of the host is a rail */
+void ucc_proc_info_init_rails(ucc_proc_info_t *pi, char **net_devices,
+                              unsigned n_net_devices);
+
 uint64_t ucc_get_system_id();
 
 const char*  ucc_hostname();
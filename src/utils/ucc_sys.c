@@ -84,6 +84,32 @@ size_t ucc_get_page_size()
     return page_size;
 }
 
+/**
+ * @return Size of the last level cache, 0 if it can not be detected.
+ */
+size_t ucc_get_llc_size()
+{
+    static long llc_size = -1;
+
+    if (llc_size < 0) {
+        llc_size = 0;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+        llc_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#ifdef _SC_LEVEL2_CACHE_SIZE
+        if (llc_size <= 0) {
+            llc_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        }
+#endif
+        if (llc_size < 0) {
+            llc_size = 0;
+        }
+        ucc_debug("last level cache size %ld", llc_size);
+    }
+
+    return llc_size;
+}
+
 static ucc_status_t ucc_sys_get_lib_info(Dl_info *dl_info)
 {
     int ret;
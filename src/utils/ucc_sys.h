@@ -26,4 +26,6 @@ ucc_status_t ucc_sys_path_join(const char *path1, const char *path2,
 
 size_t ucc_get_page_size();
 
+size_t ucc_get_llc_size();
+
 #endif
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "ucc_timeline.h"
+#include "ucc_malloc.h"
+#include "ucc_log.h"
+#include "ucc_math.h"
+#include "ucc_time.h"
+#include "ucc_datastruct.h"
+#include "ucc_atomic.h"
+#include <ucs/sys/string.h>
+#include <pthread.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+
+int                           ucc_timeline_enabled = 0;
+__thread ucc_timeline_ring_t *ucc_timeline_ring    = NULL;
+
+/* Rings of all the threads that recorded events. The rings of exited threads
+   are kept so that their events are written at dump. */
+static UCC_LIST_HEAD(ucc_timeline_rings);
+
+static struct {
+    pthread_mutex_t lock;
+    uint32_t        n_threads;
+    unsigned        ring_size;
+    uint8_t         alloc_failed; /*< warn about ring allocation once */
+    char            file_name[PATH_MAX];
+    ucc_rank_t      rank;
+    uint64_t        base_ts;      /*< timestamp taken at init */
+    double          base_wall_us; /*< wall clock at init, used to align
+                                      ranks in the merged trace */
+} ucc_timeline = {
+    .lock      = PTHREAD_MUTEX_INITIALIZER,
+    .n_threads = 0,
+    .rank      = UCC_RANK_INVALID,
+};
+
+static const struct {
+    char        ph;
+    const char *arg_names[3];
+} ucc_timeline_event_info[UCC_TIMELINE_EVENT_LAST] = {
+    [UCC_TIMELINE_TASK_INIT]          = {'n', {NULL, NULL, NULL}},
+    [UCC_TIMELINE_TASK_POST]          = {'b', {"seq_num", "schedule",
+                                               "flags"}},
+    [UCC_TIMELINE_TASK_COMPLETE]      = {'e', {"status", NULL, NULL}},
+    [UCC_TIMELINE_TASK_EVENT]         = {'n', {"listener", NULL, NULL}},
+    [UCC_TIMELINE_EXEC_TASK_POST]     = {'b', {"task_type", NULL, NULL}},
+    [UCC_TIMELINE_EXEC_TASK_COMPLETE] = {'e', {NULL, NULL, NULL}},
+    [UCC_TIMELINE_P2P_POST]           = {'b', {"peer", "bytes", "task"}},
+    [UCC_TIMELINE_P2P_COMPLETE]       = {'e', {"status", NULL, NULL}},
+    [UCC_TIMELINE_P2P_INLINE]         = {'n', {"peer", "bytes", "task"}},
+};
+
+void ucc_timeline_init(const char *file_name, unsigned ring_size)
+{
+    if (!file_name || !strlen(file_name) || ring_size == 0) {
+        return;
+    }
+    ucc_strncpy_safe(ucc_timeline.file_name, file_name,
+                     sizeof(ucc_timeline.file_name));
+    ucc_timeline.ring_size    = ucc_round_up_power2(ring_size);
+    ucc_timeline.base_ts      = ucc_timeline_timestamp();
+    ucc_timeline.base_wall_us = ucc_get_time() * UCC_USEC_PER_SEC;
+    ucc_timeline_enabled      = 1;
+}
+
+void ucc_timeline_set_rank(ucc_rank_t rank)
+{
+    ucc_timeline.rank = rank;
+}
+
+ucc_timeline_ring_t *ucc_timeline_ring_create(void)
+{
+    ucc_timeline_ring_t *ring;
+
+    ring = ucc_malloc(sizeof(*ring) +
+                      ucc_timeline.ring_size * sizeof(ucc_timeline_event_t),
+                      "timeline_ring");
+    if (!ring) {
+        if (ucc_atomic_bool_cswap8(&ucc_timeline.alloc_failed, 0, 1)) {
+            ucc_warn("failed to allocate timeline buffer, tracing of the "
+                     "thread is disabled");
+        }
+        ucc_timeline_ring = UCC_TIMELINE_RING_FAILED;
+        return UCC_TIMELINE_RING_FAILED;
+    }
+    ring->mask = ucc_timeline.ring_size - 1;
+    ring->head = 0;
+    pthread_mutex_lock(&ucc_timeline.lock);
+    ring->tid = ucc_timeline.n_threads++;
+    ucc_list_add_tail(&ucc_timeline_rings, &ring->list_elem);
+    pthread_mutex_unlock(&ucc_timeline.lock);
+    ucc_timeline_ring = ring;
+    return ring;
+}
+
+static void ucc_timeline_write_event(FILE *f, int pid, uint32_t tid,
+                                     const ucc_timeline_event_t *ev)
+{
+    const char *const *arg_names =
+        ucc_timeline_event_info[ev->type].arg_names;
+    double             ts        = ucc_timeline.base_wall_us +
+                                   ucs_time_to_usec(ev->ts -
+                                                    ucc_timeline.base_ts);
+    int                i, n_args;
+
+    fprintf(f,
+            ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\","
+            "\"id\":\"0x%" PRIx64 "\",\"ts\":%.3f,\"pid\":%d,\"tid\":%u",
+            ev->name, ev->cat, ucc_timeline_event_info[ev->type].ph, ev->id,
+            ts, pid, tid);
+    for (i = 0, n_args = 0; i < 3; i++) {
+        if (!arg_names[i]) {
+            continue;
+        }
+        fprintf(f, "%s\"%s\":%" PRId64, n_args++ ? "," : ",\"args\":{",
+                arg_names[i], (int64_t)ev->args[i]);
+    }
+    fprintf(f, "%s}", n_args ? "}" : "");
+}
+
+void ucc_timeline_dump(void)
+{
+    int                  pid;
+    char                 file_name[PATH_MAX];
+    ucc_timeline_ring_t *ring;
+    uint64_t             i, first;
+    FILE                *f;
+
+    if (!ucc_timeline_enabled) {
+        return;
+    }
+    pid = (ucc_timeline.rank == UCC_RANK_INVALID) ? (int)getpid()
+                                                  : (int)ucc_timeline.rank;
+    ucs_fill_filename_template(ucc_timeline.file_name, file_name,
+                               sizeof(file_name));
+    f = fopen(file_name, "w");
+    if (!f) {
+        ucc_warn("failed to open timeline file %s: %m", file_name);
+        return;
+    }
+    fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+               "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+               "\"args\":{\"name\":\"rank %d\"}}",
+            pid, pid);
+
+    pthread_mutex_lock(&ucc_timeline.lock);
+    ucc_list_for_each(ring, &ucc_timeline_rings, list_elem) {
+        first = (ring->head > ring->mask) ? ring->head - ring->mask - 1 : 0;
+        if (first) {
+            ucc_info("timeline buffer of thread %u wrapped, %" PRIu64
+                     " oldest events are lost", ring->tid, first);
+        }
+        for (i = first; i < ring->head; i++) {
+            ucc_timeline_write_event(f, pid, ring->tid,
+                                     &ring->events[i & ring->mask]);
+        }
+        ring->head = 0;
+    }
+    pthread_mutex_unlock(&ucc_timeline.lock);
+
+    fprintf(f, "\n]}\n");
+    fclose(f);
+    ucc_info("timeline is written to %s", file_name);
+}
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_TIMELINE_H_
+#define UCC_TIMELINE_H_
+
+#include "config.h"
+#include "ucc/api/ucc.h"
+#include "utils/ucc_compiler_def.h"
+#include "utils/ucc_datastruct.h"
+#include "utils/ucc_list.h"
+#include <ucs/time/time.h>
+
+/* Timeline records lifecycle events of collective tasks, executor tasks and
+   p2p operations into per-thread ring buffers. The buffers are written as
+   Chrome trace (Perfetto compatible) JSON when the library is finalized.
+   Each task, executor task and p2p request is an async slice keyed by its
+   pointer. */
+
+typedef enum ucc_timeline_event_type {
+    UCC_TIMELINE_TASK_INIT,
+    UCC_TIMELINE_TASK_POST,
+    UCC_TIMELINE_TASK_COMPLETE,
+    UCC_TIMELINE_TASK_EVENT,
+    UCC_TIMELINE_EXEC_TASK_POST,
+    UCC_TIMELINE_EXEC_TASK_COMPLETE,
+    UCC_TIMELINE_P2P_POST,
+    UCC_TIMELINE_P2P_COMPLETE,
+    UCC_TIMELINE_P2P_INLINE, /*< p2p completed immediately at post */
+    UCC_TIMELINE_EVENT_LAST
+} ucc_timeline_event_type_t;
+
+typedef struct ucc_timeline_event {
+    uint64_t    ts;
+    uint64_t    id;
+    uint64_t    args[3];
+    const char *name;
+    const char *cat;
+    uint8_t     type;
+} ucc_timeline_event_t;
+
+typedef struct ucc_timeline_ring {
+    ucc_list_link_t      list_elem;
+    uint32_t             tid;
+    uint64_t             mask;
+    uint64_t             head; /*< number of events ever recorded */
+    ucc_timeline_event_t events[];
+} ucc_timeline_ring_t;
+
+extern int                           ucc_timeline_enabled;
+extern __thread ucc_timeline_ring_t *ucc_timeline_ring;
+
+/* Ring of a thread that failed to allocate it, the events are dropped */
+#define UCC_TIMELINE_RING_FAILED ((ucc_timeline_ring_t *)0x1)
+
+/* Allocates the ring of the calling thread, returns
+   UCC_TIMELINE_RING_FAILED on failure */
+ucc_timeline_ring_t *ucc_timeline_ring_create(void);
+
+void ucc_timeline_init(const char *file_name, unsigned ring_size);
+
+void ucc_timeline_set_rank(ucc_rank_t rank);
+
+/* Writes the events of all threads and resets the buffers */
+void ucc_timeline_dump(void);
+
+static inline uint64_t ucc_timeline_timestamp(void)
+{
+    return ucs_get_time();
+}
+
+static inline void ucc_timeline_record(ucc_timeline_event_type_t type,
+                                       const char *name, const char *cat,
+                                       const void *id, uint64_t arg0,
+                                       uint64_t arg1, uint64_t arg2)
+{
+    ucc_timeline_ring_t  *ring = ucc_timeline_ring;
+    ucc_timeline_event_t *ev;
+
+    if (ucc_unlikely(!ring)) {
+        ring = ucc_timeline_ring_create();
+    }
+    if (ucc_unlikely(ring == UCC_TIMELINE_RING_FAILED)) {
+        return;
+    }
+    ev          = &ring->events[ring->head & ring->mask];
+    ev->ts      = ucc_timeline_timestamp();
+    ev->id      = (uint64_t)(uintptr_t)id;
+    ev->args[0] = arg0;
+    ev->args[1] = arg1;
+    ev->args[2] = arg2;
+    ev->name    = name;
+    ev->cat     = cat;
+    ev->type    = type;
+    ring->head++;
+}
+
+#define UCC_TIMELINE_EVENT(_type, _name, _cat, _id, _arg0, _arg1, _arg2)      \
+    do {                                                                       \
+        if (ucc_unlikely(ucc_timeline_enabled)) {                              \
+            ucc_timeline_record((_type), (_name), (_cat), (_id),               \
+                                (uint64_t)(_arg0), (uint64_t)(_arg1),          \
+                                (uint64_t)(_arg2));                            \
+        }                                                                      \
+    } while (0)
+
+#endif
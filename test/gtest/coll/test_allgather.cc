@@ -6,17 +6,22 @@
 
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#include "test_generic_dt.h"
 
 using Param_0 = std::tuple<int, ucc_datatype_t, ucc_memory_type_t, int, gtest_ucc_inplace_t>;
 using Param_1 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, gtest_ucc_inplace_t>;
 using Param_2 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, gtest_ucc_inplace_t, std::string>;
+using Param_3 = std::tuple<ucc_datatype_t, int, gtest_ucc_inplace_t, std::string, std::string>;
+using Param_4 = std::tuple<int, gtest_ucc_inplace_t>;
 
 class test_allgather : public UccCollArgs, public ucc::test
 {
 public:
     void data_init(int nprocs, ucc_datatype_t dtype, size_t single_rank_count,
-                   UccCollCtxVec &ctxs, bool persistent)
+                   UccCollCtxVec &ctxs, UccTeam_h team, bool persistent)
     {
+        bool is_onesided = (NULL != team);
+
         ctxs.resize(nprocs);
         for (auto r = 0; r < nprocs; r++) {
             ucc_coll_args_t *coll = (ucc_coll_args_t*)
@@ -43,9 +48,18 @@ public:
             }
 
             ctxs[r]->rbuf_size = ucc_dt_size(dtype) * single_rank_count * nprocs;
-            UCC_CHECK(ucc_mc_alloc(&ctxs[r]->dst_mc_header, ctxs[r]->rbuf_size,
-                                   mem_type));
-            coll->dst.info.buffer = ctxs[r]->dst_mc_header->addr;
+            if (is_onesided) {
+                coll->mask  = UCC_COLL_ARGS_FIELD_FLAGS |
+                              UCC_COLL_ARGS_FIELD_GLOBAL_WORK_BUFFER;
+                coll->flags = UCC_COLL_ARGS_FLAG_MEM_MAPPED_BUFFERS;
+                coll->src.info.buffer    = team->procs[r].p->onesided_buf[0];
+                coll->dst.info.buffer    = team->procs[r].p->onesided_buf[1];
+                coll->global_work_buffer = team->procs[r].p->onesided_buf[2];
+            } else {
+                UCC_CHECK(ucc_mc_alloc(&ctxs[r]->dst_mc_header,
+                                       ctxs[r]->rbuf_size, mem_type));
+                coll->dst.info.buffer = ctxs[r]->dst_mc_header->addr;
+            }
             if (TEST_INPLACE == inplace) {
                 coll->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
                 coll->flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
@@ -55,10 +69,13 @@ public:
                     ctxs[r]->init_buf, ucc_dt_size(dtype) * single_rank_count,
                     mem_type, UCC_MEMORY_TYPE_HOST));
             } else {
-                UCC_CHECK(ucc_mc_alloc(&ctxs[r]->src_mc_header,
-                                       ucc_dt_size(dtype) * single_rank_count,
-                                       mem_type));
-                coll->src.info.buffer = ctxs[r]->src_mc_header->addr;
+                if (!is_onesided) {
+                    UCC_CHECK(ucc_mc_alloc(&ctxs[r]->src_mc_header,
+                                           ucc_dt_size(dtype) *
+                                               single_rank_count,
+                                           mem_type));
+                    coll->src.info.buffer = ctxs[r]->src_mc_header->addr;
+                }
                 UCC_CHECK(ucc_mc_memcpy(coll->src.info.buffer, ctxs[r]->init_buf,
                                         ucc_dt_size(dtype) * single_rank_count,
                                         mem_type, UCC_MEMORY_TYPE_HOST));
@@ -69,6 +86,20 @@ public:
             }
         }
     }
+    void data_init(int nprocs, ucc_datatype_t dtype, size_t single_rank_count,
+                   UccCollCtxVec &ctxs, bool persistent)
+    {
+        data_init(nprocs, dtype, single_rank_count, ctxs, NULL, persistent);
+    }
+    void data_fini_onesided(UccCollCtxVec ctxs)
+    {
+        for (gtest_ucc_coll_ctx_t *ctx : ctxs) {
+            ucc_free(ctx->init_buf);
+            free(ctx->args);
+            free(ctx);
+        }
+        ctxs.clear();
+    }
     void data_fini(UccCollCtxVec ctxs)
     {
         for (gtest_ucc_coll_ctx_t* ctx : ctxs) {
@@ -254,6 +285,31 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(1,3,8192), // count
         ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));
 
+UCC_TEST_F(test_allgather, shm_cma)
+{
+    /* local contexts: all ranks on one node */
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_TLS", "ucp,shm"},
+                             {"UCC_TL_SHM_TUNE", "allgather:@cma:0-inf:inf"},
+                             {"UCC_CLS", "basic"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_LOCAL, env);
+    UccTeam_h     team = job.create_team(n_procs);
+    UccCollCtxVec ctxs;
+
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    for (auto count : {3, 65536}) {
+        for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+            set_inplace(inplace);
+            data_init(n_procs, UCC_DT_INT32, count, ctxs, false);
+            UccReq req(team, ctxs);
+            req.start();
+            req.wait();
+            EXPECT_EQ(true, data_validate(ctxs));
+            data_fini(ctxs);
+        }
+    }
+}
+
 class test_allgather_alg : public test_allgather,
         public ::testing::WithParamInterface<Param_2> {};
 
@@ -307,3 +363,120 @@ INSTANTIATE_TEST_CASE_P(
             name += std::string("_")+std::get<4>(info.param);
             return name;
         });
+
+class test_allgather_onesided : public test_allgather,
+        public ::testing::WithParamInterface<Param_3> {};
+
+UCC_TEST_P(test_allgather_onesided, alg)
+{
+    const ucc_datatype_t      dtype   = std::get<0>(GetParam());
+    const int                 count   = std::get<1>(GetParam());
+    const gtest_ucc_inplace_t inplace = std::get<2>(GetParam());
+    const std::string         tls     = std::get<4>(GetParam());
+    int                       n_procs = 7;
+    std::string               tune;
+    const char               *tls_bkp;
+
+    tune = "allgather:0-inf:@" + std::get<3>(GetParam());
+    /* job keeps the env it was created with, restore UCX_TLS for the jobs
+       of the following tests */
+    tls_bkp = std::getenv("UCX_TLS");
+    std::string   tls_orig = tls_bkp ? tls_bkp : "";
+    ucc_job_env_t env      = {{"UCC_TL_UCP_TUNE", tune}, {"UCX_TLS", tls}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL_ONESIDED, env);
+    UccTeam_h     team = job.create_team(n_procs, true, true, true);
+    UccCollCtxVec ctxs;
+
+    if (tls_bkp) {
+        setenv("UCX_TLS", tls_orig.c_str(), 1);
+    } else {
+        unsetenv("UCX_TLS");
+    }
+    set_inplace(inplace);
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+
+    data_init(n_procs, dtype, count, ctxs, team, false);
+    UccReq req(team, ctxs);
+    req.start();
+    req.wait();
+    EXPECT_EQ(true, data_validate(ctxs));
+    data_fini_onesided(ctxs);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_allgather_onesided,
+    ::testing::Combine(
+        ::testing::Values(UCC_DT_INT8, UCC_DT_FLOAT64),
+        ::testing::Values(1, 3, 8192), // count
+        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE),
+        ::testing::Values("onesided_linear", "onesided_ring"),
+        ::testing::Values("shm,self", "tcp,self"))); // UCX_TLS
+
+class test_allgather_generic_dt : public ucc::test,
+        public ::testing::WithParamInterface<Param_4> {};
+
+UCC_TEST_P(test_allgather_generic_dt, strided)
+{
+    const int                         count   = std::get<0>(GetParam());
+    const bool                        inplace =
+        std::get<1>(GetParam()) == TEST_INPLACE;
+    const int                         n_procs = 5;
+    ucc_job_env_t                     env     = {{"UCC_CLS", "basic"}};
+    UccJob                            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                                          env);
+    UccTeam_h                         team    = job.create_team(n_procs);
+    ucc_datatype_t                    dt      = test_strided_dt_create();
+    std::vector<std::vector<int32_t>> sbufs(n_procs), rbufs(n_procs);
+    UccCollCtxVec                     ctxs(n_procs);
+
+    for (int r = 0; r < n_procs; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        sbufs[r].assign(2 * count, TEST_STRIDED_DT_GAP);
+        rbufs[r].assign(2 * count * n_procs, TEST_STRIDED_DT_GAP);
+        for (int i = 0; i < count; i++) {
+            sbufs[r][2 * i] = TEST_STRIDED_DT_VAL(r, i);
+            if (inplace) {
+                rbufs[r][2 * (r * count + i)] = TEST_STRIDED_DT_VAL(r, i);
+            }
+        }
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args           = coll;
+        coll->coll_type         = UCC_COLL_TYPE_ALLGATHER;
+        coll->src.info.buffer   = sbufs[r].data();
+        coll->src.info.count    = count;
+        coll->src.info.datatype = dt;
+        coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        coll->dst.info.buffer   = rbufs[r].data();
+        coll->dst.info.count    = count * n_procs;
+        coll->dst.info.datatype = dt;
+        coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        if (inplace) {
+            coll->mask  = UCC_COLL_ARGS_FIELD_FLAGS;
+            coll->flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        }
+    }
+    UccReq req(team, ctxs);
+    req.start();
+    EXPECT_EQ(UCC_OK, req.wait());
+    for (int r = 0; r < n_procs; r++) {
+        bool ok = true;
+        for (int i = 0; i < count * n_procs && ok; i++) {
+            ok = (rbufs[r][2 * i] ==
+                  TEST_STRIDED_DT_VAL(i / count, i % count)) &&
+                 (rbufs[r][2 * i + 1] == TEST_STRIDED_DT_GAP);
+        }
+        EXPECT_TRUE(ok) << "rank " << r;
+        free(ctxs[r]->args);
+        free(ctxs[r]);
+    }
+    ucc_dt_destroy(dt);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_allgather_generic_dt,
+    ::testing::Combine(
+        ::testing::Values(3, 50000), // count, 2nd one is pipelined
+        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));
@@ -6,10 +6,13 @@
 
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#include "test_generic_dt.h"
 
 using Param_0 = std::tuple<int, ucc_datatype_t, ucc_memory_type_t, int, gtest_ucc_inplace_t, bool>;
 using Param_1 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, gtest_ucc_inplace_t, bool>;
 using Param_2 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, gtest_ucc_inplace_t, std::string, bool>;
+using Param_3 = std::tuple<int, gtest_ucc_inplace_t>;
+using Param_4 = std::tuple<bool, gtest_ucc_inplace_t, bool>;
 
 size_t noncontig_padding = 1; // # elements worth of space in between each rank's contribution to the dst buf
 
@@ -352,3 +355,129 @@ INSTANTIATE_TEST_CASE_P(
             return name;
         }
     );
+
+class test_allgatherv_split_rail : public test_allgatherv,
+        public ::testing::WithParamInterface<Param_4> {};
+
+/* ranks of the simulated nodes are either blocks of the team or placed
+   round robin, the latter is not block ordered and goes through scratch */
+UCC_TEST_P(test_allgatherv_split_rail, split_rail)
+{
+    const bool                rr      = std::get<0>(GetParam());
+    const gtest_ucc_inplace_t inplace = std::get<1>(GetParam());
+    const bool                contig  = std::get<2>(GetParam());
+    int                       n_procs = 8;
+    ucc_job_env_t             env     = {{"UCC_CLS", "all"},
+                                         {"UCC_CL_HIER_TUNE",
+                                          "allgatherv:@split_rail:0-inf:inf"},
+                                         {"UCC_CL_HIER_NRAILS", "2"}};
+    UccJob                    job(n_procs,
+                                  rr ? UccJob::UCC_JOB_CTX_GLOBAL_RR
+                                     : UccJob::UCC_JOB_CTX_GLOBAL,
+                                  env);
+    UccTeam_h                 team    = job.create_team(n_procs);
+    UccCollCtxVec             ctxs;
+
+    set_inplace(inplace);
+    set_contig(contig);
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    for (auto count : {1, 3, 8192}) {
+        data_init(n_procs, UCC_DT_INT32, count, ctxs, false);
+        UccReq req(team, ctxs);
+        req.start();
+        req.wait();
+        EXPECT_EQ(true, data_validate(ctxs)) << "count " << count;
+        data_fini(ctxs);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_allgatherv_split_rail,
+    ::testing::Combine(
+        ::testing::Bool(), // round robin placement
+        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE),
+        ::testing::Bool())); // dst buf contig
+
+class test_allgatherv_generic_dt : public ucc::test,
+        public ::testing::WithParamInterface<Param_3> {};
+
+UCC_TEST_P(test_allgatherv_generic_dt, strided)
+{
+    const int                         count   = std::get<0>(GetParam());
+    const bool                        inplace =
+        std::get<1>(GetParam()) == TEST_INPLACE;
+    const int                         n_procs = 5;
+    ucc_job_env_t                     env     = {{"UCC_CLS", "basic"}};
+    UccJob                            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                                          env);
+    UccTeam_h                         team    = job.create_team(n_procs);
+    ucc_datatype_t                    dt      = test_strided_dt_create();
+    std::vector<uint32_t>             counts(n_procs), displs(n_procs);
+    std::vector<std::vector<int32_t>> sbufs(n_procs), rbufs(n_procs);
+    UccCollCtxVec                     ctxs(n_procs);
+    uint32_t                          total   = 0;
+
+    /* uneven blocks stored in the reverse rank order with a gap element */
+    for (int r = n_procs - 1; r >= 0; r--) {
+        counts[r] = count + r;
+        displs[r] = total;
+        total    += counts[r] + 1;
+    }
+    for (int r = 0; r < n_procs; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        sbufs[r].assign(2 * counts[r], TEST_STRIDED_DT_GAP);
+        rbufs[r].assign(2 * total, TEST_STRIDED_DT_GAP);
+        for (uint32_t i = 0; i < counts[r]; i++) {
+            sbufs[r][2 * i] = TEST_STRIDED_DT_VAL(r, i);
+            if (inplace) {
+                rbufs[r][2 * (displs[r] + i)] = TEST_STRIDED_DT_VAL(r, i);
+            }
+        }
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args                  = coll;
+        coll->coll_type                = UCC_COLL_TYPE_ALLGATHERV;
+        coll->src.info.buffer          = sbufs[r].data();
+        coll->src.info.count           = counts[r];
+        coll->src.info.datatype        = dt;
+        coll->src.info.mem_type        = UCC_MEMORY_TYPE_HOST;
+        coll->dst.info_v.buffer        = rbufs[r].data();
+        coll->dst.info_v.counts        = (ucc_count_t *)counts.data();
+        coll->dst.info_v.displacements = (ucc_aint_t *)displs.data();
+        coll->dst.info_v.datatype      = dt;
+        coll->dst.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+        if (inplace) {
+            coll->mask  = UCC_COLL_ARGS_FIELD_FLAGS;
+            coll->flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        }
+    }
+    UccReq req(team, ctxs);
+    req.start();
+    EXPECT_EQ(UCC_OK, req.wait());
+    for (int r = 0; r < n_procs; r++) {
+        bool ok = true;
+        for (int p = 0; p < n_procs && ok; p++) {
+            for (uint32_t i = 0; i < counts[p] && ok; i++) {
+                ok = (rbufs[r][2 * (displs[p] + i)] ==
+                      TEST_STRIDED_DT_VAL(p, i)) &&
+                     (rbufs[r][2 * (displs[p] + i) + 1] ==
+                      TEST_STRIDED_DT_GAP);
+            }
+            /* gap element after the block is not touched */
+            ok = ok && (rbufs[r][2 * (displs[p] + counts[p])] ==
+                        TEST_STRIDED_DT_GAP);
+        }
+        EXPECT_TRUE(ok) << "rank " << r;
+        free(ctxs[r]->args);
+        free(ctxs[r]);
+    }
+    ucc_dt_destroy(dt);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_allgatherv_generic_dt,
+    ::testing::Combine(
+        ::testing::Values(3, 1000),
+        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));
@@ -331,6 +331,71 @@ TYPED_TEST(test_allreduce_alg, sra_knomial_pipelined) {
     }
 }
 
+TYPED_TEST(test_allreduce_alg, reg_cache) {
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_TL_UCP_REG_CACHE", "y"},
+                             {"UCC_TL_UCP_REG_CACHE_THRESH", "4k"},
+                             {"UCC_TL_UCP_REG_CACHE_MAX_REGIONS", "2"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h     team   = job.create_team(n_procs);
+    int           repeat = 3;
+    UccCollCtxVec ctxs;
+
+    /* do not leak the cache into the jobs of the following tests */
+    for (auto &v : env) {
+        unsetenv(v.first.c_str());
+    }
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    /* same buffers reused by persistent and regular collectives hit the
+       cache, max 2 regions make the cache evict */
+    for (auto count : {65536, 123567}) {
+        for (auto persistent : {true, false}) {
+            this->set_inplace(TEST_NO_INPLACE);
+            this->data_init(n_procs, TypeParam::dt, count, ctxs, persistent);
+            for (auto i = 0; i < repeat; i++) {
+                UccReq req(team, ctxs);
+                req.start();
+                req.wait();
+                EXPECT_EQ(true, this->data_validate(ctxs));
+                this->reset(ctxs);
+            }
+            this->data_fini(ctxs);
+        }
+    }
+}
+
+TYPED_TEST(test_allreduce_alg, knomial_persistent_prepost) {
+    int           n_procs = 7;
+    ucc_job_env_t env     = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE", "allreduce:@knomial:inf"},
+                             {"UCC_TL_UCP_ALLREDUCE_KN_RADIX", "3"},
+                             {"UCC_TL_UCP_ALLREDUCE_KN_PREPOST", "y"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h     team   = job.create_team(n_procs);
+    int           repeat = 5;
+    UccCollCtxVec ctxs;
+
+    unsetenv("UCC_TL_UCP_ALLREDUCE_KN_RADIX");
+    unsetenv("UCC_TL_UCP_ALLREDUCE_KN_PREPOST");
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    /* 7 ranks with radix 3 have BASE, PROXY and EXTRA ranks, receives of
+       the next iteration are pre-posted on BASE and PROXY */
+    for (auto count : {4, 65536}) {
+        for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+            this->set_inplace(inplace);
+            this->data_init(n_procs, TypeParam::dt, count, ctxs, true);
+            UccReq req(team, ctxs);
+            for (auto i = 0; i < repeat; i++) {
+                req.start();
+                req.wait();
+                EXPECT_EQ(true, this->data_validate(ctxs));
+                this->reset(ctxs);
+            }
+            this->data_fini(ctxs);
+        }
+    }
+}
+
 TYPED_TEST(test_allreduce_alg, dbt) {
     int           n_procs = 15;
     ucc_job_env_t env     = {{"UCC_CL_BASIC_TUNE", "inf"},
@@ -402,6 +467,38 @@ TYPED_TEST(test_allreduce_alg, rab) {
     }
 }
 
+/* simulated nodes have 2 sockets and 3 NUMA domains, "none" keeps the
+   flat NODE level */
+TYPED_TEST(test_allreduce_alg, rab_node_split) {
+    int           n_procs = 15;
+    UccCollCtxVec ctxs;
+
+    for (std::string split : {"none", "socket", "numa"}) {
+        ucc_job_env_t env = {{"UCC_CL_HIER_TUNE", "allreduce:@rab:0-inf:inf"},
+                             {"UCC_CL_HIER_NODE_SPLIT", split},
+                             {"UCC_CLS", "all"}};
+        UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+        UccTeam_h     team = job.create_team(n_procs);
+
+        for (auto &v : env) {
+            unsetenv(v.first.c_str());
+        }
+        for (auto count : {8, 65536}) {
+            for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+                SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+                this->set_inplace(inplace);
+                this->data_init(n_procs, TypeParam::dt, count, ctxs, false);
+                UccReq req(team, ctxs);
+
+                req.start();
+                req.wait();
+                EXPECT_EQ(true, this->data_validate(ctxs)) << split;
+                this->data_fini(ctxs);
+            }
+        }
+    }
+}
+
 TYPED_TEST(test_allreduce_alg, rab_pipelined) {
     int           n_procs = 15;
     ucc_job_env_t env     = {{"UCC_CL_HIER_TUNE", "allreduce:@rab:0-inf:inf"},
@@ -437,6 +534,45 @@ TYPED_TEST(test_allreduce_alg, rab_pipelined) {
     }
 }
 
+TYPED_TEST(test_allreduce_alg, rab_pipelined_shm) {
+    /* fragments fit the default 8K data slot of tl/shm */
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_CL_HIER_TUNE", "allreduce:@rab:0-inf:inf"},
+                             {"UCC_CL_HIER_ALLREDUCE_RAB_PIPELINE",
+                              "thresh=1024:fragsize=4K:nfrags=11:pdepth=3"},
+                             {"UCC_TLS", "ucp,shm"},
+                             {"UCC_TL_SHM_TUNE", "inf"},
+                             {"UCC_CLS", "all"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h     team   = job.create_team(n_procs);
+    int           repeat = 3;
+    UccCollCtxVec ctxs;
+    std::vector<ucc_memory_type_t> mt = {UCC_MEMORY_TYPE_HOST};
+
+    if (UCC_OK == ucc_mc_available(UCC_MEMORY_TYPE_CUDA)) { //add cuda_managed for cl hier?
+        mt.push_back(UCC_MEMORY_TYPE_CUDA);
+    }
+
+    for (auto count : {65536, 123567}) {
+        for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+            for (auto m : mt) {
+                SET_MEM_TYPE(m);
+                this->set_inplace(inplace);
+                this->data_init(n_procs, TypeParam::dt, count, ctxs, true);
+                UccReq req(team, ctxs);
+
+                for (auto i = 0; i < repeat; i++) {
+                    req.start();
+                    req.wait();
+                    EXPECT_EQ(true, this->data_validate(ctxs));
+                    this->reset(ctxs);
+                }
+                this->data_fini(ctxs);
+            }
+        }
+    }
+}
+
 #ifdef HAVE_UCX
 TYPED_TEST(test_allreduce_alg, sliding_window)
 {
@@ -537,3 +673,403 @@ TYPED_TEST(test_allreduce_avg_order, avg_post_op)
         }
     }
 }
+
+template <typename T>
+class test_allreduce_avg_alg : public test_allreduce<T> {
+};
+
+using test_allreduce_avg_alg_type = ::testing::Types<
+    TypeOpPair<UCC_DT_INT32, avg>, TypeOpPair<UCC_DT_UINT32, avg>,
+    TypeOpPair<UCC_DT_INT64, avg>, TypeOpPair<UCC_DT_FLOAT32, avg>,
+    TypeOpPair<UCC_DT_FLOAT64, avg>, TypeOpPair<UCC_DT_FLOAT32_COMPLEX, avg>>;
+
+TYPED_TEST_CASE(test_allreduce_avg_alg, test_allreduce_avg_alg_type);
+
+/* AVG scaling is fused into the final reduction of every algorithm, integer
+   AVG is rounded toward zero */
+TYPED_TEST(test_allreduce_avg_alg, post_op)
+{
+    int           n_procs = 7;
+    UccCollCtxVec ctxs;
+    std::vector<ucc_memory_type_t> mt = {UCC_MEMORY_TYPE_HOST};
+
+    if (UCC_OK == ucc_mc_available(UCC_MEMORY_TYPE_CUDA)) {
+        mt.push_back(UCC_MEMORY_TYPE_CUDA);
+    }
+    for (std::string alg : {"knomial", "sra_knomial", "dbt", "reproducible"}) {
+        ucc_job_env_t env = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE", "allreduce:@" + alg + ":inf"},
+                             {"UCC_TL_UCP_REDUCE_AVG_PRE_OP", "0"}};
+        UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+        UccTeam_h     team = job.create_team(n_procs);
+
+        for (auto &v : env) {
+            unsetenv(v.first.c_str());
+        }
+        for (auto count : {5, 65536}) {
+            for (auto m : mt) {
+                if (!ucc_reduction_is_supported(TypeParam::dt,
+                                                TypeParam::redop, m)) {
+                    continue;
+                }
+                SET_MEM_TYPE(m);
+                this->set_inplace(TEST_NO_INPLACE);
+                this->data_init(n_procs, TypeParam::dt, count, ctxs, false);
+                UccReq req(team, ctxs);
+                req.start();
+                req.wait();
+                EXPECT_EQ(true, this->data_validate(ctxs)) << alg;
+                this->data_fini(ctxs);
+            }
+        }
+    }
+}
+
+template <typename T>
+class test_allreduce_avg_narrow : public test_allreduce<T> {
+};
+
+using test_allreduce_avg_narrow_type = ::testing::Types<
+    TypeOpPair<UCC_DT_INT8, avg>, TypeOpPair<UCC_DT_UINT8, avg>,
+    TypeOpPair<UCC_DT_INT16, avg>, TypeOpPair<UCC_DT_UINT16, avg>>;
+
+TYPED_TEST_CASE(test_allreduce_avg_narrow, test_allreduce_avg_narrow_type);
+
+/* AVG of integers narrower than int over several reduction steps: values
+   near the type limits would wrap if partial sums were stored before the
+   division. Values are multiples of the team size so the pre-op result is
+   exact, the reference is computed in int64_t. */
+TYPED_TEST(test_allreduce_avg_narrow, near_max)
+{
+    typedef typename TypeParam::type T;
+    const int64_t n_procs = 8;
+    const int64_t hi      = std::numeric_limits<T>::max() / n_procs * n_procs;
+    const int64_t lo      = std::numeric_limits<T>::min() / n_procs * n_procs;
+    UccCollCtxVec ctxs;
+
+    for (std::string alg : {"knomial", "sra_knomial", "dbt", "reproducible"}) {
+        ucc_job_env_t env = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE", "allreduce:@" + alg + ":inf"},
+                             {"UCC_TL_UCP_ALLREDUCE_KN_RADIX", "2"}};
+        UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+        UccTeam_h     team = job.create_team(n_procs);
+
+        for (auto &v : env) {
+            unsetenv(v.first.c_str());
+        }
+        for (auto count : {5, 65536}) {
+            SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+            this->set_inplace(TEST_NO_INPLACE);
+            this->data_init(n_procs, TypeParam::dt, count, ctxs, false);
+            for (int r = 0; r < n_procs; r++) {
+                T *v = (T *)ctxs[r]->init_buf;
+
+                /* odd elements of signed types are near the minimum */
+                for (int i = 0; i < count; i++) {
+                    v[i] = (T)((lo < 0 && i % 2) ?
+                               lo + n_procs * ((i + r) % 3) :
+                               hi - n_procs * ((i + r) % 3));
+                }
+                memcpy(ctxs[r]->args->src.info.buffer, v, count * sizeof(T));
+            }
+            UccReq req(team, ctxs);
+            req.start();
+            req.wait();
+            for (int i = 0; i < count; i++) {
+                int64_t sum = 0;
+
+                for (int r = 0; r < n_procs; r++) {
+                    sum += ((T *)ctxs[r]->init_buf)[i];
+                }
+                for (int r = 0; r < n_procs; r++) {
+                    ASSERT_EQ(sum / n_procs,
+                              (int64_t)((T *)ctxs[r]->args->dst.info.buffer)[i])
+                        << alg << " count " << count << " rank " << r
+                        << " elem " << i;
+                }
+            }
+            this->data_fini(ctxs);
+        }
+    }
+}
+
+/* 16 and 8 bit floats: conversions and a value close to the type maximum
+   that stays exact once divided by a power of 2 team size */
+template <ucc_datatype_t DT> struct lowp_float;
+
+#define DECLARE_LOWP_FLOAT(_TYPE, _to_f32, _from_f32, _max)                    \
+    template <> struct lowp_float<UCC_DT_##_TYPE> {                           \
+        static float to_f32(const void *v)                                     \
+        {                                                                      \
+            return _to_f32(v);                                                 \
+        }                                                                      \
+        static void from_f32(float f, void *v)                                 \
+        {                                                                      \
+            _from_f32(f, v);                                                   \
+        }                                                                      \
+        static float max()                                                     \
+        {                                                                      \
+            return _max;                                                       \
+        }                                                                      \
+    };
+
+DECLARE_LOWP_FLOAT(FLOAT16, float16tofloat32, float32tofloat16, 60000.0f);
+DECLARE_LOWP_FLOAT(BFLOAT16, bfloat16tofloat32, float32tobfloat16, 3.0e38f);
+DECLARE_LOWP_FLOAT(FLOAT8_E4M3, float8e4m3tofloat32, float32tofloat8e4m3,
+                   448.0f);
+DECLARE_LOWP_FLOAT(FLOAT8_E5M2, float8e5m2tofloat32, float32tofloat8e5m2,
+                   57344.0f);
+
+template <typename T>
+class test_allreduce_avg_lowp : public test_allreduce<T> {
+};
+
+using test_allreduce_avg_lowp_type = ::testing::Types<
+    TypeOpPair<UCC_DT_FLOAT16, avg>, TypeOpPair<UCC_DT_BFLOAT16, avg>,
+    TypeOpPair<UCC_DT_FLOAT8_E4M3, avg>, TypeOpPair<UCC_DT_FLOAT8_E5M2, avg>>;
+
+TYPED_TEST_CASE(test_allreduce_avg_lowp, test_allreduce_avg_lowp_type);
+
+/* AVG of 16 and 8 bit floats near the type maximum: partial sums would
+   saturate or overflow to Inf if the division was done in result, even
+   with the post-op AVG configured */
+TYPED_TEST(test_allreduce_avg_lowp, near_max)
+{
+    typedef typename TypeParam::type  T;
+    typedef lowp_float<TypeParam::dt> F;
+    const int                         n_procs = 8;
+    UccCollCtxVec                     ctxs;
+    float                             ref, res;
+
+    for (std::string alg : {"knomial", "sra_knomial", "dbt", "reproducible"}) {
+        ucc_job_env_t env = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE", "allreduce:@" + alg + ":inf"},
+                             {"UCC_TL_UCP_REDUCE_AVG_PRE_OP", "0"},
+                             {"UCC_TL_UCP_ALLREDUCE_KN_RADIX", "2"}};
+        UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+        UccTeam_h     team = job.create_team(n_procs);
+
+        for (auto &v : env) {
+            unsetenv(v.first.c_str());
+        }
+        for (auto count : {5, 65536}) {
+            SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+            this->set_inplace(TEST_NO_INPLACE);
+            this->data_init(n_procs, TypeParam::dt, count, ctxs, false);
+            for (int r = 0; r < n_procs; r++) {
+                T *v = (T *)ctxs[r]->init_buf;
+
+                for (int i = 0; i < count; i++) {
+                    F::from_f32(F::max(), &v[i]);
+                }
+                memcpy(ctxs[r]->args->src.info.buffer, v, count * sizeof(T));
+            }
+            UccReq req(team, ctxs);
+            req.start();
+            req.wait();
+            ref = F::to_f32(ctxs[0]->init_buf);
+            for (int r = 0; r < n_procs; r++) {
+                for (int i = 0; i < count; i++) {
+                    res = F::to_f32(&((T *)ctxs[r]->args->dst.info.buffer)[i]);
+                    ASSERT_TRUE(std::isfinite(res))
+                        << alg << " count " << count << " rank " << r
+                        << " elem " << i;
+                    ASSERT_NEAR(ref, res, 1e-2 * ref)
+                        << alg << " count " << count << " rank " << r
+                        << " elem " << i;
+                }
+            }
+            this->data_fini(ctxs);
+        }
+    }
+}
+
+/* user-defined reduction and value-index pairs on the tl/ucp reduction
+   algorithms, parameter is the allreduce algorithm */
+class test_allreduce_user_op : public ucc::test,
+                               public ::testing::WithParamInterface<std::string> {
+  public:
+    typedef struct {
+        float   value;
+        int32_t index;
+    } float_int_t;
+
+    static ucc_status_t sum_cb(const ucc_reduce_cb_params_t *p)
+    {
+        const int64_t *s1 = (const int64_t *)p->src1;
+        int64_t       *d  = (int64_t *)p->dst;
+
+        for (size_t i = 0; i < p->count; i++) {
+            int64_t r = s1[i];
+            for (size_t j = 0; j < p->n_vectors; j++) {
+                r += ((const int64_t *)PTR_OFFSET(p->src2, p->stride * j))[i];
+            }
+            d[i] = r;
+        }
+        return UCC_OK;
+    }
+
+    template <typename T>
+    void run(UccTeam_h team, int n_procs, ucc_datatype_t dt,
+             ucc_reduction_op_t op, size_t count,
+             std::vector<std::vector<T>> &sbufs,
+             std::vector<std::vector<T>> &rbufs)
+    {
+        UccCollCtxVec ctxs(n_procs);
+
+        for (int r = 0; r < n_procs; r++) {
+            ucc_coll_args_t *coll = (ucc_coll_args_t *)
+                calloc(1, sizeof(ucc_coll_args_t));
+
+            rbufs[r].resize(count);
+            ctxs[r] = (gtest_ucc_coll_ctx_t *)
+                calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+            ctxs[r]->args           = coll;
+            coll->coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+            coll->op                = op;
+            coll->src.info.buffer   = sbufs[r].data();
+            coll->src.info.count    = count;
+            coll->src.info.datatype = dt;
+            coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            coll->dst.info.buffer   = rbufs[r].data();
+            coll->dst.info.count    = count;
+            coll->dst.info.datatype = dt;
+            coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        }
+        UccReq req(team, ctxs);
+        req.start();
+        EXPECT_EQ(UCC_OK, req.wait());
+        for (int r = 0; r < n_procs; r++) {
+            free(ctxs[r]->args);
+            free(ctxs[r]);
+        }
+    }
+};
+
+UCC_TEST_P(test_allreduce_user_op, generic_dt)
+{
+    const int            n_procs = 7;
+    const size_t         count   = 40000;
+    ucc_job_env_t        env     = {{"UCC_CLS", "basic"},
+                                    {"UCC_TL_UCP_TUNE",
+                                     "allreduce:@" + GetParam() + ":inf"}};
+    UccJob               job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h            team = job.create_team(n_procs);
+    ucc_generic_dt_ops_t ops  = {};
+    ucc_datatype_t       dt;
+
+    std::vector<std::vector<int64_t>> sbufs(n_procs), rbufs(n_procs);
+
+    for (auto &v : env) {
+        unsetenv(v.first.c_str());
+    }
+
+    ops.mask        = UCC_GENERIC_DT_OPS_FIELD_FLAGS;
+    ops.flags       = UCC_GENERIC_DT_OPS_FLAG_CONTIG |
+                      UCC_GENERIC_DT_OPS_FLAG_REDUCE;
+    ops.contig_size = sizeof(int64_t);
+    ops.reduce.cb   = sum_cb;
+    ASSERT_EQ(UCC_OK, ucc_dt_create_generic(&ops, NULL, &dt));
+    for (int r = 0; r < n_procs; r++) {
+        sbufs[r].resize(count);
+        for (size_t i = 0; i < count; i++) {
+            sbufs[r][i] = i * (r + 1);
+        }
+    }
+    run(team, n_procs, dt, UCC_OP_SUM, count, sbufs, rbufs);
+    for (int r = 0; r < n_procs; r++) {
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ((int64_t)i * n_procs * (n_procs + 1) / 2, rbufs[r][i]);
+        }
+    }
+    ucc_dt_destroy(dt);
+}
+
+UCC_TEST_P(test_allreduce_user_op, maxloc)
+{
+    const int     n_procs = 7;
+    const size_t  count   = 40000;
+    ucc_job_env_t env     = {{"UCC_CLS", "basic"},
+                             {"UCC_TL_UCP_TUNE",
+                              "allreduce:@" + GetParam() + ":inf"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h     team = job.create_team(n_procs);
+
+    std::vector<std::vector<float_int_t>> sbufs(n_procs), rbufs(n_procs);
+
+    for (auto &v : env) {
+        unsetenv(v.first.c_str());
+    }
+
+    for (int r = 0; r < n_procs; r++) {
+        sbufs[r].resize(count);
+        for (size_t i = 0; i < count; i++) {
+            sbufs[r][i].value = (float)((i + 3 * r) % 5);
+            sbufs[r][i].index = r;
+        }
+    }
+    for (auto op : {UCC_OP_MAXLOC, UCC_OP_MINLOC}) {
+        run(team, n_procs, UCC_DT_FLOAT32_INT32, op, count, sbufs, rbufs);
+        for (size_t i = 0; i < count; i++) {
+            float_int_t ref = sbufs[0][i];
+            for (int r = 1; r < n_procs; r++) {
+                float v = sbufs[r][i].value;
+                if (op == UCC_OP_MAXLOC ? v > ref.value : v < ref.value) {
+                    ref = sbufs[r][i];
+                }
+            }
+            for (int r = 0; r < n_procs; r++) {
+                ASSERT_EQ(ref.value, rbufs[r][i].value);
+                ASSERT_EQ(ref.index, rbufs[r][i].index);
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(, test_allreduce_user_op,
+                        ::testing::Values("knomial", "sra_knomial", "dbt",
+                                          "reproducible"));
+
+class test_allreduce_reproducible : public test_allreduce_user_op {
+};
+
+/* the result is the left fold in rank order even if the tuning selects a
+   different algorithm, checked bitwise */
+UCC_TEST_F(test_allreduce_reproducible, float_sum)
+{
+    ucc_job_env_t env = {{"UCC_CLS", "basic"},
+                         {"UCC_TL_UCP_TUNE", "allreduce:@knomial:inf"},
+                         {"UCC_TL_UCP_ALLREDUCE_REPRODUCIBLE", "y"}};
+    UccJob        job(16, UccJob::UCC_JOB_CTX_GLOBAL, env);
+
+    for (auto &v : env) {
+        unsetenv(v.first.c_str());
+    }
+    for (int n_procs : {7, 16}) {
+        UccTeam_h team = job.create_team(n_procs);
+
+        for (size_t count : {1000, 100003}) {
+            std::vector<std::vector<float>> sbufs(n_procs), rbufs(n_procs);
+
+            for (int r = 0; r < n_procs; r++) {
+                sbufs[r].resize(count);
+                for (size_t i = 0; i < count; i++) {
+                    /* magnitudes far apart, the sum depends on the order */
+                    sbufs[r][i] = (float)((i * 7919 + r * 104729) % 1000) /
+                                  ((r % 3 == 0) ? 3e-4f : 7.0f);
+                }
+            }
+            run(team, n_procs, UCC_DT_FLOAT32, UCC_OP_SUM, count, sbufs,
+                rbufs);
+            for (size_t i = 0; i < count; i++) {
+                float ref = sbufs[0][i];
+                for (int r = 1; r < n_procs; r++) {
+                    ref += sbufs[r][i];
+                }
+                for (int r = 0; r < n_procs; r++) {
+                    ASSERT_EQ(0, memcmp(&ref, &rbufs[r][i], sizeof(ref)));
+                }
+            }
+        }
+    }
+}
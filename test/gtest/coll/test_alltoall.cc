@@ -5,9 +5,11 @@
 
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#include "test_generic_dt.h"
 
 using Param_0 = std::tuple<int, ucc_datatype_t, ucc_memory_type_t, gtest_ucc_inplace_t, int>;
 using Param_1 = std::tuple<ucc_datatype_t, ucc_memory_type_t, gtest_ucc_inplace_t, int>;
+using Param_2 = int;
 
 class test_alltoall : public UccCollArgs, public ucc::test
 {
@@ -287,6 +289,29 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(/*TEST_INPLACE,*/ TEST_NO_INPLACE),
         ::testing::Values(1,3)));
 
+UCC_TEST_F(test_alltoall, shm_cma)
+{
+    /* local contexts: all ranks on one node */
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_TLS", "ucp,shm"},
+                             {"UCC_TL_SHM_TUNE", "alltoall:@cma:0-inf:inf"},
+                             {"UCC_CLS", "basic"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_LOCAL, env);
+    UccTeam_h     team = job.create_team(n_procs);
+    UccCollCtxVec ctxs;
+
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    this->set_inplace(TEST_NO_INPLACE);
+    for (auto count : {3, 65536}) {
+        data_init(n_procs, UCC_DT_INT32, count, ctxs, false);
+        UccReq req(team, ctxs);
+        req.start();
+        req.wait();
+        EXPECT_EQ(true, data_validate(ctxs));
+        data_fini(ctxs);
+    }
+}
+
 class test_alltoall_1 : public test_alltoall,
         public ::testing::WithParamInterface<Param_1> {};
 
@@ -332,3 +357,62 @@ INSTANTIATE_TEST_CASE_P(
 #endif
         ::testing::Values(/*TEST_INPLACE,*/ TEST_NO_INPLACE),
         ::testing::Values(1,3,8192))); // count
+
+class test_alltoall_generic_dt : public ucc::test,
+        public ::testing::WithParamInterface<Param_2> {};
+
+UCC_TEST_P(test_alltoall_generic_dt, strided)
+{
+    const int                         count   = GetParam();
+    const int                         n_procs = 5;
+    ucc_job_env_t                     env     = {{"UCC_CLS", "basic"}};
+    UccJob                            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                                          env);
+    UccTeam_h                         team    = job.create_team(n_procs);
+    ucc_datatype_t                    dt      = test_strided_dt_create();
+    std::vector<std::vector<int32_t>> sbufs(n_procs), rbufs(n_procs);
+    UccCollCtxVec                     ctxs(n_procs);
+
+    /* element i of the block rank r sends to rank p is VAL(r, p*count+i) */
+    for (int r = 0; r < n_procs; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        sbufs[r].assign(2 * count * n_procs, TEST_STRIDED_DT_GAP);
+        rbufs[r].assign(2 * count * n_procs, TEST_STRIDED_DT_GAP);
+        for (int i = 0; i < count * n_procs; i++) {
+            sbufs[r][2 * i] = TEST_STRIDED_DT_VAL(r, i);
+        }
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args           = coll;
+        coll->coll_type         = UCC_COLL_TYPE_ALLTOALL;
+        coll->src.info.buffer   = sbufs[r].data();
+        coll->src.info.count    = count * n_procs;
+        coll->src.info.datatype = dt;
+        coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        coll->dst.info.buffer   = rbufs[r].data();
+        coll->dst.info.count    = count * n_procs;
+        coll->dst.info.datatype = dt;
+        coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    }
+    UccReq req(team, ctxs);
+    req.start();
+    EXPECT_EQ(UCC_OK, req.wait());
+    for (int r = 0; r < n_procs; r++) {
+        bool ok = true;
+        for (int i = 0; i < count * n_procs && ok; i++) {
+            ok = (rbufs[r][2 * i] ==
+                  TEST_STRIDED_DT_VAL(i / count, r * count + i % count)) &&
+                 (rbufs[r][2 * i + 1] == TEST_STRIDED_DT_GAP);
+        }
+        EXPECT_TRUE(ok) << "rank " << r;
+        free(ctxs[r]->args);
+        free(ctxs[r]);
+    }
+    ucc_dt_destroy(dt);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_alltoall_generic_dt,
+    ::testing::Values(3, 50000)); // count per peer, 2nd one is pipelined
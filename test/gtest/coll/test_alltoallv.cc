@@ -6,9 +6,11 @@
 
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#include "test_generic_dt.h"
 
 using Param_0 = std::tuple<int, ucc_memory_type_t, gtest_ucc_inplace_t, ucc_datatype_t>;
 using Param_1 = std::tuple<ucc_memory_type_t, gtest_ucc_inplace_t, ucc_datatype_t>;
+using Param_2 = int;
 
 template <class T>
 class test_alltoallv : public UccCollArgs, public ucc::test
@@ -386,3 +388,90 @@ INSTANTIATE_TEST_CASE_P(
 #endif
             ::testing::Values(/*TEST_INPLACE,*/ TEST_NO_INPLACE),
             PREDEFINED_DTYPES)); // dtype
+
+class test_alltoallv_generic_dt : public ucc::test,
+        public ::testing::WithParamInterface<Param_2> {};
+
+UCC_TEST_P(test_alltoallv_generic_dt, strided)
+{
+    const int                          count   = GetParam();
+    const int                          n_procs = 5;
+    ucc_job_env_t                      env     = {{"UCC_CLS", "basic"}};
+    UccJob                             job(n_procs,
+                                           UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h                          team    = job.create_team(n_procs);
+    ucc_datatype_t                     dt      = test_strided_dt_create();
+    std::vector<std::vector<uint32_t>> scounts(n_procs), sdispls(n_procs),
+                                       rcounts(n_procs), rdispls(n_procs);
+    std::vector<std::vector<int32_t>>  sbufs(n_procs), rbufs(n_procs);
+    UccCollCtxVec                      ctxs(n_procs);
+
+    /* uneven blocks, the recv side stores them in the reverse rank order,
+       both sides leave a gap element after every block */
+    for (int r = 0; r < n_procs; r++) {
+        uint32_t stotal = 0, rtotal = 0;
+
+        scounts[r].resize(n_procs);
+        sdispls[r].resize(n_procs);
+        rcounts[r].resize(n_procs);
+        rdispls[r].resize(n_procs);
+        for (int p = 0; p < n_procs; p++) {
+            scounts[r][p] = count + (r + p) % 3;
+            sdispls[r][p] = stotal;
+            stotal       += scounts[r][p] + 1;
+        }
+        for (int p = n_procs - 1; p >= 0; p--) {
+            rcounts[r][p] = count + (r + p) % 3;
+            rdispls[r][p] = rtotal;
+            rtotal       += rcounts[r][p] + 1;
+        }
+        sbufs[r].assign(2 * stotal, TEST_STRIDED_DT_GAP);
+        rbufs[r].assign(2 * rtotal, TEST_STRIDED_DT_GAP);
+        for (uint32_t i = 0; i < stotal; i++) {
+            sbufs[r][2 * i] = TEST_STRIDED_DT_VAL(r, i);
+        }
+    }
+    for (int r = 0; r < n_procs; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args                  = coll;
+        coll->coll_type                = UCC_COLL_TYPE_ALLTOALLV;
+        coll->src.info_v.buffer        = sbufs[r].data();
+        coll->src.info_v.counts        = (ucc_count_t *)scounts[r].data();
+        coll->src.info_v.displacements = (ucc_aint_t *)sdispls[r].data();
+        coll->src.info_v.datatype      = dt;
+        coll->src.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+        coll->dst.info_v.buffer        = rbufs[r].data();
+        coll->dst.info_v.counts        = (ucc_count_t *)rcounts[r].data();
+        coll->dst.info_v.displacements = (ucc_aint_t *)rdispls[r].data();
+        coll->dst.info_v.datatype      = dt;
+        coll->dst.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+    }
+    UccReq req(team, ctxs);
+    req.start();
+    EXPECT_EQ(UCC_OK, req.wait());
+    for (int r = 0; r < n_procs; r++) {
+        bool ok = true;
+        for (int p = 0; p < n_procs && ok; p++) {
+            for (uint32_t i = 0; i < rcounts[r][p] && ok; i++) {
+                ok = (rbufs[r][2 * (rdispls[r][p] + i)] ==
+                      TEST_STRIDED_DT_VAL(p, sdispls[p][r] + i)) &&
+                     (rbufs[r][2 * (rdispls[r][p] + i) + 1] ==
+                      TEST_STRIDED_DT_GAP);
+            }
+            ok = ok && (rbufs[r][2 * (rdispls[r][p] + rcounts[r][p])] ==
+                        TEST_STRIDED_DT_GAP);
+        }
+        EXPECT_TRUE(ok) << "rank " << r;
+        free(ctxs[r]->args);
+        free(ctxs[r]);
+    }
+    ucc_dt_destroy(dt);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_alltoallv_generic_dt,
+    ::testing::Values(3, 1000)); // base count per peer
@@ -41,3 +41,47 @@ UCC_TEST_F(test_barrier, multiple)
     UccReq::startall(reqs);
     UccReq::waitall(reqs);
 }
+
+UCC_TEST_F(test_barrier, shm)
+{
+    /* local contexts: all ranks on one node */
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_TLS", "ucp,shm"},
+                             {"UCC_TL_SHM_TUNE", "inf"},
+                             {"UCC_CLS", "basic"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_LOCAL, env);
+    UccTeam_h     team = job.create_team(n_procs);
+
+    for (int i = 0; i < 3; i++) {
+        UccReq req(team, &coll);
+        req.start();
+        req.wait();
+    }
+}
+
+UCC_TEST_F(test_barrier, shm_post_order)
+{
+    /* tl/shm orders collectives by posting: the second one must not wait
+       for the first one, which is not posted yet */
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_TLS", "ucp,shm"},
+                             {"UCC_TL_SHM_TUNE", "inf"},
+                             {"UCC_CLS", "basic"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_LOCAL, env);
+    UccTeam_h     team = job.create_team(n_procs);
+    UccReq        first(team, &coll);
+    UccReq        second(team, &coll);
+
+    second.start();
+    EXPECT_EQ(UCC_OK, second.wait());
+    first.start();
+    EXPECT_EQ(UCC_OK, first.wait());
+
+    /* a collective finalized without being posted does not block others */
+    {
+        UccReq unposted(team, &coll);
+        UccReq req(team, &coll);
+        req.start();
+        EXPECT_EQ(UCC_OK, req.wait());
+    }
+}
@@ -5,10 +5,13 @@
 
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#include "test_generic_dt.h"
 
 using Param_0 = std::tuple<int, ucc_datatype_t, ucc_memory_type_t, int, int>;
 using Param_1 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, int>;
 using Param_2 = std::tuple<ucc_memory_type_t, ucc_job_env_t, int, int>;
+using Param_3 = std::tuple<int, int, std::string>;
+using Param_4 = std::tuple<int, int>;
 
 class test_bcast : public UccCollArgs, public ucc::test
 {
@@ -16,8 +19,10 @@ private:
     int root;
 public:
     void data_init(int nprocs, ucc_datatype_t dtype, size_t count,
-                   UccCollCtxVec &ctxs, bool persistent)
+                   UccCollCtxVec &ctxs, UccTeam_h team, bool persistent)
     {
+        bool is_onesided = (NULL != team);
+
         ctxs.resize(nprocs);
         for (auto r = 0; r < nprocs; r++) {
             ucc_coll_args_t *coll = (ucc_coll_args_t*)
@@ -35,9 +40,17 @@ public:
 
             ctxs[r]->rbuf_size = ucc_dt_size(dtype) * count;
 
-            UCC_CHECK(ucc_mc_alloc(&ctxs[r]->src_mc_header, ctxs[r]->rbuf_size,
-                                   mem_type));
-            coll->src.info.buffer = ctxs[r]->src_mc_header->addr;
+            if (is_onesided) {
+                coll->mask  = UCC_COLL_ARGS_FIELD_FLAGS |
+                              UCC_COLL_ARGS_FIELD_GLOBAL_WORK_BUFFER;
+                coll->flags = UCC_COLL_ARGS_FLAG_MEM_MAPPED_BUFFERS;
+                coll->src.info.buffer    = team->procs[r].p->onesided_buf[0];
+                coll->global_work_buffer = team->procs[r].p->onesided_buf[2];
+            } else {
+                UCC_CHECK(ucc_mc_alloc(&ctxs[r]->src_mc_header,
+                                       ctxs[r]->rbuf_size, mem_type));
+                coll->src.info.buffer = ctxs[r]->src_mc_header->addr;
+            }
             if (r == root) {
                 ctxs[r]->init_buf = ucc_malloc(ctxs[r]->rbuf_size, "init buf");
                 EXPECT_NE(ctxs[r]->init_buf, nullptr);
@@ -55,6 +68,11 @@ public:
             }
         }
     }
+    void data_init(int nprocs, ucc_datatype_t dtype, size_t count,
+                   UccCollCtxVec &ctxs, bool persistent)
+    {
+        data_init(nprocs, dtype, count, ctxs, NULL, persistent);
+    }
     void reset(UccCollCtxVec ctxs)
     {
         for (auto r = 0; r < ctxs.size(); r++) {
@@ -72,6 +90,18 @@ public:
         }
     }
 
+    void data_fini_onesided(UccCollCtxVec ctxs)
+    {
+        for (auto r = 0; r < ctxs.size(); r++) {
+            gtest_ucc_coll_ctx_t *ctx = ctxs[r];
+            if (r == ctx->args->root) {
+                ucc_free(ctx->init_buf);
+            }
+            free(ctx->args);
+            free(ctx);
+        }
+        ctxs.clear();
+    }
     void data_fini(UccCollCtxVec ctxs)
     {
         for (auto r = 0; r < ctxs.size(); r++) {
@@ -274,6 +304,25 @@ UCC_TEST_P(test_bcast_alg,) {
 
 ucc_job_env_t two_step_env = {{"UCC_CL_HIER_TUNE", "bcast:@2step:0-inf:inf"},
                               {"UCC_CLS", "all"}};
+ucc_job_env_t two_step_shm_env = {{"UCC_CL_HIER_TUNE",
+                                   "bcast:@2step:0-inf:inf"},
+                                  {"UCC_CL_HIER_BCAST_2STEP_PIPELINE",
+                                   "thresh=0:fragsize=4K:nfrags=5:pdepth=2"},
+                                  {"UCC_TLS", "ucp,shm"},
+                                  {"UCC_TL_SHM_TUNE", "inf"},
+                                  {"UCC_CLS", "all"}};
+ucc_job_env_t two_step_flat_env = {{"UCC_CL_HIER_TUNE",
+                                    "bcast:@2step:0-inf:inf"},
+                                   {"UCC_CL_HIER_NODE_SPLIT", "none"},
+                                   {"UCC_CLS", "all"}};
+ucc_job_env_t two_step_socket_env = {{"UCC_CL_HIER_TUNE",
+                                      "bcast:@2step:0-inf:inf"},
+                                     {"UCC_CL_HIER_NODE_SPLIT", "socket"},
+                                     {"UCC_CLS", "all"}};
+ucc_job_env_t split_rail_env = {{"UCC_CL_HIER_TUNE",
+                                 "bcast:@split_rail:0-inf:inf"},
+                                {"UCC_CL_HIER_NRAILS", "2"},
+                                {"UCC_CLS", "all"}};
 ucc_job_env_t dbt_env      = {{"UCC_TL_UCP_TUNE", "bcast:@dbt:0-inf:inf"},
                               {"UCC_CLS", "basic"}};
 ucc_job_env_t cuda_env     = {{"UCC_TL_CUDA_TUNE", "bcast:cuda:@0:0-inf:inf"},
@@ -314,11 +363,149 @@ INSTANTIATE_TEST_CASE_P(
 #ifdef HAVE_CUDA
         ::testing::Values(UCC_MEMORY_TYPE_HOST, UCC_MEMORY_TYPE_CUDA,
                           UCC_MEMORY_TYPE_CUDA_MANAGED),
-        ::testing::Values(two_step_env, dbt_env, cuda_env, host_mcast_env, host_mcast_rel_env,
+        ::testing::Values(two_step_env, two_step_flat_env,
+                          two_step_socket_env, split_rail_env, dbt_env,
+                          cuda_env, host_mcast_env, host_mcast_rel_env,
                           cuda_mcast_env, cuda_mcast_rel_env), //env
 #else
         ::testing::Values(UCC_MEMORY_TYPE_HOST),
-        ::testing::Values(two_step_env, dbt_env, host_mcast_env, host_mcast_rel_env), //env
+        ::testing::Values(two_step_env, two_step_flat_env,
+                          two_step_socket_env, two_step_shm_env,
+                          split_rail_env, dbt_env, host_mcast_env,
+                          host_mcast_rel_env), //env
 #endif
         ::testing::Values(8, 65536), // count
         ::testing::Values(15, 16))); // n_procs
+
+UCC_TEST_F(test_bcast, shm_cma)
+{
+    /* local contexts: all ranks on one node */
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_TLS", "ucp,shm"},
+                             {"UCC_TL_SHM_TUNE", "bcast:@cma:0-inf:inf"},
+                             {"UCC_CLS", "basic"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_LOCAL, env);
+    UccTeam_h     team = job.create_team(n_procs);
+    UccCollCtxVec ctxs;
+
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    for (auto count : {8, 65536}) {
+        for (int root = 0; root < n_procs; root += 3) {
+            this->set_root(root);
+            this->data_init(n_procs, UCC_DT_INT8, count, ctxs, false);
+            UccReq req(team, ctxs);
+            req.start();
+            req.wait();
+            EXPECT_EQ(true, this->data_validate(ctxs));
+            this->data_fini(ctxs);
+        }
+    }
+}
+
+class test_bcast_onesided : public test_bcast,
+        public ::testing::WithParamInterface<Param_3> {};
+
+UCC_TEST_P(test_bcast_onesided, knomial)
+{
+    const int         count    = std::get<0>(GetParam());
+    const int         n_procs  = std::get<1>(GetParam());
+    const std::string tls      = std::get<2>(GetParam());
+    const char       *tls_bkp  = std::getenv("UCX_TLS");
+    std::string       tls_orig = tls_bkp ? tls_bkp : "";
+    ucc_job_env_t     env      = {
+        {"UCC_TL_UCP_TUNE", "bcast:0-inf:@onesided_knomial"},
+        {"UCC_TL_UCP_BCAST_KN_RADIX", "3"},
+        {"UCX_TLS", tls}};
+    UccJob            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL_ONESIDED, env);
+    UccTeam_h         team = job.create_team(n_procs, true, true, true);
+    UccCollCtxVec     ctxs;
+
+    /* job keeps the env it was created with, restore UCX_TLS for the jobs
+       of the following tests */
+    if (tls_bkp) {
+        setenv("UCX_TLS", tls_orig.c_str(), 1);
+    } else {
+        unsetenv("UCX_TLS");
+    }
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    for (int root = 0; root < n_procs; root++) {
+        set_root(root);
+        data_init(n_procs, UCC_DT_INT8, count, ctxs, team, false);
+        UccReq req(team, ctxs);
+        req.start();
+        req.wait();
+        /* every rank received the data into its own mapped buffer */
+        for (int r = 0; r < n_procs; r++) {
+            EXPECT_EQ(0, memcmp(ctxs[r]->args->src.info.buffer,
+                                ctxs[root]->init_buf, ctxs[root]->rbuf_size));
+        }
+        reset(ctxs);
+        data_fini_onesided(ctxs);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_bcast_onesided,
+    ::testing::Combine(
+        ::testing::Values(8, 65536), // count
+        ::testing::Values(2, 7, 9), // n_procs
+        ::testing::Values("shm,self", "tcp,self"))); // UCX_TLS
+
+class test_bcast_generic_dt : public ucc::test,
+        public ::testing::WithParamInterface<Param_4> {};
+
+UCC_TEST_P(test_bcast_generic_dt, strided)
+{
+    const int                         count   = std::get<0>(GetParam());
+    const int                         n_procs = std::get<1>(GetParam());
+    ucc_job_env_t                     env     = {{"UCC_CLS", "basic"}};
+    UccJob                            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                                          env);
+    UccTeam_h                         team    = job.create_team(n_procs);
+    ucc_datatype_t                    dt      = test_strided_dt_create();
+    std::vector<std::vector<int32_t>> bufs(n_procs);
+    UccCollCtxVec                     ctxs(n_procs);
+
+    for (int root : {0, n_procs - 1}) {
+        for (int r = 0; r < n_procs; r++) {
+            ucc_coll_args_t *coll = (ucc_coll_args_t *)
+                calloc(1, sizeof(ucc_coll_args_t));
+
+            bufs[r].assign(2 * count, TEST_STRIDED_DT_GAP);
+            if (r == root) {
+                for (int i = 0; i < count; i++) {
+                    bufs[r][2 * i] = TEST_STRIDED_DT_VAL(root, i);
+                }
+            }
+            ctxs[r] = (gtest_ucc_coll_ctx_t *)
+                calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+            ctxs[r]->args           = coll;
+            coll->coll_type         = UCC_COLL_TYPE_BCAST;
+            coll->root              = root;
+            coll->src.info.buffer   = bufs[r].data();
+            coll->src.info.count    = count;
+            coll->src.info.datatype = dt;
+            coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        }
+        UccReq req(team, ctxs);
+        req.start();
+        EXPECT_EQ(UCC_OK, req.wait());
+        for (int r = 0; r < n_procs; r++) {
+            bool ok = true;
+            for (int i = 0; i < count && ok; i++) {
+                ok = (bufs[r][2 * i] == TEST_STRIDED_DT_VAL(root, i)) &&
+                     (bufs[r][2 * i + 1] == TEST_STRIDED_DT_GAP);
+            }
+            EXPECT_TRUE(ok) << "rank " << r << " root " << root;
+            free(ctxs[r]->args);
+            free(ctxs[r]);
+        }
+    }
+    ucc_dt_destroy(dt);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_bcast_generic_dt,
+    ::testing::Combine(
+        ::testing::Values(3, 100000), // count, 2nd one is pipelined
+        ::testing::Values(4, 7))); // n_procs
@@ -5,11 +5,13 @@
 
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#include "test_generic_dt.h"
 
 using Param_0 = std::tuple<int, ucc_datatype_t, ucc_memory_type_t, int, int,
                            gtest_ucc_inplace_t>;
 using Param_1 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, int,
                            gtest_ucc_inplace_t>;
+using Param_2 = std::tuple<int, int, gtest_ucc_inplace_t>;
 
 class test_gather : public UccCollArgs, public ucc::test {
   private:
@@ -278,3 +280,79 @@ INSTANTIATE_TEST_CASE_P(
                        ::testing::Values(1, 3, 8192), // count
                        ::testing::Values(0, 1),       // root
                        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));
+
+class test_gather_generic_dt : public ucc::test,
+        public ::testing::WithParamInterface<Param_2> {};
+
+UCC_TEST_P(test_gather_generic_dt, strided)
+{
+    const int                         count   = std::get<0>(GetParam());
+    const int                         root    = std::get<1>(GetParam());
+    const bool                        inplace =
+        std::get<2>(GetParam()) == TEST_INPLACE;
+    const int                         n_procs = 5;
+    ucc_job_env_t                     env     = {{"UCC_CLS", "basic"}};
+    UccJob                            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                                          env);
+    UccTeam_h                         team    = job.create_team(n_procs);
+    ucc_datatype_t                    dt      = test_strided_dt_create();
+    std::vector<std::vector<int32_t>> sbufs(n_procs);
+    std::vector<int32_t>              rbuf(2 * count * n_procs,
+                                           TEST_STRIDED_DT_GAP);
+    UccCollCtxVec                     ctxs(n_procs);
+
+    for (int r = 0; r < n_procs; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        sbufs[r].assign(2 * count, TEST_STRIDED_DT_GAP);
+        for (int i = 0; i < count; i++) {
+            sbufs[r][2 * i] = TEST_STRIDED_DT_VAL(r, i);
+        }
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args           = coll;
+        coll->coll_type         = UCC_COLL_TYPE_GATHER;
+        coll->root              = root;
+        coll->src.info.buffer   = sbufs[r].data();
+        coll->src.info.count    = count;
+        coll->src.info.datatype = dt;
+        coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        if (r != root) {
+            continue;
+        }
+        coll->dst.info.buffer   = rbuf.data();
+        coll->dst.info.count    = count * n_procs;
+        coll->dst.info.datatype = dt;
+        coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        if (inplace) {
+            for (int i = 0; i < count; i++) {
+                rbuf[2 * (r * count + i)] = TEST_STRIDED_DT_VAL(r, i);
+            }
+            coll->mask  = UCC_COLL_ARGS_FIELD_FLAGS;
+            coll->flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        }
+    }
+    UccReq req(team, ctxs);
+    req.start();
+    EXPECT_EQ(UCC_OK, req.wait());
+    for (int i = 0; i < count * n_procs; i++) {
+        EXPECT_EQ(TEST_STRIDED_DT_VAL(i / count, i % count), rbuf[2 * i]);
+        EXPECT_EQ(TEST_STRIDED_DT_GAP, rbuf[2 * i + 1]);
+        if (HasFailure()) {
+            break;
+        }
+    }
+    for (int r = 0; r < n_procs; r++) {
+        free(ctxs[r]->args);
+        free(ctxs[r]);
+    }
+    ucc_dt_destroy(dt);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_gather_generic_dt,
+    ::testing::Combine(
+        ::testing::Values(3, 50000), // count, 2nd one is pipelined
+        ::testing::Values(0, 4), // root
+        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));
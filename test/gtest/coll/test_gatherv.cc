@@ -5,11 +5,13 @@
 
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#include "test_generic_dt.h"
 
 using Param_0 = std::tuple<int, ucc_datatype_t, ucc_memory_type_t, int, int,
                            gtest_ucc_inplace_t>;
 using Param_1 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, int,
                            gtest_ucc_inplace_t>;
+using Param_2 = std::tuple<int, int, gtest_ucc_inplace_t>;
 
 class test_gatherv : public UccCollArgs, public ucc::test {
   private:
@@ -307,3 +309,89 @@ INSTANTIATE_TEST_CASE_P(
                        ::testing::Values(1, 3, 8192), // count
                        ::testing::Values(0, 1),       // root
                        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));
+
+class test_gatherv_generic_dt : public ucc::test,
+        public ::testing::WithParamInterface<Param_2> {};
+
+UCC_TEST_P(test_gatherv_generic_dt, strided)
+{
+    const int                         count   = std::get<0>(GetParam());
+    const int                         root    = std::get<1>(GetParam());
+    const bool                        inplace =
+        std::get<2>(GetParam()) == TEST_INPLACE;
+    const int                         n_procs = 5;
+    ucc_job_env_t                     env     = {{"UCC_CLS", "basic"}};
+    UccJob                            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                                          env);
+    UccTeam_h                         team    = job.create_team(n_procs);
+    ucc_datatype_t                    dt      = test_strided_dt_create();
+    std::vector<uint32_t>             counts(n_procs), displs(n_procs);
+    std::vector<std::vector<int32_t>> sbufs(n_procs);
+    std::vector<int32_t>              rbuf;
+    UccCollCtxVec                     ctxs(n_procs);
+    uint32_t                          total   = 0;
+
+    /* uneven blocks stored in the reverse rank order with a gap element */
+    for (int r = n_procs - 1; r >= 0; r--) {
+        counts[r] = count + r;
+        displs[r] = total;
+        total    += counts[r] + 1;
+    }
+    rbuf.assign(2 * total, TEST_STRIDED_DT_GAP);
+    for (int r = 0; r < n_procs; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        sbufs[r].assign(2 * counts[r], TEST_STRIDED_DT_GAP);
+        for (uint32_t i = 0; i < counts[r]; i++) {
+            sbufs[r][2 * i] = TEST_STRIDED_DT_VAL(r, i);
+        }
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args           = coll;
+        coll->coll_type         = UCC_COLL_TYPE_GATHERV;
+        coll->root              = root;
+        coll->src.info.buffer   = sbufs[r].data();
+        coll->src.info.count    = counts[r];
+        coll->src.info.datatype = dt;
+        coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        if (r != root) {
+            continue;
+        }
+        coll->dst.info_v.buffer        = rbuf.data();
+        coll->dst.info_v.counts        = (ucc_count_t *)counts.data();
+        coll->dst.info_v.displacements = (ucc_aint_t *)displs.data();
+        coll->dst.info_v.datatype      = dt;
+        coll->dst.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+        if (inplace) {
+            for (uint32_t i = 0; i < counts[r]; i++) {
+                rbuf[2 * (displs[r] + i)] = TEST_STRIDED_DT_VAL(r, i);
+            }
+            coll->mask  = UCC_COLL_ARGS_FIELD_FLAGS;
+            coll->flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        }
+    }
+    UccReq req(team, ctxs);
+    req.start();
+    EXPECT_EQ(UCC_OK, req.wait());
+    for (int p = 0; p < n_procs && !HasFailure(); p++) {
+        for (uint32_t i = 0; i < counts[p] && !HasFailure(); i++) {
+            EXPECT_EQ(TEST_STRIDED_DT_VAL(p, i), rbuf[2 * (displs[p] + i)]);
+            EXPECT_EQ(TEST_STRIDED_DT_GAP, rbuf[2 * (displs[p] + i) + 1]);
+        }
+        /* gap element after the block is not touched */
+        EXPECT_EQ(TEST_STRIDED_DT_GAP, rbuf[2 * (displs[p] + counts[p])]);
+    }
+    for (int r = 0; r < n_procs; r++) {
+        free(ctxs[r]->args);
+        free(ctxs[r]);
+    }
+    ucc_dt_destroy(dt);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_gatherv_generic_dt,
+    ::testing::Combine(
+        ::testing::Values(3, 1000), // base count
+        ::testing::Values(0, 4), // root
+        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef TEST_GENERIC_DT_H
+#define TEST_GENERIC_DT_H
+
+#include "common/test_ucc.h"
+
+/* Non-contiguous generic datatype: element i is the int32 at index
+   2 * i of the buffer, odd slots are gaps that must not be touched */
+typedef struct test_strided_dt_state {
+    int32_t *buffer;
+    size_t   count;
+} test_strided_dt_state_t;
+
+static inline uint8_t *test_strided_dt_byte(test_strided_dt_state_t *s,
+                                            size_t offset)
+{
+    return (uint8_t *)&s->buffer[2 * (offset / sizeof(int32_t))] +
+           offset % sizeof(int32_t);
+}
+
+static inline void *test_strided_dt_start(void *context, const void *buffer,
+                                          size_t count)
+{
+    test_strided_dt_state_t *s = new test_strided_dt_state_t;
+
+    s->buffer = (int32_t *)buffer;
+    s->count  = count;
+    return s;
+}
+
+static inline void *test_strided_dt_start_unpack(void *context, void *buffer,
+                                                 size_t count)
+{
+    return test_strided_dt_start(context, buffer, count);
+}
+
+static inline size_t test_strided_dt_packed_size(void *state)
+{
+    return ((test_strided_dt_state_t *)state)->count * sizeof(int32_t);
+}
+
+static inline size_t test_strided_dt_pack(void *state, size_t offset,
+                                          void *dest, size_t max_length)
+{
+    test_strided_dt_state_t *s   = (test_strided_dt_state_t *)state;
+    size_t                   len = std::min(max_length,
+                                            test_strided_dt_packed_size(s) -
+                                            offset);
+
+    for (size_t i = 0; i < len; i++) {
+        ((uint8_t *)dest)[i] = *test_strided_dt_byte(s, offset + i);
+    }
+    return len;
+}
+
+static inline ucc_status_t test_strided_dt_unpack(void *state, size_t offset,
+                                                  const void *src,
+                                                  size_t length)
+{
+    test_strided_dt_state_t *s = (test_strided_dt_state_t *)state;
+
+    if (offset + length > test_strided_dt_packed_size(s)) {
+        return UCC_ERR_INVALID_PARAM;
+    }
+    for (size_t i = 0; i < length; i++) {
+        *test_strided_dt_byte(s, offset + i) = ((const uint8_t *)src)[i];
+    }
+    return UCC_OK;
+}
+
+static inline void test_strided_dt_finish(void *state)
+{
+    delete (test_strided_dt_state_t *)state;
+}
+
+static inline ucc_datatype_t test_strided_dt_create()
+{
+    ucc_generic_dt_ops_t ops;
+    ucc_datatype_t       dt;
+
+    memset(&ops, 0, sizeof(ops));
+    ops.start_pack   = test_strided_dt_start;
+    ops.start_unpack = test_strided_dt_start_unpack;
+    ops.packed_size  = test_strided_dt_packed_size;
+    ops.pack         = test_strided_dt_pack;
+    ops.unpack       = test_strided_dt_unpack;
+    ops.finish       = test_strided_dt_finish;
+    UCC_CHECK(ucc_dt_create_generic(&ops, NULL, &dt));
+    return dt;
+}
+
+/* value of element i of rank r's data, gaps are filled with -1 */
+#define TEST_STRIDED_DT_VAL(_r, _i) ((int32_t)((_r) * 1000003 + (_i)))
+#define TEST_STRIDED_DT_GAP         ((int32_t)-1)
+
+#endif
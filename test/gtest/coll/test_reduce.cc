@@ -334,6 +334,24 @@ ucc_job_env_t reduce_dbt_env   = {{"UCC_TL_UCP_TUNE", "reduce:@dbt:0-inf:inf"},
                                   {"UCC_CLS", "basic"}};
 ucc_job_env_t reduce_2step_env = {{"UCC_CL_HIER_TUNE", "reduce:@2step:0-inf:inf"},
                                   {"UCC_CLS", "all"}};
+ucc_job_env_t reduce_2step_flat_env = {
+    {"UCC_CL_HIER_TUNE", "reduce:@2step:0-inf:inf"},
+    {"UCC_CL_HIER_NODE_SPLIT", "none"},
+    {"UCC_CLS", "all"}};
+ucc_job_env_t reduce_2step_socket_env = {
+    {"UCC_CL_HIER_TUNE", "reduce:@2step:0-inf:inf"},
+    {"UCC_CL_HIER_NODE_SPLIT", "socket"},
+    {"UCC_CLS", "all"}};
+/* node level of pipelined 2step runs on tl/shm, fragments of the pipeline
+   are posted in a different order on different ranks. Fragments fit the
+   default 8K data slot of tl/shm, larger ones would fall back to tl/ucp */
+ucc_job_env_t reduce_2step_shm_env = {
+    {"UCC_CL_HIER_TUNE", "reduce:@2step:0-inf:inf"},
+    {"UCC_CL_HIER_REDUCE_2STEP_PIPELINE",
+     "thresh=0:fragsize=4K:nfrags=5:pdepth=2"},
+    {"UCC_TLS", "ucp,shm"},
+    {"UCC_TL_SHM_TUNE", "inf"},
+    {"UCC_CLS", "all"}};
 ucc_job_env_t reduce_srg_env   = {{"UCC_TL_UCP_TUNE", "reduce:@srg:0-inf:inf"},
                                   {"UCC_CLS", "basic"}};
 TYPED_TEST(test_reduce_avg_order, avg_post_op) {
@@ -352,6 +370,18 @@ TYPED_TEST(test_reduce_2step, 2step) {
     TEST_DECLARE_WITH_ENV(reduce_2step_env, 16, false);
 }
 
+TYPED_TEST(test_reduce_2step, 2step_flat) {
+    TEST_DECLARE_WITH_ENV(reduce_2step_flat_env, 16, false);
+}
+
+TYPED_TEST(test_reduce_2step, 2step_socket) {
+    TEST_DECLARE_WITH_ENV(reduce_2step_socket_env, 15, false);
+}
+
+TYPED_TEST(test_reduce_2step, 2step_shm_pipelined) {
+    TEST_DECLARE_WITH_ENV(reduce_2step_shm_env, 8, false);
+}
+
 TYPED_TEST(test_reduce_srg, srg) {
     TEST_DECLARE_WITH_ENV(reduce_srg_env, 15, false);
 }
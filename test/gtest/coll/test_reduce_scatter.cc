@@ -360,6 +360,36 @@ UCC_TEST_P(test_reduce_scatter_alg,)
     }
 }
 
+UCC_TEST_P(test_reduce_scatter_alg, avg)
+{
+    test_reduce_scatter<TypeOpPair<UCC_DT_INT32, avg>> int_test;
+    test_reduce_scatter<TypeOpPair<UCC_DT_FLOAT64, avg>> dbl_test;
+    int                     n_procs = 7;
+    const ucc_job_env_t     env     = std::get<0>(GetParam());
+    UccJob                  job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h               team    = job.create_team(n_procs);
+    UccCollCtxVec           ctxs;
+
+    /* AVG scaling is fused into the last reduction of the result block */
+    for (auto count : {7 * 5, 7 * 9999}) {
+        int_test.set_mem_type(UCC_MEMORY_TYPE_HOST);
+        int_test.data_init(n_procs, UCC_DT_INT32, count, ctxs, false);
+        UccReq int_req(team, ctxs);
+        int_req.start();
+        int_req.wait();
+        EXPECT_EQ(true, int_test.data_validate(ctxs));
+        int_test.data_fini(ctxs);
+
+        dbl_test.set_mem_type(UCC_MEMORY_TYPE_HOST);
+        dbl_test.data_init(n_procs, UCC_DT_FLOAT64, count, ctxs, false);
+        UccReq dbl_req(team, ctxs);
+        dbl_req.start();
+        dbl_req.wait();
+        EXPECT_EQ(true, dbl_test.data_validate(ctxs));
+        dbl_test.data_fini(ctxs);
+    }
+}
+
 ucc_job_env_t ring_unidir_env = {{"name", "ring_unidirectional"},
                                  {"UCC_CL_BASIC_TUNE", "inf"},
                                  {"UCC_TL_UCP_TUNE", "reduce_scatter:@ring:inf"},
@@ -10,6 +10,7 @@
 #endif
 
 #include <common/test.h>
+#include <cstddef>
 
 extern "C" {
 #include <schedule/ucc_schedule.h>
@@ -20,6 +21,18 @@ class test_obj_size : public ucc::test {
 
 UCC_TEST_F(test_obj_size, size) {
     /* lets try to keep it within 8 cache lines
-       currently 480b */
+       currently 464b */
     EXPECT_LT(sizeof(ucc_coll_task_t), 64 * 8);
 }
+
+UCC_TEST_F(test_obj_size, hot_fields) {
+    const size_t line = 64;
+
+    /* fields used by the progress queue and task completion share the
+       first cache line of the task */
+    EXPECT_LE(offsetof(ucc_coll_task_t, schedule) + sizeof(ucc_schedule_t *),
+              line);
+    EXPECT_LT(offsetof(ucc_coll_task_t, progress), line);
+    EXPECT_LT(offsetof(ucc_coll_task_t, list_elem), line);
+    EXPECT_LT(offsetof(ucc_coll_task_t, team), line);
+}
@@ -370,7 +370,8 @@ ucc_status_t thread_allgather_req_free(void *request)
     return UCC_OK;
 }
 
-void proc_context_create(UccProcess_h proc, int id, ThreadAllgather *ta, bool is_global)
+void proc_context_create(UccProcess_h proc, int id, ThreadAllgather *ta,
+                         bool is_global, bool rr_nodes)
 {
     const int            nnodes   = 2;
     const int            nsockets = 2;
@@ -378,7 +379,7 @@ void proc_context_create(UccProcess_h proc, int id, ThreadAllgather *ta, bool is
     ucc_status_t         status;
     ucc_context_config_h ctx_config;
     std::stringstream    err_msg;
-    ucc_proc_info_t      proc_info;
+    ucc_proc_info_t      proc_info = {};
     int node, local_ppn, local_rank, job_size, block;
 
     status = ucc_context_config_read(proc->lib_h, NULL, &ctx_config);
@@ -398,10 +399,16 @@ void proc_context_create(UccProcess_h proc, int id, ThreadAllgather *ta, bool is
 
         /* Simulate multi-node topology for larger gtest coverage */
         job_size = ta->n_procs;
-        block = ucc_buffer_block_count(job_size, nnodes, 0);
-        node    = id / block;
-        local_ppn = ucc_buffer_block_count(job_size, nnodes, node);
-        local_rank = id - ucc_buffer_block_offset(job_size, nnodes, node);
+        if (rr_nodes) {
+            node       = id % nnodes;
+            local_ppn  = ucc_buffer_block_count(job_size, nnodes, node);
+            local_rank = id / nnodes;
+        } else {
+            block      = ucc_buffer_block_count(job_size, nnodes, 0);
+            node       = id / block;
+            local_ppn  = ucc_buffer_block_count(job_size, nnodes, node);
+            local_rank = id - ucc_buffer_block_offset(job_size, nnodes, node);
+        }
 
         proc_info.host_hash = node + 1;
         block = ucc_buffer_block_count(local_ppn, nsockets, 0);
@@ -411,6 +418,9 @@ void proc_context_create(UccProcess_h proc, int id, ThreadAllgather *ta, bool is
         proc_info.numa_id = local_rank / block;
 
         proc_info.pid = id + 1;
+        /* no network devices, tests force rails with UCC_CL_HIER_NRAILS */
+        proc_info.n_rails   = 0;
+        proc_info.rail_mask = 0;
     } else {
         proc_info = ucc_local_proc;
     }
@@ -479,8 +489,11 @@ void UccJob::create_context()
             workers.push_back(
                 std::thread(proc_context_create_mem_params, procs[i], i, &ta));
         } else {
-            workers.push_back(std::thread(proc_context_create, procs[i], i, &ta,
-                                          ctx_mode == UCC_JOB_CTX_GLOBAL));
+            workers.push_back(std::thread(
+                proc_context_create, procs[i], i, &ta,
+                ctx_mode == UCC_JOB_CTX_GLOBAL ||
+                    ctx_mode == UCC_JOB_CTX_GLOBAL_RR,
+                ctx_mode == UCC_JOB_CTX_GLOBAL_RR));
         }
     }
     for (auto i = 0; i < procs.size(); i++) {
@@ -202,7 +202,9 @@ public:
     typedef enum {
         UCC_JOB_CTX_LOCAL,
         UCC_JOB_CTX_GLOBAL, /*< ucc ctx create with OOB */
-        UCC_JOB_CTX_GLOBAL_ONESIDED
+        UCC_JOB_CTX_GLOBAL_ONESIDED,
+        UCC_JOB_CTX_GLOBAL_RR /*< same as GLOBAL, ranks are placed on the
+                                  simulated nodes round-robin */
     } ucc_job_ctx_mode_t;
     static const int nStaticTeams     = 5;
     static const int staticUccJobSize = 16;
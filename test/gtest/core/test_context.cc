@@ -7,6 +7,7 @@
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <unistd.h>
 
 test_context::test_context()
 {
@@ -47,6 +48,38 @@ UCC_TEST_F(test_context, init_multiple)
     }
 }
 
+UCC_TEST_F(test_context, progress_thread)
+{
+    ucc_lib_config_h     lib_cfg;
+    ucc_lib_params_t     mt_lib_params;
+    ucc_lib_h            mt_lib;
+    ucc_context_config_h cfg;
+    ucc_context_params_t ctx_params;
+    ucc_context_h        ctx_h;
+
+    EXPECT_EQ(UCC_OK, ucc_lib_config_read(NULL, NULL, &lib_cfg));
+    mt_lib_params.mask        = UCC_LIB_PARAM_FIELD_THREAD_MODE;
+    mt_lib_params.thread_mode = UCC_THREAD_MULTIPLE;
+    ASSERT_EQ(UCC_OK, ucc_init(&mt_lib_params, lib_cfg, &mt_lib));
+    ucc_lib_config_release(lib_cfg);
+
+    EXPECT_EQ(UCC_OK, ucc_context_config_read(mt_lib, NULL, &cfg));
+    EXPECT_EQ(UCC_OK,
+              ucc_context_config_modify(cfg, NULL, "PROGRESS_THREAD", "y"));
+    EXPECT_EQ(UCC_OK,
+              ucc_context_config_modify(cfg, NULL, "PROGRESS_THREAD_SPIN",
+                                        "10"));
+    ctx_params.mask = UCC_CONTEXT_PARAM_FIELD_TYPE;
+    ctx_params.type = UCC_CONTEXT_SHARED;
+    EXPECT_EQ(UCC_OK, ucc_context_create(mt_lib, &ctx_params, cfg, &ctx_h));
+    ucc_context_config_release(cfg);
+    /* let the thread go through spin and sleep phases */
+    usleep(10000);
+    EXPECT_EQ(UCC_OK, ucc_context_progress(ctx_h));
+    EXPECT_EQ(UCC_OK, ucc_context_destroy(ctx_h));
+    EXPECT_EQ(UCC_OK, ucc_finalize(mt_lib));
+}
+
 test_context_get_attr::test_context_get_attr()
 {
     ucc_context_params_t ctx_params;
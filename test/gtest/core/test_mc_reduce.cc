@@ -324,6 +324,8 @@ class test_mc_reduce : public testing::Test {
             }
             if (T::dt == UCC_DT_BFLOAT16) {
                 float32tobfloat16(bfloat16tofloat32(&res)*(float)alpha, &res);
+            } else if (T::dt == UCC_DT_FLOAT16) {
+                float32tofloat16(float16tofloat32(&res)*(float)alpha, &res);
             } else {
                 res *= (typename T::type)alpha;
             }
@@ -362,6 +364,7 @@ using TypeOpPairsFloat = ::testing::Types<ARITHMETIC_OP_PAIRS(FLOAT32),
                                           ARITHMETIC_OP_PAIRS(FLOAT64),
                                           ARITHMETIC_OP_PAIRS(FLOAT128),
                                           ARITHMETIC_OP_PAIRS(BFLOAT16),
+                                          ARITHMETIC_OP_PAIRS(FLOAT16),
                                           TypeOpPair<UCC_DT_FLOAT32_COMPLEX, sum>,
                                           TypeOpPair<UCC_DT_FLOAT32_COMPLEX, prod>,
                                           TypeOpPair<UCC_DT_FLOAT64_COMPLEX, sum>,
@@ -370,7 +373,8 @@ using TypeOpPairsFloat = ::testing::Types<ARITHMETIC_OP_PAIRS(FLOAT32),
                                           TypeOpPair<UCC_DT_FLOAT128_COMPLEX, prod>,
                                           TypeOpPair<UCC_DT_FLOAT32, avg>,
                                           TypeOpPair<UCC_DT_FLOAT64, avg>,
-                                          TypeOpPair<UCC_DT_BFLOAT16, avg>>;
+                                          TypeOpPair<UCC_DT_BFLOAT16, avg>,
+                                          TypeOpPair<UCC_DT_FLOAT16, avg>>;
 
 using TypeOpPairsFloatCuda = ::testing::Types<
     ARITHMETIC_OP_PAIRS(FLOAT32), ARITHMETIC_OP_PAIRS(FLOAT64),
@@ -417,6 +421,78 @@ DECLARE_REDUCE_MULTI_TEST(float, HOST);
 
 DECLARE_REDUCE_MULTI_ALPHA_TEST(float, HOST);
 
+#ifdef __SIZEOF_INT128__
+using TypeOpPairsInt128 = ::testing::Types<INT_OP_PAIRS(INT128),
+                                           INT_OP_PAIRS(UINT128)>;
+
+template <typename T>
+class test_mc_reduce_int128 : public test_mc_reduce<T, false> {};
+TYPED_TEST_CASE(test_mc_reduce_int128, TypeOpPairsInt128);
+
+DECLARE_REDUCE_TEST(int128, HOST);
+DECLARE_REDUCE_MULTI_TEST(int128, HOST);
+#endif
+
+/* FP8 is reduced in fp32 and rounded once, so the result has to match the
+   fp32 reference bit-exactly. Inputs are finite halves in [-8, 8], all the
+   partial sums are exact in fp32. */
+template <typename T>
+class test_mc_reduce_fp8 : public test_mc_reduce<T, false> {
+  public:
+    void test_reduce_fp8(int num_vec)
+    {
+        bool         avg   = (T::redop == UCC_OP_AVG);
+        double       alpha = 1.0 / (num_vec + 1);
+        ucc_status_t status;
+        float        acc;
+
+        ASSERT_EQ(UCC_OK, this->setup(UCC_MEMORY_TYPE_HOST, num_vec));
+        for (int i = 0; i < this->COUNT; i++) {
+            this->buf1_h[i] = T::from_f32(((i * 7) % 33 - 16) / 2.0f);
+            for (int j = 0; j < num_vec; j++) {
+                this->buf2_h[i + j * this->COUNT] =
+                    T::from_f32(((i * 5 + j * 3) % 33 - 16) / 2.0f);
+            }
+        }
+        status = this->do_reduce(this->buf1, this->buf2, this->res,
+                                 this->COUNT, num_vec,
+                                 this->COUNT * sizeof(*this->buf2), T::dt,
+                                 T::redop, avg, alpha);
+        ASSERT_EQ(UCC_OK, status);
+        this->free_executor();
+
+        for (int i = 0; i < this->COUNT; i++) {
+            acc = T::to_f32(this->buf1_h[i]);
+            for (int j = 0; j < num_vec; j++) {
+                acc = T::do_op(acc,
+                               T::to_f32(this->buf2_h[i + j * this->COUNT]));
+            }
+            if (avg) {
+                acc *= (float)alpha;
+            }
+            ASSERT_EQ(T::from_f32(acc), this->res_h[i]) << "index " << i;
+        }
+    }
+};
+
+#define FP8_OP_PAIRS(_TYPE)                                                    \
+    TypeOpPair<UCC_DT_##_TYPE, sum>, TypeOpPair<UCC_DT_##_TYPE, min>,          \
+        TypeOpPair<UCC_DT_##_TYPE, max>, TypeOpPair<UCC_DT_##_TYPE, avg>
+
+using TypeOpPairsFp8 =
+    ::testing::Types<FP8_OP_PAIRS(FLOAT8_E4M3), FP8_OP_PAIRS(FLOAT8_E5M2)>;
+TYPED_TEST_CASE(test_mc_reduce_fp8, TypeOpPairsFp8);
+
+TYPED_TEST(test_mc_reduce_fp8, HOST)
+{
+    this->test_reduce_fp8(1);
+}
+
+TYPED_TEST(test_mc_reduce_fp8, multi_HOST)
+{
+    this->test_reduce_fp8(20);
+}
+
 #ifdef HAVE_CUDA
 DECLARE_REDUCE_TEST(int, CUDA);
 DECLARE_REDUCE_TEST(uint, CUDA);
@@ -450,3 +526,488 @@ DECLARE_REDUCE_MULTI_TEST(float_triggered, CUDA);
 
 DECLARE_REDUCE_MULTI_ALPHA_TEST(float_triggered, CUDA);
 #endif
+
+class test_ec_cpu_reduce : public testing::Test {
+  protected:
+    const int          COUNT = 1024;
+    ucc_ee_executor_t *executor;
+
+    virtual void SetUp() override
+    {
+        ucc_ee_executor_params_t params;
+        ucc_mc_params_t          mc_params = {
+            .thread_mode = UCC_THREAD_SINGLE,
+        };
+        ucc_ec_params_t          ec_params = {
+            .thread_mode = UCC_THREAD_SINGLE,
+        };
+
+        ucc_constructor();
+        ucc_mc_init(&mc_params);
+        ucc_ec_init(&ec_params);
+        params.mask    = UCC_EE_EXECUTOR_PARAM_FIELD_TYPE;
+        params.ee_type = UCC_EE_CPU_THREAD;
+        ASSERT_EQ(UCC_OK, ucc_ee_executor_init(&params, &executor));
+        ASSERT_EQ(UCC_OK, ucc_ee_executor_start(executor, NULL));
+    }
+
+    virtual void TearDown() override
+    {
+        ucc_ee_executor_stop(executor);
+        ucc_ee_executor_finalize(executor);
+        ucc_mc_finalize();
+    }
+
+    ucc_status_t post_wait(ucc_ee_executor_task_args_t *eargs)
+    {
+        ucc_ee_executor_task_t *task;
+        ucc_status_t            status;
+
+        status = ucc_ee_executor_task_post(executor, eargs, &task);
+        if (UCC_OK != status) {
+            return status;
+        }
+        while (0 < (status = ucc_ee_executor_task_test(task))) {
+            ;
+        }
+        ucc_ee_executor_task_finalize(task);
+        return status;
+    }
+
+    ucc_status_t reduce(std::vector<void *> &srcs, void *dst,
+                        ucc_datatype_t dt, ucc_reduction_op_t op)
+    {
+        ucc_ee_executor_task_args_t eargs = {};
+
+        eargs.task_type     = UCC_EE_EXECUTOR_TASK_REDUCE;
+        eargs.reduce.dst    = dst;
+        eargs.reduce.count  = COUNT;
+        eargs.reduce.dt     = dt;
+        eargs.reduce.op     = op;
+        eargs.reduce.n_srcs = srcs.size();
+        for (size_t i = 0; i < srcs.size(); i++) {
+            eargs.reduce.srcs[i] = srcs[i];
+        }
+        return post_wait(&eargs);
+    }
+
+    /* compares to a fold in double precision */
+    template <typename T>
+    void complex_reduce(ucc_datatype_t dt, ucc_reduction_op_t op,
+                        size_t count)
+    {
+        const int                                 n_srcs = 5;
+        const double                              alpha  = 1.0 / n_srcs;
+        const double                              tol    =
+            std::numeric_limits<T>::epsilon() * 64;
+        std::vector<std::vector<std::complex<T>>> bufs(n_srcs);
+        std::vector<std::complex<T>>              dst(count);
+        std::complex<double>                      ref;
+        ucc_ee_executor_task_args_t               eargs = {};
+
+        for (int j = 0; j < n_srcs; j++) {
+            bufs[j].resize(count);
+            for (size_t i = 0; i < count; i++) {
+                bufs[j][i] = std::complex<T>(0.5 + (i % 7) * 0.25 - j,
+                                             1.0 - (i % 5) * 0.5 + j * 0.125);
+            }
+            eargs.reduce.srcs[j] = bufs[j].data();
+        }
+        eargs.task_type     = UCC_EE_EXECUTOR_TASK_REDUCE;
+        eargs.flags         = op == UCC_OP_AVG ?
+                              UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA : 0;
+        eargs.reduce.dst    = dst.data();
+        eargs.reduce.count  = count;
+        eargs.reduce.dt     = dt;
+        eargs.reduce.op     = op;
+        eargs.reduce.alpha  = alpha;
+        eargs.reduce.n_srcs = n_srcs;
+        ASSERT_EQ(UCC_OK, post_wait(&eargs));
+        for (size_t i = 0; i < count; i++) {
+            ref = std::complex<double>(bufs[0][i]);
+            for (int j = 1; j < n_srcs; j++) {
+                if (op == UCC_OP_PROD) {
+                    ref *= std::complex<double>(bufs[j][i]);
+                } else {
+                    ref += std::complex<double>(bufs[j][i]);
+                }
+            }
+            if (op == UCC_OP_AVG) {
+                ref *= alpha;
+            }
+            ASSERT_NEAR(ref.real(), dst[i].real(), tol * (1 + std::abs(ref)));
+            ASSERT_NEAR(ref.imag(), dst[i].imag(), tol * (1 + std::abs(ref)));
+        }
+    }
+};
+
+typedef struct {
+    double  value;
+    int32_t index;
+} test_float64_int32_t;
+
+TEST_F(test_ec_cpu_reduce, maxloc_minloc)
+{
+    const int                                      n_srcs = 5;
+    std::vector<std::vector<test_float64_int32_t>> bufs(n_srcs);
+    std::vector<test_float64_int32_t>              res(COUNT);
+    std::vector<void *>                            srcs;
+
+    ASSERT_EQ(16, ucc_dt_size(UCC_DT_FLOAT64_INT32));
+    for (int j = 0; j < n_srcs; j++) {
+        bufs[j].resize(COUNT);
+        for (int i = 0; i < COUNT; i++) {
+            /* every 4th element is a tie across all the sources */
+            bufs[j][i].value = (i % 4) ? (double)((i * 7 + j * 13) % 11) : 1.0;
+            bufs[j][i].index = n_srcs - j;
+        }
+        srcs.push_back(bufs[j].data());
+    }
+    for (auto op : {UCC_OP_MAXLOC, UCC_OP_MINLOC}) {
+        ASSERT_EQ(UCC_OK, reduce(srcs, res.data(), UCC_DT_FLOAT64_INT32, op));
+        for (int i = 0; i < COUNT; i++) {
+            test_float64_int32_t ref = bufs[0][i];
+            for (int j = 1; j < n_srcs; j++) {
+                const test_float64_int32_t &v = bufs[j][i];
+                bool better = (op == UCC_OP_MAXLOC) ? v.value > ref.value
+                                                    : v.value < ref.value;
+                if (better ||
+                    (v.value == ref.value && v.index < ref.index)) {
+                    ref = v;
+                }
+            }
+            ASSERT_EQ(ref.value, res[i].value);
+            ASSERT_EQ(ref.index, res[i].index);
+        }
+    }
+    EXPECT_EQ(UCC_ERR_NOT_SUPPORTED,
+              reduce(srcs, res.data(), UCC_DT_FLOAT64_INT32, UCC_OP_SUM));
+}
+
+static int test_user_reduce_calls;
+
+static ucc_status_t test_user_reduce_cb(const ucc_reduce_cb_params_t *p)
+{
+    const int64_t *s1 = (const int64_t *)p->src1;
+    int64_t       *d  = (int64_t *)p->dst;
+
+    test_user_reduce_calls++;
+    for (size_t i = 0; i < p->count; i++) {
+        int64_t r = s1[i];
+        for (size_t j = 0; j < p->n_vectors; j++) {
+            r += ((const int64_t *)PTR_OFFSET(p->src2, p->stride * j))[i];
+        }
+        d[i] = r;
+    }
+    return UCC_OK;
+}
+
+TEST_F(test_ec_cpu_reduce, userdefined)
+{
+    const int                         n_srcs = 4;
+    std::vector<std::vector<int64_t>> bufs(n_srcs);
+    std::vector<int64_t>              strided(n_srcs * COUNT);
+    std::vector<int64_t>              res(COUNT);
+    std::vector<void *>               srcs;
+    ucc_generic_dt_ops_t              ops = {};
+    ucc_ee_executor_task_args_t       eargs = {};
+    ucc_datatype_t                    dt;
+
+    ops.mask        = UCC_GENERIC_DT_OPS_FIELD_FLAGS;
+    ops.flags       = UCC_GENERIC_DT_OPS_FLAG_CONTIG |
+                      UCC_GENERIC_DT_OPS_FLAG_REDUCE;
+    ops.contig_size = sizeof(int64_t);
+    ops.reduce.cb   = test_user_reduce_cb;
+    ASSERT_EQ(UCC_OK, ucc_dt_create_generic(&ops, NULL, &dt));
+
+    /* separate buffers: the callback runs once per source over all the
+       elements, dst aliasing a source is consumed first */
+    for (int j = 0; j < n_srcs; j++) {
+        bufs[j].resize(COUNT);
+        for (int i = 0; i < COUNT; i++) {
+            bufs[j][i] = i * (j + 1);
+            strided[j * COUNT + i] = i * (j + 1);
+        }
+        srcs.push_back(bufs[j].data());
+    }
+    test_user_reduce_calls = 0;
+    ASSERT_EQ(UCC_OK, reduce(srcs, bufs[2].data(), dt, UCC_OP_SUM));
+    EXPECT_EQ(n_srcs - 1, test_user_reduce_calls);
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_EQ(i * 10, bufs[2][i]);
+    }
+
+    /* strided sources are passed to the callback in one call */
+    test_user_reduce_calls       = 0;
+    eargs.task_type              = UCC_EE_EXECUTOR_TASK_REDUCE_STRIDED;
+    eargs.reduce_strided.dst     = res.data();
+    eargs.reduce_strided.src1    = strided.data();
+    eargs.reduce_strided.src2    = &strided[COUNT];
+    eargs.reduce_strided.stride  = COUNT * sizeof(int64_t);
+    eargs.reduce_strided.count   = COUNT;
+    eargs.reduce_strided.n_src2  = n_srcs - 1;
+    eargs.reduce_strided.dt      = dt;
+    eargs.reduce_strided.op      = UCC_OP_SUM;
+    ASSERT_EQ(UCC_OK, post_wait(&eargs));
+    EXPECT_EQ(1, test_user_reduce_calls);
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_EQ(i * 10, res[i]);
+    }
+    ucc_dt_destroy(dt);
+}
+
+TEST_F(test_ec_cpu_reduce, reduce_copy)
+{
+    /* not a multiple of the executor block, dst is not 16B aligned */
+    const size_t                    count  = 5 * COUNT + 3;
+    const int                       n_srcs = 3;
+    const int                       n_dst2 = 2;
+    const double                    alpha  = 0.25;
+    std::vector<std::vector<float>> bufs(n_srcs);
+    std::vector<std::vector<float>> dsts(n_dst2 + 1);
+    ucc_ee_executor_task_args_t     eargs = {};
+    float                           ref;
+
+    for (int j = 0; j < n_srcs; j++) {
+        bufs[j].resize(count);
+        for (size_t i = 0; i < count; i++) {
+            bufs[j][i] = (float)((i * (j + 3)) % 1000);
+        }
+        eargs.reduce_copy.reduce.srcs[j] = bufs[j].data();
+    }
+    for (int j = 0; j < n_dst2 + 1; j++) {
+        dsts[j].resize(count + 1, -1.0f);
+    }
+    for (uint16_t nt : {0, (int)UCC_EEE_TASK_FLAG_NT_STORE}) {
+        eargs.task_type                 = UCC_EE_EXECUTOR_TASK_REDUCE_COPY;
+        eargs.flags                     = nt |
+                                          UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA;
+        eargs.reduce_copy.reduce.dst    = &dsts[0][1];
+        eargs.reduce_copy.reduce.count  = count;
+        eargs.reduce_copy.reduce.dt     = UCC_DT_FLOAT32;
+        eargs.reduce_copy.reduce.op     = UCC_OP_AVG;
+        eargs.reduce_copy.reduce.alpha  = alpha;
+        eargs.reduce_copy.reduce.n_srcs = n_srcs;
+        eargs.reduce_copy.n_dst2        = n_dst2;
+        for (int j = 0; j < n_dst2; j++) {
+            eargs.reduce_copy.dst2[j] = &dsts[j + 1][1];
+        }
+        ASSERT_EQ(UCC_OK, post_wait(&eargs));
+        for (size_t i = 0; i < count; i++) {
+            ref = (float)((bufs[0][i] + bufs[1][i] + bufs[2][i]) * alpha);
+            for (int j = 0; j < n_dst2 + 1; j++) {
+                ASSERT_FLOAT_EQ(ref, dsts[j][i + 1]);
+            }
+        }
+        for (int j = 0; j < n_dst2 + 1; j++) {
+            EXPECT_EQ(-1.0f, dsts[j][0]);
+        }
+    }
+
+    /* in place reduction with streaming stores */
+    eargs.task_type      = UCC_EE_EXECUTOR_TASK_REDUCE;
+    eargs.flags          = UCC_EEE_TASK_FLAG_NT_STORE;
+    eargs.reduce.dst     = bufs[0].data();
+    eargs.reduce.srcs[0] = bufs[0].data();
+    eargs.reduce.srcs[1] = bufs[1].data();
+    eargs.reduce.count   = count;
+    eargs.reduce.dt      = UCC_DT_FLOAT32;
+    eargs.reduce.op      = UCC_OP_SUM;
+    eargs.reduce.n_srcs  = 2;
+    ASSERT_EQ(UCC_OK, post_wait(&eargs));
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ((float)((i * 3) % 1000 + (i * 4) % 1000), bufs[0][i]);
+    }
+}
+
+TEST_F(test_ec_cpu_reduce, avg_int)
+{
+    const int                         n_srcs = 7;
+    std::vector<std::vector<int32_t>> bufs(n_srcs);
+    std::vector<int8_t>               b8[UCC_EE_EXECUTOR_NUM_BUFS], d8(COUNT);
+    std::vector<int32_t>              dst(COUNT);
+    ucc_ee_executor_task_args_t       eargs = {};
+    int32_t                           sum;
+
+    /* sum is divided by 1 / alpha exactly and rounded toward zero, as for
+       C integer division */
+    for (int j = 0; j < n_srcs; j++) {
+        bufs[j].resize(COUNT);
+        for (int i = 0; i < COUNT; i++) {
+            bufs[j][i] = (i % 2 ? -1 : 1) * (i * (j + 1) + j);
+        }
+        eargs.reduce.srcs[j] = bufs[j].data();
+    }
+    eargs.task_type     = UCC_EE_EXECUTOR_TASK_REDUCE;
+    eargs.flags         = UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA;
+    eargs.reduce.dst    = dst.data();
+    eargs.reduce.count  = COUNT;
+    eargs.reduce.dt     = UCC_DT_INT32;
+    eargs.reduce.op     = UCC_OP_AVG;
+    eargs.reduce.alpha  = 1.0 / n_srcs;
+    eargs.reduce.n_srcs = n_srcs;
+    ASSERT_EQ(UCC_OK, post_wait(&eargs));
+    for (int i = 0; i < COUNT; i++) {
+        sum = 0;
+        for (int j = 0; j < n_srcs; j++) {
+            sum += bufs[j][i];
+        }
+        ASSERT_EQ(sum / n_srcs, dst[i]);
+    }
+
+    /* narrow types do not overflow in the sum */
+    b8[0].assign(COUNT, 100);
+    b8[1].assign(COUNT, 120);
+    eargs.reduce.srcs[0] = b8[0].data();
+    eargs.reduce.srcs[1] = b8[1].data();
+    eargs.reduce.dst     = d8.data();
+    eargs.reduce.dt      = UCC_DT_INT8;
+    eargs.reduce.alpha   = 0.5;
+    eargs.reduce.n_srcs  = 2;
+    ASSERT_EQ(UCC_OK, post_wait(&eargs));
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_EQ(110, d8[i]);
+    }
+
+    /* nor when the sources are accumulated in a temporary */
+    for (int j = 0; j < UCC_EE_EXECUTOR_NUM_BUFS; j++) {
+        b8[j].assign(COUNT, 100 + j);
+        eargs.reduce.srcs[j] = b8[j].data();
+    }
+    eargs.reduce.alpha  = 1.0 / UCC_EE_EXECUTOR_NUM_BUFS;
+    eargs.reduce.n_srcs = UCC_EE_EXECUTOR_NUM_BUFS;
+    ASSERT_EQ(UCC_OK, post_wait(&eargs));
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_EQ(100 + (UCC_EE_EXECUTOR_NUM_BUFS - 1) / 2, d8[i]);
+    }
+}
+
+TEST_F(test_ec_cpu_reduce, alpha_prod)
+{
+    std::vector<double>         a(COUNT), b(COUNT), dst(COUNT);
+    ucc_ee_executor_task_args_t eargs = {};
+
+    /* alpha is applied to the result of any op in the same pass */
+    for (int i = 0; i < COUNT; i++) {
+        a[i] = i + 1;
+        b[i] = 0.5 * i;
+    }
+    eargs.task_type      = UCC_EE_EXECUTOR_TASK_REDUCE;
+    eargs.flags          = UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA;
+    eargs.reduce.dst     = dst.data();
+    eargs.reduce.srcs[0] = a.data();
+    eargs.reduce.srcs[1] = b.data();
+    eargs.reduce.count   = COUNT;
+    eargs.reduce.dt      = UCC_DT_FLOAT64;
+    eargs.reduce.op      = UCC_OP_PROD;
+    eargs.reduce.alpha   = 0.25;
+    eargs.reduce.n_srcs  = 2;
+    ASSERT_EQ(UCC_OK, post_wait(&eargs));
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_EQ(a[i] * b[i] * 0.25, dst[i]);
+    }
+}
+
+TEST_F(test_ec_cpu_reduce, scatter_gather)
+{
+    /* more entries than any of the MULTI tasks can take */
+    const int n_entries = 3 * UCC_EE_EXECUTOR_NUM_BUFS;
+    const int n_srcs    = 3;
+    std::vector<std::vector<int32_t>>      src(n_entries), dst(n_entries);
+    std::vector<std::vector<void *>>       srcs(n_entries);
+    std::vector<ucc_eee_sg_copy_entry_t>   copies(n_entries);
+    std::vector<ucc_eee_sg_reduce_entry_t> reductions(n_entries);
+    ucc_ee_executor_task_args_t            eargs = {};
+
+
+    for (int e = 0; e < n_entries; e++) {
+        /* entries differ in size, some are empty */
+        src[e].resize(n_srcs * e * 7);
+        dst[e].resize(e * 7, -1);
+        for (size_t i = 0; i < src[e].size(); i++) {
+            src[e][i] = e * 1000 + i;
+        }
+        copies[e].src = src[e].data();
+        copies[e].dst = dst[e].data();
+        copies[e].len = dst[e].size() * sizeof(int32_t);
+    }
+    eargs.task_type         = UCC_EE_EXECUTOR_TASK_COPY_SG;
+    eargs.copy_sg.entries   = copies.data();
+    eargs.copy_sg.n_entries = n_entries;
+    ASSERT_EQ(UCC_OK, post_wait(&eargs));
+    for (int e = 0; e < n_entries; e++) {
+        for (size_t i = 0; i < dst[e].size(); i++) {
+            ASSERT_EQ(src[e][i], dst[e][i]);
+        }
+    }
+
+    for (int e = 0; e < n_entries; e++) {
+        for (int j = 0; j < n_srcs; j++) {
+            srcs[e].push_back(src[e].data() + j * e * 7);
+        }
+        reductions[e].dst    = dst[e].data();
+        reductions[e].srcs   = srcs[e].data();
+        reductions[e].count  = dst[e].size();
+        reductions[e].n_srcs = n_srcs;
+    }
+    eargs                     = {};
+    eargs.task_type           = UCC_EE_EXECUTOR_TASK_REDUCE_SG;
+    eargs.reduce_sg.entries   = reductions.data();
+    eargs.reduce_sg.n_entries = n_entries;
+    eargs.reduce_sg.dt        = UCC_DT_INT32;
+    eargs.reduce_sg.op        = UCC_OP_SUM;
+    ASSERT_EQ(UCC_OK, post_wait(&eargs));
+    for (int e = 0; e < n_entries; e++) {
+        for (size_t i = 0; i < dst[e].size(); i++) {
+            ASSERT_EQ(src[e][i] + src[e][i + e * 7] + src[e][i + 2 * e * 7],
+                      dst[e][i]);
+        }
+    }
+}
+
+#ifdef __SIZEOF_INT128__
+TEST_F(test_ec_cpu_reduce, int128_wide)
+{
+    const test_uint128_t        lo = ~(uint64_t)0;
+    std::vector<test_uint128_t> a(COUNT), b(COUNT), ud(COUNT);
+    std::vector<test_int128_t>  sa(COUNT), sb(COUNT), sd(COUNT);
+    std::vector<void *>         srcs;
+
+    /* carries and bitwise ops cross the 64-bit halves */
+    for (int i = 0; i < COUNT; i++) {
+        a[i]  = lo - i;
+        b[i]  = ((test_uint128_t)(i + 1) << 64) + i + 1;
+        sa[i] = -((test_int128_t)(i + 1) << 70);
+        sb[i] = (test_int128_t)i << 66;
+    }
+    srcs = {a.data(), b.data()};
+    ASSERT_EQ(UCC_OK, reduce(srcs, ud.data(), UCC_DT_UINT128, UCC_OP_SUM));
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_INT128_EQ((test_uint128_t)(i + 2) << 64, ud[i]);
+    }
+    ASSERT_EQ(UCC_OK, reduce(srcs, ud.data(), UCC_DT_UINT128, UCC_OP_BXOR));
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_INT128_EQ(a[i] ^ b[i], ud[i]);
+    }
+    srcs = {sa.data(), sb.data()};
+    ASSERT_EQ(UCC_OK, reduce(srcs, sd.data(), UCC_DT_INT128, UCC_OP_MIN));
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_INT128_EQ(sa[i], sd[i]);
+    }
+    ASSERT_EQ(UCC_OK, reduce(srcs, sd.data(), UCC_DT_INT128, UCC_OP_SUM));
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_INT128_EQ(sa[i] + sb[i], sd[i]);
+    }
+}
+#endif
+
+TEST_F(test_ec_cpu_reduce, complex)
+{
+    /* odd count leaves a tail after the vector loop */
+    for (size_t count : {(size_t)COUNT, (size_t)COUNT - 1, (size_t)3}) {
+        for (auto op : {UCC_OP_SUM, UCC_OP_PROD, UCC_OP_AVG}) {
+            complex_reduce<float>(UCC_DT_FLOAT32_COMPLEX, op, count);
+            complex_reduce<double>(UCC_DT_FLOAT64_COMPLEX, op, count);
+        }
+    }
+}
@@ -37,6 +37,15 @@ DECLARE_TYPE_OP_PAIR(uint16_t, UINT16, ASSERT_EQ);
 DECLARE_TYPE_OP_PAIR(uint32_t, UINT32, ASSERT_EQ);
 DECLARE_TYPE_OP_PAIR(uint64_t, UINT64, ASSERT_EQ);
 
+#ifdef __SIZEOF_INT128__
+/* gtest can not print 128-bit integers */
+#define ASSERT_INT128_EQ(_a, _b) ASSERT_TRUE((_a) == (_b))
+__extension__ typedef __int128          test_int128_t;
+__extension__ typedef unsigned __int128 test_uint128_t;
+DECLARE_TYPE_OP_PAIR(test_int128_t, INT128, ASSERT_INT128_EQ);
+DECLARE_TYPE_OP_PAIR(test_uint128_t, UINT128, ASSERT_INT128_EQ);
+#endif
+
 //TODO Bfloat Custom
 DECLARE_TYPE_OP_PAIR(float, FLOAT32, ASSERT_FLOAT_EQ);
 DECLARE_TYPE_OP_PAIR(double, FLOAT64, ASSERT_FLOAT_EQ);
@@ -74,6 +83,57 @@ struct TypeOpPair<UCC_DT_BFLOAT16, op> {
     }
 };
 
+template <template <typename P> class op>
+struct TypeOpPair<UCC_DT_FLOAT16, op> {
+    using type                            = uint16_t;
+    const static ucc_datatype_t     dt    = UCC_DT_FLOAT16;
+    const static ucc_reduction_op_t redop = op<float>::redop;
+    static void                     assert_equal(type arg1, type arg2)
+    {
+        // relative: CPU accumulates all vectors in fp32 and rounds once,
+        // reference rounds to float16 after every pair
+        float f1 = float16tofloat32(&arg1);
+        float f2 = float16tofloat32(&arg2);
+        ASSERT_NEAR(f1, f2, 1e-2 * fabs(f1) + 1e-7);
+    }
+    static type do_op(type arg1, type arg2)
+    {
+        op<float>  _op;
+        uint16_t   res;
+        float32tofloat16(
+            _op(float16tofloat32(&arg1), float16tofloat32(&arg2)), &res);
+        return res;
+    }
+};
+
+/* FP8 pairs only provide conversions: the reference is computed in fp32,
+   see test_mc_reduce_fp8 */
+#define DECLARE_TYPE_OP_PAIR_FP8(_TYPE, _to_f32, _from_f32)            \
+    template <template <typename P> class op>                          \
+    struct TypeOpPair<UCC_DT_##_TYPE, op> {                            \
+        using type                            = uint8_t;               \
+        const static ucc_datatype_t     dt    = UCC_DT_##_TYPE;        \
+        const static ucc_reduction_op_t redop = op<float>::redop;      \
+        static float to_f32(type arg)                                  \
+        {                                                              \
+            return _to_f32(&arg);                                      \
+        }                                                              \
+        static type from_f32(float arg)                                \
+        {                                                              \
+            type res;                                                  \
+            _from_f32(arg, &res);                                      \
+            return res;                                                \
+        }                                                              \
+        static float do_op(float arg1, float arg2)                     \
+        {                                                              \
+            op<float> _op;                                             \
+            return _op(arg1, arg2);                                    \
+        }                                                              \
+    };
+
+DECLARE_TYPE_OP_PAIR_FP8(FLOAT8_E4M3, float8e4m3tofloat32, float32tofloat8e4m3);
+DECLARE_TYPE_OP_PAIR_FP8(FLOAT8_E5M2, float8e5m2tofloat32, float32tofloat8e5m2);
+
 #define DECLARE_OP_(_op, _UCC_OP, _OP)                          \
     template<typename T>                                        \
     class _op {                                                 \
@@ -140,7 +200,8 @@ static inline bool ucc_reduction_is_supported(ucc_datatype_t dt,
                                               ucc_memory_type_t mt)
 {
     if ((mt != UCC_MEMORY_TYPE_HOST) &&
-        ((dt == UCC_DT_FLOAT128) || (dt == UCC_DT_FLOAT128_COMPLEX))) {
+        ((dt == UCC_DT_FLOAT128) || (dt == UCC_DT_FLOAT128_COMPLEX) ||
+         (dt == UCC_DT_INT128) || (dt == UCC_DT_UINT128))) {
         return false;
     }
     switch(op) {
@@ -161,9 +222,22 @@ static inline bool ucc_reduction_is_supported(ucc_datatype_t dt,
         case UCC_DT_FLOAT32_COMPLEX:
         case UCC_DT_FLOAT64_COMPLEX:
         case UCC_DT_BFLOAT16:
+        case UCC_DT_FLOAT16:
         case UCC_DT_FLOAT128:
         case UCC_DT_FLOAT128_COMPLEX:
             break;
+        case UCC_DT_INT8:
+        case UCC_DT_INT16:
+        case UCC_DT_INT32:
+        case UCC_DT_INT64:
+        case UCC_DT_INT128:
+        case UCC_DT_UINT8:
+        case UCC_DT_UINT16:
+        case UCC_DT_UINT32:
+        case UCC_DT_UINT64:
+        case UCC_DT_UINT128:
+            /* exact integer division is done by the host executor only */
+            return mt == UCC_MEMORY_TYPE_HOST;
         default:
             return false;
         }
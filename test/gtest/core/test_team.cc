@@ -121,3 +121,226 @@ UCC_TEST_F(test_team, team_get_attr)
     /* shuffle vector so that teams are destroyed in different order */
     std::shuffle(teams.begin(), teams.end(), std::default_random_engine());
 }
+
+UCC_TEST_F(test_team, team_get_attr_telemetry)
+{
+    const int                               n_iters = 5;
+    UccTeam_h                               team;
+    ucc_coll_args_t                         args;
+    ucc_team_attr_t                         attr;
+    std::vector<ucc_coll_telemetry_entry_t> entries;
+
+    team           = UccJob::getStaticJob()->create_team(4);
+    args.mask      = 0;
+    args.coll_type = UCC_COLL_TYPE_BARRIER;
+    for (int i = 0; i < n_iters; i++) {
+        UccReq req(team, &args);
+        req.start();
+        EXPECT_EQ(UCC_OK, req.wait());
+    }
+
+    for (auto &p : team->procs) {
+        /* query the number of entries first */
+        attr.mask                = UCC_TEAM_ATTR_FIELD_TELEMETRY;
+        attr.telemetry.n_entries = 0;
+        attr.telemetry.entries   = NULL;
+        EXPECT_EQ(UCC_OK, ucc_team_get_attr(p.team, &attr));
+        ASSERT_EQ(1, attr.telemetry.n_entries);
+
+        entries.resize(attr.telemetry.n_entries);
+        attr.telemetry.entries = entries.data();
+        EXPECT_EQ(UCC_OK, ucc_team_get_attr(p.team, &attr));
+        EXPECT_EQ(UCC_COLL_TYPE_BARRIER, entries[0].coll_type);
+        EXPECT_EQ(0, entries[0].msgsize_bucket);
+        EXPECT_EQ(n_iters, entries[0].n_colls);
+        EXPECT_EQ(0, entries[0].n_errors);
+        uint64_t n_hist = 0;
+        for (int k = 0; k < UCC_COLL_TELEMETRY_LAT_BUCKETS; k++) {
+            n_hist += entries[0].lat_hist[k];
+        }
+        EXPECT_EQ(n_iters, n_hist);
+    }
+}
+
+/* Posts n_colls allreduces inside of the fusion window on each rank and
+   checks that they are fused into one */
+static void test_coll_fusion(UccTeam_h team)
+{
+    const int                         n_colls = 4;
+    const int                         count   = 8;
+    int                               n_procs;
+    std::vector<std::vector<int32_t>> src, dst;
+    std::vector<ucc_coll_args_t>      args;
+    std::vector<ucc_coll_req_h>       reqs;
+    ucc_coll_req_h                    req;
+    ucc_team_attr_t                   attr;
+    ucc_status_t                      st;
+
+    n_procs = team->procs.size();
+    src.resize(n_procs * n_colls);
+    dst.resize(n_procs * n_colls);
+    args.resize(n_procs * n_colls);
+    for (int p = 0; p < n_procs; p++) {
+        for (int c = 0; c < n_colls; c++) {
+            int              i = p * n_colls + c;
+            ucc_coll_args_t &a = args[i];
+
+            src[i].assign(count, p + c);
+            dst[i].assign(count, 0);
+            a.mask              = 0;
+            a.coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+            a.op                = UCC_OP_SUM;
+            a.src.info.buffer   = src[i].data();
+            a.src.info.count    = count;
+            a.src.info.datatype = UCC_DT_INT32;
+            a.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            a.dst.info.buffer   = dst[i].data();
+            a.dst.info.count    = count;
+            a.dst.info.datatype = UCC_DT_INT32;
+            a.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            ASSERT_EQ(UCC_OK, ucc_collective_init(&a, &req,
+                                                  team->procs[p].team));
+            reqs.push_back(req);
+        }
+    }
+
+    for (auto &p : team->procs) {
+        EXPECT_EQ(UCC_OK, ucc_collective_fusion_start(p.team));
+    }
+    for (auto &r : reqs) {
+        EXPECT_EQ(UCC_OK, ucc_collective_post(r));
+    }
+    for (auto &p : team->procs) {
+        EXPECT_EQ(UCC_OK, ucc_collective_fusion_end(p.team));
+    }
+    for (auto &r : reqs) {
+        while ((st = ucc_collective_test(r)) > 0) {
+            team->progress();
+        }
+        EXPECT_EQ(UCC_OK, st);
+    }
+    for (auto &r : reqs) {
+        EXPECT_EQ(UCC_OK, ucc_collective_finalize(r));
+    }
+
+    for (int p = 0; p < n_procs; p++) {
+        for (int c = 0; c < n_colls; c++) {
+            int32_t expected = n_procs * c + n_procs * (n_procs - 1) / 2;
+
+            for (auto v : dst[p * n_colls + c]) {
+                EXPECT_EQ(expected, v);
+            }
+        }
+        attr.mask                = UCC_TEAM_ATTR_FIELD_TELEMETRY;
+        attr.telemetry.n_entries = 0;
+        attr.telemetry.entries   = NULL;
+        EXPECT_EQ(UCC_OK, ucc_team_get_attr(team->procs[p].team, &attr));
+        EXPECT_EQ(n_colls, attr.telemetry.n_fused_colls);
+        EXPECT_EQ(1, attr.telemetry.n_fusion_batches);
+    }
+}
+
+UCC_TEST_F(test_team, coll_fusion)
+{
+    test_coll_fusion(UccJob::getStaticJob()->create_team(4));
+}
+
+UCC_TEST_F(test_team, coll_fusion_shm)
+{
+    /* single node team, fused allreduce runs on tl/shm while the deferred
+       members are initialized but never posted */
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_TLS", "ucp,shm"},
+                             {"UCC_TL_SHM_TUNE", "inf"},
+                             {"UCC_CLS", "basic"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_LOCAL, env);
+
+    test_coll_fusion(job.create_team(n_procs));
+}
+
+/* Posts a batch of n_colls allreduces on each rank of a 4 ranks team and
+   checks the results */
+static void test_coll_batch(int n_colls, bool timeout)
+{
+    const int                         count = 8;
+    UccTeam_h                         team;
+    int                               n_procs;
+    std::vector<std::vector<int32_t>> src, dst;
+    std::vector<ucc_coll_args_t>      args;
+    std::vector<ucc_coll_req_h>       reqs;
+    std::vector<ucc_team_h>           teams;
+    ucc_coll_req_h                    req;
+    ucc_status_t                      st;
+
+    team    = UccJob::getStaticJob()->create_team(4);
+    n_procs = team->procs.size();
+    src.resize(n_procs * n_colls);
+    dst.resize(n_procs * n_colls);
+    args.resize(n_procs * n_colls);
+    for (int p = 0; p < n_procs; p++) {
+        for (int c = 0; c < n_colls; c++) {
+            int              i = p * n_colls + c;
+            ucc_coll_args_t &a = args[i];
+
+            src[i].assign(count, p + c);
+            dst[i].assign(count, 0);
+            a.mask              = 0;
+            if (timeout) {
+                /* would expire at the first progress if the post time
+                   of the batch collectives was not set */
+                a.mask    = UCC_COLL_ARGS_FIELD_FLAGS;
+                a.flags   = UCC_COLL_ARGS_FLAG_TIMEOUT;
+                a.timeout = 60;
+            }
+            a.coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+            a.op                = UCC_OP_SUM;
+            a.src.info.buffer   = src[i].data();
+            a.src.info.count    = count;
+            a.src.info.datatype = UCC_DT_INT32;
+            a.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            a.dst.info.buffer   = dst[i].data();
+            a.dst.info.count    = count;
+            a.dst.info.datatype = UCC_DT_INT32;
+            a.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        }
+        teams.assign(n_colls, team->procs[p].team);
+        ASSERT_EQ(UCC_OK, ucc_collective_init_batch(&args[p * n_colls],
+                                                    teams.data(), n_colls,
+                                                    &req));
+        reqs.push_back(req);
+    }
+
+    for (auto &r : reqs) {
+        EXPECT_EQ(UCC_OK, ucc_collective_post(r));
+    }
+    for (auto &r : reqs) {
+        while ((st = ucc_collective_test(r)) > 0) {
+            team->progress();
+        }
+        EXPECT_EQ(UCC_OK, st);
+    }
+    for (auto &r : reqs) {
+        EXPECT_EQ(UCC_OK, ucc_collective_finalize(r));
+    }
+
+    for (int p = 0; p < n_procs; p++) {
+        for (int c = 0; c < n_colls; c++) {
+            int32_t expected = n_procs * c + n_procs * (n_procs - 1) / 2;
+
+            for (auto v : dst[p * n_colls + c]) {
+                EXPECT_EQ(expected, v);
+            }
+        }
+    }
+}
+
+UCC_TEST_F(test_team, coll_batch)
+{
+    /* more than fits into one schedule */
+    test_coll_batch(10, false);
+}
+
+UCC_TEST_F(test_team, coll_batch_timeout)
+{
+    test_coll_batch(10, true);
+}
@@ -12,6 +12,7 @@ extern "C" {
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <chrono>
 
 class addr_storage {
   public:
@@ -703,3 +704,124 @@ UCC_TEST_F(test_topo, node_leaders)
     EXPECT_EQ(3, node_leaders[2]);
     EXPECT_EQ(3, node_leaders[3]);
 }
+
+UCC_TEST_F(test_topo, full_host_ordered)
+{
+    const ucc_rank_t n_hosts  = 4;
+    const ucc_rank_t ppn      = 4;
+    const ucc_rank_t ctx_size = n_hosts * ppn;
+    addr_storage     s(ctx_size);
+    ucc_sbgp_t *     sbgp;
+    ucc_subset_t     set;
+    ucc_rank_t       i;
+
+    /* round-robin placement: rank i runs on host i % n_hosts, socket is
+       alternated within the host */
+    for (i = 0; i < ctx_size; i++) {
+        SET_PI(s, i, 0xa00 + i % n_hosts, (i / n_hosts) % 2, i);
+    }
+
+    set.map.ep_num = ctx_size;
+    set.myrank     = 5;
+    set.map.type   = UCC_EP_MAP_FULL;
+
+    EXPECT_EQ(UCC_OK, ucc_context_topo_init(&s.storage, &ctx_topo));
+    EXPECT_EQ(UCC_OK, ucc_topo_init(set, ctx_topo, &topo));
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_FULL_HOST_ORDERED);
+    EXPECT_EQ(UCC_SBGP_ENABLED, sbgp->status);
+    EXPECT_EQ(ctx_size, sbgp->group_size);
+    /* host 0: socket 0 {0, 8}, socket 1 {4, 12}, host 1: ... */
+    EXPECT_EQ(true, check_sbgp(sbgp, {0, 8, 4, 12, 1, 9, 5, 13,
+                                      2, 10, 6, 14, 3, 11, 7, 15}));
+    EXPECT_EQ(5, ucc_ep_map_eval(sbgp->map, sbgp->group_rank));
+}
+
+UCC_TEST_F(test_topo, full_host_ordered_subset)
+{
+    const ucc_rank_t ctx_size              = 8;
+    const ucc_rank_t team_size             = 4;
+    ucc_rank_t       team_ranks[team_size] = {6, 1, 3, 4};
+    addr_storage     s(ctx_size);
+    ucc_sbgp_t *     sbgp;
+    ucc_subset_t     set;
+    ucc_rank_t       i;
+
+    for (i = 0; i < ctx_size; i++) {
+        SET_PI(s, i, 0xa00 + i % 2, 0, i);
+    }
+
+    /* team ranks 0 and 3 are on host 0, team ranks 1 and 2 on host 1 */
+    set.map.ep_num          = team_size;
+    set.myrank              = 3;
+    set.map.type            = UCC_EP_MAP_ARRAY;
+    set.map.array.map       = team_ranks;
+    set.map.array.elem_size = sizeof(ucc_rank_t);
+
+    EXPECT_EQ(UCC_OK, ucc_context_topo_init(&s.storage, &ctx_topo));
+    EXPECT_EQ(UCC_OK, ucc_topo_init(set, ctx_topo, &topo));
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_FULL_HOST_ORDERED);
+    EXPECT_EQ(UCC_SBGP_ENABLED, sbgp->status);
+    EXPECT_EQ(true, check_sbgp(sbgp, {0, 3, 1, 2}));
+    EXPECT_EQ(1, sbgp->group_rank);
+}
+
+/* 1M procs, 8 per node, the ranks of a node are spread over the whole
+   world. Construction cost must not grow with nnodes * size: a quadratic
+   pass over the nodes takes minutes at this scale. */
+UCC_TEST_F(test_topo, scale_1m)
+{
+    const ucc_rank_t ctx_size = 1 << 20;
+    const ucc_rank_t ppn      = 8;
+    const ucc_rank_t nnodes   = ctx_size / ppn;
+    addr_storage     s(ctx_size);
+    ucc_sbgp_t      *sbgps, *sbgp;
+    ucc_subset_t     set;
+    int              n_sbgps;
+    double           elapsed;
+
+    for (ucc_rank_t r = 0; r < ctx_size; r++) {
+        SET_PI(s, r, 0x9e3779b97f4a7c15ULL * (r % nnodes + 1),
+               (r / nnodes) % 2, r);
+    }
+    set.map.ep_num = ctx_size;
+    set.map.type   = UCC_EP_MAP_FULL;
+    set.myrank     = ctx_size - 1;
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(UCC_OK, ucc_context_topo_init(&s.storage, &ctx_topo));
+    EXPECT_EQ(UCC_OK, ucc_topo_init(set, ctx_topo, &topo));
+    EXPECT_EQ(nnodes, ctx_topo->nnodes);
+    EXPECT_EQ(ppn, ctx_topo->min_ppn);
+    EXPECT_EQ(ppn, ctx_topo->max_ppn);
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_NODE);
+    EXPECT_EQ(UCC_SBGP_ENABLED, sbgp->status);
+    EXPECT_EQ(ppn, sbgp->group_size);
+    EXPECT_EQ(ppn - 1, sbgp->group_rank);
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_NODE_LEADERS);
+    EXPECT_EQ(UCC_SBGP_DISABLED, sbgp->status);
+    EXPECT_EQ(nnodes, sbgp->group_size);
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_NET);
+    EXPECT_EQ(UCC_SBGP_ENABLED, sbgp->status);
+    EXPECT_EQ(nnodes, sbgp->group_size);
+    EXPECT_EQ(nnodes - 1, sbgp->group_rank);
+
+    EXPECT_EQ(UCC_OK, ucc_topo_get_all_nodes(topo, &sbgps, &n_sbgps));
+    EXPECT_EQ((int)nnodes, n_sbgps);
+    EXPECT_EQ(true, check_sbgp(&sbgps[1], {1, nnodes + 1, 2 * nnodes + 1,
+                                           3 * nnodes + 1, 4 * nnodes + 1,
+                                           5 * nnodes + 1, 6 * nnodes + 1,
+                                           7 * nnodes + 1}));
+    EXPECT_EQ(nnodes - 1, topo->node_leader_rank);
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_FULL_HOST_ORDERED);
+    EXPECT_EQ(UCC_SBGP_ENABLED, sbgp->status);
+    EXPECT_EQ(ctx_size - 1, sbgp->group_rank);
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                            start).count();
+    EXPECT_LT(elapsed, 10.0);
+}
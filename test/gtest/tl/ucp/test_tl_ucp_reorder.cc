@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * See file LICENSE for terms.
+ */
+
+#include "common/test_ucc.h"
+#include "components/tl/ucp/tl_ucp.h"
+
+/* Ranks are placed on 2 simulated nodes round-robin, so that the identity
+   order puts every ring neighbour and every odd knomial child on the other
+   node. Checks the number of tl/ucp sends crossing the node boundary with
+   and without the rank reordering. */
+class test_tl_ucp_reorder : public ucc::test {
+public:
+    static const int n_procs = 8;
+    static const int count   = 64;
+
+    /* sum of the sends to other hosts over all the procs of the team */
+    uint64_t net_sends(UccTeam_h team)
+    {
+        ucc_tl_context_t *tl_ctx;
+        uint64_t          n = 0;
+
+        for (auto &p : team->procs) {
+            EXPECT_EQ(UCC_OK, ucc_tl_context_get(p.p->ctx_h, "ucp", &tl_ctx));
+            n += ucc_derived_of(tl_ctx, ucc_tl_ucp_context_t)
+                     ->send_stats.net_sends;
+            ucc_tl_context_put(tl_ctx);
+        }
+        return n;
+    }
+
+    uint64_t run(ucc_coll_type_t coll_type, const char *reordering)
+    {
+        ucc_job_env_t env = {{"UCC_CLS", "basic"},
+                             {"UCC_TLS", "ucp"},
+                             {"UCC_TL_UCP_SEND_STATS", "y"},
+                             {"UCC_TL_UCP_RANKS_REORDERING", reordering},
+                             {"UCC_TL_UCP_BCAST_KN_RADIX", "2"},
+                             {"UCC_TL_UCP_TUNE",
+                              "bcast:0-inf:@knomial#allgather:0-inf:@ring"}};
+        UccJob            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL_RR, env);
+        UccTeam_h         team = job.create_team(n_procs);
+        std::vector<std::vector<uint8_t>> sbufs(n_procs), rbufs(n_procs);
+        std::vector<ucc_coll_args_t>      args(n_procs);
+        std::vector<gtest_ucc_coll_ctx_t> ctx(n_procs);
+        UccCollCtxVec                     ctxs;
+        uint64_t                          before;
+
+        for (int i = 0; i < n_procs; i++) {
+            sbufs[i].assign(count, (uint8_t)i);
+            rbufs[i].assign(count * n_procs, 0xff);
+            memset(&args[i], 0, sizeof(args[i]));
+            args[i].coll_type = coll_type;
+            args[i].src.info  = {sbufs[i].data(), count, UCC_DT_UINT8,
+                                 UCC_MEMORY_TYPE_HOST};
+            if (coll_type == UCC_COLL_TYPE_BCAST) {
+                args[i].root = 0;
+            } else {
+                args[i].dst.info = {rbufs[i].data(), count * n_procs,
+                                    UCC_DT_UINT8, UCC_MEMORY_TYPE_HOST};
+            }
+            memset(&ctx[i], 0, sizeof(ctx[i]));
+            ctx[i].args = &args[i];
+            ctxs.push_back(&ctx[i]);
+        }
+
+        before = net_sends(team);
+        UccReq req(team, ctxs);
+        EXPECT_EQ(UCC_OK, req.status);
+        req.start();
+        EXPECT_EQ(UCC_OK, req.wait());
+
+        for (int i = 0; i < n_procs; i++) {
+            for (int j = 0; j < count; j++) {
+                if (coll_type == UCC_COLL_TYPE_BCAST) {
+                    EXPECT_EQ(0, sbufs[i][j]);
+                } else {
+                    for (int r = 0; r < n_procs; r++) {
+                        EXPECT_EQ(r, rbufs[i][r * count + j]);
+                    }
+                }
+            }
+        }
+        return net_sends(team) - before;
+    }
+};
+
+UCC_TEST_F(test_tl_ucp_reorder, bcast_knomial)
+{
+    /* radix 2 tree: all 4 odd children are on the other node, with the
+       reordering only the root of the second node subtree is */
+    EXPECT_EQ(4, run(UCC_COLL_TYPE_BCAST, "n"));
+    EXPECT_EQ(1, run(UCC_COLL_TYPE_BCAST, "y"));
+}
+
+UCC_TEST_F(test_tl_ucp_reorder, allgather_ring)
+{
+    /* each of n_procs - 1 steps sends to the right neighbour: all of them
+       cross the node boundary with identity order, 2 with the reordering */
+    EXPECT_EQ(n_procs * (n_procs - 1), run(UCC_COLL_TYPE_ALLGATHER, "n"));
+    EXPECT_EQ(2 * (n_procs - 1), run(UCC_COLL_TYPE_ALLGATHER, "y"));
+}
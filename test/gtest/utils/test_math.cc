@@ -41,3 +41,86 @@ UCC_TEST_P(test_bfloats16_cast, start_with_bfloat16)
 
 INSTANTIATE_TEST_CASE_P(, test_bfloats16_cast,
                         ::testing::Values(31000, 400, 17, 13569, 0));
+
+class test_narrow_floats_cast : public ucc::test {
+};
+
+UCC_TEST_F(test_narrow_floats_cast, float16_roundtrip)
+{
+    uint16_t h, res;
+    float    f;
+
+    for (uint32_t i = 0; i <= UINT16_MAX; i++) {
+        h = (uint16_t)i;
+        f = float16tofloat32(&h);
+        if (f != f) {
+            continue;
+        }
+        float32tofloat16(f, &res);
+        EXPECT_EQ(h, res);
+    }
+}
+
+UCC_TEST_F(test_narrow_floats_cast, float16_rounding)
+{
+    uint16_t h;
+
+    /* 1 + 2^-11 is a tie between 1 and 1 + 2^-10, rounds to even */
+    float32tofloat16(1.0f + 1.0f / 2048, &h);
+    EXPECT_EQ(0x3c00, h);
+    float32tofloat16(1.0f + 3.0f / 2048, &h);
+    EXPECT_EQ(0x3c02, h);
+    float32tofloat16(65504.0f, &h);
+    EXPECT_EQ(0x7bff, h);
+    float32tofloat16(65520.0f, &h);
+    EXPECT_EQ(0x7c00, h);
+    /* smallest subnormal */
+    float32tofloat16(1.0f / (1 << 24), &h);
+    EXPECT_EQ(0x0001, h);
+    float32tofloat16(-1.0f / (1 << 25), &h);
+    EXPECT_EQ(0x8000, h);
+}
+
+UCC_TEST_F(test_narrow_floats_cast, float8_roundtrip)
+{
+    uint8_t v, res;
+
+    for (uint32_t i = 0; i <= UINT8_MAX; i++) {
+        v = (uint8_t)i;
+        if ((v & 0x7f) != 0x7f) {
+            float32tofloat8e4m3(float8e4m3tofloat32(&v), &res);
+            EXPECT_EQ(v, res);
+        }
+        if ((v & 0x7f) <= 0x7c) {
+            float32tofloat8e5m2(float8e5m2tofloat32(&v), &res);
+            EXPECT_EQ(v, res);
+        }
+    }
+}
+
+UCC_TEST_F(test_narrow_floats_cast, float8_rounding)
+{
+    uint8_t v;
+
+    v = 0x7e;
+    EXPECT_EQ(448.0f, float8e4m3tofloat32(&v));
+    v = 0x7b;
+    EXPECT_EQ(57344.0f, float8e5m2tofloat32(&v));
+    /* e4m3 has no infinity, overflow saturates */
+    float32tofloat8e4m3(1e6f, &v);
+    EXPECT_EQ(0x7e, v);
+    float32tofloat8e4m3(-1e6f, &v);
+    EXPECT_EQ(0xfe, v);
+    float32tofloat8e5m2(1e6f, &v);
+    EXPECT_EQ(0x7c, v);
+    /* 1.0625 is a tie between 1 and 1.125 in e4m3 */
+    float32tofloat8e4m3(1.0625f, &v);
+    EXPECT_EQ(0x38, v);
+    float32tofloat8e4m3(1.1875f, &v);
+    EXPECT_EQ(0x3a, v);
+    /* smallest subnormals */
+    float32tofloat8e4m3(1.0f / 512, &v);
+    EXPECT_EQ(0x01, v);
+    float32tofloat8e5m2(1.0f / 65536, &v);
+    EXPECT_EQ(0x01, v);
+}
@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * See file LICENSE for terms.
+ */
+
+extern "C" {
+#include "utils/ucc_mpool.h"
+#include "utils/ucc_atomic.h"
+#include "utils/arch/cpu.h"
+#include <limits.h>
+#include <pthread.h>
+}
+#include <common/test.h>
+#include <vector>
+
+#define MPOOL_NUM_ITERS  200000
+#define MPOOL_BATCH      48
+
+typedef struct test_mpool_elem {
+    uint64_t owner;
+    uint64_t seq;
+} test_mpool_elem_t;
+
+typedef struct test_mpool_arg {
+    ucc_mpool_t *mp;
+    uint64_t     id;
+    uint32_t    *errors;
+    /* objects allocated by this thread and released by the next one */
+    std::vector<void *> handoff;
+} test_mpool_arg_t;
+
+static void *mpool_thread(void *arg)
+{
+    test_mpool_arg_t * a = (test_mpool_arg_t *)arg;
+    test_mpool_elem_t *objs[MPOOL_BATCH];
+    int                i, j;
+
+    for (i = 0; i < MPOOL_NUM_ITERS / MPOOL_BATCH; i++) {
+        for (j = 0; j < MPOOL_BATCH; j++) {
+            objs[j] = (test_mpool_elem_t *)ucc_mpool_get(a->mp);
+            if (!objs[j]) {
+                ucc_atomic_add32(a->errors, 1);
+                return NULL;
+            }
+            objs[j]->owner = a->id;
+            objs[j]->seq   = j;
+        }
+        /* object handed out twice would have been overwritten by
+           another thread */
+        for (j = 0; j < MPOOL_BATCH; j++) {
+            if (objs[j]->owner != a->id || objs[j]->seq != (uint64_t)j) {
+                ucc_atomic_add32(a->errors, 1);
+            }
+            ucc_mpool_put(objs[j]);
+        }
+    }
+    for (j = 0; j < MPOOL_BATCH; j++) {
+        a->handoff.push_back(ucc_mpool_get(a->mp));
+    }
+    return NULL;
+}
+
+static void *mpool_release_thread(void *arg)
+{
+    test_mpool_arg_t *a = (test_mpool_arg_t *)arg;
+
+    for (auto &o : a->handoff) {
+        ucc_mpool_put(o);
+    }
+    return NULL;
+}
+
+class test_mpool : public ucc::test
+{
+  public:
+    ucc_mpool_t mp;
+    uint32_t    errors;
+    void        run(ucc_thread_mode_t tm, int n_threads);
+};
+
+void test_mpool::run(ucc_thread_mode_t tm, int n_threads)
+{
+    std::vector<pthread_t>        threads(n_threads);
+    std::vector<test_mpool_arg_t> args(n_threads);
+    int                           i;
+
+    errors = 0;
+    ASSERT_EQ(UCC_OK, ucc_mpool_init(&mp, 0, sizeof(test_mpool_elem_t), 0,
+                                     UCC_CACHE_LINE_SIZE, 16, UINT_MAX, NULL,
+                                     tm, "test_mpool"));
+    for (i = 0; i < n_threads; i++) {
+        args[i].mp     = &mp;
+        args[i].id     = i + 1;
+        args[i].errors = &errors;
+        pthread_create(&threads[i], NULL, mpool_thread, &args[i]);
+    }
+    for (i = 0; i < n_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    /* release objects from threads that did not allocate them */
+    for (i = 0; i < n_threads; i++) {
+        pthread_create(&threads[i], NULL, mpool_release_thread,
+                       &args[(i + 1) % n_threads]);
+    }
+    for (i = 0; i < n_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    EXPECT_EQ(0u, errors);
+    /* leak check: objects left in per-thread caches must be returned */
+    ucc_mpool_cleanup(&mp, 1);
+}
+
+UCC_TEST_F(test_mpool, single_thread)
+{
+    run(UCC_THREAD_SINGLE, 1);
+}
+
+UCC_TEST_F(test_mpool, multiple_one_thread)
+{
+    run(UCC_THREAD_MULTIPLE, 1);
+}
+
+UCC_TEST_F(test_mpool, multiple_many_threads)
+{
+    run(UCC_THREAD_MULTIPLE, 16);
+}
+
+UCC_TEST_F(test_mpool, multiple_more_threads_than_caches)
+{
+    run(UCC_THREAD_MULTIPLE, UCC_MPOOL_TCACHE_MAX_THREADS + 8);
+}
+
+UCC_TEST_F(test_mpool, tcache_disabled_bounded_pool)
+{
+    void *obj;
+
+    ASSERT_EQ(UCC_OK, ucc_mpool_init(&mp, 0, sizeof(test_mpool_elem_t), 0,
+                                     UCC_CACHE_LINE_SIZE, 4, 4, NULL,
+                                     UCC_THREAD_MULTIPLE, "test_mpool"));
+    EXPECT_EQ(0u, mp.tcache_size);
+    obj = ucc_mpool_get(&mp);
+    EXPECT_NE(nullptr, obj);
+    ucc_mpool_put(obj);
+    ucc_mpool_cleanup(&mp, 1);
+}
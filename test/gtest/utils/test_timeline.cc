@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * See file LICENSE for terms.
+ */
+
+extern "C" {
+#include "utils/ucc_timeline.h"
+#include <unistd.h>
+}
+#include <common/test.h>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+class test_timeline : public ucc::test {
+public:
+    static const int      ring_size = 4;
+    std::string           file_name;
+    int                   enabled_bkp;
+
+    test_timeline()
+    {
+        enabled_bkp = ucc_timeline_enabled;
+        file_name   = "/tmp/ucc_gtest_timeline_" +
+                      std::to_string(getpid()) + ".json";
+        ucc_timeline_init(file_name.c_str(), ring_size);
+    }
+
+    ~test_timeline()
+    {
+        ucc_timeline_enabled = enabled_bkp;
+        unlink(file_name.c_str());
+    }
+
+    /* records n events named _name on a new thread, so that the thread
+       creates its own ring */
+    void record(int n, const char *name, bool failed_ring = false)
+    {
+        std::thread t([=]() {
+            if (failed_ring) {
+                ucc_timeline_ring = UCC_TIMELINE_RING_FAILED;
+            }
+            for (int i = 0; i < n; i++) {
+                UCC_TIMELINE_EVENT(UCC_TIMELINE_TASK_EVENT, name, "gtest",
+                                   this, i, 0, 0);
+            }
+        });
+        t.join();
+    }
+
+    /* dumps the timeline and returns the number of events named _name */
+    int count(const char *name)
+    {
+        std::ifstream     f;
+        std::stringstream ss;
+        std::string       s, key;
+        size_t            pos;
+        int               n = 0;
+
+        ucc_timeline_dump();
+        f.open(file_name);
+        EXPECT_TRUE(f.is_open());
+        ss << f.rdbuf();
+        s   = ss.str();
+        key = std::string("\"name\":\"") + name + "\"";
+        EXPECT_EQ((size_t)0, s.find("{\"displayTimeUnit\""));
+        EXPECT_NE(std::string::npos, s.find("]}"));
+        for (pos = s.find(key); pos != std::string::npos;
+             pos = s.find(key, pos + 1)) {
+            n++;
+        }
+        return n;
+    }
+};
+
+UCC_TEST_F(test_timeline, record)
+{
+    record(ring_size - 1, "gtest_record");
+    EXPECT_EQ(ring_size - 1, count("gtest_record"));
+    /* dump resets the rings */
+    EXPECT_EQ(0, count("gtest_record"));
+}
+
+UCC_TEST_F(test_timeline, wrap)
+{
+    /* only the newest ring_size events are kept */
+    record(3 * ring_size + 1, "gtest_wrap");
+    EXPECT_EQ(ring_size, count("gtest_wrap"));
+}
+
+UCC_TEST_F(test_timeline, threads)
+{
+    record(2, "gtest_threads");
+    record(3, "gtest_threads");
+    EXPECT_EQ(5, count("gtest_threads"));
+}
+
+UCC_TEST_F(test_timeline, failed_ring)
+{
+    /* thread without a ring drops the events and does not retry the
+       allocation */
+    record(ring_size, "gtest_failed", true);
+    EXPECT_EQ(0, count("gtest_failed"));
+}
@@ -43,6 +43,12 @@ static inline MPI_Datatype ucc_dt_to_mpi(ucc_datatype_t dt) {
     case UCC_DT_INT128:
     case UCC_DT_UINT128:
     case UCC_DT_BFLOAT16:
+    case UCC_DT_FLOAT8_E4M3:
+    case UCC_DT_FLOAT8_E5M2:
+    case UCC_DT_FLOAT32_INT32:
+    case UCC_DT_FLOAT64_INT32:
+    case UCC_DT_INT32_INT32:
+    case UCC_DT_INT64_INT32:
     default:
         std::cerr << "Unsupported dt\n";
         MPI_Abort(MPI_COMM_WORLD, -1);
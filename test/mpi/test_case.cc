@@ -73,6 +73,8 @@ void TestCase::run(bool triggered)
 
         if (mem_type == UCC_MEMORY_TYPE_CUDA) {
             ee_type = UCC_EE_CUDA_STREAM;
+        } else if (mem_type == UCC_MEMORY_TYPE_HOST) {
+            ee_type = UCC_EE_CPU_THREAD;
         } else {
             UCC_CHECK(UCC_ERR_NOT_SUPPORTED);
         }
@@ -85,8 +87,25 @@ void TestCase::run(bool triggered)
 
 
         UCC_CHECK(ucc_collective_triggered_post(ee, &comp_ev));
-        UCC_CHECK(ucc_ee_get_event(ee, &post_ev));
-        UCC_CHECK(ucc_ee_ack_event(ee, post_ev));
+        if (ee_type == UCC_EE_CPU_THREAD) {
+            /* compute is done, collective starts on the event */
+            UCC_CHECK(ucc_ee_set_event(ee, &comp_ev));
+            while (true) {
+                if (UCC_OK != ucc_ee_get_event(ee, &post_ev)) {
+                    ucc_context_progress(team.ctx);
+                    continue;
+                }
+                ucc_event_type_t ev_type = post_ev->ev_type;
+                /* completion events of previous runs are skipped */
+                UCC_CHECK(ucc_ee_ack_event(ee, post_ev));
+                if (ev_type == UCC_EVENT_COLLECTIVE_POST) {
+                    break;
+                }
+            }
+        } else {
+            UCC_CHECK(ucc_ee_get_event(ee, &post_ev));
+            UCC_CHECK(ucc_ee_ack_event(ee, post_ev));
+        }
     } else {
         UCC_CHECK(ucc_collective_post(req));
     }
@@ -335,7 +335,7 @@ int ucc_coll_inplace_supported(ucc_coll_type_t c)
 
 bool ucc_coll_triggered_supported(ucc_memory_type_t mt)
 {
-    if (mt == UCC_MEMORY_TYPE_CUDA) {
+    if (mt == UCC_MEMORY_TYPE_CUDA || mt == UCC_MEMORY_TYPE_HOST) {
         return true;
     }
 
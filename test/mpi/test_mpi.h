@@ -182,13 +182,14 @@ typedef struct ucc_test_team {
     ucc_ee_h cuda_ee;
     cudaStream_t cuda_stream;
 #endif
+    ucc_ee_h cpu_ee;
     ucc_test_mpi_team_t type;
     MPI_Comm comm;
     ucc_team_h team;
     ucc_context_h ctx;
     ucc_test_team(ucc_test_mpi_team_t _type, MPI_Comm _comm,
                   ucc_team_h _team, ucc_context_h _ctx) :
-    type(_type), comm(_comm), team(_team), ctx(_ctx)
+    cpu_ee(nullptr), type(_type), comm(_comm), team(_team), ctx(_ctx)
     {
 #ifdef HAVE_CUDA
         cuda_stream = nullptr;
@@ -223,6 +224,21 @@ typedef struct ucc_test_team {
     }
 #endif
 
+    ucc_status_t get_cpu_ee(ucc_ee_h *ee)
+    {
+        ucc_ee_params_t ee_params;
+
+        if (!cpu_ee) {
+            ee_params.ee_type         = UCC_EE_CPU_THREAD;
+            ee_params.ee_context_size = 0;
+            ee_params.ee_context      = nullptr;
+            UCC_CHECK(ucc_ee_create(team, &ee_params, &cpu_ee));
+        }
+
+        *ee = cpu_ee;
+        return UCC_OK;
+    }
+
     ucc_status_t get_ee(ucc_ee_type_t ee_type, ucc_ee_h *ee)
     {
         switch (ee_type) {
@@ -230,6 +246,8 @@ typedef struct ucc_test_team {
         case UCC_EE_CUDA_STREAM:
             return get_cuda_ee(ee);
 #endif
+        case UCC_EE_CPU_THREAD:
+            return get_cpu_ee(ee);
         default:
             return UCC_ERR_NOT_SUPPORTED;
 
@@ -241,6 +259,9 @@ typedef struct ucc_test_team {
 #ifdef HAVE_CUDA
         free_cuda_ee();
 #endif
+        if (cpu_ee) {
+            UCC_CHECK(ucc_ee_destroy(cpu_ee));
+        }
     }
 
 } ucc_test_team_t;
@@ -4,7 +4,10 @@
  * See file LICENSE for terms.
  */
 
+#include <algorithm>
 #include <iomanip>
+#include <thread>
+#include <vector>
 #include "ucc_pt_benchmark.h"
 #include "components/mc/ucc_mc.h"
 #include "ucc_perftest.h"
@@ -114,8 +117,9 @@ ucc_status_t ucc_pt_benchmark::run_bench() noexcept
 {
     ucc_status_t       st;
     ucc_pt_test_args_t args;
-    double             time;
+    double             time, time_comm, time_comm_avg;
     double             time_min, time_max, time_avg;
+    double             overlap    = -1;
     double             total_time = 0;
 
     generator->reset();
@@ -132,8 +136,38 @@ ucc_status_t ucc_pt_benchmark::run_bench() noexcept
         }
         args.coll_args.root = config.root;
         UCCCHECK_GOTO(coll->init_args(args), exit_err, st);
-        if ((uint64_t)config.op_type < (uint64_t)UCC_COLL_TYPE_LAST) {
-            UCCCHECK_GOTO(run_single_coll_test(args.coll_args, warmup, iter, time),
+        if ((uint64_t)config.op_type < (uint64_t)UCC_COLL_TYPE_LAST &&
+            config.n_threads > 1) {
+            UCCCHECK_GOTO(run_init_finalize_test(args.coll_args, warmup, iter,
+                                                 time),
+                          free_coll, st);
+        } else if ((uint64_t)config.op_type < (uint64_t)UCC_COLL_TYPE_LAST &&
+                   config.compute_us > 0) {
+            UCCCHECK_GOTO(run_single_coll_test(args.coll_args, warmup, iter, 0,
+                                               time_comm),
+                          free_coll, st);
+            UCCCHECK_GOTO(run_single_coll_test(args.coll_args, warmup, iter,
+                                               config.compute_us, time),
+                          free_coll, st);
+            /* share of the collective time hidden behind compute */
+            comm->allreduce(&time_comm, &time_comm_avg, 1, UCC_OP_SUM);
+            time_comm_avg /= comm->get_size();
+            overlap = (time_comm_avg + config.compute_us - time) /
+                      std::min(time_comm_avg, (double)config.compute_us);
+            overlap   = std::max(0.0, std::min(1.0, overlap)) * 100;
+        } else if ((uint64_t)config.op_type < (uint64_t)UCC_COLL_TYPE_LAST &&
+                   config.n_fuse > 0) {
+            UCCCHECK_GOTO(run_fused_coll_test(args.coll_args, warmup, iter,
+                                              time),
+                          free_coll, st);
+        } else if ((uint64_t)config.op_type < (uint64_t)UCC_COLL_TYPE_LAST &&
+                   config.n_batch > 0) {
+            UCCCHECK_GOTO(run_batch_coll_test(args.coll_args, warmup, iter,
+                                              time),
+                          free_coll, st);
+        } else if ((uint64_t)config.op_type < (uint64_t)UCC_COLL_TYPE_LAST) {
+            UCCCHECK_GOTO(run_single_coll_test(args.coll_args, warmup, iter, 0,
+                                               time),
                           free_coll, st);
         } else {
             UCCCHECK_GOTO(run_single_executor_test(args.executor_args,
@@ -147,7 +181,8 @@ ucc_status_t ucc_pt_benchmark::run_bench() noexcept
         time_avg /= comm->get_size();
         total_time += time_max;
 
-        print_time(generator->get_src_count(), args, time_avg, time_min, time_max);
+        print_time(generator->get_src_count(), args, time_avg, time_min,
+                   time_max, overlap);
         coll->free_args(args);
         if (!coll->has_range()) {
             /* exit here since collective doesn't have count argument */
@@ -158,6 +193,19 @@ ucc_status_t ucc_pt_benchmark::run_bench() noexcept
     if (comm->get_rank() == 0) {
         std::cout << "Total time: " << total_time / 1000 << " ms" << std::endl;
     }
+    if (config.n_fuse > 0 && comm->get_rank() == 0) {
+        ucc_team_attr_t attr;
+
+        attr.mask                = UCC_TEAM_ATTR_FIELD_TELEMETRY;
+        attr.telemetry.n_entries = 0;
+        attr.telemetry.entries   = nullptr;
+        if (ucc_team_get_attr(comm->get_team(), &attr) == UCC_OK) {
+            std::cout << "Fused collectives: "
+                      << attr.telemetry.n_fused_colls << " into "
+                      << attr.telemetry.n_fusion_batches << " batches"
+                      << std::endl;
+        }
+    }
 
     return UCC_OK;
 free_coll:
@@ -174,8 +222,19 @@ static inline double get_time_us(void)
     return t.tv_sec * 1e6 + t.tv_usec;
 }
 
+/* Busy loop standing for application compute, it does not call UCC so
+   the collective advances only if it is progressed by other thread */
+static inline void compute_us(int us)
+{
+    double s = get_time_us();
+
+    while (get_time_us() - s < us) {
+    }
+}
+
 ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
                                                     int nwarmup, int niter,
+                                                    int compute_time,
                                                     double &time)
                                                     noexcept
 {
@@ -216,7 +275,18 @@ ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
             UCCCHECK_GOTO(ucc_collective_init(&args, &req, team), exit_err, st);
         }
 
-        if (triggered) {
+        if (triggered && ee->ee_type == UCC_EE_CPU_THREAD) {
+            comp_ev.req = req;
+            UCCCHECK_GOTO(ucc_collective_triggered_post(ee, &comp_ev),
+                          free_req, st);
+            /* host compute is done, collective starts on the event */
+            UCCCHECK_GOTO(ucc_ee_set_event(ee, &comp_ev), free_req, st);
+            while (ucc_ee_get_event(ee, &post_ev) != UCC_OK) {
+                UCCCHECK_GOTO(ucc_context_progress(ctx), free_req, st);
+            }
+            ucc_assert(post_ev->ev_type == UCC_EVENT_COLLECTIVE_POST);
+            UCCCHECK_GOTO(ucc_ee_ack_event(ee, post_ev), free_req, st);
+        } else if (triggered) {
             comp_ev.req = req;
             UCCCHECK_GOTO(ucc_collective_triggered_post(ee, &comp_ev),
                           free_req, st);
@@ -227,11 +297,19 @@ ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
             UCCCHECK_GOTO(ucc_collective_post(req), free_req, st);
         }
 
+        if (compute_time > 0) {
+            compute_us(compute_time);
+        }
         st = ucc_collective_test(req);
         while (st > 0) {
             UCCCHECK_GOTO(ucc_context_progress(ctx), free_req, st);
             st = ucc_collective_test(req);
         }
+        if (triggered && ee->ee_type == UCC_EE_CPU_THREAD &&
+            ucc_ee_get_event(ee, &post_ev) == UCC_OK) {
+            /* completion event, request status is already checked */
+            ucc_ee_ack_event(ee, post_ev);
+        }
 
         if (!persistent) {
             ucc_collective_finalize(req);
@@ -261,6 +339,173 @@ exit_err:
     return st;
 }
 
+ucc_status_t ucc_pt_benchmark::run_fused_coll_test(ucc_coll_args_t args,
+                                                   int nwarmup, int niter,
+                                                   double &time) noexcept
+{
+    ucc_team_h                  team    = comm->get_team();
+    ucc_context_h               ctx     = comm->get_context();
+    int                         n_colls = config.n_fuse;
+    std::vector<ucc_coll_req_h> reqs(n_colls, nullptr);
+    ucc_status_t                st      = UCC_OK;
+    int                         n_done;
+
+    UCCCHECK_GOTO(comm->barrier(), exit_err, st);
+    time = 0;
+    args.root = config.root % comm->get_size();
+    for (int i = 0; i < nwarmup + niter; i++) {
+        double s = get_time_us();
+
+        for (int j = 0; j < n_colls; j++) {
+            UCCCHECK_GOTO(ucc_collective_init(&args, &reqs[j], team),
+                          free_reqs, st);
+        }
+        UCCCHECK_GOTO(ucc_collective_fusion_start(team), free_reqs, st);
+        for (int j = 0; j < n_colls; j++) {
+            st = ucc_collective_post(reqs[j]);
+            if (st != UCC_OK) {
+                ucc_collective_fusion_end(team);
+                goto free_reqs;
+            }
+        }
+        UCCCHECK_GOTO(ucc_collective_fusion_end(team), free_reqs, st);
+        do {
+            UCCCHECK_GOTO(ucc_context_progress(ctx), free_reqs, st);
+            n_done = 0;
+            for (int j = 0; j < n_colls; j++) {
+                st = ucc_collective_test(reqs[j]);
+                if (st < 0) {
+                    goto free_reqs;
+                }
+                n_done += (st == UCC_OK);
+            }
+        } while (n_done < n_colls);
+        for (int j = 0; j < n_colls; j++) {
+            ucc_collective_finalize(reqs[j]);
+            reqs[j] = nullptr;
+        }
+        double f = get_time_us();
+        if (i >= nwarmup) {
+            time += f - s;
+        }
+        UCCCHECK_GOTO(comm->barrier(), exit_err, st);
+    }
+    if (niter != 0) {
+        time /= (double)niter * n_colls;
+    }
+    return UCC_OK;
+free_reqs:
+    for (auto req : reqs) {
+        if (req) {
+            ucc_collective_finalize(req);
+        }
+    }
+exit_err:
+    return st;
+}
+
+ucc_status_t ucc_pt_benchmark::run_batch_coll_test(ucc_coll_args_t args,
+                                                   int nwarmup, int niter,
+                                                   double &time) noexcept
+{
+    ucc_team_h                   team    = comm->get_team();
+    ucc_context_h                ctx     = comm->get_context();
+    int                          n_colls = config.n_batch;
+    std::vector<ucc_coll_args_t> batch_args(n_colls, args);
+    std::vector<ucc_team_h>      teams(n_colls, team);
+    ucc_status_t                 st      = UCC_OK;
+    ucc_coll_req_h               req;
+
+    UCCCHECK_GOTO(comm->barrier(), exit_err, st);
+    time = 0;
+    for (int j = 0; j < n_colls; j++) {
+        batch_args[j].root = (config.root + j) % comm->get_size();
+    }
+    for (int i = 0; i < nwarmup + niter; i++) {
+        double s = get_time_us();
+
+        UCCCHECK_GOTO(ucc_collective_init_batch(batch_args.data(),
+                                                teams.data(), n_colls, &req),
+                      exit_err, st);
+        UCCCHECK_GOTO(ucc_collective_post(req), free_req, st);
+        st = ucc_collective_test(req);
+        while (st > 0) {
+            UCCCHECK_GOTO(ucc_context_progress(ctx), free_req, st);
+            st = ucc_collective_test(req);
+        }
+        ucc_collective_finalize(req);
+        double f = get_time_us();
+        if (st != UCC_OK) {
+            goto exit_err;
+        }
+        if (i >= nwarmup) {
+            time += f - s;
+        }
+        UCCCHECK_GOTO(comm->barrier(), exit_err, st);
+    }
+    if (niter != 0) {
+        time /= (double)niter * n_colls;
+    }
+    return UCC_OK;
+free_req:
+    ucc_collective_finalize(req);
+exit_err:
+    return st;
+}
+
+ucc_status_t ucc_pt_benchmark::run_init_finalize_test(ucc_coll_args_t args,
+                                                      int nwarmup, int niter,
+                                                      double &time)
+                                                      noexcept
+{
+    ucc_team_h                team = comm->get_team();
+    std::vector<std::thread>  threads;
+    std::vector<double>       thread_time(config.n_threads, 0);
+    std::vector<ucc_status_t> thread_st(config.n_threads, UCC_OK);
+    ucc_status_t              st;
+
+    UCCCHECK_GOTO(comm->barrier(), exit_err, st);
+    args.root = config.root % comm->get_size();
+    for (int t = 0; t < config.n_threads; t++) {
+        threads.emplace_back([&, t]() {
+            ucc_coll_req_h req;
+            double         s = 0;
+
+            for (int i = 0; i < nwarmup + niter; i++) {
+                if (i == nwarmup) {
+                    s = get_time_us();
+                }
+                thread_st[t] = ucc_collective_init(&args, &req, team);
+                if (thread_st[t] != UCC_OK) {
+                    return;
+                }
+                thread_st[t] = ucc_collective_finalize(req);
+                if (thread_st[t] != UCC_OK) {
+                    return;
+                }
+            }
+            thread_time[t] = get_time_us() - s;
+        });
+    }
+    for (auto &th : threads) {
+        th.join();
+    }
+
+    time = 0;
+    for (int t = 0; t < config.n_threads; t++) {
+        UCCCHECK_GOTO(thread_st[t], exit_err, st);
+        time += thread_time[t];
+    }
+    /* average time of single init/finalize pair as seen by one thread */
+    if (niter != 0) {
+        time /= (double)niter * config.n_threads;
+    }
+    UCCCHECK_GOTO(comm->barrier(), exit_err, st);
+    return UCC_OK;
+exit_err:
+    return st;
+}
+
 ucc_status_t
 ucc_pt_benchmark::run_single_executor_test(ucc_ee_executor_task_args_t args,
                                            int nwarmup, int niter,
@@ -343,6 +588,16 @@ void ucc_pt_benchmark::print_header()
                         std::to_string(config.inplace):
                         "N/A")
                   << std::endl;
+        if (config.n_threads > 1) {
+            std::cout << std::left << std::setw(24)
+                      << "Threads: " << config.n_threads
+                      << " (collective init/finalize time)" << std::endl;
+        }
+        if (config.compute_us > 0) {
+            std::cout << std::left << std::setw(24)
+                      << "Overlap compute: " << config.compute_us << " us"
+                      << std::endl;
+        }
         std::cout << std::left << std::setw(24)
                   << "Warmup:" << std::endl
                   << std::left << std::setw(24)
@@ -363,6 +618,10 @@ void ucc_pt_benchmark::print_header()
         if (config.full_print) {
             std::cout << std::setw(42) << "Bandwidth, GB/s";
         }
+        if (config.compute_us > 0) {
+            std::cout << std::setw(config.full_print ? 24 : 42)
+                      << "Overlap, %";
+        }
         std::cout << std::endl;
         std::cout << std::setw(36) << "avg"
                   << std::setw(12) << "min"
@@ -379,7 +638,8 @@ void ucc_pt_benchmark::print_header()
 void ucc_pt_benchmark::print_time(size_t count, ucc_pt_test_args_t args,
                                   double time_avg,
                                   double time_min,
-                                  double time_max)
+                                  double time_max,
+                                  double overlap)
 {
     size_t size    = count * ucc_dt_size(config.dt);
     int    gsize   = comm->get_size();
@@ -420,6 +680,9 @@ void ucc_pt_benchmark::print_time(size_t count, ucc_pt_test_args_t args,
                 }
             }
         }
+        if (overlap >= 0) {
+            std::cout << std::setw(12) << overlap;
+        }
         std::cout << std::endl;
         std::cout.copyfmt(iostate);
     }
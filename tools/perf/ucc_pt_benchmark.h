@@ -22,13 +22,22 @@ class ucc_pt_benchmark {
 
     void print_header();
     void print_time(size_t count, ucc_pt_test_args_t args, double time_avg,
-                    double time_min, double time_max);
+                    double time_min, double time_max, double overlap);
 public:
     ucc_pt_benchmark(ucc_pt_benchmark_config cfg, ucc_pt_comm *communicator);
     ucc_status_t run_bench() noexcept;
     ucc_status_t run_single_coll_test(ucc_coll_args_t args,
-                                      int nwarmup, int niter,
+                                      int nwarmup, int niter, int compute_us,
                                       double &time) noexcept;
+    ucc_status_t run_fused_coll_test(ucc_coll_args_t args,
+                                     int nwarmup, int niter,
+                                     double &time) noexcept;
+    ucc_status_t run_batch_coll_test(ucc_coll_args_t args,
+                                     int nwarmup, int niter,
+                                     double &time) noexcept;
+    ucc_status_t run_init_finalize_test(ucc_coll_args_t args,
+                                        int nwarmup, int niter,
+                                        double &time) noexcept;
     ucc_status_t run_single_executor_test(ucc_ee_executor_task_args_t args,
                                           int nwarmup, int niter,
                                           double &time) noexcept;
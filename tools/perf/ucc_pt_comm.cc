@@ -77,6 +77,16 @@ ucc_ee_h ucc_pt_comm::get_ee()
                 ucc_pt_cudaStreamDestroy((cudaStream_t)stream);
                 throw std::runtime_error(ucc_status_string(status));
             }
+        } else if (cfg.mt == UCC_MEMORY_TYPE_HOST) {
+            ee_params.ee_type         = UCC_EE_CPU_THREAD;
+            ee_params.ee_context_size = 0;
+            ee_params.ee_context      = nullptr;
+            status = ucc_ee_create(team, &ee_params, &ee);
+            if (status != UCC_OK) {
+                std::cerr << "failed to create UCC EE: "
+                          << ucc_status_string(status);
+                throw std::runtime_error(ucc_status_string(status));
+            }
         } else {
             std::cerr << "execution engine is not supported for given memory type"
                       << std::endl;
@@ -144,7 +154,7 @@ ucc_status_t ucc_pt_comm::init()
                   exit_err, st);
     std::memset(&lib_params, 0, sizeof(ucc_lib_params_t));
     lib_params.mask = UCC_LIB_PARAM_FIELD_THREAD_MODE;
-    lib_params.thread_mode = UCC_THREAD_SINGLE;
+    lib_params.thread_mode = cfg.thread_mode;
     UCCCHECK_GOTO(ucc_init(&lib_params, lib_config, &lib), free_lib_config, st);
 
     if (UCC_OK != ucc_mc_available(cfg.mt)) {
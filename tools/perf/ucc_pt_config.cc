@@ -31,12 +31,19 @@ ucc_pt_config::ucc_pt_config() {
     bench.root           = 0;
     bench.root_shift     = 0;
     bench.mult_factor    = 2;
+    bench.n_threads      = 1;
+    bench.compute_us     = 0;
+    bench.n_fuse         = 0;
+    bench.n_batch        = 0;
     comm.mt              = bench.mt;
+    comm.thread_mode     = UCC_THREAD_SINGLE;
 }
 
 const std::map<std::string, ucc_reduction_op_t> ucc_pt_reduction_op_map = {
     {"sum", UCC_OP_SUM}, {"prod", UCC_OP_PROD}, {"min", UCC_OP_MIN},
-    {"max", UCC_OP_MAX}, {"avg", UCC_OP_AVG},
+    {"max", UCC_OP_MAX}, {"avg", UCC_OP_AVG}, {"maxloc", UCC_OP_MAXLOC},
+    {"minloc", UCC_OP_MINLOC}, {"band", UCC_OP_BAND}, {"bor", UCC_OP_BOR},
+    {"bxor", UCC_OP_BXOR},
 };
 
 const std::map<std::string, ucc_pt_op_type_t> ucc_pt_op_map = {
@@ -73,6 +80,8 @@ const std::map<std::string, ucc_datatype_t> ucc_pt_datatype_map = {
     {"uint16", UCC_DT_UINT16},
     {"float16", UCC_DT_FLOAT16},
     {"bfloat16", UCC_DT_BFLOAT16},
+    {"float8_e4m3", UCC_DT_FLOAT8_E4M3},
+    {"float8_e5m2", UCC_DT_FLOAT8_E5M2},
     {"int32", UCC_DT_INT32},
     {"uint32", UCC_DT_UINT32},
     {"float32", UCC_DT_FLOAT32},
@@ -83,8 +92,12 @@ const std::map<std::string, ucc_datatype_t> ucc_pt_datatype_map = {
     {"float64_complex", UCC_DT_FLOAT64_COMPLEX},
     {"int128", UCC_DT_INT128},
     {"uint128", UCC_DT_UINT128},
-    {"float128", UCC_DT_FLOAT64},
+    {"float128", UCC_DT_FLOAT128},
     {"float128_complex", UCC_DT_FLOAT128_COMPLEX},
+    {"float32_int32", UCC_DT_FLOAT32_INT32},
+    {"float64_int32", UCC_DT_FLOAT64_INT32},
+    {"int32_int32", UCC_DT_INT32_INT32},
+    {"int64_int32", UCC_DT_INT64_INT32},
 };
 
 ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
@@ -101,7 +114,7 @@ ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
     optind = 1;
 
     while (1) {
-        c = getopt_long(argc, argv, "c:b:e:d:f:m:n:w:o:N:r:S:iphFT", long_options, &option_index);
+        c = getopt_long(argc, argv, "c:b:e:d:f:m:n:w:o:N:r:S:t:O:B:G:iphFT", long_options, &option_index);
         if (c == -1)
             break;
         if (c == 0) { // long option
@@ -255,6 +268,43 @@ ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
             case 'N':
                 std::stringstream(optarg) >> bench.n_bufs;
                 break;
+            case 't':
+                std::stringstream(optarg) >> bench.n_threads;
+                if (bench.n_threads < 1) {
+                    std::cerr << "invalid number of threads: " << optarg
+                              << std::endl;
+                    return UCC_ERR_INVALID_PARAM;
+                }
+                if (bench.n_threads > 1) {
+                    comm.thread_mode = UCC_THREAD_MULTIPLE;
+                }
+                break;
+            case 'O':
+                std::stringstream(optarg) >> bench.compute_us;
+                if (bench.compute_us < 0) {
+                    std::cerr << "invalid compute time: " << optarg
+                              << std::endl;
+                    return UCC_ERR_INVALID_PARAM;
+                }
+                /* allows UCC_PROGRESS_THREAD to be enabled */
+                comm.thread_mode = UCC_THREAD_MULTIPLE;
+                break;
+            case 'B':
+                std::stringstream(optarg) >> bench.n_fuse;
+                if (bench.n_fuse < 1) {
+                    std::cerr << "invalid number of fused collectives: "
+                              << optarg << std::endl;
+                    return UCC_ERR_INVALID_PARAM;
+                }
+                break;
+            case 'G':
+                std::stringstream(optarg) >> bench.n_batch;
+                if (bench.n_batch < 1) {
+                    std::cerr << "invalid number of batched collectives: "
+                              << optarg << std::endl;
+                    return UCC_ERR_INVALID_PARAM;
+                }
+                break;
             case 'i':
                 bench.inplace = true;
                 break;
@@ -293,6 +343,20 @@ void ucc_pt_config::print_help()
     std::cout << "  -f <number>: multiplication factor between sizes. Default : 2."<<std::endl;
     std::cout << "  -N <number>: number of buffers"<<std::endl;
     std::cout << "  -T: triggered collective"<<std::endl;
+    std::cout << "  -t <number>: number of threads calling collective init/finalize"
+              << " concurrently, measures init/finalize time instead of"
+              << " collective time"<<std::endl;
+    std::cout << "  -O <number>: overlap mode, compute for <number> us between"
+              << " collective post and test without calling progress, reports"
+              << " the fraction of collective time hidden by compute"
+              << std::endl;
+    std::cout << "  -B <number>: fusion mode, post <number> collectives back"
+              << " to back inside fusion window, reports time per collective"
+              << std::endl;
+    std::cout << "  -G <number>: batch mode, init <number> collectives as one"
+              << " batch and post it once, root of rooted collectives is"
+              << " shifted by one in the batch, reports time per collective"
+              << std::endl;
     std::cout << "  -F: enable full print"<<std::endl;
     std::cout << "  -S: <number>: root shift for rooted collectives"<<std::endl;
     std::cout << "  --gen <exp:min=N[@max=M]|file:name=filename[@nrep=N]>: Pattern generator (exponential or file-based)" << std::endl;
@@ -28,6 +28,7 @@ struct ucc_pt_bootstrap_config {
 
 struct ucc_pt_comm_config {
     ucc_memory_type_t mt;
+    ucc_thread_mode_t thread_mode;
 };
 
 typedef enum {
@@ -104,6 +105,10 @@ struct ucc_pt_benchmark_config {
     int                root;
     int                root_shift;
     int                mult_factor;
+    int                n_threads;
+    int                compute_us;
+    int                n_fuse;
+    int                n_batch;
     ucc_pt_gen_config  gen;
 };
 
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# See file LICENSE for terms.
+#
+# Merges per-rank timelines written with UCC_TIMELINE_FILE into a single
+# Chrome trace that can be opened in chrome://tracing or ui.perfetto.dev.
+# Optionally prints per-collective skew of post and completion times across
+# ranks, which shows the late ranks of every collective.
+#
+
+import argparse
+import json
+import sys
+from collections import defaultdict
+
+# UCC_COLL_TASK_FLAG_TOP_LEVEL
+TOP_LEVEL_FLAG = 1 << 2
+
+
+def load(path):
+    with open(path) as f:
+        return json.load(f)["traceEvents"]
+
+
+def top_level_slices(events):
+    """Returns {(pid, seq_num): (name, begin_ts, end_ts)} of the top level
+    tasks. Task ids are reused, so begin and end are paired in order."""
+    open_slices = {}
+    slices = {}
+    for ev in sorted(events, key=lambda e: e.get("ts", 0)):
+        key = (ev.get("pid"), ev.get("id"), ev.get("cat"))
+        if ev.get("ph") == "b":
+            args = ev.get("args", {})
+            if args.get("flags", 0) & TOP_LEVEL_FLAG:
+                open_slices[key] = (args["seq_num"], ev["name"], ev["ts"])
+        elif ev.get("ph") == "e" and key in open_slices:
+            seq_num, name, begin = open_slices.pop(key)
+            slices[(ev["pid"], seq_num)] = (name, begin, ev["ts"])
+    return slices
+
+
+def print_skew(slices, top):
+    colls = defaultdict(dict)
+    for (pid, seq_num), s in slices.items():
+        colls[seq_num][pid] = s
+    rows = []
+    for seq_num, ranks in colls.items():
+        if len(ranks) < 2:
+            continue
+        posts = {pid: s[1] for pid, s in ranks.items()}
+        ends = {pid: s[2] for pid, s in ranks.items()}
+        late = max(posts, key=posts.get)
+        rows.append((max(posts.values()) - min(posts.values()),
+                     max(ends.values()) - min(ends.values()),
+                     seq_num, next(iter(ranks.values()))[0], late))
+    rows.sort(reverse=True)
+    print("%-10s %-16s %14s %14s %10s" %
+          ("seq_num", "coll", "post_skew_us", "end_skew_us", "late_rank"))
+    for post_skew, end_skew, seq_num, name, late in rows[:top]:
+        print("%-10d %-16s %14.3f %14.3f %10s" %
+              (seq_num, name, post_skew, end_skew, late))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Merge per-rank UCC timelines into one Chrome trace")
+    parser.add_argument("files", nargs="+", help="per-rank timeline files")
+    parser.add_argument("-o", "--output", default="ucc_timeline.json",
+                        help="merged trace file")
+    parser.add_argument("-s", "--skew", type=int, default=0, metavar="N",
+                        help="print N collectives with the largest skew")
+    args = parser.parse_args()
+
+    events = []
+    for path in args.files:
+        try:
+            events.extend(load(path))
+        except (OSError, ValueError, KeyError) as e:
+            sys.exit("failed to read %s: %s" % (path, e))
+
+    with open(args.output, "w") as f:
+        json.dump({"displayTimeUnit": "ns", "traceEvents": events}, f)
+    print("merged %d files, %d events into %s" %
+          (len(args.files), len(events), args.output))
+
+    if args.skew:
+        print_skew(top_level_slices(events), args.skew)
+
+
+if __name__ == "__main__":
+    main()